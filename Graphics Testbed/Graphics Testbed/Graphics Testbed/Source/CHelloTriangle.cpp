@@ -35,7 +35,7 @@ void CHelloTriangle::Initialize(TCWindow* mainWindow)
 	// Create the vertex shader.
 	//
 
-	vertexShader = new TCShader(mGraphicsContext);
+	vertexShader = TCMakeRef< TCShader >(mGraphicsContext);
 
 	TCShader::Description description;
 	description.shaderFilepath = mFileManager->GetResourceDirectory() + "Shaders\\HLSL\\UnlitHomogenous.rvs";
@@ -50,7 +50,7 @@ void CHelloTriangle::Initialize(TCWindow* mainWindow)
 	// Create the pixel shader.
 	//
 
-	pixelShader = new TCShader(mGraphicsContext);
+	pixelShader = TCMakeRef< TCShader >(mGraphicsContext);
 
 	description.shaderFilepath = mFileManager->GetResourceDirectory() + "Shaders\\HLSL\\UnlitHomogenous.rps";
 	description.shaderType = TCShader::kShaderTypePixel;
@@ -86,17 +86,9 @@ bool CHelloTriangle::Update(float deltaTime)
 
 void CHelloTriangle::CleanUp()
 {
-	if( vertexShader != NULL )
-	{
-		vertexShader->Release();
-		TC_SAFE_DELETE( vertexShader );
-	}
-
-	if( pixelShader != NULL )
-	{
-		pixelShader->Release();
-		TC_SAFE_DELETE( pixelShader );
-	}
+	// Dropping the refs queues the shaders, the context destroys them when the application cleans it up.
+	vertexShader.Reset();
+	pixelShader.Reset();
 
 	CApplication::CleanUp();
 }
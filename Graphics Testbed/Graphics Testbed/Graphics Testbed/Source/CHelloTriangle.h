@@ -7,17 +7,13 @@
 
 #include "TCApplication.h"
 #include "CApplication.h"
+#include "TCShader.h"
+#include "TCRef.h"
 
 //
 // Defines
 //
 
-//
-// Forward Declarations
-//
-
-class TCShader;
-
 //
 // Class Declaration
 //
@@ -33,8 +29,8 @@ class CHelloTriangle : public CApplication
 		virtual void OnEventFired(TCEventID eventID, void* eventData);
 
 	protected:	// Members
-		TCShader* vertexShader;
-		TCShader* pixelShader;
+		TCRef< TCShader > vertexShader;
+		TCRef< TCShader > pixelShader;
 
 	protected:	// Methods
 
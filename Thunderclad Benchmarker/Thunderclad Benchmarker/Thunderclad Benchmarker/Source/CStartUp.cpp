@@ -0,0 +1,52 @@
+//
+// TCWindowsStartUp
+// This file's purpose is to run every benchmark once and write the results to the log.
+//
+
+//
+// Includes
+//
+
+#include <windows.h>
+#include <tchar.h>
+
+#include "TCLogger.h"
+#include "TCUnitTestManager.h"
+#include "TCHashFunctions_Benchmark.h"
+#include "TCSortedContainers_Benchmark.h"
+#include "TCMemUtils_Benchmark.h"
+
+//
+// Defines
+//
+
+#define NULL 0
+
+//
+// WinMain
+// This is the entry point for any windows application.
+//
+
+int WINAPI WinMain(HINSTANCE hInstance,
+                   HINSTANCE hPrevInstance,
+                   LPSTR lpCmdLine,
+                   int nCmdShow)
+{
+	TCLogger::GetInstance()->SetLogName("Thunderclad Benchmarks");
+	TCLogger::GetInstance()->LogInfo("Starting benchmarks, build in Release for meaningful numbers.");
+
+	//
+	// Run Benchmarks
+	//
+
+	TCUnitTestManager::GetInstance()->Initialize();
+	TCUnitTestManager::GetInstance()->AddUnitTest( new TCHashFunctions_Benchmark() );
+	TCUnitTestManager::GetInstance()->AddUnitTest( new TCSortedContainers_Benchmark() );
+	TCUnitTestManager::GetInstance()->AddUnitTest( new TCMemUtils_Benchmark() );
+	TCUnitTestManager::GetInstance()->StartTests();
+	TCUnitTestManager::GetInstance()->Destroy();
+
+	TCLogger::GetInstance()->LogInfo("Finished benchmarks.");
+
+	return 0;
+}
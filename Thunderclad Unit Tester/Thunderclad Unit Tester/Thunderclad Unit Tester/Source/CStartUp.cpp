@@ -15,6 +15,27 @@
 #include "TCUnitTestManager.h"
 #include "TCList_UnitTest.h"
 #include "TCHashTable_UnitTest.h"
+#include "TCFlatHashTable_UnitTest.h"
+#include "TCHashFunctions_UnitTest.h"
+#include "TCSortedList_UnitTest.h"
+#include "TCBTreeMap_UnitTest.h"
+#include "TCSPSCQueue_UnitTest.h"
+#include "TCMPMCQueue_UnitTest.h"
+#include "TCSlotMap_UnitTest.h"
+#include "TCIntrusiveList_UnitTest.h"
+#include "TCEventDispatcher_UnitTest.h"
+#include "TCBitSet_UnitTest.h"
+#include "TCStringBuilder_UnitTest.h"
+#include "TCStringView_UnitTest.h"
+#include "TCStringUtils_UnitTest.h"
+#include "TCStringAtom_UnitTest.h"
+#include "TCNumberConversion_UnitTest.h"
+#include "TCUnicode_UnitTest.h"
+#include "TCLinearArena_UnitTest.h"
+#include "TCPoolAllocator_UnitTest.h"
+#include "TCMemoryTracker_UnitTest.h"
+#include "TCMemUtils_UnitTest.h"
+#include "TCRef_UnitTest.h"
 #include "TCString_UnitTest.h"
 #include "TCFile_UnitTest.h"
 
@@ -113,6 +134,27 @@ int WINAPI WinMain(HINSTANCE hInstance,
 	TCUnitTestManager::GetInstance()->AddUnitTest( new TCString_UnitTest() );
 	TCUnitTestManager::GetInstance()->AddUnitTest( new TCList_UnitTest() );
 	TCUnitTestManager::GetInstance()->AddUnitTest( new TCHashTable_UnitTest() );
+	TCUnitTestManager::GetInstance()->AddUnitTest( new TCFlatHashTable_UnitTest() );
+	TCUnitTestManager::GetInstance()->AddUnitTest( new TCHashFunctions_UnitTest() );
+	TCUnitTestManager::GetInstance()->AddUnitTest( new TCSortedList_UnitTest() );
+	TCUnitTestManager::GetInstance()->AddUnitTest( new TCBTreeMap_UnitTest() );
+	TCUnitTestManager::GetInstance()->AddUnitTest( new TCSPSCQueue_UnitTest() );
+	TCUnitTestManager::GetInstance()->AddUnitTest( new TCMPMCQueue_UnitTest() );
+	TCUnitTestManager::GetInstance()->AddUnitTest( new TCSlotMap_UnitTest() );
+	TCUnitTestManager::GetInstance()->AddUnitTest( new TCIntrusiveList_UnitTest() );
+	TCUnitTestManager::GetInstance()->AddUnitTest( new TCEventDispatcher_UnitTest() );
+	TCUnitTestManager::GetInstance()->AddUnitTest( new TCBitSet_UnitTest() );
+	TCUnitTestManager::GetInstance()->AddUnitTest( new TCStringBuilder_UnitTest() );
+	TCUnitTestManager::GetInstance()->AddUnitTest( new TCStringView_UnitTest() );
+	TCUnitTestManager::GetInstance()->AddUnitTest( new TCStringUtils_UnitTest() );
+	TCUnitTestManager::GetInstance()->AddUnitTest( new TCStringAtom_UnitTest() );
+	TCUnitTestManager::GetInstance()->AddUnitTest( new TCNumberConversion_UnitTest() );
+	TCUnitTestManager::GetInstance()->AddUnitTest( new TCUnicode_UnitTest() );
+	TCUnitTestManager::GetInstance()->AddUnitTest( new TCLinearArena_UnitTest() );
+	TCUnitTestManager::GetInstance()->AddUnitTest( new TCPoolAllocator_UnitTest() );
+	TCUnitTestManager::GetInstance()->AddUnitTest( new TCMemoryTracker_UnitTest() );
+	TCUnitTestManager::GetInstance()->AddUnitTest( new TCMemUtils_UnitTest() );
+	TCUnitTestManager::GetInstance()->AddUnitTest( new TCRef_UnitTest() );
 	TCUnitTestManager::GetInstance()->AddUnitTest( new TCFile_UnitTest( gFileManager ) );
 	TCUnitTestManager::GetInstance()->StartTests();
 
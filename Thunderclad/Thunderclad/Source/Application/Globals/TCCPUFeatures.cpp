@@ -0,0 +1,119 @@
+//
+// TCCPUFeatures.cpp
+// This file will define the queries for the instruction sets the cpu supports.
+//
+
+//
+// Includes
+//
+
+#include "TCCPUFeatures.h"
+
+#if TC_PLATFORM_WIN32
+	#include <intrin.h>
+	#include <immintrin.h>
+#endif
+
+//
+// Defines
+//
+
+#define TC_CPUID_ECX_SSE42		( 1 << 20 )
+#define TC_CPUID_ECX_POPCNT		( 1 << 23 )
+#define TC_CPUID_ECX_OSXSAVE	( 1 << 27 )
+#define TC_CPUID_ECX_AVX		( 1 << 28 )
+#define TC_CPUID_EBX_AVX2		( 1 << 5 )
+#define TC_XCR0_XMM_YMM_STATE	( 0x6 )
+
+namespace TCCPUFeatures
+{
+#if TC_PLATFORM_WIN32
+
+	//
+	// ReadFeatureFlags
+	//		- Will read the ecx feature flags of cpuid leaf 1.
+	//
+
+	static int ReadFeatureFlags()
+	{
+		int cpuInfo[ 4 ] = { 0 };
+		__cpuid( cpuInfo, 1 );
+		return cpuInfo[ 2 ];
+	}
+
+#endif // TC_PLATFORM_WIN32
+
+	//
+	// HasSSE42
+	//		- Will determine if the cpu supports SSE 4.2.
+	// Inputs:
+	//		- None.
+	// Outputs:
+	//		- bool: Is SSE 4.2 supported.
+	//
+
+	bool HasSSE42()
+	{
+#if TC_PLATFORM_WIN32
+		static const bool hasSSE42 = ( ReadFeatureFlags() & TC_CPUID_ECX_SSE42 ) != 0;
+		return hasSSE42;
+#else
+		return false;
+#endif
+	}
+
+	//
+	// HasPopCnt
+	//		- Will determine if the cpu supports the popcnt instruction.
+	// Inputs:
+	//		- None.
+	// Outputs:
+	//		- bool: Is popcnt supported.
+	//
+
+	bool HasPopCnt()
+	{
+#if TC_PLATFORM_WIN32
+		static const bool hasPopCnt = ( ReadFeatureFlags() & TC_CPUID_ECX_POPCNT ) != 0;
+		return hasPopCnt;
+#else
+		return false;
+#endif
+	}
+
+	//
+	// HasAVX2
+	//		- Will determine if the cpu supports AVX2 and the os saves the ymm registers on a context switch.
+	// Inputs:
+	//		- None.
+	// Outputs:
+	//		- bool: Is AVX2 supported.
+	//
+
+	bool HasAVX2()
+	{
+#if TC_PLATFORM_WIN32
+		static const bool hasAVX2 = []()
+		{
+			int cpuInfo[ 4 ] = { 0 };
+			__cpuid( cpuInfo, 0 );
+			if( cpuInfo[ 0 ] < 7 )
+				return false;
+
+			int featureFlags = ReadFeatureFlags();
+			if( ( featureFlags & TC_CPUID_ECX_OSXSAVE ) == 0 || ( featureFlags & TC_CPUID_ECX_AVX ) == 0 )
+				return false;
+
+			if( ( _xgetbv( 0 ) & TC_XCR0_XMM_YMM_STATE ) != TC_XCR0_XMM_YMM_STATE )
+				return false;
+
+			__cpuidex( cpuInfo, 7, 0 );
+			return ( cpuInfo[ 1 ] & TC_CPUID_EBX_AVX2 ) != 0;
+		}();
+
+		return hasAVX2;
+#else
+		return false;
+#endif
+	}
+}
@@ -0,0 +1,31 @@
+//
+// TCCPUFeatures.h
+// This file will declare the queries for the instruction sets the cpu supports.
+//
+
+#ifndef __TC_CPU_FEATURES_H__
+#define __TC_CPU_FEATURES_H__
+
+//
+// Includes
+//
+
+#include "TCPlatformPrecompilerSymbols.h"
+
+//
+// Defines
+//
+
+//
+// Every query asks the cpu once and caches the answer, so they are cheap enough to check before each SIMD path.
+// SSE2 is part of every cpu we ship on and isn't queried.
+//
+
+namespace TCCPUFeatures
+{
+	bool HasSSE42();
+	bool HasPopCnt();
+	bool HasAVX2();
+}
+
+#endif // __TC_CPU_FEATURES_H__
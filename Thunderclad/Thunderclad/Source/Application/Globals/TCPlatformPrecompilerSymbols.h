@@ -17,6 +17,20 @@
 
 #define TC_BUILD_CONFIGURATION_DEBUG	_DEBUG
 
+// VS2013 has no constexpr or alignof, functions marked with TC_CONSTEXPR are evaluated at run time there.
+#if defined( _MSC_VER ) && _MSC_VER < 1900
+	#define TC_CONSTEXPR
+	#define TC_HAS_CONSTEXPR	0
+	#define TC_ALIGNOF( type )	__alignof( type )
+#else
+	#define TC_CONSTEXPR		constexpr
+	#define TC_HAS_CONSTEXPR	1
+	#define TC_ALIGNOF( type )	alignof( type )
+#endif
+
+// For parameters and locals only used in some builds.
+#define TC_UNUSED( x )	( (void)( x ) )
+
 #if TC_PLATFORM_WIN32
 	#include <assert.h>
 	#define TC_ASSERT( x ) assert( x )
@@ -24,6 +38,13 @@
 	#ifndef NULL
 		#define NULL 0
 	#endif // NULL
+
+	// For scans that read whole aligned blocks past the end of a string, which can't fault but do trip the sanitizer.
+	#if defined( __SANITIZE_ADDRESS__ )
+		#define TC_NO_SANITIZE_ADDRESS __declspec( no_sanitize_address )
+	#else
+		#define TC_NO_SANITIZE_ADDRESS
+	#endif
 #endif
 
 #endif // __TC_PLATFORM_PRECOMPILER_SYMBOLS_H__
\ No newline at end of file
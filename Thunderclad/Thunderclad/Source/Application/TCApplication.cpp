@@ -15,6 +15,8 @@
 #include "TCKeyboardInput.h"
 #include "TCLogger.h"
 #include "TCShader.h"
+#include "TCFrameArena.h"
+#include "TCMemoryTracker.h"
 
 #if TC_PLATFORM_WIN32
 	#include "TCInputManager.win32.h"
@@ -102,6 +104,12 @@ TCApplication::~TCApplication()
 
 void TCApplication::Initialize( TCWindow* mainWindow )
 {
+	//
+	// Transient memory comes from the frame arena, it has to be ready before anything else starts up.
+	//
+
+	gFrameArena->Initialize();
+
 	//
 	// Register ourselves as a listener to the main window.
 	//
@@ -112,6 +120,13 @@ void TCApplication::Initialize( TCWindow* mainWindow )
 		SubscribeTo( mMainWindow );
 	}
 
+	//
+	// Everything allocated from here on should be freed by the time the application exits, the subscription to the
+	// window lives as long as the window so it comes first.
+	//
+
+	TCMemoryTracker::SetLeakCheckpoint();
+
 	//
 	// Create Input.
 	//
@@ -133,7 +148,8 @@ void TCApplication::Initialize( TCWindow* mainWindow )
 
 //
 // Update
-//		- Will update this application.
+//		- Will update this application, memory from the frame arena is released at the start of every frame. On exit
+//		  the memory still allocated is reported.
 // Inputs:
 //		- float deltaTime: The timestep since the last frame.
 // Outputs:
@@ -145,9 +161,13 @@ bool TCApplication::Update( float deltaTime )
 	if( mExitGame )
 	{
 		CleanUp();
+
+		TCMemoryTracker::ReportStats();
+		TCMemoryTracker::ReportLeaks();
 		return true;	// Kill the game.
 	}
 
+	gFrameArena->BeginFrame();
 	RenderFrame();
 
 	return false;		// Continue running the game.
@@ -27,6 +27,23 @@ TCList< TCWindow_Win32* > TCWindow_Win32::gWindowList;	// This a list of all win
 TCWindow_Win32* gWindowBeingInitialized = NULL;			// This is a bit hacky, but we don't actually get our hWND until after the message proc has recieved message.
 														// So this is used as a shitty way to catch that edge case.
 
+//
+// ToWideString
+//		- Will convert a UTF-8 string for the wide Win32 functions, the window is registered as a unicode window so
+//		  titles and class names with non-ASCII characters show correctly.
+// Inputs:
+//		- const TCString& string: The string to convert.
+//		- TCList< char16 >& wideString: Filled with the NULL terminated UTF-16 string.
+// Outputs:
+//		- None.
+//
+
+static void ToWideString( const TCString& string, TCList< char16 >& wideString )
+{
+	wideString.Resize( string.Length() + 1 );	// UTF-16 never needs more units than UTF-8 has bytes.
+	string.ToUTF16( &wideString[ 0 ] );
+}
+
 //
 // Default Window Procedure
 // Inputs:
@@ -57,7 +74,7 @@ LRESULT CALLBACK DefaultWindowMessagePump( HWND hWnd,
 		if( gWindowBeingInitialized == NULL )
 		{
 			gLogger->LogFailure("Recieving a window message for a window that hasn't been added to the window list!");
-			return DefWindowProc( hWnd, message, wParam, lParam );
+			return DefWindowProcW( hWnd, message, wParam, lParam );
 		}
 		else
 		{
@@ -78,7 +95,7 @@ LRESULT CALLBACK DefaultWindowMessagePump( HWND hWnd,
 
 	if( result == Success_Unhandled )
 	{
-		return DefWindowProc( hWnd, message, wParam, lParam );	
+		return DefWindowProcW( hWnd, message, wParam, lParam );	
 	}
 	else if( TC_FAILED( result ) )
 	{
@@ -288,8 +305,11 @@ void TCWindow_Win32::Destroy()
 {
 	if( mWindow != NULL )
 	{
+		TCList< char16 > wideClassName;
+		ToWideString( mWindowClassName, wideClassName );
+
 		DestroyWindow( mWindow );
-		UnregisterClass( mWindowClassName.Data(), mInstance );
+		UnregisterClassW( (const wchar_t*)&wideClassName[ 0 ], mInstance );
 		mWindow = NULL;
 	}
 }
@@ -498,7 +518,10 @@ TCResult TCWindow_Win32::InitializeWindowClass( TCWindow_Win32::Win32Description
 	// Initialize our class variable. 
 	//
 
-	mWindowClass.cbSize			= sizeof( WNDCLASSEX );			// The size of the class we are passing in.
+	TCList< char16 > wideClassName;
+	ToWideString( mWindowClassName, wideClassName );
+
+	mWindowClass.cbSize			= sizeof( WNDCLASSEXW );			// The size of the class we are passing in.
 	mWindowClass.style			= CS_HREDRAW | CS_VREDRAW;		// We want to redraw if we resize horizontally and vertically.
 	mWindowClass.lpfnWndProc	= mWindowProcedure;				// The window procedure we are going to use for this object.
 	mWindowClass.cbClsExtra		= 0;
@@ -508,13 +531,17 @@ TCResult TCWindow_Win32::InitializeWindowClass( TCWindow_Win32::Win32Description
 	mWindowClass.hCursor		= mCursor;						// This is the cursor to be shown when within our window's borders.
 	mWindowClass.hbrBackground	= mBackgroundBrush;				// This is the clear color for the window.
 	mWindowClass.lpszMenuName	= NULL;
-	mWindowClass.lpszClassName	= mWindowClassName.Data();		// The name of the class that will be registered.
+	mWindowClass.lpszClassName	= (const wchar_t*)&wideClassName[ 0 ];	// The name of the class that will be registered, only read while registering.
 
 	//
 	// Create the window class.
 	//
 
-	RegisterClassEx( &mWindowClass );	// TODO: Determine how to check for success/failure on this operation.
+	RegisterClassExW( &mWindowClass );	// TODO: Determine how to check for success/failure on this operation.
+
+	// The wide name goes away with this function, so don't keep a pointer to it. The name is converted again when it's needed.
+	mWindowClass.lpszClassName = NULL;
+
 	return TCResult::Success;
 }
 
@@ -540,9 +567,14 @@ TCResult TCWindow_Win32::InitializeWindow( TCWindow_Win32::Win32Description& des
 	// Create our window.
 	//
 
+	TCList< char16 > wideClassName;
+	TCList< char16 > wideTitle;
+	ToWideString( mWindowClassName, wideClassName );
+	ToWideString( mWindowTitle, wideTitle );
+
 	gWindowBeingInitialized = this; // This is a hacky way to fix the message pump from getting messages from a window that can't register yet.
-	mWindow = CreateWindow( mWindowClassName.Data(),		// The name of the window class we just registered.
-							mWindowTitle.Data(),			// The title of the window.
+	mWindow = CreateWindowW( (const wchar_t*)&wideClassName[ 0 ],	// The name of the window class we just registered.
+							(const wchar_t*)&wideTitle[ 0 ],		// The title of the window.
 							WS_OVERLAPPEDWINDOW,			// The style for the window.
 							(int)description.xPosition,		// The x position of the window.
 							(int)description.yPosition,		// The y position of the window.
@@ -139,7 +139,7 @@ class TCWindow_Win32 : public TCWindow
 		HINSTANCE		mInstance;
 		HWND			mWindow;
 		HWND			mParentWindow;
-		WNDCLASSEX		mWindowClass;
+		WNDCLASSEXW		mWindowClass;
 		HBRUSH			mBackgroundBrush;
 		HCURSOR			mCursor;
 		WndProcedure	mWindowProcedure;
@@ -0,0 +1,136 @@
+//
+// TCBTreeMap.h
+// This file will declare an ordered map that stores its entries in wide, shallow tree nodes.
+//
+
+#ifndef __TC_BTREE_MAP_H__
+#define __TC_BTREE_MAP_H__
+
+//
+// Includes
+//
+
+#include "TCPlatformPrecompilerSymbols.h"
+#include "TCCompareTraits.h"
+
+#include <stddef.h>
+#include <iterator>
+
+//
+// Defines
+//
+
+#define TC_BTREE_NODE_SIZE	(32)	// The most keys a node holds, a lookup touches one node per level.
+
+//
+// Class Declaration
+//		- A B+ tree, every entry lives in a leaf and the leaves are chained in key order, the branches only guide searches.
+//		- Keys are ordered by the Compare policy, see TCCompareTraits.h, two keys are the same key when neither orders first.
+//		- Iterating the map visits the entries in key order, LowerBound and UpperBound give the iterators for a range.
+//
+
+template< typename Key, typename Value, typename Compare = TCLess< Key > >
+class TCBTreeMap
+{
+	public:		// Members
+		class Leaf;
+
+		class Entry
+		{
+			public:
+				Key		key;
+				Value	value;
+		};
+
+		class Iterator
+		{
+			public:		// Members
+				typedef std::forward_iterator_tag	iterator_category;
+				typedef Entry						value_type;
+				typedef ptrdiff_t					difference_type;
+				typedef Entry*						pointer;
+				typedef Entry&						reference;
+
+			public:		// Methods
+								Iterator()								: mLeaf( NULL ), mIndex( 0 ) {}
+								Iterator( Leaf* leaf, int index );
+
+				Entry&			operator*() const						{ return mLeaf->entries[ mIndex ]; }
+				Entry*			operator->() const						{ return &mLeaf->entries[ mIndex ]; }
+				Iterator&		operator++();
+				Iterator		operator++( int )						{ Iterator previous = *this; ++(*this); return previous; }
+				bool			operator==( const Iterator& rhs ) const	{ return mLeaf == rhs.mLeaf && mIndex == rhs.mIndex; }
+				bool			operator!=( const Iterator& rhs ) const	{ return !( *this == rhs ); }
+
+			private:	// Members
+				Leaf*			mLeaf;
+				int				mIndex;
+		};
+
+		class Node
+		{
+			public:
+				bool	isLeaf;
+				int		count;		// Entries in a leaf, keys in a branch.
+		};
+
+		class Leaf : public Node
+		{
+			public:
+				Entry	entries[ TC_BTREE_NODE_SIZE + 1 ];		// One spare so a full leaf can take an entry before it splits.
+				Leaf*	next;
+		};
+
+		class Branch : public Node
+		{
+			public:
+				Key		keys[ TC_BTREE_NODE_SIZE + 1 ];			// Every key in children[ i ] orders before keys[ i ], every key in children[ i + 1 ] does not.
+				Node*	children[ TC_BTREE_NODE_SIZE + 2 ];
+		};
+
+	public:		// Methods
+						TCBTreeMap();
+						TCBTreeMap( const TCBTreeMap& map );
+		TCBTreeMap&		operator=( const TCBTreeMap& map );
+						~TCBTreeMap();
+
+		void			Clone( const TCBTreeMap& map );
+		void			Clear();
+		inline int		Count()										{ return mCount; }
+
+		void			AddValue( Key key, Value value );
+		void			RemoveValue( Key key );
+
+		bool			ContainsKey( Key key );
+		bool			GetValue( Key key, Value** value );
+
+		Iterator		LowerBound( const Key& key );
+		Iterator		UpperBound( const Key& key );
+
+		// Lower case so the map works with range-for and <algorithm>.
+		Iterator		begin()										{ return Iterator( mFirstLeaf, 0 ); }
+		Iterator		end()										{ return Iterator(); }
+
+	private:	// Members
+		Node*			mRoot;
+		Leaf*			mFirstLeaf;
+		int				mCount;
+
+	private:	// Methods
+		Leaf*			FindLeaf( const Key& key );
+		Node*			Insert( Node* node, const Key& key, const Value& value, Key& splitKey, bool& added );
+		bool			Remove( Node* node, const Key& key );
+		void			Rebalance( Branch* parent, int childIndex );
+		void			MergeLeaves( Branch* parent, int childIndex );
+		void			MergeBranches( Branch* parent, int childIndex );
+		void			RemoveFromBranch( Branch* branch, int keyIndex );
+		void			DestroyNode( Node* node );
+
+		static int		ChildIndex( Branch* branch, const Key& key );
+		static int		LowerIndex( Leaf* leaf, const Key& key );
+		static int		UpperIndex( Leaf* leaf, const Key& key );
+};
+
+#include "TCBTreeMap.hpp"
+
+#endif // __TC_BTREE_MAP_H__
@@ -0,0 +1,868 @@
+//
+// TCBTreeMap.hpp
+// This file will define the methods declared for a B-tree map.
+//
+
+#ifndef __TC_BTREE_MAP_HPP__
+#define __TC_BTREE_MAP_HPP__
+
+//
+// Includes
+//
+
+#include "TCBTreeMap.h"
+#include "TCLogger.h"
+#include "TCMemUtils.h"
+
+//
+// Defines
+//
+
+#define TC_BTREE_MIN_NODE_SIZE	(TC_BTREE_NODE_SIZE / 2)	// Nodes other than the root never hold fewer keys than this.
+
+//
+// Default Constructor
+//		- Will initialize the map to a safe, empty state, no nodes are allocated until the first entry is added.
+// Inputs:
+//		- None.
+// Outputs:
+//		- None.
+//
+
+template< class Key, class Value, class Compare >
+TCBTreeMap< Key, Value, Compare >::TCBTreeMap()
+{
+	mRoot		= NULL;
+	mFirstLeaf	= NULL;
+	mCount		= 0;
+}
+
+//
+// Copy Constructor
+//		- Will initialize this map to a copy of another map.
+// Inputs:
+//		- const TCBTreeMap& map: The map to copy.
+// Outputs:
+//		- None.
+//
+
+template< class Key, class Value, class Compare >
+TCBTreeMap< Key, Value, Compare >::TCBTreeMap( const TCBTreeMap& map )
+{
+	mRoot		= NULL;
+	mFirstLeaf	= NULL;
+	mCount		= 0;
+
+	Clone( map );
+}
+
+//
+// Assignment Operator
+//		- Will set this map equal to another map.
+// Inputs:
+//		- const TCBTreeMap& map: The map to copy.
+// Outputs:
+//		- TCBTreeMap&: The reference to this map.
+//
+
+template< class Key, class Value, class Compare >
+TCBTreeMap< Key, Value, Compare >& TCBTreeMap< Key, Value, Compare >::operator=( const TCBTreeMap& map )
+{
+	if( this != &map )
+	{
+		Clone( map );
+	}
+
+	return *this;
+}
+
+//
+// Destructor
+//		- Will free all resources associated with this map.
+// Inputs:
+//		- None.
+// Outputs:
+//		- None.
+//
+
+template< class Key, class Value, class Compare >
+TCBTreeMap< Key, Value, Compare >::~TCBTreeMap()
+{
+	Clear();
+}
+
+//
+// Clone
+//		- Will copy another map to this map.
+// Inputs:
+//		- const TCBTreeMap& map: The map to copy.
+// Outputs:
+//		- None.
+//
+
+template< class Key, class Value, class Compare >
+void TCBTreeMap< Key, Value, Compare >::Clone( const TCBTreeMap& map )
+{
+	Clear();
+
+	for( Leaf* leaf = map.mFirstLeaf; leaf != NULL; leaf = leaf->next )
+	{
+		for( int currentEntry = 0; currentEntry < leaf->count; ++currentEntry )
+		{
+			AddValue( leaf->entries[ currentEntry ].key, leaf->entries[ currentEntry ].value );
+		}
+	}
+}
+
+//
+// Clear
+//		- Will free every node in the map.
+// Inputs:
+//		- None.
+// Outputs:
+//		- None.
+//
+
+template< class Key, class Value, class Compare >
+void TCBTreeMap< Key, Value, Compare >::Clear()
+{
+	if( mRoot != NULL )
+	{
+		DestroyNode( mRoot );
+	}
+
+	mRoot		= NULL;
+	mFirstLeaf	= NULL;
+	mCount		= 0;
+}
+
+//
+// AddValue
+//		- This will add a value to the map.
+// Inputs:
+//		- Key key: The key for this value, it must not be a duplicate.
+//		- Value value: The value for this key.
+// Outputs:
+//		- None.
+//
+
+template< class Key, class Value, class Compare >
+void TCBTreeMap< Key, Value, Compare >::AddValue( Key key, Value value )
+{
+	if( mRoot == NULL )
+	{
+		Leaf* leaf	= new Leaf();
+		leaf->isLeaf	= true;
+		leaf->count		= 0;
+		leaf->next		= NULL;
+
+		mRoot		= leaf;
+		mFirstLeaf	= leaf;
+	}
+
+	Key splitKey;
+	bool added = false;
+	Node* splitNode = Insert( mRoot, key, value, splitKey, added );
+
+	//
+	// If the root split the tree grows a level.
+	//
+
+	if( splitNode != NULL )
+	{
+		Branch* root		= new Branch();
+		root->isLeaf		= false;
+		root->count			= 1;
+		root->keys[ 0 ]		= splitKey;
+		root->children[ 0 ]	= mRoot;
+		root->children[ 1 ]	= splitNode;
+
+		mRoot = root;
+	}
+
+	if( !added )
+	{
+		TCLogger::GetInstance()->LogError("B-tree map already contains this key");
+		return;
+	}
+
+	mCount++;
+}
+
+//
+// RemoveValue
+//		- Will remove a value from the map.
+// Inputs:
+//		- Key key: The key for the value to remove.
+// Outputs:
+//		- None.
+//
+
+template< class Key, class Value, class Compare >
+void TCBTreeMap< Key, Value, Compare >::RemoveValue( Key key )
+{
+	if( mRoot == NULL || !Remove( mRoot, key ) )
+		return;
+
+	mCount--;
+
+	//
+	// If the root lost its last key the tree shrinks a level.
+	//
+
+	if( !mRoot->isLeaf && mRoot->count == 0 )
+	{
+		Branch* oldRoot = (Branch*)mRoot;
+		mRoot = oldRoot->children[ 0 ];
+		delete oldRoot;
+	}
+	else if( mRoot->isLeaf && mRoot->count == 0 )
+	{
+		delete (Leaf*)mRoot;
+		mRoot		= NULL;
+		mFirstLeaf	= NULL;
+	}
+}
+
+//
+// ContainsKey
+//		- Will return if the map contains the specified key.
+// Inputs:
+//		- Key key: The key to search for.
+// Outputs:
+//		- bool: Does the map contain the key.
+//
+
+template< class Key, class Value, class Compare >
+bool TCBTreeMap< Key, Value, Compare >::ContainsKey( Key key )
+{
+	Value* value = NULL;
+	return GetValue( key, &value );
+}
+
+//
+// GetValue
+//		- Will return the value associated with a specified key.
+// Inputs:
+//		- Key key: The key associated with the value.
+//		- Value** value: The pointer to set to the value.
+// Outputs:
+//		- bool: Whether the key was found or not.
+//
+
+template< class Key, class Value, class Compare >
+bool TCBTreeMap< Key, Value, Compare >::GetValue( Key key, Value** value )
+{
+	if( value == NULL )
+		return false;
+
+	*value = NULL;
+
+	Leaf* leaf = FindLeaf( key );
+	if( leaf == NULL )
+		return false;
+
+	int index = LowerIndex( leaf, key );
+	if( index >= leaf->count || Compare::Less( key, leaf->entries[ index ].key ) )
+		return false;
+
+	*value = &leaf->entries[ index ].value;
+	return true;
+}
+
+//
+// LowerBound
+//		- Will find the first entry whose key does not order before the key provided.
+// Inputs:
+//		- const Key& key: The key to search for.
+// Outputs:
+//		- Iterator: The entry, end() if every key orders before it.
+//
+
+template< class Key, class Value, class Compare >
+typename TCBTreeMap< Key, Value, Compare >::Iterator TCBTreeMap< Key, Value, Compare >::LowerBound( const Key& key )
+{
+	Leaf* leaf = FindLeaf( key );
+	if( leaf == NULL )
+		return end();
+
+	return Iterator( leaf, LowerIndex( leaf, key ) );
+}
+
+//
+// UpperBound
+//		- Will find the first entry whose key orders after the key provided.
+// Inputs:
+//		- const Key& key: The key to search for.
+// Outputs:
+//		- Iterator: The entry, end() if no key orders after it.
+//
+
+template< class Key, class Value, class Compare >
+typename TCBTreeMap< Key, Value, Compare >::Iterator TCBTreeMap< Key, Value, Compare >::UpperBound( const Key& key )
+{
+	Leaf* leaf = FindLeaf( key );
+	if( leaf == NULL )
+		return end();
+
+	return Iterator( leaf, UpperIndex( leaf, key ) );
+}
+
+//
+// FindLeaf
+//		- Will walk down the tree to the leaf the key belongs in.
+// Inputs:
+//		- const Key& key: The key to search for.
+// Outputs:
+//		- Leaf*: The leaf, NULL if the map is empty.
+//
+
+template< class Key, class Value, class Compare >
+typename TCBTreeMap< Key, Value, Compare >::Leaf* TCBTreeMap< Key, Value, Compare >::FindLeaf( const Key& key )
+{
+	Node* node = mRoot;
+	if( node == NULL )
+		return NULL;
+
+	while( !node->isLeaf )
+	{
+		Branch* branch = (Branch*)node;
+		node = branch->children[ ChildIndex( branch, key ) ];
+	}
+
+	return (Leaf*)node;
+}
+
+//
+// Insert
+//		- Will add an entry below a node, splitting any node that overflows on the way back up.
+// Inputs:
+//		- Node* node: The node to add below.
+//		- const Key& key: The key to add.
+//		- const Value& value: The value to add.
+//		- Key& splitKey: Set to the first key of the new node if the node split.
+//		- bool& added: Set to false if the key was already in the map.
+// Outputs:
+//		- Node*: The new node to the right of the node if it split, otherwise NULL.
+//
+
+template< class Key, class Value, class Compare >
+typename TCBTreeMap< Key, Value, Compare >::Node* TCBTreeMap< Key, Value, Compare >::Insert( Node* node, const Key& key, const Value& value, Key& splitKey, bool& added )
+{
+	if( node->isLeaf )
+	{
+		Leaf* leaf = (Leaf*)node;
+
+		int index = LowerIndex( leaf, key );
+		if( index < leaf->count && !Compare::Less( key, leaf->entries[ index ].key ) )
+		{
+			added = false;
+			return NULL;
+		}
+
+		for( int currentEntry = leaf->count; currentEntry > index; --currentEntry )
+		{
+			leaf->entries[ currentEntry ] = TCMove( leaf->entries[ currentEntry - 1 ] );
+		}
+
+		leaf->entries[ index ].key		= key;
+		leaf->entries[ index ].value	= value;
+		leaf->count++;
+		added = true;
+
+		if( leaf->count <= TC_BTREE_NODE_SIZE )
+			return NULL;
+
+		//
+		// Split the upper half of the leaf into a new leaf.
+		//
+
+		Leaf* right		= new Leaf();
+		right->isLeaf	= true;
+		right->count	= leaf->count - leaf->count / 2;
+		right->next		= leaf->next;
+
+		int middle = leaf->count / 2;
+		for( int currentEntry = middle; currentEntry < leaf->count; ++currentEntry )
+		{
+			right->entries[ currentEntry - middle ] = TCMove( leaf->entries[ currentEntry ] );
+			leaf->entries[ currentEntry ] = Entry();
+		}
+
+		leaf->count = middle;
+		leaf->next	= right;
+
+		splitKey = right->entries[ 0 ].key;
+		return right;
+	}
+
+	Branch* branch = (Branch*)node;
+
+	int childIndex = ChildIndex( branch, key );
+	Key childSplitKey;
+	Node* childSplit = Insert( branch->children[ childIndex ], key, value, childSplitKey, added );
+	if( childSplit == NULL )
+		return NULL;
+
+	//
+	// The child split, add the new child after it.
+	//
+
+	for( int currentKey = branch->count; currentKey > childIndex; --currentKey )
+	{
+		branch->keys[ currentKey ]			= TCMove( branch->keys[ currentKey - 1 ] );
+		branch->children[ currentKey + 1 ]	= branch->children[ currentKey ];
+	}
+
+	branch->keys[ childIndex ]			= childSplitKey;
+	branch->children[ childIndex + 1 ]	= childSplit;
+	branch->count++;
+
+	if( branch->count <= TC_BTREE_NODE_SIZE )
+		return NULL;
+
+	//
+	// Split the branch, the middle key moves up to the parent.
+	//
+
+	int middle = branch->count / 2;
+
+	Branch* right	= new Branch();
+	right->isLeaf	= false;
+	right->count	= branch->count - middle - 1;
+
+	for( int currentKey = middle + 1; currentKey < branch->count; ++currentKey )
+	{
+		right->keys[ currentKey - middle - 1 ] = TCMove( branch->keys[ currentKey ] );
+		branch->keys[ currentKey ] = Key();
+	}
+
+	for( int currentChild = middle + 1; currentChild <= branch->count; ++currentChild )
+	{
+		right->children[ currentChild - middle - 1 ] = branch->children[ currentChild ];
+	}
+
+	splitKey = TCMove( branch->keys[ middle ] );
+	branch->keys[ middle ] = Key();
+	branch->count = middle;
+
+	return right;
+}
+
+//
+// Remove
+//		- Will remove an entry below a node, refilling any child that falls under the minimum size.
+// Inputs:
+//		- Node* node: The node to remove below.
+//		- const Key& key: The key to remove.
+// Outputs:
+//		- bool: Was the key found and removed.
+//
+
+template< class Key, class Value, class Compare >
+bool TCBTreeMap< Key, Value, Compare >::Remove( Node* node, const Key& key )
+{
+	if( node->isLeaf )
+	{
+		Leaf* leaf = (Leaf*)node;
+
+		int index = LowerIndex( leaf, key );
+		if( index >= leaf->count || Compare::Less( key, leaf->entries[ index ].key ) )
+			return false;
+
+		for( int currentEntry = index; currentEntry + 1 < leaf->count; ++currentEntry )
+		{
+			leaf->entries[ currentEntry ] = TCMove( leaf->entries[ currentEntry + 1 ] );
+		}
+
+		leaf->count--;
+		leaf->entries[ leaf->count ] = Entry();
+		return true;
+	}
+
+	Branch* branch = (Branch*)node;
+
+	int childIndex = ChildIndex( branch, key );
+	if( !Remove( branch->children[ childIndex ], key ) )
+		return false;
+
+	if( branch->children[ childIndex ]->count < TC_BTREE_MIN_NODE_SIZE )
+	{
+		Rebalance( branch, childIndex );
+	}
+
+	return true;
+}
+
+//
+// Rebalance
+//		- Will refill a child that fell under the minimum size, borrowing from a sibling if one can spare it, otherwise merging with it.
+// Inputs:
+//		- Branch* parent: The parent of the child.
+//		- int childIndex: The index of the child in the parent.
+// Outputs:
+//		- None.
+//
+
+template< class Key, class Value, class Compare >
+void TCBTreeMap< Key, Value, Compare >::Rebalance( Branch* parent, int childIndex )
+{
+	Node* child	= parent->children[ childIndex ];
+	Node* left	= ( childIndex > 0 ) ? parent->children[ childIndex - 1 ] : NULL;
+	Node* right	= ( childIndex < parent->count ) ? parent->children[ childIndex + 1 ] : NULL;
+
+	if( child->isLeaf )
+	{
+		Leaf* childLeaf = (Leaf*)child;
+
+		if( left != NULL && left->count > TC_BTREE_MIN_NODE_SIZE )
+		{
+			//
+			// Take the last entry of the left sibling.
+			//
+
+			Leaf* leftLeaf = (Leaf*)left;
+			for( int currentEntry = childLeaf->count; currentEntry > 0; --currentEntry )
+			{
+				childLeaf->entries[ currentEntry ] = TCMove( childLeaf->entries[ currentEntry - 1 ] );
+			}
+
+			leftLeaf->count--;
+			childLeaf->entries[ 0 ] = TCMove( leftLeaf->entries[ leftLeaf->count ] );
+			leftLeaf->entries[ leftLeaf->count ] = Entry();
+			childLeaf->count++;
+
+			parent->keys[ childIndex - 1 ] = childLeaf->entries[ 0 ].key;
+			return;
+		}
+
+		if( right != NULL && right->count > TC_BTREE_MIN_NODE_SIZE )
+		{
+			//
+			// Take the first entry of the right sibling.
+			//
+
+			Leaf* rightLeaf = (Leaf*)right;
+			childLeaf->entries[ childLeaf->count ] = TCMove( rightLeaf->entries[ 0 ] );
+			childLeaf->count++;
+
+			for( int currentEntry = 0; currentEntry + 1 < rightLeaf->count; ++currentEntry )
+			{
+				rightLeaf->entries[ currentEntry ] = TCMove( rightLeaf->entries[ currentEntry + 1 ] );
+			}
+
+			rightLeaf->count--;
+			rightLeaf->entries[ rightLeaf->count ] = Entry();
+
+			parent->keys[ childIndex ] = rightLeaf->entries[ 0 ].key;
+			return;
+		}
+
+		MergeLeaves( parent, ( left != NULL ) ? childIndex - 1 : childIndex );
+		return;
+	}
+
+	Branch* childBranch = (Branch*)child;
+
+	if( left != NULL && left->count > TC_BTREE_MIN_NODE_SIZE )
+	{
+		//
+		// Rotate through the parent, the separator comes down and the left sibling's last key goes up.
+		//
+
+		Branch* leftBranch = (Branch*)left;
+		for( int currentKey = childBranch->count; currentKey > 0; --currentKey )
+		{
+			childBranch->keys[ currentKey ]			= TCMove( childBranch->keys[ currentKey - 1 ] );
+			childBranch->children[ currentKey + 1 ]	= childBranch->children[ currentKey ];
+		}
+		childBranch->children[ 1 ] = childBranch->children[ 0 ];
+
+		childBranch->keys[ 0 ]		= TCMove( parent->keys[ childIndex - 1 ] );
+		childBranch->children[ 0 ]	= leftBranch->children[ leftBranch->count ];
+		childBranch->count++;
+
+		leftBranch->count--;
+		parent->keys[ childIndex - 1 ] = TCMove( leftBranch->keys[ leftBranch->count ] );
+		leftBranch->keys[ leftBranch->count ] = Key();
+		return;
+	}
+
+	if( right != NULL && right->count > TC_BTREE_MIN_NODE_SIZE )
+	{
+		//
+		// Rotate through the parent, the separator comes down and the right sibling's first key goes up.
+		//
+
+		Branch* rightBranch = (Branch*)right;
+		childBranch->keys[ childBranch->count ]			= TCMove( parent->keys[ childIndex ] );
+		childBranch->children[ childBranch->count + 1 ]	= rightBranch->children[ 0 ];
+		childBranch->count++;
+
+		parent->keys[ childIndex ] = TCMove( rightBranch->keys[ 0 ] );
+		for( int currentKey = 0; currentKey + 1 < rightBranch->count; ++currentKey )
+		{
+			rightBranch->keys[ currentKey ]		= TCMove( rightBranch->keys[ currentKey + 1 ] );
+			rightBranch->children[ currentKey ]	= rightBranch->children[ currentKey + 1 ];
+		}
+		rightBranch->children[ rightBranch->count - 1 ] = rightBranch->children[ rightBranch->count ];
+
+		rightBranch->count--;
+		rightBranch->keys[ rightBranch->count ] = Key();
+		return;
+	}
+
+	MergeBranches( parent, ( left != NULL ) ? childIndex - 1 : childIndex );
+}
+
+//
+// MergeLeaves
+//		- Will move every entry of a leaf into the leaf before it and free it.
+// Inputs:
+//		- Branch* parent: The parent of the leaves.
+//		- int childIndex: The index of the left leaf, the leaf after it is merged into it.
+// Outputs:
+//		- None.
+//
+
+template< class Key, class Value, class Compare >
+void TCBTreeMap< Key, Value, Compare >::MergeLeaves( Branch* parent, int childIndex )
+{
+	Leaf* left	= (Leaf*)parent->children[ childIndex ];
+	Leaf* right	= (Leaf*)parent->children[ childIndex + 1 ];
+
+	for( int currentEntry = 0; currentEntry < right->count; ++currentEntry )
+	{
+		left->entries[ left->count + currentEntry ] = TCMove( right->entries[ currentEntry ] );
+	}
+
+	left->count += right->count;
+	left->next	= right->next;
+	delete right;
+
+	RemoveFromBranch( parent, childIndex );
+}
+
+//
+// MergeBranches
+//		- Will move the separator and every key and child of a branch into the branch before it and free it.
+// Inputs:
+//		- Branch* parent: The parent of the branches.
+//		- int childIndex: The index of the left branch, the branch after it is merged into it.
+// Outputs:
+//		- None.
+//
+
+template< class Key, class Value, class Compare >
+void TCBTreeMap< Key, Value, Compare >::MergeBranches( Branch* parent, int childIndex )
+{
+	Branch* left	= (Branch*)parent->children[ childIndex ];
+	Branch* right	= (Branch*)parent->children[ childIndex + 1 ];
+
+	left->keys[ left->count ] = parent->keys[ childIndex ];
+	for( int currentKey = 0; currentKey < right->count; ++currentKey )
+	{
+		left->keys[ left->count + 1 + currentKey ] = TCMove( right->keys[ currentKey ] );
+	}
+
+	for( int currentChild = 0; currentChild <= right->count; ++currentChild )
+	{
+		left->children[ left->count + 1 + currentChild ] = right->children[ currentChild ];
+	}
+
+	left->count += right->count + 1;
+	delete right;
+
+	RemoveFromBranch( parent, childIndex );
+}
+
+//
+// RemoveFromBranch
+//		- Will remove a separator and the child after it from a branch, used once that child is merged away.
+// Inputs:
+//		- Branch* branch: The branch to remove from.
+//		- int keyIndex: The separator to remove, children[ keyIndex + 1 ] goes with it.
+// Outputs:
+//		- None.
+//
+
+template< class Key, class Value, class Compare >
+void TCBTreeMap< Key, Value, Compare >::RemoveFromBranch( Branch* branch, int keyIndex )
+{
+	for( int currentKey = keyIndex; currentKey + 1 < branch->count; ++currentKey )
+	{
+		branch->keys[ currentKey ]			= TCMove( branch->keys[ currentKey + 1 ] );
+		branch->children[ currentKey + 1 ]	= branch->children[ currentKey + 2 ];
+	}
+
+	branch->count--;
+	branch->keys[ branch->count ] = Key();
+}
+
+//
+// DestroyNode
+//		- Will free a node and everything below it.
+// Inputs:
+//		- Node* node: The node to free.
+// Outputs:
+//		- None.
+//
+
+template< class Key, class Value, class Compare >
+void TCBTreeMap< Key, Value, Compare >::DestroyNode( Node* node )
+{
+	if( node->isLeaf )
+	{
+		delete (Leaf*)node;
+		return;
+	}
+
+	Branch* branch = (Branch*)node;
+	for( int currentChild = 0; currentChild <= branch->count; ++currentChild )
+	{
+		DestroyNode( branch->children[ currentChild ] );
+	}
+
+	delete branch;
+}
+
+//
+// ChildIndex
+//		- Will binary search a branch for the child a key belongs in.
+// Inputs:
+//		- Branch* branch: The branch to search.
+//		- const Key& key: The key to search for.
+// Outputs:
+//		- int: The index of the child, the number of separators that don't order after the key.
+//
+
+template< class Key, class Value, class Compare >
+int TCBTreeMap< Key, Value, Compare >::ChildIndex( Branch* branch, const Key& key )
+{
+	int first = 0;
+	int count = branch->count;
+	while( count > 0 )
+	{
+		int step = count / 2;
+		if( !Compare::Less( key, branch->keys[ first + step ] ) )
+		{
+			first += step + 1;
+			count -= step + 1;
+		}
+		else
+		{
+			count = step;
+		}
+	}
+
+	return first;
+}
+
+//
+// LowerIndex
+//		- Will binary search a leaf for the first entry whose key does not order before the key provided.
+// Inputs:
+//		- Leaf* leaf: The leaf to search.
+//		- const Key& key: The key to search for.
+// Outputs:
+//		- int: The index, the count of the leaf if every key orders before it.
+//
+
+template< class Key, class Value, class Compare >
+int TCBTreeMap< Key, Value, Compare >::LowerIndex( Leaf* leaf, const Key& key )
+{
+	int first = 0;
+	int count = leaf->count;
+	while( count > 0 )
+	{
+		int step = count / 2;
+		if( Compare::Less( leaf->entries[ first + step ].key, key ) )
+		{
+			first += step + 1;
+			count -= step + 1;
+		}
+		else
+		{
+			count = step;
+		}
+	}
+
+	return first;
+}
+
+//
+// UpperIndex
+//		- Will binary search a leaf for the first entry whose key orders after the key provided.
+// Inputs:
+//		- Leaf* leaf: The leaf to search.
+//		- const Key& key: The key to search for.
+// Outputs:
+//		- int: The index, the count of the leaf if no key orders after it.
+//
+
+template< class Key, class Value, class Compare >
+int TCBTreeMap< Key, Value, Compare >::UpperIndex( Leaf* leaf, const Key& key )
+{
+	int first = 0;
+	int count = leaf->count;
+	while( count > 0 )
+	{
+		int step = count / 2;
+		if( !Compare::Less( key, leaf->entries[ first + step ].key ) )
+		{
+			first += step + 1;
+			count -= step + 1;
+		}
+		else
+		{
+			count = step;
+		}
+	}
+
+	return first;
+}
+
+//
+// Iterator Constructor
+//		- Will point the iterator at an entry in a leaf, an index past the end of the leaf moves on to the next leaf.
+// Inputs:
+//		- Leaf* leaf: The leaf, NULL gives the end iterator.
+//		- int index: The index of the entry in the leaf.
+// Outputs:
+//		- None.
+//
+
+template< class Key, class Value, class Compare >
+TCBTreeMap< Key, Value, Compare >::Iterator::Iterator( Leaf* leaf, int index )
+	: mLeaf( leaf ), mIndex( index )
+{
+	while( mLeaf != NULL && mIndex >= mLeaf->count )
+	{
+		mLeaf	= mLeaf->next;
+		mIndex	= 0;
+	}
+}
+
+//
+// Iterator Increment
+//		- Will move the iterator to the entry with the next key.
+// Inputs:
+//		- None.
+// Outputs:
+//		- Iterator&: This iterator.
+//
+
+template< class Key, class Value, class Compare >
+typename TCBTreeMap< Key, Value, Compare >::Iterator& TCBTreeMap< Key, Value, Compare >::Iterator::operator++()
+{
+	mIndex++;
+	if( mIndex >= mLeaf->count )
+	{
+		mLeaf	= mLeaf->next;
+		mIndex	= 0;
+	}
+
+	return *this;
+}
+
+#endif // __TC_BTREE_MAP_HPP__
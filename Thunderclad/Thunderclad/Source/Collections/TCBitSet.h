@@ -0,0 +1,77 @@
+//
+// TCBitSet.h
+// This file will declare a fixed size set of bits.
+//
+
+#ifndef __TC_BIT_SET_H__
+#define __TC_BIT_SET_H__
+
+//
+// Includes
+//
+
+#include "TCBitUtils.h"
+
+//
+// Defines
+//
+
+//
+// Class Declaration
+//		- The bits are packed 64 to a word and live inside the object, so a TCBitSet never allocates.
+//		- Bits past Bits in the last word are always kept clear, Count and the bulk operations rely on it.
+//
+
+template< unsigned int Bits >
+class TCBitSet
+{
+	public:		// Members
+		enum { WordCount = TC_BIT_WORD_COUNT( Bits ) };
+
+	public:		// Methods
+									TCBitSet();
+
+		inline int					Size() const							{ return Bits; }
+		inline bool					Test( int bit ) const					{ TC_ASSERT( bit >= 0 && bit < (int)Bits ); return ( mWords[ TC_BIT_WORD_INDEX( bit ) ] & TC_BIT_WORD_MASK( bit ) ) != 0; }
+		inline bool					operator[]( int bit ) const				{ return Test( bit ); }
+
+		inline void					Set( int bit )							{ TC_ASSERT( bit >= 0 && bit < (int)Bits ); mWords[ TC_BIT_WORD_INDEX( bit ) ] |= TC_BIT_WORD_MASK( bit ); }
+		inline void					Set( int bit, bool value )				{ if( value ) Set( bit ); else Reset( bit ); }
+		inline void					Reset( int bit )						{ TC_ASSERT( bit >= 0 && bit < (int)Bits ); mWords[ TC_BIT_WORD_INDEX( bit ) ] &= ~TC_BIT_WORD_MASK( bit ); }
+		inline void					Flip( int bit )							{ TC_ASSERT( bit >= 0 && bit < (int)Bits ); mWords[ TC_BIT_WORD_INDEX( bit ) ] ^= TC_BIT_WORD_MASK( bit ); }
+
+		void						SetAll();
+		void						ResetAll();
+		void						FlipAll();
+
+		inline int					Count() const							{ return TCBitUtils::PopCount( mWords, WordCount ); }
+		inline bool					Any() const								{ return TCBitUtils::Any( mWords, WordCount ); }
+		inline bool					None() const							{ return !Any(); }
+		inline bool					All() const								{ return Count() == (int)Bits; }
+		inline int					FindFirstSet( int startBit = 0 ) const	{ return TCBitUtils::FindFirstSet( mWords, WordCount, startBit ); }
+
+		inline TCBitSet&			operator&=( const TCBitSet& rhs )		{ TCBitUtils::And( mWords, rhs.mWords, WordCount ); return *this; }
+		inline TCBitSet&			operator|=( const TCBitSet& rhs )		{ TCBitUtils::Or( mWords, rhs.mWords, WordCount ); return *this; }
+		inline TCBitSet&			operator^=( const TCBitSet& rhs )		{ TCBitUtils::Xor( mWords, rhs.mWords, WordCount ); return *this; }
+		inline TCBitSet&			AndNot( const TCBitSet& rhs )			{ TCBitUtils::AndNot( mWords, rhs.mWords, WordCount ); return *this; }
+
+		inline bool					operator==( const TCBitSet& rhs ) const	{ return TCBitUtils::Equal( mWords, rhs.mWords, WordCount ); }
+		inline bool					operator!=( const TCBitSet& rhs ) const	{ return !( *this == rhs ); }
+
+		inline TCBitWord*			GetWords()								{ return mWords; }
+		inline const TCBitWord*		GetWords() const						{ return mWords; }
+
+		// Lower case so bit sets work with range-for, visits the index of every set bit in order.
+		inline TCBitIterator		begin() const							{ return TCBitIterator( mWords, WordCount, 0 ); }
+		inline TCBitIterator		end() const								{ return TCBitIterator( mWords, WordCount, WordCount ); }
+
+	private:	// Members
+		TCBitWord					mWords[ WordCount ];
+
+	private:	// Methods
+		void						ClearUnusedBits();
+};
+
+#include "TCBitSet.hpp"
+
+#endif // __TC_BIT_SET_H__
@@ -0,0 +1,99 @@
+//
+// TCBitSet.hpp
+// This file will define the methods declared for a fixed size set of bits.
+//
+
+#ifndef __TC_BIT_SET_HPP__
+#define __TC_BIT_SET_HPP__
+
+//
+// Includes
+//
+
+#include "TCBitSet.h"
+
+//
+// Defines
+//
+
+//
+// Default Constructor
+//		- Initializes every bit to clear.
+// Inputs:
+//		- None.
+// Outputs:
+//		- None.
+//
+
+template< unsigned int Bits >
+TCBitSet< Bits >::TCBitSet()
+{
+	TCBitUtils::Fill( mWords, WordCount, false );
+}
+
+//
+// SetAll
+//		- Will set every bit.
+// Inputs:
+//		- None.
+// Outputs:
+//		- None.
+//
+
+template< unsigned int Bits >
+void TCBitSet< Bits >::SetAll()
+{
+	TCBitUtils::Fill( mWords, WordCount, true );
+	ClearUnusedBits();
+}
+
+//
+// ResetAll
+//		- Will clear every bit.
+// Inputs:
+//		- None.
+// Outputs:
+//		- None.
+//
+
+template< unsigned int Bits >
+void TCBitSet< Bits >::ResetAll()
+{
+	TCBitUtils::Fill( mWords, WordCount, false );
+}
+
+//
+// FlipAll
+//		- Will flip every bit.
+// Inputs:
+//		- None.
+// Outputs:
+//		- None.
+//
+
+template< unsigned int Bits >
+void TCBitSet< Bits >::FlipAll()
+{
+	TCBitUtils::Not( mWords, WordCount );
+	ClearUnusedBits();
+}
+
+//
+// ClearUnusedBits
+//		- Will clear the bits in the last word that are past the end of the set.
+// Inputs:
+//		- None.
+// Outputs:
+//		- None.
+//
+
+template< unsigned int Bits >
+void TCBitSet< Bits >::ClearUnusedBits()
+{
+	if( Bits % TC_BITS_PER_WORD != 0 )
+	{
+		mWords[ WordCount - 1 ] &= TC_BIT_WORD_MASK( Bits ) - 1;
+	}
+}
+
+#endif // __TC_BIT_SET_HPP__
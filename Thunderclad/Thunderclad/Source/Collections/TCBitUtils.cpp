@@ -0,0 +1,283 @@
+//
+// TCBitUtils.cpp
+// This file will define the word level helpers shared by the bit containers.
+//
+
+//
+// Includes
+//
+
+#include "TCBitUtils.h"
+#include "TCCPUFeatures.h"
+
+#include <string.h>
+
+#if TC_PLATFORM_WIN32
+	#include <emmintrin.h>
+	#include <immintrin.h>
+#endif
+
+//
+// Defines
+//
+
+//
+// Bulk Operations
+//		- Each operation can be applied to a word, an SSE2 register or an AVX2 register.
+//
+
+struct TCBitAndOp
+{
+	static inline TCBitWord	Apply( TCBitWord dest, TCBitWord source )	{ return dest & source; }
+#if TC_PLATFORM_WIN32
+	static inline __m128i	Apply( __m128i dest, __m128i source )		{ return _mm_and_si128( dest, source ); }
+	static inline __m256i	Apply( __m256i dest, __m256i source )		{ return _mm256_and_si256( dest, source ); }
+#endif
+};
+
+struct TCBitOrOp
+{
+	static inline TCBitWord	Apply( TCBitWord dest, TCBitWord source )	{ return dest | source; }
+#if TC_PLATFORM_WIN32
+	static inline __m128i	Apply( __m128i dest, __m128i source )		{ return _mm_or_si128( dest, source ); }
+	static inline __m256i	Apply( __m256i dest, __m256i source )		{ return _mm256_or_si256( dest, source ); }
+#endif
+};
+
+struct TCBitXorOp
+{
+	static inline TCBitWord	Apply( TCBitWord dest, TCBitWord source )	{ return dest ^ source; }
+#if TC_PLATFORM_WIN32
+	static inline __m128i	Apply( __m128i dest, __m128i source )		{ return _mm_xor_si128( dest, source ); }
+	static inline __m256i	Apply( __m256i dest, __m256i source )		{ return _mm256_xor_si256( dest, source ); }
+#endif
+};
+
+struct TCBitAndNotOp
+{
+	static inline TCBitWord	Apply( TCBitWord dest, TCBitWord source )	{ return dest & ~source; }
+#if TC_PLATFORM_WIN32
+	static inline __m128i	Apply( __m128i dest, __m128i source )		{ return _mm_andnot_si128( source, dest ); }
+	static inline __m256i	Apply( __m256i dest, __m256i source )		{ return _mm256_andnot_si256( source, dest ); }
+#endif
+};
+
+//
+// ApplyWords
+//		- Will combine two runs of words, 4 words at a time with AVX2, then 2 at a time with SSE2, then one at a time.
+//
+
+template< class Op >
+static void ApplyWords( TCBitWord* dest, const TCBitWord* source, int wordCount )
+{
+	TC_ASSERT( ( dest != NULL && source != NULL ) || wordCount == 0 );
+
+	int currentWord = 0;
+
+#if TC_PLATFORM_WIN32
+	if( wordCount >= 4 && TCCPUFeatures::HasAVX2() )
+	{
+		for( ; currentWord + 4 <= wordCount; currentWord += 4 )
+		{
+			__m256i destBits	= _mm256_loadu_si256( (const __m256i*)( dest + currentWord ) );
+			__m256i sourceBits	= _mm256_loadu_si256( (const __m256i*)( source + currentWord ) );
+			_mm256_storeu_si256( (__m256i*)( dest + currentWord ), Op::Apply( destBits, sourceBits ) );
+		}
+
+		// Avoid the penalty for switching back to SSE code with the upper halves dirty.
+		_mm256_zeroupper();
+	}
+
+	for( ; currentWord + 2 <= wordCount; currentWord += 2 )
+	{
+		__m128i destBits	= _mm_loadu_si128( (const __m128i*)( dest + currentWord ) );
+		__m128i sourceBits	= _mm_loadu_si128( (const __m128i*)( source + currentWord ) );
+		_mm_storeu_si128( (__m128i*)( dest + currentWord ), Op::Apply( destBits, sourceBits ) );
+	}
+#endif
+
+	for( ; currentWord < wordCount; ++currentWord )
+	{
+		dest[ currentWord ] = Op::Apply( dest[ currentWord ], source[ currentWord ] );
+	}
+}
+
+namespace TCBitUtils
+{
+	//
+	// PopCount
+	//		- Will count the set bits in a run of words.
+	// Inputs:
+	//		- const TCBitWord* words: The words to count.
+	//		- int wordCount: The number of words.
+	// Outputs:
+	//		- int: The number of set bits.
+	//
+
+	int PopCount( const TCBitWord* words, int wordCount )
+	{
+		TC_ASSERT( words != NULL || wordCount == 0 );
+
+		int count = 0;
+
+#if TC_PLATFORM_WIN32
+		if( TCCPUFeatures::HasPopCnt() )
+		{
+			for( int currentWord = 0; currentWord < wordCount; ++currentWord )
+			{
+			#if defined( _M_X64 )
+				count += (int)__popcnt64( words[ currentWord ] );
+			#else
+				count += (int)__popcnt( (unsigned int)words[ currentWord ] ) + (int)__popcnt( (unsigned int)( words[ currentWord ] >> 32 ) );
+			#endif
+			}
+
+			return count;
+		}
+#endif
+
+		for( int currentWord = 0; currentWord < wordCount; ++currentWord )
+		{
+			count += PopCount( words[ currentWord ] );
+		}
+
+		return count;
+	}
+
+	//
+	// FindFirstSet
+	//		- Will find the first set bit at or after a starting bit.
+	// Inputs:
+	//		- const TCBitWord* words: The words to search.
+	//		- int wordCount: The number of words.
+	//		- int startBit: The first bit to look at.
+	// Outputs:
+	//		- int: The index of the set bit, -1 if there is none.
+	//
+
+	int FindFirstSet( const TCBitWord* words, int wordCount, int startBit )
+	{
+		TC_ASSERT( startBit >= 0 );
+
+		int currentWord = TC_BIT_WORD_INDEX( startBit );
+		if( currentWord >= wordCount )
+			return -1;
+
+		// Mask off the bits before the start in the first word.
+		TCBitWord word = words[ currentWord ] & ( ~(TCBitWord)0 << ( startBit % TC_BITS_PER_WORD ) );
+		while( word == 0 )
+		{
+			if( ++currentWord >= wordCount )
+				return -1;
+
+			word = words[ currentWord ];
+		}
+
+		return currentWord * TC_BITS_PER_WORD + CountTrailingZeros( word );
+	}
+
+	//
+	// Any
+	//		- Will tell if any bit is set in a run of words.
+	// Inputs:
+	//		- const TCBitWord* words: The words to check.
+	//		- int wordCount: The number of words.
+	// Outputs:
+	//		- bool: Is any bit set.
+	//
+
+	bool Any( const TCBitWord* words, int wordCount )
+	{
+		for( int currentWord = 0; currentWord < wordCount; ++currentWord )
+		{
+			if( words[ currentWord ] != 0 )
+				return true;
+		}
+
+		return false;
+	}
+
+	//
+	// Equal
+	//		- Will compare two runs of words.
+	// Inputs:
+	//		- const TCBitWord* lhs: The first words.
+	//		- const TCBitWord* rhs: The second words.
+	//		- int wordCount: The number of words in each.
+	// Outputs:
+	//		- bool: Are the words the same.
+	//
+
+	bool Equal( const TCBitWord* lhs, const TCBitWord* rhs, int wordCount )
+	{
+		return wordCount == 0 || memcmp( lhs, rhs, wordCount * sizeof( TCBitWord ) ) == 0;
+	}
+
+	//
+	// Fill
+	//		- Will set or clear every bit in a run of words.
+	// Inputs:
+	//		- TCBitWord* dest: The words to fill.
+	//		- int wordCount: The number of words.
+	//		- bool value: Set or clear.
+	// Outputs:
+	//		- None.
+	//
+
+	void Fill( TCBitWord* dest, int wordCount, bool value )
+	{
+		if( wordCount > 0 )
+		{
+			memset( dest, value ? 0xFF : 0x00, wordCount * sizeof( TCBitWord ) );
+		}
+	}
+
+	//
+	// And, Or, Xor, AndNot
+	//		- Will combine a run of words into another run of the same length.
+	// Inputs:
+	//		- TCBitWord* dest: The words to update.
+	//		- const TCBitWord* source: The words to combine with.
+	//		- int wordCount: The number of words in each.
+	// Outputs:
+	//		- None.
+	//
+
+	void And( TCBitWord* dest, const TCBitWord* source, int wordCount )
+	{
+		ApplyWords< TCBitAndOp >( dest, source, wordCount );
+	}
+
+	void Or( TCBitWord* dest, const TCBitWord* source, int wordCount )
+	{
+		ApplyWords< TCBitOrOp >( dest, source, wordCount );
+	}
+
+	void Xor( TCBitWord* dest, const TCBitWord* source, int wordCount )
+	{
+		ApplyWords< TCBitXorOp >( dest, source, wordCount );
+	}
+
+	void AndNot( TCBitWord* dest, const TCBitWord* source, int wordCount )
+	{
+		ApplyWords< TCBitAndNotOp >( dest, source, wordCount );
+	}
+
+	//
+	// Not
+	//		- Will flip every bit in a run of words.
+	// Inputs:
+	//		- TCBitWord* dest: The words to flip.
+	//		- int wordCount: The number of words.
+	// Outputs:
+	//		- None.
+	//
+
+	void Not( TCBitWord* dest, int wordCount )
+	{
+		for( int currentWord = 0; currentWord < wordCount; ++currentWord )
+		{
+			dest[ currentWord ] = ~dest[ currentWord ];
+		}
+	}
+}
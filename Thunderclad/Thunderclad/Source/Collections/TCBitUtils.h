@@ -0,0 +1,153 @@
+//
+// TCBitUtils.h
+// This file will declare the word level helpers shared by the bit containers.
+//
+
+#ifndef __TC_BIT_UTILS_H__
+#define __TC_BIT_UTILS_H__
+
+//
+// Includes
+//
+
+#include "TCPlatformPrecompilerSymbols.h"
+
+#include <stddef.h>
+#include <iterator>
+
+#if TC_PLATFORM_WIN32
+	#include <intrin.h>
+#endif
+
+//
+// Defines
+//
+
+typedef unsigned long long TCBitWord;
+
+#define TC_BITS_PER_WORD				(64)
+#define TC_BIT_WORD_COUNT( bits )		( ( (bits) + TC_BITS_PER_WORD - 1 ) / TC_BITS_PER_WORD )
+#define TC_BIT_WORD_INDEX( bit )		( (bit) / TC_BITS_PER_WORD )
+#define TC_BIT_WORD_MASK( bit )			( (TCBitWord)1 << ( (bit) % TC_BITS_PER_WORD ) )
+
+namespace TCBitUtils
+{
+	//
+	// Single word helpers.
+	//
+
+	inline int CountTrailingZeros( TCBitWord word )		// The word must not be zero.
+	{
+		TC_ASSERT( word != 0 );
+
+	#if TC_PLATFORM_WIN32
+		unsigned long index;
+		#if defined( _M_X64 )
+			_BitScanForward64( &index, word );
+			return (int)index;
+		#else
+			if( _BitScanForward( &index, (unsigned long)word ) )
+				return (int)index;
+
+			_BitScanForward( &index, (unsigned long)( word >> 32 ) );
+			return (int)index + 32;
+		#endif
+	#else
+		return __builtin_ctzll( word );
+	#endif
+	}
+
+	inline int CountLeadingZeros( TCBitWord word )		// The word must not be zero.
+	{
+		TC_ASSERT( word != 0 );
+
+	#if TC_PLATFORM_WIN32
+		unsigned long index;
+		#if defined( _M_X64 )
+			_BitScanReverse64( &index, word );
+			return 63 - (int)index;
+		#else
+			if( _BitScanReverse( &index, (unsigned long)( word >> 32 ) ) )
+				return 31 - (int)index;
+
+			_BitScanReverse( &index, (unsigned long)word );
+			return 63 - (int)index;
+		#endif
+	#else
+		return __builtin_clzll( word );
+	#endif
+	}
+
+	inline int PopCount( TCBitWord word )
+	{
+		word = word - ( ( word >> 1 ) & 0x5555555555555555ULL );
+		word = ( word & 0x3333333333333333ULL ) + ( ( word >> 2 ) & 0x3333333333333333ULL );
+		word = ( word + ( word >> 4 ) ) & 0x0F0F0F0F0F0F0F0FULL;
+		return (int)( ( word * 0x0101010101010101ULL ) >> 56 );
+	}
+
+	//
+	// Whole array helpers, these use POPCNT, SSE2 and AVX2 when the cpu has them.
+	//
+
+	int		PopCount( const TCBitWord* words, int wordCount );
+	int		FindFirstSet( const TCBitWord* words, int wordCount, int startBit );	// -1 when no bit at or after startBit is set.
+	bool	Any( const TCBitWord* words, int wordCount );
+	bool	Equal( const TCBitWord* lhs, const TCBitWord* rhs, int wordCount );
+
+	void	Fill( TCBitWord* dest, int wordCount, bool value );
+	void	And( TCBitWord* dest, const TCBitWord* source, int wordCount );			// dest &= source
+	void	Or( TCBitWord* dest, const TCBitWord* source, int wordCount );			// dest |= source
+	void	Xor( TCBitWord* dest, const TCBitWord* source, int wordCount );			// dest ^= source
+	void	AndNot( TCBitWord* dest, const TCBitWord* source, int wordCount );		// dest &= ~source
+	void	Not( TCBitWord* dest, int wordCount );									// dest = ~dest
+}
+
+//
+// TCBitIterator
+//		- Walks the indices of the set bits in a run of words, skipping a whole word of clear bits at a time.
+//
+
+class TCBitIterator
+{
+	public:		// Members
+		typedef std::forward_iterator_tag	iterator_category;
+		typedef int							value_type;
+		typedef ptrdiff_t					difference_type;
+		typedef const int*					pointer;
+		typedef int							reference;
+
+	public:		// Methods
+		TCBitIterator( const TCBitWord* words, int wordCount, int wordIndex )
+			: mWords( words ), mWordCount( wordCount ), mWordIndex( wordIndex ), mCurrent( 0 )
+		{
+			if( mWordIndex < mWordCount )
+			{
+				mCurrent = mWords[ mWordIndex ];
+				SkipClearWords();
+			}
+		}
+
+		int				operator*() const							{ return mWordIndex * TC_BITS_PER_WORD + TCBitUtils::CountTrailingZeros( mCurrent ); }
+		TCBitIterator&	operator++()								{ mCurrent &= mCurrent - 1; SkipClearWords(); return *this; }
+		TCBitIterator	operator++( int )							{ TCBitIterator previous = *this; ++(*this); return previous; }
+		bool			operator==( const TCBitIterator& rhs ) const	{ return mWordIndex == rhs.mWordIndex && mCurrent == rhs.mCurrent; }
+		bool			operator!=( const TCBitIterator& rhs ) const	{ return !( *this == rhs ); }
+
+	private:	// Members
+		const TCBitWord*	mWords;
+		int					mWordCount;
+		int					mWordIndex;
+		TCBitWord			mCurrent;		// The bits of the current word that haven't been visited yet.
+
+	private:	// Methods
+		void SkipClearWords()
+		{
+			while( mCurrent == 0 && ++mWordIndex < mWordCount )
+			{
+				mCurrent = mWords[ mWordIndex ];
+			}
+		}
+};
+
+#endif // __TC_BIT_UTILS_H__
@@ -0,0 +1,68 @@
+//
+// TCCompareTraits.h
+// This file will define how keys are ordered by the sorted collections.
+//
+
+#ifndef __TC_COMPARE_TRAITS_H__
+#define __TC_COMPARE_TRAITS_H__
+
+//
+// Includes
+//
+
+#include "TCPlatformPrecompilerSymbols.h"
+#include "TCString.h"
+#include "TCStringUtils.h"
+
+//
+// Defines
+//
+
+//
+// TCLess
+//		- Will determine if one key orders before another, two keys are the same key when neither orders first.
+//		- By default operator< is used, types without one should specialize this.
+//
+
+template< typename Key >
+struct TCLess
+{
+	static inline bool Less( const Key& lhs, const Key& rhs )
+	{
+		return lhs < rhs;
+	}
+};
+
+//
+// String Specializations
+//		- Strings order by their characters, not their addresses.
+//
+
+template<>
+struct TCLess< const char8* >
+{
+	static inline bool Less( const char8* const& lhs, const char8* const& rhs )
+	{
+		return TCStringUtils::Compare( lhs, rhs ) < 0;
+	}
+};
+
+template<>
+struct TCLess< char8* >
+{
+	static inline bool Less( char8* const& lhs, char8* const& rhs )
+	{
+		return TCStringUtils::Compare( lhs, rhs ) < 0;
+	}
+};
+
+template<>
+struct TCLess< TCString >
+{
+	static inline bool Less( const TCString& lhs, const TCString& rhs )
+	{
+		return lhs.Compare( rhs ) < 0;
+	}
+};
+
+#endif // __TC_COMPARE_TRAITS_H__
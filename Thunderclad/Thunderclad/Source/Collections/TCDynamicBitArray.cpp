@@ -0,0 +1,379 @@
+//
+// TCDynamicBitArray.cpp
+// This file will define the methods declared for a set of bits that can be resized at run time.
+//
+
+//
+// Includes
+//
+
+#include "TCDynamicBitArray.h"
+#include "TCMemUtils.h"
+
+#include <string.h>
+
+//
+// Defines
+//
+
+//
+// Default Constructor
+//		- Initializes the array to a safe, empty state.
+// Inputs:
+//		- None.
+// Outputs:
+//		- None.
+//
+
+TCDynamicBitArray::TCDynamicBitArray()
+{
+	mWords			= NULL;
+	mSize			= 0;
+	mCapacityWords	= 0;
+}
+
+//
+// Constructor
+//		- Initializes the array to a number of bits.
+// Inputs:
+//		- int size: The number of bits.
+//		- bool value: The value of every bit.
+// Outputs:
+//		- None.
+//
+
+TCDynamicBitArray::TCDynamicBitArray( int size, bool value )
+{
+	mWords			= NULL;
+	mSize			= 0;
+	mCapacityWords	= 0;
+
+	Resize( size, value );
+}
+
+//
+// Copy Constructor
+//		- Will initialize this array to be a copy of another array.
+// Inputs:
+//		- const TCDynamicBitArray& inRef: The array to copy.
+// Outputs:
+//		- None.
+//
+
+TCDynamicBitArray::TCDynamicBitArray( const TCDynamicBitArray& inRef )
+{
+	mWords			= NULL;
+	mSize			= 0;
+	mCapacityWords	= 0;
+
+	Clone( inRef );
+}
+
+//
+// Move Constructor
+//		- Will take the words from another array, leaving it empty.
+// Inputs:
+//		- TCDynamicBitArray&& inRef: The array to move from.
+// Outputs:
+//		- None.
+//
+
+TCDynamicBitArray::TCDynamicBitArray( TCDynamicBitArray&& inRef )
+{
+	mWords			= inRef.mWords;
+	mSize			= inRef.mSize;
+	mCapacityWords	= inRef.mCapacityWords;
+
+	inRef.mWords			= NULL;
+	inRef.mSize				= 0;
+	inRef.mCapacityWords	= 0;
+}
+
+//
+// Destructor
+//		- Will release the words.
+// Inputs:
+//		- None.
+// Outputs:
+//		- None.
+//
+
+TCDynamicBitArray::~TCDynamicBitArray()
+{
+	CleanUp();
+}
+
+//
+// Assignment Operator
+//		- Will set this array equal to another array.
+// Inputs:
+//		- const TCDynamicBitArray& inRef: The array to copy.
+// Outputs:
+//		- TCDynamicBitArray&: This array.
+//
+
+TCDynamicBitArray& TCDynamicBitArray::operator=( const TCDynamicBitArray& inRef )
+{
+	if( this != &inRef )
+	{
+		Clone( inRef );
+	}
+
+	return *this;
+}
+
+//
+// Move Assignment Operator
+//		- Will take the words from another array, leaving it empty.
+// Inputs:
+//		- TCDynamicBitArray&& inRef: The array to move from.
+// Outputs:
+//		- TCDynamicBitArray&: This array.
+//
+
+TCDynamicBitArray& TCDynamicBitArray::operator=( TCDynamicBitArray&& inRef )
+{
+	if( this != &inRef )
+	{
+		CleanUp();
+
+		mWords			= inRef.mWords;
+		mSize			= inRef.mSize;
+		mCapacityWords	= inRef.mCapacityWords;
+
+		inRef.mWords			= NULL;
+		inRef.mSize				= 0;
+		inRef.mCapacityWords	= 0;
+	}
+
+	return *this;
+}
+
+//
+// Resize
+//		- Will change the number of bits, the words are only reallocated when the array grows past its capacity.
+// Inputs:
+//		- int size: The new number of bits.
+//		- bool value: The value of any bits added to the end.
+// Outputs:
+//		- None.
+//
+
+void TCDynamicBitArray::Resize( int size, bool value )
+{
+	TC_ASSERT( size >= 0 );
+
+	int oldSize			= mSize;
+	int oldWordCount	= WordCount();
+	int newWordCount	= TC_BIT_WORD_COUNT( size );
+
+	//
+	// Grow the words, doubling so repeated resizes stay cheap.
+	//
+
+	if( newWordCount > mCapacityWords )
+	{
+		int newCapacity = mCapacityWords * 2;
+		if( newCapacity < newWordCount )
+		{
+			newCapacity = newWordCount;
+		}
+
+		TCBitWord* newWords = new TCBitWord[ newCapacity ];
+		if( oldWordCount > 0 )
+		{
+			memcpy( newWords, mWords, oldWordCount * sizeof( TCBitWord ) );
+		}
+
+		TC_SAFE_DELETE_ARRAY( mWords );
+		mWords			= newWords;
+		mCapacityWords	= newCapacity;
+	}
+
+	//
+	// Fill in the added bits, the words past the old end may hold stale bits from before a shrink.
+	//
+
+	if( size > oldSize )
+	{
+		TCBitUtils::Fill( mWords + oldWordCount, newWordCount - oldWordCount, value );
+
+		if( value && oldSize % TC_BITS_PER_WORD != 0 )
+		{
+			mWords[ oldWordCount - 1 ] |= ~( TC_BIT_WORD_MASK( oldSize ) - 1 );
+		}
+	}
+
+	mSize = size;
+	ClearUnusedBits();
+}
+
+//
+// Clear
+//		- Will remove every bit, the words are kept for reuse.
+// Inputs:
+//		- None.
+// Outputs:
+//		- None.
+//
+
+void TCDynamicBitArray::Clear()
+{
+	mSize = 0;
+}
+
+//
+// SetAll
+//		- Will set every bit.
+// Inputs:
+//		- None.
+// Outputs:
+//		- None.
+//
+
+void TCDynamicBitArray::SetAll()
+{
+	TCBitUtils::Fill( mWords, WordCount(), true );
+	ClearUnusedBits();
+}
+
+//
+// ResetAll
+//		- Will clear every bit.
+// Inputs:
+//		- None.
+// Outputs:
+//		- None.
+//
+
+void TCDynamicBitArray::ResetAll()
+{
+	TCBitUtils::Fill( mWords, WordCount(), false );
+}
+
+//
+// FlipAll
+//		- Will flip every bit.
+// Inputs:
+//		- None.
+// Outputs:
+//		- None.
+//
+
+void TCDynamicBitArray::FlipAll()
+{
+	TCBitUtils::Not( mWords, WordCount() );
+	ClearUnusedBits();
+}
+
+//
+// Bulk Operators
+//		- Will combine another array of the same size into this one.
+// Inputs:
+//		- const TCDynamicBitArray& rhs: The array to combine with.
+// Outputs:
+//		- TCDynamicBitArray&: This array.
+//
+
+TCDynamicBitArray& TCDynamicBitArray::operator&=( const TCDynamicBitArray& rhs )
+{
+	TC_ASSERT( mSize == rhs.mSize && "Bit arrays must be the same size" );
+	TCBitUtils::And( mWords, rhs.mWords, WordCount() );
+	return *this;
+}
+
+TCDynamicBitArray& TCDynamicBitArray::operator|=( const TCDynamicBitArray& rhs )
+{
+	TC_ASSERT( mSize == rhs.mSize && "Bit arrays must be the same size" );
+	TCBitUtils::Or( mWords, rhs.mWords, WordCount() );
+	return *this;
+}
+
+TCDynamicBitArray& TCDynamicBitArray::operator^=( const TCDynamicBitArray& rhs )
+{
+	TC_ASSERT( mSize == rhs.mSize && "Bit arrays must be the same size" );
+	TCBitUtils::Xor( mWords, rhs.mWords, WordCount() );
+	return *this;
+}
+
+TCDynamicBitArray& TCDynamicBitArray::AndNot( const TCDynamicBitArray& rhs )
+{
+	TC_ASSERT( mSize == rhs.mSize && "Bit arrays must be the same size" );
+	TCBitUtils::AndNot( mWords, rhs.mWords, WordCount() );
+	return *this;
+}
+
+//
+// Equality Operator
+//		- Will compare two arrays.
+// Inputs:
+//		- const TCDynamicBitArray& rhs: The array to compare with.
+// Outputs:
+//		- bool: Do the arrays have the same size and bits.
+//
+
+bool TCDynamicBitArray::operator==( const TCDynamicBitArray& rhs ) const
+{
+	return mSize == rhs.mSize && TCBitUtils::Equal( mWords, rhs.mWords, WordCount() );
+}
+
+//
+// Clone
+//		- Will copy another array, reusing the words when they are big enough.
+// Inputs:
+//		- const TCDynamicBitArray& inRef: The array to copy.
+// Outputs:
+//		- None.
+//
+
+void TCDynamicBitArray::Clone( const TCDynamicBitArray& inRef )
+{
+	int wordCount = inRef.WordCount();
+	if( wordCount > mCapacityWords )
+	{
+		CleanUp();
+
+		mWords			= new TCBitWord[ wordCount ];
+		mCapacityWords	= wordCount;
+	}
+
+	if( wordCount > 0 )
+	{
+		memcpy( mWords, inRef.mWords, wordCount * sizeof( TCBitWord ) );
+	}
+
+	mSize = inRef.mSize;
+}
+
+//
+// CleanUp
+//		- Will release the words.
+// Inputs:
+//		- None.
+// Outputs:
+//		- None.
+//
+
+void TCDynamicBitArray::CleanUp()
+{
+	TC_SAFE_DELETE_ARRAY( mWords );
+	mSize			= 0;
+	mCapacityWords	= 0;
+}
+
+//
+// ClearUnusedBits
+//		- Will clear the bits in the last word that are past the end of the array.
+// Inputs:
+//		- None.
+// Outputs:
+//		- None.
+//
+
+void TCDynamicBitArray::ClearUnusedBits()
+{
+	if( mSize % TC_BITS_PER_WORD != 0 )
+	{
+		mWords[ WordCount() - 1 ] &= TC_BIT_WORD_MASK( mSize ) - 1;
+	}
+}
@@ -0,0 +1,89 @@
+//
+// TCDynamicBitArray.h
+// This file will declare a set of bits that can be resized at run time.
+//
+
+#ifndef __TC_DYNAMIC_BIT_ARRAY_H__
+#define __TC_DYNAMIC_BIT_ARRAY_H__
+
+//
+// Includes
+//
+
+#include "TCBitUtils.h"
+
+//
+// Defines
+//
+
+//
+// Class Declaration
+//		- The bits are packed 64 to a word in one heap block, which only grows, so resizing down and back up doesn't allocate.
+//		- Bits past Size() in the last word are always kept clear, Count and the bulk operations rely on it.
+//		- The bulk operations expect both arrays to be the same size.
+//
+
+class TCDynamicBitArray
+{
+	public:		// Members
+	public:		// Methods
+									TCDynamicBitArray();
+									TCDynamicBitArray( int size, bool value = false );
+									TCDynamicBitArray( const TCDynamicBitArray& inRef );
+									TCDynamicBitArray( TCDynamicBitArray&& inRef );
+									~TCDynamicBitArray();
+
+		TCDynamicBitArray&			operator=( const TCDynamicBitArray& inRef );
+		TCDynamicBitArray&			operator=( TCDynamicBitArray&& inRef );
+
+		inline int					Size() const							{ return mSize; }
+		inline bool					IsEmpty() const							{ return mSize == 0; }
+		void						Resize( int size, bool value = false );
+		void						Clear();
+
+		inline bool					Test( int bit ) const					{ TC_ASSERT( bit >= 0 && bit < mSize ); return ( mWords[ TC_BIT_WORD_INDEX( bit ) ] & TC_BIT_WORD_MASK( bit ) ) != 0; }
+		inline bool					operator[]( int bit ) const				{ return Test( bit ); }
+
+		inline void					Set( int bit )							{ TC_ASSERT( bit >= 0 && bit < mSize ); mWords[ TC_BIT_WORD_INDEX( bit ) ] |= TC_BIT_WORD_MASK( bit ); }
+		inline void					Set( int bit, bool value )				{ if( value ) Set( bit ); else Reset( bit ); }
+		inline void					Reset( int bit )						{ TC_ASSERT( bit >= 0 && bit < mSize ); mWords[ TC_BIT_WORD_INDEX( bit ) ] &= ~TC_BIT_WORD_MASK( bit ); }
+		inline void					Flip( int bit )							{ TC_ASSERT( bit >= 0 && bit < mSize ); mWords[ TC_BIT_WORD_INDEX( bit ) ] ^= TC_BIT_WORD_MASK( bit ); }
+
+		void						SetAll();
+		void						ResetAll();
+		void						FlipAll();
+
+		inline int					Count() const							{ return TCBitUtils::PopCount( mWords, WordCount() ); }
+		inline bool					Any() const								{ return TCBitUtils::Any( mWords, WordCount() ); }
+		inline bool					None() const							{ return !Any(); }
+		inline bool					All() const								{ return Count() == mSize; }
+		inline int					FindFirstSet( int startBit = 0 ) const	{ return TCBitUtils::FindFirstSet( mWords, WordCount(), startBit ); }
+
+		TCDynamicBitArray&			operator&=( const TCDynamicBitArray& rhs );
+		TCDynamicBitArray&			operator|=( const TCDynamicBitArray& rhs );
+		TCDynamicBitArray&			operator^=( const TCDynamicBitArray& rhs );
+		TCDynamicBitArray&			AndNot( const TCDynamicBitArray& rhs );
+
+		bool						operator==( const TCDynamicBitArray& rhs ) const;
+		inline bool					operator!=( const TCDynamicBitArray& rhs ) const	{ return !( *this == rhs ); }
+
+		inline int					WordCount() const						{ return TC_BIT_WORD_COUNT( mSize ); }
+		inline TCBitWord*			GetWords()								{ return mWords; }
+		inline const TCBitWord*		GetWords() const						{ return mWords; }
+
+		// Lower case so bit arrays work with range-for, visits the index of every set bit in order.
+		inline TCBitIterator		begin() const							{ return TCBitIterator( mWords, WordCount(), 0 ); }
+		inline TCBitIterator		end() const								{ return TCBitIterator( mWords, WordCount(), WordCount() ); }
+
+	private:	// Members
+		TCBitWord*					mWords;
+		int							mSize;
+		int							mCapacityWords;
+
+	private:	// Methods
+		void						Clone( const TCDynamicBitArray& inRef );
+		void						CleanUp();
+		void						ClearUnusedBits();
+};
+
+#endif // __TC_DYNAMIC_BIT_ARRAY_H__
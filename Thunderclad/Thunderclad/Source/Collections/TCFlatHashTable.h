@@ -0,0 +1,115 @@
+//
+// TCFlatHashTable.h
+// This file will declare an open addressing hash table that stores all of its entries in one contiguous block.
+//
+
+#ifndef __TC_FLAT_HASH_TABLE_H__
+#define __TC_FLAT_HASH_TABLE_H__
+
+//
+// Includes
+//
+
+#include "TCPlatformPrecompilerSymbols.h"
+#include "TCHashFunctions.h"
+#include "TCHashTraits.h"
+
+#include <stddef.h>
+#include <iterator>
+
+//
+// Defines
+//
+
+//
+// Class Declaration
+//		- Entries are placed with Robin Hood hashing, every slot remembers how far it is from its ideal slot
+//		  so lookups can stop as soon as they pass a slot that is closer to home than the key would be.
+//		- Removal shifts the following entries back a slot instead of leaving tombstones behind.
+//		- Keys are hashed and compared through TCHash and TCEqual.
+//		- Iterating the table walks the slots in order and visits each entry once, in no particular order.
+//
+
+template< typename Key, typename Value >
+class TCFlatHashTable
+{
+	public:		// Members
+		class Entry
+		{
+			public:
+				Key		key;
+				Value	value;
+
+				Entry( const Key& inKey, const Value& inValue ) : key( inKey ), value( inValue ) {}
+		};
+
+		class Iterator
+		{
+			public:		// Members
+				typedef std::forward_iterator_tag	iterator_category;
+				typedef Entry						value_type;
+				typedef ptrdiff_t					difference_type;
+				typedef Entry*						pointer;
+				typedef Entry&						reference;
+
+			public:		// Methods
+								Iterator()								: mTable( NULL ), mSlot( 0 ) {}
+								Iterator( TCFlatHashTable* table, unsigned int slot );
+
+				Entry&			operator*() const						{ return mTable->mEntries[ mSlot ]; }
+				Entry*			operator->() const						{ return &mTable->mEntries[ mSlot ]; }
+				Iterator&		operator++();
+				Iterator		operator++( int )						{ Iterator previous = *this; ++(*this); return previous; }
+				bool			operator==( const Iterator& rhs ) const	{ return mSlot == rhs.mSlot; }
+				bool			operator!=( const Iterator& rhs ) const	{ return mSlot != rhs.mSlot; }
+
+			private:	// Members
+				TCFlatHashTable*	mTable;
+				unsigned int		mSlot;
+
+			private:	// Methods
+				void			SkipEmptySlots();
+		};
+
+	public:		// Methods
+
+							TCFlatHashTable( unsigned int capacity = 0, TCHashFunction func = TCHashFunctions::OneAtATimeHash );
+							TCFlatHashTable( const TCFlatHashTable& table );
+		TCFlatHashTable&	operator=( const TCFlatHashTable& table );
+							~TCFlatHashTable();
+
+		void				Clone( const TCFlatHashTable& table );
+		void				Clear();
+		void				Reserve( unsigned int count );
+		inline int			Count()									{ return mCount; }
+		inline int			Capacity()								{ return mCapacity; }
+
+		void				AddValue( Key key, Value value );
+		void				RemoveValue( Key key );
+
+		bool				ContainsValue( Value value );
+		bool				ContainsKey( Key key );
+
+		bool				GetValue( Key key, Value** value );
+
+		// Lower case so the table works with range-for and <algorithm>.
+		Iterator			begin()									{ return Iterator( this, 0 ); }
+		Iterator			end()									{ return Iterator( this, mCapacity ); }
+
+	private:	// Members
+		Entry*				mEntries;
+		unsigned char*		mDistances;		// 0 marks an empty slot, otherwise the probe distance + 1.
+		TCHashFunction		mHashFunction;
+		unsigned int		mCapacity;		// Always zero or a power of two.
+		unsigned int		mCount;
+
+	private:	// Methods
+		void				Rehash( unsigned int capacity );
+		void				InsertEntry( Entry& entry );
+		int					FindSlot( const Key& key );
+		unsigned int		GetHash( const Key& key );
+};
+
+#include "TCFlatHashTable.hpp"
+
+#endif // __TC_FLAT_HASH_TABLE_H__
@@ -0,0 +1,542 @@
+//
+// TCFlatHashTable.hpp
+// This file will implement an open addressing hash table.
+//
+
+#ifndef __TC_FLAT_HASH_TABLE_HPP__
+#define __TC_FLAT_HASH_TABLE_HPP__
+
+//
+// Includes
+//
+
+#include "TCFlatHashTable.h"
+#include "TCLogger.h"
+#include "TCMemUtils.h"
+#include "TCMemoryTracker.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <new>
+
+//
+// Defines
+//
+
+#define TC_FLAT_HASH_TABLE_MIN_CAPACITY		8
+#define TC_FLAT_HASH_TABLE_MAX_LOAD_PERCENT	80		// Grow once the table is this full.
+#define TC_FLAT_HASH_TABLE_MAX_DISTANCE		255		// The largest probe distance a slot can record.
+
+//
+// Default Constructor
+//		- Will initialize the class to a safe state.
+// Inputs:
+//		- unsigned int capacity: The number of entries to reserve space for.
+//		- TCHashFunction function: The hash function to use.
+// Outputs:
+//		- None.
+//
+
+template< class Key, class Value >
+TCFlatHashTable< Key, Value >::TCFlatHashTable( unsigned int capacity, TCHashFunction function )
+{
+	if( function == NULL )
+	{
+		TCLogger::GetInstance()->LogError("Provided a NULL hash function to a flat hash table. Falling back to default.");
+		function = TCHashFunctions::OneAtATimeHash;
+	}
+
+	mEntries		= NULL;
+	mDistances		= NULL;
+	mHashFunction	= function;
+	mCapacity		= 0;
+	mCount			= 0;
+
+	Reserve( capacity );
+}
+
+//
+// Copy Constructor
+//		- Will initialize this class to a copy of another hash table.
+// Inputs:
+//		- const TCFlatHashTable& inRef: The table to initialize us to.
+// Outputs:
+//		- None.
+//
+
+template< class Key, class Value >
+TCFlatHashTable< Key, Value >::TCFlatHashTable( const TCFlatHashTable& inRef )
+{
+	mEntries	= NULL;
+	mDistances	= NULL;
+	mCapacity	= 0;
+	mCount		= 0;
+
+	Clone( inRef );
+}
+
+//
+// Assignment Operator
+//		- Will set this table equal to another table.
+// Inputs:
+//		- const TCFlatHashTable& inRef: The hash table to set us equal to.
+// Outputs:
+//		- TCFlatHashTable&: The reference to this table.
+//
+
+template< class Key, class Value >
+TCFlatHashTable< Key, Value >& TCFlatHashTable< Key, Value >::operator=( const TCFlatHashTable& inRef )
+{
+	if( this != &inRef )
+	{
+		Clone( inRef );
+	}
+
+	return *this;
+}
+
+//
+// Destructor
+//		- This will free all resources associated with this table.
+// Inputs:
+//		- None.
+// Outputs:
+//		- None.
+//
+
+template< class Key, class Value >
+TCFlatHashTable< Key, Value >::~TCFlatHashTable()
+{
+	Clear();
+}
+
+//
+// Clone
+//		- This will copy another hash table to this table.
+// Inputs:
+//		- const TCFlatHashTable& inRef: The table to copy.
+// Outputs:
+//		- None.
+//
+
+template< class Key, class Value >
+void TCFlatHashTable< Key, Value >::Clone( const TCFlatHashTable< Key, Value >& inRef )
+{
+	Clear();
+
+	mHashFunction = inRef.mHashFunction;
+	if( inRef.mCapacity == 0 )
+		return;
+
+	//
+	// Both tables share a capacity and hash function, so every entry can stay in the same slot.
+	//
+
+	mCapacity	= inRef.mCapacity;
+	mCount		= inRef.mCount;
+	mEntries	= (Entry*)TCMemoryTracker::Allocate( sizeof( Entry ) * mCapacity, TCMemoryTracker::kMemoryTagCollections );
+	mDistances	= new unsigned char[ mCapacity ];
+	memcpy( mDistances, inRef.mDistances, mCapacity );
+
+	for( unsigned int currentSlot = 0; currentSlot < mCapacity; ++currentSlot )
+	{
+		if( mDistances[ currentSlot ] != 0 )
+		{
+			new( &mEntries[ currentSlot ] ) Entry( inRef.mEntries[ currentSlot ] );
+		}
+	}
+}
+
+//
+// Clear
+//		- This will free all resources associated with this table.
+// Inputs:
+//		- None.
+// Outputs:
+//		- None.
+//
+
+template< class Key, class Value >
+void TCFlatHashTable< Key, Value >::Clear()
+{
+	for( unsigned int currentSlot = 0; currentSlot < mCapacity; ++currentSlot )
+	{
+		if( mDistances[ currentSlot ] != 0 )
+		{
+			mEntries[ currentSlot ].~Entry();
+		}
+	}
+
+	TCMemoryTracker::Free( mEntries );
+	mEntries = NULL;
+	TC_SAFE_DELETE_ARRAY( mDistances );
+
+	mCapacity	= 0;
+	mCount		= 0;
+}
+
+//
+// Reserve
+//		- This will make sure the table can hold a number of entries without growing.
+// Inputs:
+//		- unsigned int count: The number of entries to make space for.
+// Outputs:
+//		- None.
+//
+
+template< class Key, class Value >
+void TCFlatHashTable< Key, Value >::Reserve( unsigned int count )
+{
+	if( count == 0 )
+		return;
+
+	unsigned int capacity = TC_FLAT_HASH_TABLE_MIN_CAPACITY;
+	while( (unsigned long long)capacity * TC_FLAT_HASH_TABLE_MAX_LOAD_PERCENT < (unsigned long long)count * 100 )
+	{
+		capacity <<= 1;
+	}
+
+	if( capacity > mCapacity )
+	{
+		Rehash( capacity );
+	}
+}
+
+//
+// AddValue
+//		- This will add a value to the hash table.
+// Inputs:
+//		- Key key: The key for this value, it must not be a duplicate.
+//		- Value value: The value for this key.
+// Outputs:
+//		- None.
+//
+
+template< class Key, class Value >
+void TCFlatHashTable< Key, Value >::AddValue( Key key, Value value )
+{
+	if( FindSlot( key ) != -1 )
+	{
+		TCLogger::GetInstance()->LogError("Flat Hash Table already contains this key");
+		return;
+	}
+
+	//
+	// Grow before we pass our load limit, probe sequences get long quickly past it.
+	//
+
+	if( (unsigned long long)( mCount + 1 ) * 100 > (unsigned long long)mCapacity * TC_FLAT_HASH_TABLE_MAX_LOAD_PERCENT )
+	{
+		Rehash( mCapacity == 0 ? TC_FLAT_HASH_TABLE_MIN_CAPACITY : mCapacity * 2 );
+	}
+
+	Entry entry( key, value );
+	InsertEntry( entry );
+}
+
+//
+// RemoveValue
+//		- Will remove a value from the table.
+// Inputs:
+//		- Key key: The key for the value to remove.
+// Outputs:
+//		- None.
+//
+
+template< class Key, class Value >
+void TCFlatHashTable< Key, Value >::RemoveValue( Key key )
+{
+	int slot = FindSlot( key );
+	if( slot == -1 )
+		return;
+
+	//
+	// Shift every following entry that isn't in its ideal slot back by one, this closes the gap
+	// without needing a tombstone.
+	//
+
+	unsigned int mask			= mCapacity - 1;
+	unsigned int currentSlot	= (unsigned int)slot;
+	unsigned int nextSlot		= ( currentSlot + 1 ) & mask;
+
+	mEntries[ currentSlot ].~Entry();
+	while( mDistances[ nextSlot ] > 1 )
+	{
+		new( &mEntries[ currentSlot ] ) Entry( mEntries[ nextSlot ] );
+		mEntries[ nextSlot ].~Entry();
+		mDistances[ currentSlot ] = mDistances[ nextSlot ] - 1;
+
+		currentSlot = nextSlot;
+		nextSlot	= ( nextSlot + 1 ) & mask;
+	}
+
+	mDistances[ currentSlot ] = 0;
+	mCount--;
+}
+
+//
+// ContainsValue
+//		- Will return if the table contains a KVP with the value provided.
+// Inputs:
+//		- Value value: The value to search for.
+// Outputs:
+//		- bool: Does the table contain the value.
+//
+
+template< class Key, class Value >
+bool TCFlatHashTable< Key, Value >::ContainsValue( Value value )
+{
+	for( unsigned int currentSlot = 0; currentSlot < mCapacity; ++currentSlot )
+	{
+		if( mDistances[ currentSlot ] != 0 && mEntries[ currentSlot ].value == value )
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+//
+// ContainsKey
+//		- Will return if the table contains the specified key.
+// Inputs:
+//		- Key key: The key to search for.
+// Outputs:
+//		- bool: Does the table contain the key.
+//
+
+template< class Key, class Value >
+bool TCFlatHashTable< Key, Value >::ContainsKey( Key key )
+{
+	return FindSlot( key ) != -1;
+}
+
+//
+// GetValue
+//		- Will return the value associated with a specified key.
+// Inputs:
+//		- Key key: The key associated with the value.
+//		- Value** value: The pointer to set the value to.
+// Outputs:
+//		- Value: The value in the table.
+//		- bool: Whether the operation succeeded or not.
+//
+
+template< class Key, class Value >
+bool TCFlatHashTable< Key, Value >::GetValue( Key key, Value** value )
+{
+	if( value == NULL )
+		return false;
+
+	int slot = FindSlot( key );
+	if( slot == -1 )
+	{
+		*value = NULL;
+		return false;
+	}
+
+	*value = &mEntries[ slot ].value;
+	return true;
+}
+
+//
+// Rehash
+//		- This will move every entry into a new set of slots.
+// Inputs:
+//		- unsigned int capacity: The new slot count, must be a power of two.
+// Outputs:
+//		- None.
+//
+
+template< class Key, class Value >
+void TCFlatHashTable< Key, Value >::Rehash( unsigned int capacity )
+{
+	TC_ASSERT( capacity > 0 && ( capacity & ( capacity - 1 ) ) == 0 && "Flat hash table capacity must be a power of two." );
+
+	Entry*			oldEntries		= mEntries;
+	unsigned char*	oldDistances	= mDistances;
+	unsigned int	oldCapacity		= mCapacity;
+
+	mEntries	= (Entry*)TCMemoryTracker::Allocate( sizeof( Entry ) * capacity, TCMemoryTracker::kMemoryTagCollections );
+	mDistances	= new unsigned char[ capacity ];
+	mCapacity	= capacity;
+	mCount		= 0;
+	memset( mDistances, 0, capacity );
+
+	for( unsigned int currentSlot = 0; currentSlot < oldCapacity; ++currentSlot )
+	{
+		if( oldDistances[ currentSlot ] != 0 )
+		{
+			InsertEntry( oldEntries[ currentSlot ] );
+			oldEntries[ currentSlot ].~Entry();
+		}
+	}
+
+	TCMemoryTracker::Free( oldEntries );
+	TC_SAFE_DELETE_ARRAY( oldDistances );
+}
+
+//
+// InsertEntry
+//		- This will place an entry, displacing any entry that sits closer to its ideal slot.
+// Inputs:
+//		- Entry& entry: The entry to place, it is used as scratch space while displacing.
+// Outputs:
+//		- None.
+//
+
+template< class Key, class Value >
+void TCFlatHashTable< Key, Value >::InsertEntry( Entry& entry )
+{
+	unsigned int	mask		= mCapacity - 1;
+	unsigned int	slot		= GetHash( entry.key ) & mask;
+	unsigned char	distance	= 1;
+
+	while( true )
+	{
+		if( mDistances[ slot ] == 0 )
+		{
+			new( &mEntries[ slot ] ) Entry( entry );
+			mDistances[ slot ] = distance;
+			mCount++;
+			return;
+		}
+
+		//
+		// Take from the rich, this slot's entry is closer to home than we are.
+		//
+
+		if( mDistances[ slot ] < distance )
+		{
+			Entry displaced( mEntries[ slot ] );
+			mEntries[ slot ] = entry;
+			entry = displaced;
+
+			unsigned char displacedDistance = mDistances[ slot ];
+			mDistances[ slot ] = distance;
+			distance = displacedDistance;
+		}
+
+		slot = ( slot + 1 ) & mask;
+		distance++;
+
+		//
+		// A probe this long means the hash is clustering badly, spread the table out.
+		//
+
+		if( distance == TC_FLAT_HASH_TABLE_MAX_DISTANCE )
+		{
+			Rehash( mCapacity * 2 );
+			InsertEntry( entry );
+			return;
+		}
+	}
+}
+
+//
+// FindSlot
+//		- This will find the slot holding a key.
+// Inputs:
+//		- const Key& key: The key to search for.
+// Outputs:
+//		- int: The slot holding the key, -1 if not found.
+//
+
+template< class Key, class Value >
+int TCFlatHashTable< Key, Value >::FindSlot( const Key& key )
+{
+	if( mCount == 0 )
+		return -1;
+
+	unsigned int mask		= mCapacity - 1;
+	unsigned int slot		= GetHash( key ) & mask;
+	unsigned int distance	= 1;
+
+	//
+	// Once we reach a slot closer to home than we are the key can't be any further along.
+	//
+
+	while( mDistances[ slot ] >= distance )
+	{
+		if( mDistances[ slot ] == distance && TCEqual< Key >::Equal( mEntries[ slot ].key, key ) )
+		{
+			return (int)slot;
+		}
+
+		slot = ( slot + 1 ) & mask;
+		distance++;
+	}
+
+	return -1;
+}
+
+//
+// GetHash
+//		- This function will generate the hash for a key.
+// Inputs:
+//		- const Key& key: The key to hash.
+// Outputs:
+//		- unsigned int: The hash.
+//
+
+template< class Key, class Value >
+unsigned int TCFlatHashTable< Key, Value >::GetHash( const Key& key )
+{
+	return TCHash< Key >::Hash( key, mHashFunction );
+}
+
+//
+// Iterator Constructor
+//		- Will point the iterator at the first occupied slot at or after the slot provided.
+// Inputs:
+//		- TCFlatHashTable* table: The table to walk.
+//		- unsigned int slot: The slot to start at, the capacity gives the end iterator.
+// Outputs:
+//		- None.
+//
+
+template< class Key, class Value >
+TCFlatHashTable< Key, Value >::Iterator::Iterator( TCFlatHashTable* table, unsigned int slot )
+	: mTable( table ), mSlot( slot )
+{
+	SkipEmptySlots();
+}
+
+//
+// Iterator Increment
+//		- Will move the iterator to the next entry in the table.
+// Inputs:
+//		- None.
+// Outputs:
+//		- Iterator&: This iterator.
+//
+
+template< class Key, class Value >
+typename TCFlatHashTable< Key, Value >::Iterator& TCFlatHashTable< Key, Value >::Iterator::operator++()
+{
+	mSlot++;
+	SkipEmptySlots();
+
+	return *this;
+}
+
+//
+// SkipEmptySlots
+//		- Will move past any empty slots.
+// Inputs:
+//		- None.
+// Outputs:
+//		- None.
+//
+
+template< class Key, class Value >
+void TCFlatHashTable< Key, Value >::Iterator::SkipEmptySlots()
+{
+	while( mSlot < mTable->mCapacity && mTable->mDistances[ mSlot ] == 0 )
+	{
+		mSlot++;
+	}
+}
+
+#endif // __TC_FLAT_HASH_TABLE_HPP__
@@ -9,12 +9,253 @@
 //
 
 #include "TCHashFunctions.h"
+#include "TCCPUFeatures.h"
 #include "TCPlatformPrecompilerSymbols.h"
 
+#include <string.h>
+
+#if TC_PLATFORM_WIN32
+	#include <intrin.h>
+	#include <nmmintrin.h>
+#endif
+
 //
 // Defines
 //
 
+#define XXHASH_PRIME64_1	(0x9E3779B185EBCA87ULL)
+#define XXHASH_PRIME64_2	(0xC2B2AE3D27D4EB4FULL)
+#define XXHASH_PRIME64_3	(0x165667B19E3779F9ULL)
+#define XXHASH_PRIME64_4	(0x85EBCA77C2B2AE63ULL)
+#define XXHASH_PRIME64_5	(0x27D4EB2F165667C5ULL)
+#define XXHASH_STRIPE_SIZE	(32)
+
+#define CRC32C_POLYNOMIAL	(0x82F63B78)	// Castagnoli, bit reflected.
+
+//
+// Helpers
+//
+
+static inline unsigned long long RotateLeft64( unsigned long long value, int amount )
+{
+	return ( value << amount ) | ( value >> ( 64 - amount ) );
+}
+
+static inline unsigned long long Read64( const unsigned char* pointer )
+{
+	unsigned long long value;
+	memcpy( &value, pointer, sizeof( value ) );
+	return value;
+}
+
+static inline unsigned int Read32( const unsigned char* pointer )
+{
+	unsigned int value;
+	memcpy( &value, pointer, sizeof( value ) );
+	return value;
+}
+
+static inline unsigned long long XXHashRound( unsigned long long accumulator, unsigned long long input )
+{
+	accumulator += input * XXHASH_PRIME64_2;
+	accumulator = RotateLeft64( accumulator, 31 );
+	return accumulator * XXHASH_PRIME64_1;
+}
+
+static inline unsigned long long XXHashMergeRound( unsigned long long hash, unsigned long long accumulator )
+{
+	hash ^= XXHashRound( 0, accumulator );
+	return hash * XXHASH_PRIME64_1 + XXHASH_PRIME64_4;
+}
+
+//
+// XXHashStripes
+//		- Will consume as many whole 32 byte stripes as are available.
+// Inputs:
+//		- unsigned long long* accumulators: The four running lanes.
+//		- const unsigned char* pointer: The data.
+//		- unsigned int len: The length of the data in bytes.
+// Outputs:
+//		- unsigned int: The number of bytes consumed.
+//
+
+static unsigned int XXHashStripes( unsigned long long* accumulators, const unsigned char* pointer, unsigned int len )
+{
+	unsigned int consumed = 0;
+	for( ; consumed + XXHASH_STRIPE_SIZE <= len; consumed += XXHASH_STRIPE_SIZE )
+	{
+		accumulators[ 0 ] = XXHashRound( accumulators[ 0 ], Read64( pointer + consumed ) );
+		accumulators[ 1 ] = XXHashRound( accumulators[ 1 ], Read64( pointer + consumed + 8 ) );
+		accumulators[ 2 ] = XXHashRound( accumulators[ 2 ], Read64( pointer + consumed + 16 ) );
+		accumulators[ 3 ] = XXHashRound( accumulators[ 3 ], Read64( pointer + consumed + 24 ) );
+	}
+
+	return consumed;
+}
+
+//
+// XXHashFinish
+//		- Will fold in the tail of the input and mix the final hash.
+// Inputs:
+//		- unsigned long long hash: The hash so far.
+//		- const unsigned char* pointer: The remaining data, less than a stripe.
+//		- unsigned int len: The length of the remaining data.
+// Outputs:
+//		- unsigned long long: The hash.
+//
+
+static unsigned long long XXHashFinish( unsigned long long hash, const unsigned char* pointer, unsigned int len )
+{
+	for( ; len >= 8; len -= 8, pointer += 8 )
+	{
+		hash ^= XXHashRound( 0, Read64( pointer ) );
+		hash = RotateLeft64( hash, 27 ) * XXHASH_PRIME64_1 + XXHASH_PRIME64_4;
+	}
+
+	if( len >= 4 )
+	{
+		hash ^= (unsigned long long)Read32( pointer ) * XXHASH_PRIME64_1;
+		hash = RotateLeft64( hash, 23 ) * XXHASH_PRIME64_2 + XXHASH_PRIME64_3;
+		len -= 4;
+		pointer += 4;
+	}
+
+	for( ; len > 0; --len, ++pointer )
+	{
+		hash ^= (*pointer) * XXHASH_PRIME64_5;
+		hash = RotateLeft64( hash, 11 ) * XXHASH_PRIME64_1;
+	}
+
+	hash ^= hash >> 33;
+	hash *= XXHASH_PRIME64_2;
+	hash ^= hash >> 29;
+	hash *= XXHASH_PRIME64_3;
+	hash ^= hash >> 32;
+
+	return hash;
+}
+
+//
+// XXHashMergeAccumulators
+//		- Will combine the four lanes into a single hash.
+// Inputs:
+//		- const unsigned long long* accumulators: The four lanes.
+// Outputs:
+//		- unsigned long long: The hash.
+//
+
+static unsigned long long XXHashMergeAccumulators( const unsigned long long* accumulators )
+{
+	unsigned long long hash =	RotateLeft64( accumulators[ 0 ], 1 ) + RotateLeft64( accumulators[ 1 ], 7 ) +
+								RotateLeft64( accumulators[ 2 ], 12 ) + RotateLeft64( accumulators[ 3 ], 18 );
+
+	hash = XXHashMergeRound( hash, accumulators[ 0 ] );
+	hash = XXHashMergeRound( hash, accumulators[ 1 ] );
+	hash = XXHashMergeRound( hash, accumulators[ 2 ] );
+	hash = XXHashMergeRound( hash, accumulators[ 3 ] );
+
+	return hash;
+}
+
+//
+// CRC32C Lookup Tables
+//		- Eight tables so the portable path can consume eight bytes per step.
+//
+
+struct CRC32CTables
+{
+	unsigned int table[ 8 ][ 256 ];
+
+	CRC32CTables()
+	{
+		for( unsigned int currentByte = 0; currentByte < 256; ++currentByte )
+		{
+			unsigned int crc = currentByte;
+			for( int currentBit = 0; currentBit < 8; ++currentBit )
+			{
+				crc = ( crc & 1 ) ? ( crc >> 1 ) ^ CRC32C_POLYNOMIAL : ( crc >> 1 );
+			}
+			table[ 0 ][ currentByte ] = crc;
+		}
+
+		for( unsigned int currentByte = 0; currentByte < 256; ++currentByte )
+		{
+			for( int currentTable = 1; currentTable < 8; ++currentTable )
+			{
+				unsigned int previous = table[ currentTable - 1 ][ currentByte ];
+				table[ currentTable ][ currentByte ] = ( previous >> 8 ) ^ table[ 0 ][ previous & 0xFF ];
+			}
+		}
+	}
+};
+
+static const CRC32CTables& GetCRC32CTables()
+{
+	static CRC32CTables tables;
+	return tables;
+}
+
+//
+// CRC32CPortable
+//		- Will update a crc with the slicing by eight table method.
+//
+
+static unsigned int CRC32CPortable( unsigned int crc, const unsigned char* pointer, unsigned int len )
+{
+	const CRC32CTables& tables = GetCRC32CTables();
+
+	for( ; len >= 8; len -= 8, pointer += 8 )
+	{
+		unsigned int low	= Read32( pointer ) ^ crc;
+		unsigned int high	= Read32( pointer + 4 );
+
+		crc =	tables.table[ 7 ][ low & 0xFF ] ^ tables.table[ 6 ][ ( low >> 8 ) & 0xFF ] ^
+				tables.table[ 5 ][ ( low >> 16 ) & 0xFF ] ^ tables.table[ 4 ][ low >> 24 ] ^
+				tables.table[ 3 ][ high & 0xFF ] ^ tables.table[ 2 ][ ( high >> 8 ) & 0xFF ] ^
+				tables.table[ 1 ][ ( high >> 16 ) & 0xFF ] ^ tables.table[ 0 ][ high >> 24 ];
+	}
+
+	for( ; len > 0; --len, ++pointer )
+	{
+		crc = ( crc >> 8 ) ^ tables.table[ 0 ][ ( crc ^ *pointer ) & 0xFF ];
+	}
+
+	return crc;
+}
+
+#if TC_PLATFORM_WIN32
+
+//
+// CRC32CHardware
+//		- Will update a crc with the SSE 4.2 crc32 instruction.
+//
+
+static unsigned int CRC32CHardware( unsigned int crc, const unsigned char* pointer, unsigned int len )
+{
+#if defined( _M_X64 )
+	unsigned long long crc64 = crc;
+	for( ; len >= 8; len -= 8, pointer += 8 )
+	{
+		crc64 = _mm_crc32_u64( crc64, Read64( pointer ) );
+	}
+	crc = (unsigned int)crc64;
+#endif
+
+	for( ; len >= 4; len -= 4, pointer += 4 )
+	{
+		crc = _mm_crc32_u32( crc, Read32( pointer ) );
+	}
+
+	for( ; len > 0; --len, ++pointer )
+	{
+		crc = _mm_crc32_u8( crc, *pointer );
+	}
+
+	return crc;
+}
+
+#endif // TC_PLATFORM_WIN32
+
 namespace TCHashFunctions
 {
 	//
@@ -197,4 +438,205 @@ namespace TCHashFunctions
 
 		return hash;
 	}
+
+	//
+	// XXHash
+	//		- This is XXHash64 folded down to 32 bits so it can be used as a TCHashFunction.
+	// Inputs:
+	//		- void* data: The key.
+	//		- unsigned int len: The length of the key in bytes.
+	// Outputs:
+	//		- unsigned int: The hash.
+	//
+
+	unsigned int XXHash( void* data, unsigned int len )
+	{
+		TC_ASSERT( data != NULL && len > 0 );
+
+		unsigned long long hash = XXHash64( data, len );
+		return (unsigned int)( hash ^ ( hash >> 32 ) );
+	}
+
+	//
+	// CRC32CHash
+	//		- This is CRC32C in the shape of a TCHashFunction.
+	// Inputs:
+	//		- void* data: The key.
+	//		- unsigned int len: The length of the key in bytes.
+	// Outputs:
+	//		- unsigned int: The hash.
+	//
+
+	unsigned int CRC32CHash( void* data, unsigned int len )
+	{
+		TC_ASSERT( data != NULL && len > 0 );
+
+		return CRC32C( data, len );
+	}
+
+	//
+	// XXHash64
+	//		- This is Yann Collet's XXH64, it consumes four 64 bit lanes at a time.
+	// Inputs:
+	//		- const void* data: The data to hash.
+	//		- unsigned int len: The length of the data in bytes.
+	//		- unsigned long long seed: The seed for the hash.
+	// Outputs:
+	//		- unsigned long long: The hash.
+	//
+
+	unsigned long long XXHash64( const void* data, unsigned int len, unsigned long long seed )
+	{
+		TC_ASSERT( data != NULL || len == 0 );
+
+		const unsigned char* pointer = (const unsigned char*)data;
+		unsigned long long hash = 0;
+
+		if( len >= XXHASH_STRIPE_SIZE )
+		{
+			unsigned long long accumulators[ 4 ] =
+			{
+				seed + XXHASH_PRIME64_1 + XXHASH_PRIME64_2,
+				seed + XXHASH_PRIME64_2,
+				seed,
+				seed - XXHASH_PRIME64_1,
+			};
+
+			unsigned int consumed = XXHashStripes( accumulators, pointer, len );
+			hash = XXHashMergeAccumulators( accumulators );
+
+			pointer += consumed;
+			hash += len;
+			return XXHashFinish( hash, pointer, len - consumed );
+		}
+
+		hash = seed + XXHASH_PRIME64_5 + len;
+		return XXHashFinish( hash, pointer, len );
+	}
+
+	//
+	// CRC32C
+	//		- This will compute the Castagnoli crc, using the SSE 4.2 instruction when the cpu has it.
+	// Inputs:
+	//		- const void* data: The data to hash.
+	//		- unsigned int len: The length of the data in bytes.
+	//		- unsigned int crc: The result of the previous chunk, or 0 to start.
+	// Outputs:
+	//		- unsigned int: The crc.
+	//
+
+	unsigned int CRC32C( const void* data, unsigned int len, unsigned int crc )
+	{
+		TC_ASSERT( data != NULL || len == 0 );
+
+		const unsigned char* pointer = (const unsigned char*)data;
+		crc = ~crc;
+
+#if TC_PLATFORM_WIN32
+		if( TCCPUFeatures::HasSSE42() )
+		{
+			return ~CRC32CHardware( crc, pointer, len );
+		}
+#endif
+
+		return ~CRC32CPortable( crc, pointer, len );
+	}
+
+	//
+	// XXHash64Begin
+	//		- Will prepare a streaming hash.
+	// Inputs:
+	//		- XXHash64State& state: The state to prepare.
+	//		- unsigned long long seed: The seed for the hash.
+	// Outputs:
+	//		- None.
+	//
+
+	void XXHash64Begin( XXHash64State& state, unsigned long long seed )
+	{
+		state.accumulators[ 0 ]	= seed + XXHASH_PRIME64_1 + XXHASH_PRIME64_2;
+		state.accumulators[ 1 ]	= seed + XXHASH_PRIME64_2;
+		state.accumulators[ 2 ]	= seed;
+		state.accumulators[ 3 ]	= seed - XXHASH_PRIME64_1;
+		state.totalLength		= 0;
+		state.seed				= seed;
+		state.bufferSize		= 0;
+	}
+
+	//
+	// XXHash64Update
+	//		- Will feed another chunk of data into a streaming hash.
+	// Inputs:
+	//		- XXHash64State& state: The hash state.
+	//		- const void* data: The chunk.
+	//		- unsigned int len: The length of the chunk in bytes.
+	// Outputs:
+	//		- None.
+	//
+
+	void XXHash64Update( XXHash64State& state, const void* data, unsigned int len )
+	{
+		TC_ASSERT( data != NULL || len == 0 );
+
+		if( len == 0 )
+			return;
+
+		const unsigned char* pointer = (const unsigned char*)data;
+		state.totalLength += len;
+
+		//
+		// Top up a partial stripe left over from the last chunk first.
+		//
+
+		if( state.bufferSize > 0 )
+		{
+			unsigned int toCopy = XXHASH_STRIPE_SIZE - state.bufferSize;
+			if( toCopy > len )
+				toCopy = len;
+
+			memcpy( state.buffer + state.bufferSize, pointer, toCopy );
+			state.bufferSize += toCopy;
+			pointer += toCopy;
+			len -= toCopy;
+
+			if( state.bufferSize < XXHASH_STRIPE_SIZE )
+				return;
+
+			XXHashStripes( state.accumulators, state.buffer, XXHASH_STRIPE_SIZE );
+			state.bufferSize = 0;
+		}
+
+		//
+		// Consume whole stripes straight from the input and keep the tail for later.
+		//
+
+		unsigned int consumed = XXHashStripes( state.accumulators, pointer, len );
+		state.bufferSize = len - consumed;
+		memcpy( state.buffer, pointer + consumed, state.bufferSize );
+	}
+
+	//
+	// XXHash64End
+	//		- Will produce the hash of everything fed in so far, the state can keep being updated afterwards.
+	// Inputs:
+	//		- const XXHash64State& state: The hash state.
+	// Outputs:
+	//		- unsigned long long: The hash.
+	//
+
+	unsigned long long XXHash64End( const XXHash64State& state )
+	{
+		unsigned long long hash = 0;
+		if( state.totalLength >= XXHASH_STRIPE_SIZE )
+		{
+			hash = XXHashMergeAccumulators( state.accumulators );
+		}
+		else
+		{
+			hash = state.seed + XXHASH_PRIME64_5;
+		}
+
+		hash += state.totalLength;
+		return XXHashFinish( hash, state.buffer, state.bufferSize );
+	}
 }
\ No newline at end of file
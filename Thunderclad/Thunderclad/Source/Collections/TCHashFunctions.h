@@ -14,6 +14,10 @@ typedef unsigned int (*TCHashFunction)( void* data, unsigned int len );	// TCHas
 
 namespace TCHashFunctions
 {
+	//
+	// Byte at a time hashes.
+	//
+
 	unsigned int AdditiveHash( void* data, unsigned int len );
 	unsigned int XorHash( void* data, unsigned int len );
 	unsigned int RotatingHash( void* data, unsigned int len );
@@ -21,6 +25,33 @@ namespace TCHashFunctions
 	unsigned int ShiftAddXorHash( void* data, unsigned int len );
 	unsigned int FNVHash( void* data, unsigned int len );
 	unsigned int OneAtATimeHash( void* data, unsigned int len );
+
+	//
+	// Word at a time hashes.
+	//
+
+	unsigned int XXHash( void* data, unsigned int len );
+	unsigned int CRC32CHash( void* data, unsigned int len );
+
+	unsigned long long XXHash64( const void* data, unsigned int len, unsigned long long seed = 0 );
+	unsigned int CRC32C( const void* data, unsigned int len, unsigned int crc = 0 );	// Pass the previous result as crc to hash in chunks.
+
+	//
+	// Streaming XXHash64, for data that arrives in chunks. The result matches XXHash64 over the whole input.
+	//
+
+	struct XXHash64State
+	{
+		unsigned long long	accumulators[ 4 ];
+		unsigned long long	totalLength;
+		unsigned long long	seed;
+		unsigned char		buffer[ 32 ];
+		unsigned int		bufferSize;
+	};
+
+	void				XXHash64Begin( XXHash64State& state, unsigned long long seed = 0 );
+	void				XXHash64Update( XXHash64State& state, const void* data, unsigned int len );
+	unsigned long long	XXHash64End( const XXHash64State& state );
 }
 
 #endif
\ No newline at end of file
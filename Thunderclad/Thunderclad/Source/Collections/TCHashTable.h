@@ -12,27 +12,63 @@
 
 #include "TCPlatformPrecompilerSymbols.h"
 #include "TCHashFunctions.h"
+#include "TCHashTraits.h"
 #include "TCList.h"
 
+#include <stddef.h>
+#include <iterator>
+
 //
 // Defines
 //
 
 //
 // Class Declaration
+//		- Iterating the table walks every bucket once and visits each entry's key and value, in no particular order.
 //
 
 template< typename Key, typename Value >
 class TCHashTable
 {
 	public:		// Members
+		// Iterators hand out const entries so a key can't be changed out from under its bucket, the value stays writable.
 		class Entry
 		{
 			public:
-				Value value;
+				Key key;
+				mutable Value value;
 				int keyIndex;
 		};
 
+		class Iterator
+		{
+			public:		// Members
+				typedef std::forward_iterator_tag	iterator_category;
+				typedef Entry						value_type;
+				typedef ptrdiff_t					difference_type;
+				typedef const Entry*				pointer;
+				typedef const Entry&				reference;
+
+			public:		// Methods
+								Iterator()								: mTable( NULL ), mBucket( 0 ), mEntry( 0 ) {}
+								Iterator( TCList< TCList< Entry > >* table, int bucket );
+
+				const Entry&	operator*() const						{ return (*mTable)[ mBucket ][ mEntry ]; }
+				const Entry*	operator->() const						{ return &(*mTable)[ mBucket ][ mEntry ]; }
+				Iterator&		operator++();
+				Iterator		operator++( int )						{ Iterator previous = *this; ++(*this); return previous; }
+				bool			operator==( const Iterator& rhs ) const	{ return mBucket == rhs.mBucket && mEntry == rhs.mEntry; }
+				bool			operator!=( const Iterator& rhs ) const	{ return !( *this == rhs ); }
+
+			private:	// Members
+				TCList< TCList< Entry > >*	mTable;
+				int							mBucket;
+				int							mEntry;
+
+			private:	// Methods
+				void			SkipEmptyBuckets();
+		};
+
 	public:		// Methods
 
 						TCHashTable( unsigned int capacity = 0, TCHashFunction func = TCHashFunctions::OneAtATimeHash );
@@ -54,6 +90,10 @@ class TCHashTable
 		Key				GetKey( int keyIndex )						{ return mKeys[ keyIndex ]; }
 		bool			GetValue( Key key, Value** value );
 
+		// Lower case so the table works with range-for and <algorithm>.
+		Iterator		begin()										{ return Iterator( &mTable, 0 ); }
+		Iterator		end()										{ return Iterator( &mTable, mTable.Count() ); }
+
 	private:	// Members
 		TCList< TCList< Entry > >	mTable;
 		TCList< Key >				mKeys;
@@ -65,6 +105,7 @@ class TCHashTable
 	private:	// Methods
 
 		void IncreaseCapacity( unsigned int capacity );
+		Entry* FindEntry( const Key& key, unsigned int bucketIndex );
 		unsigned int GetBucketIndex( Key key );
 		unsigned int GeneratePrime( unsigned int capacity );
 };
@@ -13,6 +13,7 @@
 #include "TCHashTable.h"
 #include "TCLogger.h"
 #include "TCMathUtils.h"
+#include "TCMemUtils.h"
 
 #include <limits.h>
 
@@ -107,17 +108,17 @@ TCHashTable< Key, Value >::~TCHashTable()
 template< class Key, class Value >
 void TCHashTable< Key, Value >::Clone( const TCHashTable< Key, Value >& inRef )
 {
-	mCount			= inRef.mCount;
-	mCapacity		= inRef.mCapacity;
-	mTable			= inRef.mTable;
-	mKeys			= inRef.mKeys;
-	mBucketIndices	= inRef.mBucketIndices;
-	mHashFunction	= inRef.mHashFunction;
+	mCount				= inRef.mCount;
+	mCapacity			= inRef.mCapacity;
+	mTable				= inRef.mTable;
+	mKeys				= inRef.mKeys;
+	mBucketListIndices	= inRef.mBucketListIndices;
+	mHashFunction		= inRef.mHashFunction;
 }
 
 //
 // Clear
-//		- This will free all resources associated with this table.
+//		- This will free all entries in this table, the buckets are kept so the table can be used again.
 // Inputs:
 //		- None.
 // Outputs:
@@ -131,7 +132,6 @@ void TCHashTable< Key, Value >::Clear()
 	{
 		mTable[ currentBucket ].Clear();
 	}
-	mTable.Clear();
 	mKeys.Clear();
 	mBucketListIndices.Clear();
 
@@ -161,7 +161,7 @@ void TCHashTable< Key, Value >::AddValue( Key key, Value value )
 	// Check to see if this key already exists.
 	//
 
-	if( mKeys.Contains( key ) )
+	if( FindEntry( key, hash ) != NULL )
 	{
 		TCLogger::GetInstance()->LogError("Hash Table already contains this key");
 		return;
@@ -175,6 +175,7 @@ void TCHashTable< Key, Value >::AddValue( Key key, Value value )
 	int keyIndex = mKeys.Count() - 1;
 
 	Entry entry;
+	entry.key = key;
 	entry.value = value;
 	entry.keyIndex = keyIndex;
 	mTable[ hash ].Append( entry );
@@ -188,7 +189,7 @@ void TCHashTable< Key, Value >::AddValue( Key key, Value value )
 
 	if( mTable[ hash ].Count() >= MAX_COLLISIONS )
 	{
-		IncreaseCapacity( GeneratePrime( mCapacity ) );
+		IncreaseCapacity( GeneratePrime( mCapacity * 2 ) );
 	}
 
 	//
@@ -214,41 +215,40 @@ void TCHashTable< Key, Value >::RemoveValue( Key key )
 	// Check to see if we have the key specified.
 	//
 
-	unsigned int keyIndex = mKeys.Find( key );
-	if( keyIndex == -1 )
+	unsigned int hash = GetBucketIndex( key );
+	Entry* entry = FindEntry( key, hash );
+	if( entry == NULL )
 		return;
 
-	//
-	// Get the hash for the key
-	//
-
-	unsigned int hash = GetBucketIndex( key );
-	unsigned int bucketIndex = mBucketListIndices[ keyIndex ];
+	int keyIndex = entry->keyIndex;
+	int bucketIndex = mBucketListIndices[ keyIndex ];
 
 	//
-	// Remove the value from the table.
+	// Remove the value from its bucket, the last entry in the bucket takes its place.
 	//
 
-	if( hash < (unsigned int)mTable.Count() )
+	TCList< Entry >& bucket = mTable[ hash ];
+	bucket.RemoveAtSwap( bucketIndex );
+	if( bucketIndex < bucket.Count() )
 	{
-		for( int currentEntry = bucketIndex + 1; currentEntry < mTable[ hash ].Count(); ++currentEntry )
-		{
-			mBucketListIndices[ mTable[ hash ][ currentEntry ].keyIndex ]--;	// Shift back the bucket indices.
-			mTable[ hash ][ currentEntry ].keyIndex--;
-		}
-		mTable[ hash ].RemoveAt( bucketIndex );
+		mBucketListIndices[ bucket[ bucketIndex ].keyIndex ] = bucketIndex;
 	}
 
 	//
-	// Remove the key.
+	// Remove the key, the last key takes its place so its entry needs to know its new index.
 	//
 
-	mKeys.Remove( key );
-	mBucketListIndices.RemoveAt( keyIndex );
-
-	mCount--;
+	int lastKeyIndex = mKeys.Count() - 1;
+	if( keyIndex != lastKeyIndex )
+	{
+		unsigned int lastHash = GetBucketIndex( mKeys[ lastKeyIndex ] );
+		mTable[ lastHash ][ mBucketListIndices[ lastKeyIndex ] ].keyIndex = keyIndex;
+	}
 
+	mKeys.RemoveAtSwap( keyIndex );
+	mBucketListIndices.RemoveAtSwap( keyIndex );
 
+	mCount--;
 }
 
 //
@@ -290,7 +290,7 @@ bool TCHashTable< Key, Value >::ContainsValue( Value value )
 template< class Key, class Value >
 bool TCHashTable< Key, Value >::ContainsKey( Key key )
 {
-	return mKeys.Contains( key );
+	return FindEntry( key, GetBucketIndex( key ) ) != NULL;
 }
 
 //
@@ -318,28 +318,18 @@ bool TCHashTable< Key, Value >::GetValue( Key key, Value** value )
 	// Make sure we actually have this key.
 	//
 
-	int keyIndex = mKeys.Find( key );
-	if( keyIndex == -1 )
+	Entry* entry = FindEntry( key, GetBucketIndex( key ) );
+	if( entry == NULL )
 	{
-		value = NULL;
+		*value = NULL;
 		return false;	
 	}
 
-	//
-	// Get our hash.
-	//
-
-	unsigned int hash = GetBucketIndex( key );
-
 	//
 	// Return the value
 	//
 
-	if( hash < (unsigned int)mTable.Count() )
-	{
-		*value = &mTable[ hash ][ mBucketListIndices[ keyIndex ] ].value;
-	}
-
+	*value = &entry->value;
 	return true;
 }
 
@@ -355,14 +345,14 @@ bool TCHashTable< Key, Value >::GetValue( Key key, Value** value )
 template< class Key, class Value >
 unsigned int TCHashTable< Key, Value >::GetBucketIndex( Key key )
 {
-	unsigned int hash = mHashFunction( (void*)&key, sizeof( Key ) );
+	unsigned int hash = TCHash< Key >::Hash( key, mHashFunction );
 	hash &= 0x7FFFFFFF;
 	return hash % mTable.Count();
 } 
 
 //
 // GeneratePrime
-//		- This function will take in a capacity and return the next prime greater than it.
+//		- This function will take in a capacity and return the next prime greater than it, never the capacity itself.
 // Inputs:
 //		- unsigned int capacity
 // Outputs:
@@ -372,7 +362,7 @@ unsigned int TCHashTable< Key, Value >::GetBucketIndex( Key key )
 template< class Key, class Value >
 unsigned int TCHashTable< Key, Value >::GeneratePrime( unsigned int capacity )
 {
-	for (int i = (capacity | 1); i < INT_MAX; i+=2) 
+	for (int i = ((capacity + 1) | 1); i < INT_MAX; i+=2) 
     {
         if (TCMathUtils::IsPrime(i))
             return i;
@@ -383,7 +373,8 @@ unsigned int TCHashTable< Key, Value >::GeneratePrime( unsigned int capacity )
 
 //
 // IncreaseCapacity
-//		- This will expand the width of our table to better avoid collisions.
+//		- This will expand the width of our table to better avoid collisions. Every entry is hashed again into the
+//		  new buckets, the key list doesn't move so only the bucket positions change.
 // Inputs:
 //		- unsigned int capacity
 // Outputs:
@@ -402,8 +393,104 @@ void TCHashTable< Key, Value >::IncreaseCapacity( unsigned int capacity )
 	if( capacity == 0 )
 		capacity = 1;
 
+	TCList< TCList< Entry > > previousTable( TCMove( mTable ) );
+
 	mCapacity = capacity;
 	mTable.Resize( capacity );
+
+	//
+	// Rehash the entries from the old buckets.
+	//
+
+	for( int currentBucket = 0; currentBucket < previousTable.Count(); ++currentBucket )
+	{
+		TCList< Entry >& bucket = previousTable[ currentBucket ];
+		for( int currentEntry = 0; currentEntry < bucket.Count(); ++currentEntry )
+		{
+			unsigned int hash = GetBucketIndex( bucket[ currentEntry ].key );
+			mBucketListIndices[ bucket[ currentEntry ].keyIndex ] = mTable[ hash ].Count();
+			mTable[ hash ].Append( TCMove( bucket[ currentEntry ] ) );
+		}
+	}
+}
+
+//
+// FindEntry
+//		- Will search a bucket for the entry with the key provided.
+// Inputs:
+//		- const Key& key: The key to search for.
+//		- unsigned int bucketIndex: The bucket the key hashes to.
+// Outputs:
+//		- Entry*: The entry, NULL if the key is not in the table.
+//
+
+template< class Key, class Value >
+typename TCHashTable< Key, Value >::Entry* TCHashTable< Key, Value >::FindEntry( const Key& key, unsigned int bucketIndex )
+{
+	TCList< Entry >& bucket = mTable[ bucketIndex ];
+	for( int currentEntry = 0; currentEntry < bucket.Count(); ++currentEntry )
+	{
+		if( TCEqual< Key >::Equal( bucket[ currentEntry ].key, key ) )
+		{
+			return &bucket[ currentEntry ];
+		}
+	}
+
+	return NULL;
+}
+
+//
+// Iterator Constructor
+//		- Will point the iterator at the first entry at or after the bucket provided.
+// Inputs:
+//		- TCList< TCList< Entry > >* table: The buckets of the table to walk.
+//		- int bucket: The bucket to start at, the bucket count gives the end iterator.
+// Outputs:
+//		- None.
+//
+
+template< class Key, class Value >
+TCHashTable< Key, Value >::Iterator::Iterator( TCList< TCList< Entry > >* table, int bucket )
+	: mTable( table ), mBucket( bucket ), mEntry( 0 )
+{
+	SkipEmptyBuckets();
+}
+
+//
+// Iterator Increment
+//		- Will move the iterator to the next entry in the table.
+// Inputs:
+//		- None.
+// Outputs:
+//		- Iterator&: This iterator.
+//
+
+template< class Key, class Value >
+typename TCHashTable< Key, Value >::Iterator& TCHashTable< Key, Value >::Iterator::operator++()
+{
+	mEntry++;
+	SkipEmptyBuckets();
+
+	return *this;
+}
+
+//
+// SkipEmptyBuckets
+//		- Will move past the end of the current bucket and any empty buckets after it.
+// Inputs:
+//		- None.
+// Outputs:
+//		- None.
+//
+
+template< class Key, class Value >
+void TCHashTable< Key, Value >::Iterator::SkipEmptyBuckets()
+{
+	while( mBucket < mTable->Count() && mEntry >= (*mTable)[ mBucket ].Count() )
+	{
+		mBucket++;
+		mEntry = 0;
+	}
 }
 
 #endif // __TC_HASH_TABLE_HPP__
\ No newline at end of file
@@ -0,0 +1,212 @@
+//
+// TCHashTraits.h
+// This file will define how keys are hashed and compared by the hash tables.
+//
+
+#ifndef __TC_HASH_TRAITS_H__
+#define __TC_HASH_TRAITS_H__
+
+//
+// Includes
+//
+
+#include "TCPlatformPrecompilerSymbols.h"
+#include "TCHashFunctions.h"
+#include "TCString.h"
+#include "TCStringUtils.h"
+
+#include <string.h>
+
+//
+// Defines
+//
+
+#define TC_HASH_INTEGER_MULTIPLIER	(0x9E3779B97F4A7C15ULL)		// 2^64 divided by the golden ratio.
+#define TC_HASH_COMBINE_CONSTANT	(0x9E3779B9)
+
+//
+// TCHashInteger
+//		- Will hash an integer with a single multiply, the high bits of the product are well mixed.
+// Inputs:
+//		- unsigned long long value: The value to hash.
+// Outputs:
+//		- unsigned int: The hash.
+//
+
+inline unsigned int TCHashInteger( unsigned long long value )
+{
+	return (unsigned int)( ( value * TC_HASH_INTEGER_MULTIPLIER ) >> 32 );
+}
+
+//
+// TCHashCombine
+//		- Will fold another hash into a running hash, used to hash structs member by member.
+// Inputs:
+//		- unsigned int seed: The running hash.
+//		- unsigned int hash: The hash to fold in.
+// Outputs:
+//		- unsigned int: The combined hash.
+//
+
+inline unsigned int TCHashCombine( unsigned int seed, unsigned int hash )
+{
+	return seed ^ ( hash + TC_HASH_COMBINE_CONSTANT + ( seed << 6 ) + ( seed >> 2 ) );
+}
+
+//
+// TCHash
+//		- Will hash a key by value.
+//		- By default the bytes of the key are hashed with the table's hash function, this suits plain structs.
+//		  Structs with padding, pointers or strings inside them should specialize this and use TCHashCombine.
+//
+
+template< typename Key >
+struct TCHash
+{
+	static inline unsigned int Hash( const Key& key, TCHashFunction function )
+	{
+		return function( (void*)&key, sizeof( Key ) );
+	}
+};
+
+//
+// Integer Specializations
+//		- Integers skip the byte loop and take a single multiply.
+//
+
+#define TC_DECLARE_INTEGER_HASH( type )												\
+	template<>																		\
+	struct TCHash< type >															\
+	{																				\
+		static inline unsigned int Hash( const type& key, TCHashFunction )			\
+		{																			\
+			return TCHashInteger( (unsigned long long)key );						\
+		}																			\
+	};
+
+TC_DECLARE_INTEGER_HASH( bool )
+TC_DECLARE_INTEGER_HASH( char )
+TC_DECLARE_INTEGER_HASH( signed char )
+TC_DECLARE_INTEGER_HASH( unsigned char )
+TC_DECLARE_INTEGER_HASH( short )
+TC_DECLARE_INTEGER_HASH( unsigned short )
+TC_DECLARE_INTEGER_HASH( int )
+TC_DECLARE_INTEGER_HASH( unsigned int )
+TC_DECLARE_INTEGER_HASH( long )
+TC_DECLARE_INTEGER_HASH( unsigned long )
+TC_DECLARE_INTEGER_HASH( long long )
+TC_DECLARE_INTEGER_HASH( unsigned long long )
+
+#undef TC_DECLARE_INTEGER_HASH
+
+//
+// Floating Point Specializations
+//		- Positive and negative zero compare equal, so they need to hash the same.
+//
+
+template<>
+struct TCHash< float >
+{
+	static inline unsigned int Hash( const float& key, TCHashFunction )
+	{
+		float value = ( key == 0.0f ) ? 0.0f : key;
+
+		unsigned int bits = 0;
+		memcpy( &bits, &value, sizeof( bits ) );
+		return TCHashInteger( bits );
+	}
+};
+
+template<>
+struct TCHash< double >
+{
+	static inline unsigned int Hash( const double& key, TCHashFunction )
+	{
+		double value = ( key == 0.0 ) ? 0.0 : key;
+
+		unsigned long long bits = 0;
+		memcpy( &bits, &value, sizeof( bits ) );
+		return TCHashInteger( bits ^ ( bits >> 32 ) );
+	}
+};
+
+//
+// Pointer Specialization
+//		- Pointers hash their address, not what they point to.
+//
+
+template< typename Object >
+struct TCHash< Object* >
+{
+	static inline unsigned int Hash( Object* const& key, TCHashFunction )
+	{
+		return TCHashInteger( (unsigned long long)(size_t)key );
+	}
+};
+
+//
+// String Specializations
+//		- Strings hash their characters with the table's hash function.
+//
+
+template<>
+struct TCHash< const char8* >
+{
+	static inline unsigned int Hash( const char8* const& key, TCHashFunction function )
+	{
+		int length = TCStringUtils::Length( key );
+		return ( length > 0 ) ? function( (void*)key, length ) : 0;
+	}
+};
+
+template<>
+struct TCHash< char8* >
+{
+	static inline unsigned int Hash( char8* const& key, TCHashFunction function )
+	{
+		return TCHash< const char8* >::Hash( key, function );
+	}
+};
+
+template<>
+struct TCHash< TCString >
+{
+	static inline unsigned int Hash( const TCString& key, TCHashFunction function )
+	{
+		return ( key.Length() > 0 ) ? function( (void*)key.Data(), key.Length() ) : 0;
+	}
+};
+
+//
+// TCEqual
+//		- Will determine if two keys are the same key.
+//
+
+template< typename Key >
+struct TCEqual
+{
+	static inline bool Equal( const Key& lhs, const Key& rhs )
+	{
+		return lhs == rhs;
+	}
+};
+
+template<>
+struct TCEqual< const char8* >
+{
+	static inline bool Equal( const char8* const& lhs, const char8* const& rhs )
+	{
+		return TCStringUtils::Compare( lhs, rhs ) == 0;
+	}
+};
+
+template<>
+struct TCEqual< char8* >
+{
+	static inline bool Equal( char8* const& lhs, char8* const& rhs )
+	{
+		return TCStringUtils::Compare( lhs, rhs ) == 0;
+	}
+};
+
+#endif // __TC_HASH_TRAITS_H__
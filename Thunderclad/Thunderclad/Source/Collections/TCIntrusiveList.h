@@ -0,0 +1,108 @@
+//
+// TCIntrusiveList.h
+// This file will declare a doubly linked list whose links live inside the objects it holds.
+//
+
+#ifndef __TC_INTRUSIVE_LIST_H__
+#define __TC_INTRUSIVE_LIST_H__
+
+//
+// Includes
+//
+
+#include "TCPlatformPrecompilerSymbols.h"
+
+#include <stddef.h>
+#include <iterator>
+
+//
+// Defines
+//
+
+//
+// TCIntrusiveLink
+//		- Embed one of these in an object for every list the object can be in at the same time.
+//
+
+template< typename Object >
+struct TCIntrusiveLink
+{
+	Object*		prev;
+	Object*		next;
+
+				TCIntrusiveLink()		: prev( NULL ), next( NULL ) {}
+};
+
+//
+// Class Declaration
+//		- The list never allocates or owns its objects, adding and removing only rewires the links, so both are O(1).
+//		- Link names the TCIntrusiveLink member the list uses, so one object can be in several lists at once.
+//		- An object can only be in one list per link, and must be removed before it is destroyed.
+//
+
+template< typename Object, TCIntrusiveLink< Object > Object::*Link >
+class TCIntrusiveList
+{
+	public:		// Members
+		class Iterator
+		{
+			public:		// Members
+				typedef std::forward_iterator_tag	iterator_category;
+				typedef Object						value_type;
+				typedef ptrdiff_t					difference_type;
+				typedef Object*						pointer;
+				typedef Object&						reference;
+
+			public:		// Methods
+								Iterator( Object* object )				: mObject( object ) {}
+
+				Object&			operator*() const						{ return *mObject; }
+				Object*			operator->() const						{ return mObject; }
+				Iterator&		operator++()							{ mObject = ( mObject->*Link ).next; return *this; }
+				Iterator		operator++( int )						{ Iterator previous = *this; ++(*this); return previous; }
+				bool			operator==( const Iterator& rhs ) const	{ return mObject == rhs.mObject; }
+				bool			operator!=( const Iterator& rhs ) const	{ return mObject != rhs.mObject; }
+
+			private:	// Members
+				Object*			mObject;
+		};
+
+	public:		// Methods
+						TCIntrusiveList();
+						~TCIntrusiveList();
+
+		inline int		Count() const				{ return mCount; }
+		inline bool		IsEmpty() const				{ return mCount == 0; }
+		inline Object*	First() const				{ return mFirst; }
+		inline Object*	Last() const				{ return mLast; }
+		static Object*	Next( Object* object )		{ return ( object->*Link ).next; }
+		static Object*	Previous( Object* object )	{ return ( object->*Link ).prev; }
+
+		void			PushFront( Object* object );
+		void			PushBack( Object* object );
+		void			InsertAfter( Object* position, Object* object );
+		void			Remove( Object* object );
+		Object*			PopFront();
+		void			Clear();
+
+		bool			Contains( Object* object ) const;
+
+		// Lower case so intrusive lists work with range-for and <algorithm>, the object being visited may be removed
+		// only if the loop reads the next object before removing it.
+		Iterator		begin() const				{ return Iterator( mFirst ); }
+		Iterator		end() const					{ return Iterator( NULL ); }
+
+	private:	// Members
+		Object*			mFirst;
+		Object*			mLast;
+		int				mCount;
+
+	private:	// Methods
+		// The links point into the objects, a copy would share them, so lists can't be copied.
+						TCIntrusiveList( const TCIntrusiveList& list );
+		TCIntrusiveList& operator=( const TCIntrusiveList& list );
+};
+
+#include "TCIntrusiveList.hpp"
+
+#endif // __TC_INTRUSIVE_LIST_H__
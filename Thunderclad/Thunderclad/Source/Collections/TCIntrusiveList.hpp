@@ -0,0 +1,258 @@
+//
+// TCIntrusiveList.hpp
+// This file will define the methods declared for an intrusive list.
+//
+
+#ifndef __TC_INTRUSIVE_LIST_HPP__
+#define __TC_INTRUSIVE_LIST_HPP__
+
+//
+// Includes
+//
+
+#include "TCIntrusiveList.h"
+
+//
+// Defines
+//
+
+//
+// Default Constructor
+//		- Initializes the list to a safe, empty state.
+// Inputs:
+//		- None.
+// Outputs:
+//		- None.
+//
+
+template< class Object, TCIntrusiveLink< Object > Object::*Link >
+TCIntrusiveList< Object, Link >::TCIntrusiveList()
+{
+	mFirst	= NULL;
+	mLast	= NULL;
+	mCount	= 0;
+}
+
+//
+// Destructor
+//		- Will unlink every object, the objects themselves are left alone.
+// Inputs:
+//		- None.
+// Outputs:
+//		- None.
+//
+
+template< class Object, TCIntrusiveLink< Object > Object::*Link >
+TCIntrusiveList< Object, Link >::~TCIntrusiveList()
+{
+	Clear();
+}
+
+//
+// PushFront
+//		- Will add an object to the front of the list.
+// Inputs:
+//		- Object* object: The object to add, it must not be in a list on this link.
+// Outputs:
+//		- None.
+//
+
+template< class Object, TCIntrusiveLink< Object > Object::*Link >
+void TCIntrusiveList< Object, Link >::PushFront( Object* object )
+{
+	TCIntrusiveLink< Object >& link = object->*Link;
+	TC_ASSERT( link.prev == NULL && link.next == NULL && mFirst != object && "Object is already in a list" );
+
+	link.prev = NULL;
+	link.next = mFirst;
+
+	if( mFirst != NULL )
+	{
+		( mFirst->*Link ).prev = object;
+	}
+	else
+	{
+		mLast = object;
+	}
+
+	mFirst = object;
+	mCount++;
+}
+
+//
+// PushBack
+//		- Will add an object to the back of the list.
+// Inputs:
+//		- Object* object: The object to add, it must not be in a list on this link.
+// Outputs:
+//		- None.
+//
+
+template< class Object, TCIntrusiveLink< Object > Object::*Link >
+void TCIntrusiveList< Object, Link >::PushBack( Object* object )
+{
+	TCIntrusiveLink< Object >& link = object->*Link;
+	TC_ASSERT( link.prev == NULL && link.next == NULL && mFirst != object && "Object is already in a list" );
+
+	link.prev = mLast;
+	link.next = NULL;
+
+	if( mLast != NULL )
+	{
+		( mLast->*Link ).next = object;
+	}
+	else
+	{
+		mFirst = object;
+	}
+
+	mLast = object;
+	mCount++;
+}
+
+//
+// InsertAfter
+//		- Will add an object right after another object in the list.
+// Inputs:
+//		- Object* position: The object in this list to add after, NULL adds to the front.
+//		- Object* object: The object to add, it must not be in a list on this link.
+// Outputs:
+//		- None.
+//
+
+template< class Object, TCIntrusiveLink< Object > Object::*Link >
+void TCIntrusiveList< Object, Link >::InsertAfter( Object* position, Object* object )
+{
+	if( position == NULL )
+	{
+		PushFront( object );
+		return;
+	}
+
+	if( position == mLast )
+	{
+		PushBack( object );
+		return;
+	}
+
+	TCIntrusiveLink< Object >& link = object->*Link;
+	TCIntrusiveLink< Object >& positionLink = position->*Link;
+	TC_ASSERT( link.prev == NULL && link.next == NULL && mFirst != object && "Object is already in a list" );
+
+	link.prev = position;
+	link.next = positionLink.next;
+	( positionLink.next->*Link ).prev = object;
+	positionLink.next = object;
+
+	mCount++;
+}
+
+//
+// Remove
+//		- Will take an object out of the list.
+// Inputs:
+//		- Object* object: The object to remove, it must be in this list.
+// Outputs:
+//		- None.
+//
+
+template< class Object, TCIntrusiveLink< Object > Object::*Link >
+void TCIntrusiveList< Object, Link >::Remove( Object* object )
+{
+	TCIntrusiveLink< Object >& link = object->*Link;
+
+	if( link.prev != NULL )
+	{
+		( link.prev->*Link ).next = link.next;
+	}
+	else
+	{
+		TC_ASSERT( mFirst == object && "Object is not in this list" );
+		mFirst = link.next;
+	}
+
+	if( link.next != NULL )
+	{
+		( link.next->*Link ).prev = link.prev;
+	}
+	else
+	{
+		TC_ASSERT( mLast == object && "Object is not in this list" );
+		mLast = link.prev;
+	}
+
+	link.prev = NULL;
+	link.next = NULL;
+	mCount--;
+}
+
+//
+// PopFront
+//		- Will take the first object out of the list.
+// Inputs:
+//		- None.
+// Outputs:
+//		- Object*: The object, NULL if the list was empty.
+//
+
+template< class Object, TCIntrusiveLink< Object > Object::*Link >
+Object* TCIntrusiveList< Object, Link >::PopFront()
+{
+	Object* object = mFirst;
+	if( object != NULL )
+	{
+		Remove( object );
+	}
+
+	return object;
+}
+
+//
+// Clear
+//		- Will unlink every object, the objects themselves are left alone.
+// Inputs:
+//		- None.
+// Outputs:
+//		- None.
+//
+
+template< class Object, TCIntrusiveLink< Object > Object::*Link >
+void TCIntrusiveList< Object, Link >::Clear()
+{
+	Object* object = mFirst;
+	while( object != NULL )
+	{
+		TCIntrusiveLink< Object >& link = object->*Link;
+		object = link.next;
+
+		link.prev = NULL;
+		link.next = NULL;
+	}
+
+	mFirst	= NULL;
+	mLast	= NULL;
+	mCount	= 0;
+}
+
+//
+// Contains
+//		- Will walk the list looking for an object.
+// Inputs:
+//		- Object* object: The object to look for.
+// Outputs:
+//		- bool: Is the object in this list.
+//
+
+template< class Object, TCIntrusiveLink< Object > Object::*Link >
+bool TCIntrusiveList< Object, Link >::Contains( Object* object ) const
+{
+	for( Object* current = mFirst; current != NULL; current = ( current->*Link ).next )
+	{
+		if( current == object )
+			return true;
+	}
+
+	return false;
+}
+
+#endif // __TC_INTRUSIVE_LIST_HPP__
@@ -11,51 +11,95 @@
 //
 
 #include "TCPlatformPrecompilerSymbols.h"
+#include "TCAllocator.h"
+
+//
+// Defines
+//
+
+#define DEFAULT_GROWTH_RATE		(1.5f)	// Growing geometrically keeps appends amortized constant time.
+#define TC_LIST_MIN_CAPACITY	(4)
 
 //
 // Class Declaration
+//		- Storage comes from the Allocator policy, see TCAllocator.h.
 //
 
-template< typename Object >
+template< typename Object, typename Allocator = TCHeapAllocator >
 class TCList
 {	
 	public:		// Members
+		typedef Object*			Iterator;		// Plain pointers, so lists work with range-for and <algorithm>.
+		typedef const Object*	ConstIterator;
+
 	public:		// Methods
 						TCList();
 						TCList( float growthRate );
+						TCList( const Allocator& allocator, float growthRate = DEFAULT_GROWTH_RATE );
 						TCList( const TCList& list );
+						TCList( TCList&& list );
 						~TCList();
 
 		TCList&			operator=( const TCList& list );
+		TCList&			operator=( TCList&& list );
 		inline Object&	operator[]( int index )			{ TC_ASSERT( index >= 0 && index < mNumObjects && "Accessing a list out of bounds"); return mList[ index ]; }
 
 		void			SetGrowthRate( float rate )		{ mGrowthRate = rate; }
-		float			GetGrowthRate()					{ return rate; }
+		float			GetGrowthRate()					{ return mGrowthRate; }
 
-		int				Count()							{ return mNumObjects; }
+		int				Count() const					{ return mNumObjects; }
 		int				Capacity()						{ return mCapacity; }
 
-		void			Append( Object object );
-		void			Remove( Object object );
+		Iterator		begin()							{ return mList; }
+		Iterator		end()							{ return mList + mNumObjects; }
+		ConstIterator	begin() const					{ return mList; }
+		ConstIterator	end() const						{ return mList + mNumObjects; }
+
+		void			Append( const Object& object );
+		void			Append( Object&& object );
+		template< typename... Args >
+		Object&			EmplaceBack( Args&&... args );
+		void			AppendRange( const Object* objects, int count );
+		void			AppendRange( const TCList& list );
+		void			Remove( const Object& object );
 		void			RemoveAt( int index );
+		void			RemoveSwap( const Object& object );
+		void			RemoveAtSwap( int index );
+		void			RemoveRange( int index, int count );
+		template< typename Predicate >
+		int				RemoveIf( Predicate predicate );
 		void			Insert( Object object, int index );
+		void			InsertRange( const Object* objects, int count, int index );
 		void			Clear();
-		bool			Contains( Object object );
-		int				Find( Object object );	
+		bool			Contains( const Object& object );
+		int				Find( const Object& object );	
 		void			Reserve( int amount );
+		void			ShrinkToFit();
 		void			Resize( int size );
 		void			Copy( const TCList& list );
 
 	private:	// Members
-		Object*		mList;
+		Object*		mList;			// Raw storage, only the first mNumObjects slots hold constructed objects.
 		int			mNumObjects;
 		int			mCapacity;
 		float		mGrowthRate;
+		Allocator	mAllocator;
 
 	private:	// Methods
-		void			IncreaseCapacity();
+		int				GetNextCapacity();
+		Object*			Allocate( int capacity );
+		void			MoveStorage( Object* newList, int capacity );
+		void			TakeStorage( TCList& list );
 };
 
+//
+// TCInlineList
+//		- A list that keeps its first Count objects inside itself, so small lists never touch the heap.
+//
+
+template< typename Object, unsigned int Count >
+using TCInlineList = TCList< Object, TCInlineAllocator< sizeof( Object ) * Count > >;
+
 #include "TCList.hpp"	// Include the declaration.
 
 #endif // __TCLIST_H__
\ No newline at end of file
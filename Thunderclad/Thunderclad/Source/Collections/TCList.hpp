@@ -14,12 +14,13 @@
 #include "TCMemUtils.h"
 #include "TCMathUtils.h"
 
+#include <string.h>
+#include <new>
+
 //
 // Defines
 //
 
-#define DEFAULT_GROWTH_RATE (1.0f)
-
 //
 // Default Constructor
 //		- Initializes the list to a save state.
@@ -29,8 +30,8 @@
 //		- None.
 //
 
-template <class Object>
-TCList< Object >::TCList()
+template <class Object, class Allocator>
+TCList< Object, Allocator >::TCList()
 {
 	mGrowthRate = DEFAULT_GROWTH_RATE;
 	mNumObjects = 0;
@@ -47,8 +48,28 @@ TCList< Object >::TCList()
 //		- None.
 //
 
-template <class Object>
-TCList< Object >::TCList( float growthRate )
+template <class Object, class Allocator>
+TCList< Object, Allocator >::TCList( float growthRate )
+{
+	mGrowthRate = growthRate;
+	mNumObjects	= 0;
+	mCapacity	= 0;
+	mList		= NULL;
+}
+
+//
+// Allocator Constructor
+//		- Initialize the list to a safe state drawing its storage from the allocator provided.
+// Inputs:
+//		- const Allocator& allocator: The allocator to draw from, e.g. one bound to an arena.
+//		- float growthRate: The rate at which the expansion of the list should happen.
+// Outputs:
+//		- None.
+//
+
+template <class Object, class Allocator>
+TCList< Object, Allocator >::TCList( const Allocator& allocator, float growthRate )
+	: mAllocator( allocator )
 {
 	mGrowthRate = growthRate;
 	mNumObjects	= 0;
@@ -65,13 +86,39 @@ TCList< Object >::TCList( float growthRate )
 //		- None.
 //
 
-template <class Object>
-TCList< Object >::TCList( const TCList& toCopy )
+template <class Object, class Allocator>
+TCList< Object, Allocator >::TCList( const TCList& toCopy )
+	: mAllocator( toCopy.mAllocator )
 {
-	mList = NULL;
+	mGrowthRate = DEFAULT_GROWTH_RATE;
+	mNumObjects = 0;
+	mList		= NULL;
+	mCapacity	= 0;
+
 	Copy( toCopy );
 }
 
+//
+// Move Constructor
+//		- Will take the storage of the list provided, leaving it empty.
+// Inputs:
+//		- TCList&& list: The list to take from.
+// Outputs:
+//		- None.
+//
+
+template <class Object, class Allocator>
+TCList< Object, Allocator >::TCList( TCList&& list )
+	: mAllocator( list.mAllocator )
+{
+	mGrowthRate = list.mGrowthRate;
+	mNumObjects = 0;
+	mList		= NULL;
+	mCapacity	= 0;
+
+	TakeStorage( list );
+}
+
 //
 // Destructor
 //		- Will free all resources associated with this object
@@ -81,8 +128,8 @@ TCList< Object >::TCList( const TCList& toCopy )
 //		- None.
 //
 
-template <class Object>
-TCList< Object >::~TCList()
+template <class Object, class Allocator>
+TCList< Object, Allocator >::~TCList()
 {
 	Clear();
 }
@@ -96,26 +143,86 @@ TCList< Object >::~TCList()
 //		- const TCList& list: The reference to this object.
 //
 
-template <class Object>
-TCList<Object>& TCList< Object >::operator=( const TCList<Object>& list )
+template <class Object, class Allocator>
+TCList< Object, Allocator >& TCList< Object, Allocator >::operator=( const TCList& list )
 {
-	Clear();
-	Copy( list );
+	if( this != &list )
+	{
+		Clear();
+		Copy( list );
+	}
+
+	return *this;
+}
+
+//
+// Move Assignment Operator
+//		- Will release our objects and take the storage and allocator of the list provided, leaving it empty.
+// Inputs:
+//		- TCList&& list: The list to take from.
+// Outputs:
+//		- TCList& list: The reference to this object.
+//
+
+template <class Object, class Allocator>
+TCList< Object, Allocator >& TCList< Object, Allocator >::operator=( TCList&& list )
+{
+	if( this != &list )
+	{
+		Clear();
+
+		mGrowthRate = list.mGrowthRate;
+		mAllocator	= list.mAllocator;
+		TakeStorage( list );
+	}
 
 	return *this;
 }
 
 //
 // Append
-//		- Will add an object to the end of the list.
+//		- Will add a copy of an object to the end of the list.
 // Inputs:
-//		- Object: The object to add.
+//		- const Object& object: The object to add.
 // Outputs:
 //		- None.
 //
 
-template <class Object>
-void TCList< Object >::Append( Object object )
+template <class Object, class Allocator>
+void TCList< Object, Allocator >::Append( const Object& object )
+{
+	EmplaceBack( object );
+}
+
+//
+// Append
+//		- Will move an object onto the end of the list.
+// Inputs:
+//		- Object&& object: The object to move in.
+// Outputs:
+//		- None.
+//
+
+template <class Object, class Allocator>
+void TCList< Object, Allocator >::Append( Object&& object )
+{
+	EmplaceBack( TCMove( object ) );
+}
+
+//
+// EmplaceBack
+//		- Will construct an object in place at the end of the list.
+//		- The arguments may refer to objects in this list, so the new object is constructed before the
+//		  old objects are moved out of their storage.
+// Inputs:
+//		- Args&&... args: The arguments to pass to the object's constructor.
+// Outputs:
+//		- Object&: The new object.
+//
+
+template <class Object, class Allocator>
+template <typename... Args>
+Object& TCList< Object, Allocator >::EmplaceBack( Args&&... args )
 {
 	//
 	// Check to see if we need to increase our capacity.
@@ -123,28 +230,93 @@ void TCList< Object >::Append( Object object )
 
 	if( mNumObjects + 1 > mCapacity )
 	{
-		IncreaseCapacity();
-	}
+		int capacity = GetNextCapacity();
+		Object* newList = Allocate( capacity );
 
-	//
-	// Add the object.
-	//
+		new ( &newList[ mNumObjects ] ) Object( TCForward< Args >( args )... );
+		MoveStorage( newList, capacity );
+	}
+	else
+	{
+		new ( &mList[ mNumObjects ] ) Object( TCForward< Args >( args )... );
+	}
 
-	mList[ mNumObjects ] = object;
 	mNumObjects++;
+	return mList[ mNumObjects - 1 ];
+}
+
+//
+// AppendRange
+//		- Will add copies of a run of objects to the end of the list, growing at most once.
+//		- The objects may be in this list, so they are copied before the old objects are moved out of their storage.
+// Inputs:
+//		- const Object* objects: The first object to add.
+//		- int count: The number of objects to add.
+// Outputs:
+//		- None.
+//
+
+template <class Object, class Allocator>
+void TCList< Object, Allocator >::AppendRange( const Object* objects, int count )
+{
+	if( count <= 0 )
+		return;
+
+	Object* destination = mList;
+	int capacity = mCapacity;
+
+	if( mNumObjects + count > mCapacity )
+	{
+		capacity = TC_MAX( GetNextCapacity(), mNumObjects + count );
+		destination = Allocate( capacity );
+	}
+
+	if( TCIsTriviallyCopyable< Object >::Value )
+	{
+		memcpy( (void*)&destination[ mNumObjects ], (const void*)objects, sizeof( Object ) * count );
+	}
+	else
+	{
+		for( int currentObject = 0; currentObject < count; ++currentObject )
+		{
+			new ( &destination[ mNumObjects + currentObject ] ) Object( objects[ currentObject ] );
+		}
+	}
+
+	if( destination != mList )
+	{
+		MoveStorage( destination, capacity );
+	}
+
+	mNumObjects += count;
+}
+
+//
+// AppendRange
+//		- Will add copies of every object in a list to the end of this list.
+// Inputs:
+//		- const TCList& list: The list to add, may be this list.
+// Outputs:
+//		- None.
+//
+
+template <class Object, class Allocator>
+void TCList< Object, Allocator >::AppendRange( const TCList& list )
+{
+	AppendRange( list.mList, list.mNumObjects );
 }
 
 //
 // Remove
 //		- Will remove an object from the list.
 // Inputs:
-//		- Object& object: The object to remove from the list.
+//		- const Object& object: The object to remove from the list.
 // Ouputs:
 //		- None.
 //
 
-template <class Object>
-void TCList< Object >::Remove( Object object )
+template <class Object, class Allocator>
+void TCList< Object, Allocator >::Remove( const Object& object )
 {
 	int index = Find( object );
 	if( index >= 0 )
@@ -162,69 +334,201 @@ void TCList< Object >::Remove( Object object )
 //		- None.
 //
 
-template <class Object>
-void TCList< Object >::RemoveAt( int index )
+template <class Object, class Allocator>
+void TCList< Object, Allocator >::RemoveAt( int index )
 {
-	if( index < 0 || index > mNumObjects )
+	if( index < 0 || index >= mNumObjects )
+	{
+		TC_ASSERT( 0 && "Tried to remove an object from a list at an invalid index." );
+		return;
+	}
+
+	RemoveRange( index, 1 );
+}
+
+//
+// RemoveSwap
+//		- Will remove an object from the list by moving the last object into its place, the order of the list is not kept.
+// Inputs:
+//		- const Object& object: The object to remove from the list.
+// Ouputs:
+//		- None.
+//
+
+template <class Object, class Allocator>
+void TCList< Object, Allocator >::RemoveSwap( const Object& object )
+{
+	int index = Find( object );
+	if( index >= 0 )
+	{
+		RemoveAtSwap( index );
+	}
+}
+
+//
+// RemoveAtSwap
+//		- Will remove an object in constant time by moving the last object into its place, the order of the list is not kept.
+// Inputs:
+//		- int index: The index to an object to remove from the list.
+// Outputs:
+//		- None.
+//
+
+template <class Object, class Allocator>
+void TCList< Object, Allocator >::RemoveAtSwap( int index )
+{
+	if( index < 0 || index >= mNumObjects )
 	{
 		TC_ASSERT( 0 && "Tried to remove an object from a list at an invalid index." );
 		return;
 	}
-	
+
+	mNumObjects--;
+	if( index != mNumObjects )
+	{
+		mList[ index ] = TCMove( mList[ mNumObjects ] );
+	}
+
+	mList[ mNumObjects ].~Object();
+}
+
+//
+// RemoveRange
+//		- Will remove a run of objects, shifting the rest of the list down once.
+// Inputs:
+//		- int index: The index of the first object to remove.
+//		- int count: The number of objects to remove.
+// Outputs:
+//		- None.
+//
+
+template <class Object, class Allocator>
+void TCList< Object, Allocator >::RemoveRange( int index, int count )
+{
+	if( index < 0 || count < 0 || index + count > mNumObjects )
+	{
+		TC_ASSERT( 0 && "Tried to remove a range from a list that is out of bounds." );
+		return;
+	}
+
+	if( count == 0 )
+		return;
+
 	//
-	// Shift the list down one.
+	// Shift the list down.
 	//
 
-	for( int currentObject = index; currentObject < mNumObjects; ++currentObject )
+	if( TCIsTriviallyCopyable< Object >::Value )
 	{
-		if( currentObject + 1 < mNumObjects )
+		memmove( (void*)&mList[ index ], (const void*)&mList[ index + count ], sizeof( Object ) * ( mNumObjects - index - count ) );
+	}
+	else
+	{
+		for( int currentObject = index; currentObject + count < mNumObjects; ++currentObject )
 		{
-			mList[ currentObject ] = mList[ currentObject + 1 ];
+			mList[ currentObject ] = TCMove( mList[ currentObject + count ] );
+		}
+
+		//
+		// Destroy the leftover objects at the end.
+		//
+
+		for( int currentObject = mNumObjects - count; currentObject < mNumObjects; ++currentObject )
+		{
+			mList[ currentObject ].~Object();
 		}
 	}
 
-	//
-	// Update the object size.
-	//
+	mNumObjects -= count;
+}
 
-	mNumObjects--;
+//
+// RemoveIf
+//		- Will remove every object the predicate accepts, compacting the list in a single pass.
+// Inputs:
+//		- Predicate predicate: Called with each object, returns true to remove it.
+// Outputs:
+//		- int: The number of objects removed.
+//
+
+template <class Object, class Allocator>
+template <typename Predicate>
+int TCList< Object, Allocator >::RemoveIf( Predicate predicate )
+{
+	int numKept = 0;
+	for( int currentObject = 0; currentObject < mNumObjects; ++currentObject )
+	{
+		if( predicate( mList[ currentObject ] ) )
+			continue;
+
+		if( numKept != currentObject )
+		{
+			mList[ numKept ] = TCMove( mList[ currentObject ] );
+		}
+
+		numKept++;
+	}
+
+	for( int currentObject = numKept; currentObject < mNumObjects; ++currentObject )
+	{
+		mList[ currentObject ].~Object();
+	}
+
+	int numRemoved = mNumObjects - numKept;
+	mNumObjects = numKept;
+
+	return numRemoved;
 }
 
 //
 // Insert
 //		- Will add an object at a specific location.
 // Inputs:
-//		- Object& object: The object to add.
-//		- int index: The index to add the object to at.
+//		- Object object: The object to add.
+//		- int index: The index to add the object to at, the count of the list will append it.
 // Outputs:
 //		- None.
 //
 
-template < class Object >
-void TCList< Object >::Insert( Object object, int index )
+template <class Object, class Allocator>
+void TCList< Object, Allocator >::Insert( Object object, int index )
 {
-	if( index < 0 || index >= mNumObjects )
+	if( index < 0 || index > mNumObjects )
 	{
 		TC_ASSERT( 0 && "Tried to insert an object into a TCList at an invalid index." );
 		return;
 	}
 
+	if( index == mNumObjects )
+	{
+		EmplaceBack( TCMove( object ) );
+		return;
+	}
+
 	//
 	// Make sure we have space.
 	//
 
 	if( mNumObjects + 1 > mCapacity )
 	{
-		IncreaseCapacity();
+		Reserve( GetNextCapacity() );
 	}
 
 	//
-	// Shift list forward.
+	// Shift list forward, the last object moves into the unconstructed slot at the end.
 	//
 
-	for( int currentObject = mNumObjects - 1; currentObject >= index; --currentObject )
+	if( TCIsTriviallyCopyable< Object >::Value )
+	{
+		memmove( (void*)&mList[ index + 1 ], (const void*)&mList[ index ], sizeof( Object ) * ( mNumObjects - index ) );
+	}
+	else
 	{
-		mList[ currentObject + 1 ] = mList[ currentObject ];		
+		new ( &mList[ mNumObjects ] ) Object( TCMove( mList[ mNumObjects - 1 ] ) );
+		for( int currentObject = mNumObjects - 1; currentObject > index; --currentObject )
+		{
+			mList[ currentObject ] = TCMove( mList[ currentObject - 1 ] );
+		}
 	}
 
 	//
@@ -232,7 +536,98 @@ void TCList< Object >::Insert( Object object, int index )
 	//
 
 	mNumObjects++;
-	mList[ index ] = object;
+	mList[ index ] = TCMove( object );
+}
+
+//
+// InsertRange
+//		- Will add copies of a run of objects at a specific location, shifting the rest of the list up once.
+// Inputs:
+//		- const Object* objects: The first object to add.
+//		- int count: The number of objects to add.
+//		- int index: The index to add the objects at, the count of the list will append them.
+// Outputs:
+//		- None.
+//
+
+template <class Object, class Allocator>
+void TCList< Object, Allocator >::InsertRange( const Object* objects, int count, int index )
+{
+	if( index < 0 || index > mNumObjects || count < 0 )
+	{
+		TC_ASSERT( 0 && "Tried to insert a range into a TCList at an invalid index." );
+		return;
+	}
+
+	if( count == 0 )
+		return;
+
+	if( index == mNumObjects )
+	{
+		AppendRange( objects, count );
+		return;
+	}
+
+	//
+	// Objects from this list would be moved while we shift, so copy them out first.
+	//
+
+	if( objects + count > mList && objects < mList + mNumObjects )
+	{
+		TCList copy( mAllocator );
+		copy.AppendRange( objects, count );
+		InsertRange( copy.mList, count, index );
+		return;
+	}
+
+	//
+	// Make sure we have space.
+	//
+
+	if( mNumObjects + count > mCapacity )
+	{
+		Reserve( TC_MAX( GetNextCapacity(), mNumObjects + count ) );
+	}
+
+	if( TCIsTriviallyCopyable< Object >::Value )
+	{
+		memmove( (void*)&mList[ index + count ], (const void*)&mList[ index ], sizeof( Object ) * ( mNumObjects - index ) );
+		memcpy( (void*)&mList[ index ], (const void*)objects, sizeof( Object ) * count );
+	}
+	else
+	{
+		//
+		// Shift the list forward, objects landing past the old end go into unconstructed slots.
+		//
+
+		for( int currentObject = mNumObjects - 1; currentObject >= index; --currentObject )
+		{
+			int target = currentObject + count;
+			if( target >= mNumObjects )
+			{
+				new ( &mList[ target ] ) Object( TCMove( mList[ currentObject ] ) );
+			}
+			else
+			{
+				mList[ target ] = TCMove( mList[ currentObject ] );
+			}
+		}
+
+		for( int currentObject = 0; currentObject < count; ++currentObject )
+		{
+			int target = index + currentObject;
+			if( target < mNumObjects )
+			{
+				mList[ target ] = objects[ currentObject ];
+			}
+			else
+			{
+				new ( &mList[ target ] ) Object( objects[ currentObject ] );
+			}
+		}
+	}
+
+	mNumObjects += count;
 }
 
 //
@@ -244,25 +639,31 @@ void TCList< Object >::Insert( Object object, int index )
 //		- None.
 //
 
-template <class Object>
-void TCList< Object >::Clear()
+template <class Object, class Allocator>
+void TCList< Object, Allocator >::Clear()
 {
-	mCapacity = 0;
+	for( int currentObject = 0; currentObject < mNumObjects; ++currentObject )
+	{
+		mList[ currentObject ].~Object();
+	}
+
+	mAllocator.Free( mList );
+	mList		= NULL;
+	mCapacity	= 0;
 	mNumObjects = 0;
-	TC_SAFE_DELETE_ARRAY( mList );
 }
 
 //
 // Contains
 //		- Will return whether or not the object specified is in the list.
 // Inputs:
-//		- Object& object: The object to search for.
+//		- const Object& object: The object to search for.
 // Outputs:
 //		- bool: Was the object found or not.
 //
 
-template <class Object>
-bool TCList< Object >::Contains( Object object )
+template <class Object, class Allocator>
+bool TCList< Object, Allocator >::Contains( const Object& object )
 {
 	return ( Find( object ) != -1 );
 }
@@ -271,13 +672,13 @@ bool TCList< Object >::Contains( Object object )
 // Find
 //		- Will return the index of an object provided in the list, or -1 if not found.
 // Inputs:
-//		- Object& object: The object to search for.
+//		- const Object& object: The object to search for.
 // Outputs:
 //		- int: The index of the object, -1 if not found.
 //
 
-template <class Object>
-int TCList< Object >::Find( Object object )
+template <class Object, class Allocator>
+int TCList< Object, Allocator >::Find( const Object& object )
 {
 	for( int currentObject = 0; currentObject < mNumObjects; ++currentObject )
 	{
@@ -299,50 +700,71 @@ int TCList< Object >::Find( Object object )
 //		- None.
 //
 
-template <class Object>
-void TCList< Object >::Reserve( int capacity )
+template <class Object, class Allocator>
+void TCList< Object, Allocator >::Reserve( int capacity )
 {
-	if( mCapacity > capacity )
+	if( mCapacity >= capacity )
 		return;
 
-	//
-	// Increase the size of the list..
-	//
+	MoveStorage( Allocate( capacity ), capacity );
+}
 
-	mCapacity = capacity;
+//
+// ShrinkToFit
+//		- Will reduce the capacity of the list to its count, releasing the unused storage.
+// Inputs:
+//		- None.
+// Outputs:
+//		- None.
+//
 
-	Object* oldList = mList;
-	mList = new Object[ mCapacity ];
+template <class Object, class Allocator>
+void TCList< Object, Allocator >::ShrinkToFit()
+{
+	if( mCapacity == mNumObjects )
+		return;
 
 	//
-	// Copy over the old list.
+	// Storage held inside the allocator, like an inline buffer, frees nothing by shrinking.
 	//
 
-	for( int currentObject = 0; currentObject < mNumObjects; ++currentObject )
+	if( mList != NULL && !mAllocator.CanTransfer( mList ) )
+		return;
+
+	if( mNumObjects == 0 )
 	{
-		mList[ currentObject ] = oldList[ currentObject ];
+		Clear();
+		return;
 	}
 
-	//
-	// Free the old list.
-	//
-
-	TC_SAFE_DELETE_ARRAY( oldList );
+	MoveStorage( Allocate( mNumObjects ), mNumObjects );
 }
 
 //
 // Resize
 //		- This will increase the capacity to the size provided and will update the count.
+//		- New objects are default constructed, objects past the new size are destroyed.
 // Inputs:
 //		- int size: The new size to grow to.
 // Outputs:
 //		- None.
 //
 
-template <class Object>
-void TCList< Object >::Resize( int size )
+template <class Object, class Allocator>
+void TCList< Object, Allocator >::Resize( int size )
 {
 	Reserve( size );
+
+	for( int currentObject = size; currentObject < mNumObjects; ++currentObject )
+	{
+		mList[ currentObject ].~Object();
+	}
+
+	for( int currentObject = mNumObjects; currentObject < size; ++currentObject )
+	{
+		new ( &mList[ currentObject ] ) Object();
+	}
+
 	mNumObjects = size;
 }
 
@@ -355,73 +777,144 @@ void TCList< Object >::Resize( int size )
 //		- void.
 //
 
-template <class Object>
-void TCList< Object >::Copy( const TCList<Object>& toCopy )
+template <class Object, class Allocator>
+void TCList< Object, Allocator >::Copy( const TCList& toCopy )
 {
 	//
 	// Free old memory.
 	//
 
 	Clear();
-	
+
 	//
 	// Copy over variables.
 	//
 
 	mCapacity = toCopy.mCapacity;
 	mGrowthRate = toCopy.mGrowthRate;
-	mNumObjects = toCopy.mNumObjects;
 
 	//
-	// Copy over the list information.
+	// Copy construct the objects straight into the new storage.
 	//
 
-	mList = new Object[ mCapacity ];
-	for( int currentObject = 0; currentObject < mNumObjects; ++currentObject )
+	mList = Allocate( mCapacity );
+	for( int currentObject = 0; currentObject < toCopy.mNumObjects; ++currentObject )
 	{
-		mList[ currentObject ] = toCopy.mList[ currentObject ];
+		new ( &mList[ currentObject ] ) Object( toCopy.mList[ currentObject ] );
 	}
+
+	mNumObjects = toCopy.mNumObjects;
 }
 
 //
-// IncreaseCapacity
-//		- Will increase the capacity of the list with a specified growth rate.
+// GetNextCapacity
+//		- Will calculate the capacity to grow to with the list's growth rate.
+//		- An empty list starts at the allocator's inline capacity so a small list fills it before reaching the heap.
 // Inputs:
 //		- None.
 // Outputs:
-//		- None.
+//		- int: The new capacity.
 //
 
-template <class Object>
-void TCList< Object >::IncreaseCapacity()
+template <class Object, class Allocator>
+int TCList< Object, Allocator >::GetNextCapacity()
 {
-	//
-	// Calculate our new capacity.
-	//
+	int capacity = TC_MAX((int)((float)mCapacity * mGrowthRate), mCapacity + 1);
 
-	mCapacity = TC_MAX((int)((float)mCapacity * mGrowthRate), mCapacity + 1);
-	
-	//
-	// Allocate a new array.
-	//
+	int minimumCapacity = (int)( mAllocator.GetInlineSize() / sizeof( Object ) );
+	if( minimumCapacity == 0 )
+	{
+		minimumCapacity = TC_LIST_MIN_CAPACITY;
+	}
 
-	Object* oldList = mList;
-	mList = new Object[ mCapacity ];
+	return TC_MAX( capacity, minimumCapacity );
+}
 
-	//
-	// Copy over the old list.
-	//
+//
+// Allocate
+//		- Will allocate uninitialized storage for objects, nothing is constructed.
+// Inputs:
+//		- int capacity: The number of objects to make room for.
+// Outputs:
+//		- Object*: The storage, NULL if the capacity is zero.
+//
 
-	for( int currentObject = 0; currentObject < mNumObjects; ++currentObject )
+template <class Object, class Allocator>
+Object* TCList< Object, Allocator >::Allocate( int capacity )
+{
+	if( capacity <= 0 )
+		return NULL;
+
+	return (Object*)mAllocator.Allocate( sizeof( Object ) * capacity );
+}
+
+//
+// MoveStorage
+//		- Will move our objects into new storage and release the old storage.
+// Inputs:
+//		- Object* newList: The storage to move into, from Allocate.
+//		- int capacity: The capacity of the new storage.
+// Outputs:
+//		- None.
+//
+
+template <class Object, class Allocator>
+void TCList< Object, Allocator >::MoveStorage( Object* newList, int capacity )
+{
+	if( TCIsTriviallyCopyable< Object >::Value )
+	{
+		if( mNumObjects > 0 )
+		{
+			memcpy( (void*)newList, (const void*)mList, sizeof( Object ) * mNumObjects );
+		}
+	}
+	else
 	{
-		mList[ currentObject ] = oldList[ currentObject ];
+		for( int currentObject = 0; currentObject < mNumObjects; ++currentObject )
+		{
+			new ( &newList[ currentObject ] ) Object( TCMove( mList[ currentObject ] ) );
+			mList[ currentObject ].~Object();
+		}
 	}
 
-	//
-	// Delete the old list.
-	//
+	mAllocator.Free( mList );
+	mList		= newList;
+	mCapacity	= capacity;
+}
+
+//
+// TakeStorage
+//		- Will take the objects of the list provided, leaving it empty, we must be empty and share its allocator.
+//		- Storage the allocator can't hand over, like an inline buffer, has its objects moved one by one instead.
+// Inputs:
+//		- TCList& list: The list to take from.
+// Outputs:
+//		- None.
+//
+
+template <class Object, class Allocator>
+void TCList< Object, Allocator >::TakeStorage( TCList& list )
+{
+	if( list.mList == NULL || list.mAllocator.CanTransfer( list.mList ) )
+	{
+		mList		= list.mList;
+		mNumObjects = list.mNumObjects;
+		mCapacity	= list.mCapacity;
+
+		list.mList			= NULL;
+		list.mNumObjects	= 0;
+		list.mCapacity		= 0;
+		return;
+	}
+
+	Reserve( list.mNumObjects );
+	for( int currentObject = 0; currentObject < list.mNumObjects; ++currentObject )
+	{
+		new ( &mList[ currentObject ] ) Object( TCMove( list.mList[ currentObject ] ) );
+	}
 
-	TC_SAFE_DELETE_ARRAY( oldList );
+	mNumObjects = list.mNumObjects;
+	list.Clear();
 }
 
-#endif // __TCLIST_HPP__
\ No newline at end of file
+#endif // __TCLIST_HPP__
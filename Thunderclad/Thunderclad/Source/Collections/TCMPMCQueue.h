@@ -0,0 +1,77 @@
+//
+// TCMPMCQueue.h
+// This file will declare a bounded queue that any number of threads can push to and pop from without locks.
+//
+
+#ifndef __TC_MPMC_QUEUE_H__
+#define __TC_MPMC_QUEUE_H__
+
+//
+// Includes
+//
+
+#include "TCPlatformPrecompilerSymbols.h"
+#include "TCMemUtils.h"
+
+#include <atomic>
+
+//
+// Defines
+//
+
+//
+// Class Declaration
+//		- Dmitry Vyukov's bounded MPMC queue. Every slot carries a sequence number that says whose turn it is, so
+//		  a thread claims a slot with one compare and swap on the shared index and then works on the slot alone.
+//		- The capacity is rounded up to a power of two and never changes, pushing to a full queue fails instead of growing.
+//		- PushRange and PopRange claim a run of ready slots with a single compare and swap.
+//		- Objects pushed by one thread are popped in the order they were pushed, there is no order between threads.
+//
+
+template< typename Object >
+class TCMPMCQueue
+{
+	public:		// Members
+	public:		// Methods
+							TCMPMCQueue( unsigned int capacity );
+							~TCMPMCQueue();
+
+		unsigned int		Capacity() const				{ return mMask + 1; }
+		unsigned int		Count() const;
+		bool				IsEmpty() const					{ return Count() == 0; }
+
+		bool				Push( const Object& object );
+		bool				Push( Object&& object );
+		int					PushRange( const Object* objects, int count );
+
+		bool				Pop( Object& object );
+		int					PopRange( Object* objects, int maxCount );
+
+	private:	// Members
+		struct Slot
+		{
+			std::atomic< unsigned int >	sequence;	// Equal to the position when free to push, the position + 1 when ready to pop.
+			Object						object;
+		};
+
+		Slot*						mSlots;
+		unsigned int				mMask;
+		char						mPadding0[ TC_CACHE_LINE_SIZE ];
+
+		std::atomic< unsigned int >	mPushPosition;
+		char						mPadding1[ TC_CACHE_LINE_SIZE ];
+
+		std::atomic< unsigned int >	mPopPosition;
+		char						mPadding2[ TC_CACHE_LINE_SIZE ];
+
+	private:	// Methods
+		// Queues are shared between threads by address, so they can't be copied.
+							TCMPMCQueue( const TCMPMCQueue& queue );
+		TCMPMCQueue&		operator=( const TCMPMCQueue& queue );
+
+		int					ClaimSlots( std::atomic< unsigned int >& position, unsigned int readyOffset, int wanted, unsigned int& firstPosition );
+};
+
+#include "TCMPMCQueue.hpp"
+
+#endif // __TC_MPMC_QUEUE_H__
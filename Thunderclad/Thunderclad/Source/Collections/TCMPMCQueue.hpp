@@ -0,0 +1,272 @@
+//
+// TCMPMCQueue.hpp
+// This file will define the methods declared for a multiple producer, multiple consumer queue.
+//
+
+#ifndef __TC_MPMC_QUEUE_HPP__
+#define __TC_MPMC_QUEUE_HPP__
+
+//
+// Includes
+//
+
+#include "TCMPMCQueue.h"
+#include "TCLogger.h"
+
+//
+// Defines
+//
+
+#define TC_MPMC_QUEUE_MIN_CAPACITY	(2)		// A single slot can't tell a full queue from an empty one.
+
+//
+// Constructor
+//		- Will allocate the slots, the capacity is rounded up to a power of two so positions wrap with a mask.
+// Inputs:
+//		- unsigned int capacity: The most objects the queue holds at once.
+// Outputs:
+//		- None.
+//
+
+template< class Object >
+TCMPMCQueue< Object >::TCMPMCQueue( unsigned int capacity )
+{
+	if( capacity > ( 1u << 31 ) )
+	{
+		TCLogger::GetInstance()->LogFailure("Provided an invalid capacity to the MPMC queue.");
+		capacity = 1u << 31;
+	}
+
+	unsigned int roundedCapacity = TC_MPMC_QUEUE_MIN_CAPACITY;
+	while( roundedCapacity < capacity )
+	{
+		roundedCapacity <<= 1;
+	}
+
+	mSlots	= new Slot[ roundedCapacity ];
+	mMask	= roundedCapacity - 1;
+
+	for( unsigned int currentSlot = 0; currentSlot < roundedCapacity; ++currentSlot )
+	{
+		mSlots[ currentSlot ].sequence.store( currentSlot, std::memory_order_relaxed );
+	}
+
+	mPushPosition.store( 0, std::memory_order_relaxed );
+	mPopPosition.store( 0, std::memory_order_relaxed );
+}
+
+//
+// Destructor
+//		- Will free the slots, no thread may be using the queue.
+// Inputs:
+//		- None.
+// Outputs:
+//		- None.
+//
+
+template< class Object >
+TCMPMCQueue< Object >::~TCMPMCQueue()
+{
+	TC_SAFE_DELETE_ARRAY( mSlots );
+}
+
+//
+// Count
+//		- Will return the number of claimed slots, it may already be out of date if other threads are working.
+// Inputs:
+//		- None.
+// Outputs:
+//		- unsigned int: The number of objects.
+//
+
+template< class Object >
+unsigned int TCMPMCQueue< Object >::Count() const
+{
+	unsigned int popPosition = mPopPosition.load( std::memory_order_acquire );
+	unsigned int pushPosition = mPushPosition.load( std::memory_order_acquire );
+
+	int count = (int)( pushPosition - popPosition );
+	return ( count > 0 ) ? (unsigned int)count : 0;
+}
+
+//
+// Push
+//		- Will add an object to the back of the queue.
+// Inputs:
+//		- const Object& object: The object to add.
+// Outputs:
+//		- bool: False if the queue was full.
+//
+
+template< class Object >
+bool TCMPMCQueue< Object >::Push( const Object& object )
+{
+	unsigned int position = 0;
+	if( ClaimSlots( mPushPosition, 0, 1, position ) == 0 )
+		return false;
+
+	Slot& slot = mSlots[ position & mMask ];
+	slot.object = object;
+	slot.sequence.store( position + 1, std::memory_order_release );
+
+	return true;
+}
+
+//
+// Push
+//		- Will move an object to the back of the queue.
+// Inputs:
+//		- Object&& object: The object to move in, it is left untouched if the queue was full.
+// Outputs:
+//		- bool: False if the queue was full.
+//
+
+template< class Object >
+bool TCMPMCQueue< Object >::Push( Object&& object )
+{
+	unsigned int position = 0;
+	if( ClaimSlots( mPushPosition, 0, 1, position ) == 0 )
+		return false;
+
+	Slot& slot = mSlots[ position & mMask ];
+	slot.object = TCMove( object );
+	slot.sequence.store( position + 1, std::memory_order_release );
+
+	return true;
+}
+
+//
+// PushRange
+//		- Will add as many objects as there are free slots in a row, the run stays together in the queue.
+// Inputs:
+//		- const Object* objects: The first object to add.
+//		- int count: The number of objects to add.
+// Outputs:
+//		- int: The number of objects added, the first ones in the run.
+//
+
+template< class Object >
+int TCMPMCQueue< Object >::PushRange( const Object* objects, int count )
+{
+	unsigned int position = 0;
+	int numObjects = ClaimSlots( mPushPosition, 0, count, position );
+
+	for( int currentObject = 0; currentObject < numObjects; ++currentObject )
+	{
+		Slot& slot = mSlots[ ( position + currentObject ) & mMask ];
+		slot.object = objects[ currentObject ];
+		slot.sequence.store( position + currentObject + 1, std::memory_order_release );
+	}
+
+	return numObjects;
+}
+
+//
+// Pop
+//		- Will take the object at the front of the queue.
+// Inputs:
+//		- Object& object: Set to the object, untouched if the queue was empty.
+// Outputs:
+//		- bool: False if the queue was empty.
+//
+
+template< class Object >
+bool TCMPMCQueue< Object >::Pop( Object& object )
+{
+	unsigned int position = 0;
+	if( ClaimSlots( mPopPosition, 1, 1, position ) == 0 )
+		return false;
+
+	Slot& slot = mSlots[ position & mMask ];
+	object = TCMove( slot.object );
+	slot.sequence.store( position + mMask + 1, std::memory_order_release );	// Free for the push one lap later.
+
+	return true;
+}
+
+//
+// PopRange
+//		- Will take as many objects as are ready in a row, up to the number requested.
+// Inputs:
+//		- Object* objects: Room for the objects taken.
+//		- int maxCount: The most objects to take.
+// Outputs:
+//		- int: The number of objects taken.
+//
+
+template< class Object >
+int TCMPMCQueue< Object >::PopRange( Object* objects, int maxCount )
+{
+	unsigned int position = 0;
+	int numObjects = ClaimSlots( mPopPosition, 1, maxCount, position );
+
+	for( int currentObject = 0; currentObject < numObjects; ++currentObject )
+	{
+		Slot& slot = mSlots[ ( position + currentObject ) & mMask ];
+		objects[ currentObject ] = TCMove( slot.object );
+		slot.sequence.store( position + currentObject + mMask + 1, std::memory_order_release );
+	}
+
+	return numObjects;
+}
+
+//
+// ClaimSlots
+//		- Will claim a run of slots that are ready for this side of the queue. A slot at a position is ready to push when
+//		  its sequence equals the position and ready to pop when it equals the position + 1. A ready slot can't change until
+//		  its position is claimed, so once the run is counted one compare and swap on the shared position claims all of it.
+// Inputs:
+//		- std::atomic< unsigned int >& position: The push or pop position to advance.
+//		- unsigned int readyOffset: 0 when pushing, 1 when popping.
+//		- int wanted: The most slots to claim.
+//		- unsigned int& firstPosition: Set to the position of the first slot claimed.
+// Outputs:
+//		- int: The number of slots claimed, 0 if the queue was full when pushing or empty when popping.
+//
+
+template< class Object >
+int TCMPMCQueue< Object >::ClaimSlots( std::atomic< unsigned int >& position, unsigned int readyOffset, int wanted, unsigned int& firstPosition )
+{
+	if( wanted <= 0 )
+		return 0;
+
+	unsigned int current = position.load( std::memory_order_relaxed );
+	for( ;; )
+	{
+		int numSlots = 0;
+		int difference = 0;
+		while( numSlots < wanted )
+		{
+			unsigned int slotPosition = current + numSlots;
+			unsigned int sequence = mSlots[ slotPosition & mMask ].sequence.load( std::memory_order_acquire );
+
+			difference = (int)( sequence - ( slotPosition + readyOffset ) );
+			if( difference != 0 )
+				break;
+
+			numSlots++;
+		}
+
+		if( numSlots == 0 )
+		{
+			//
+			// A slot from the last lap means the queue is full or empty. A slot from a later position means another
+			// thread claimed it first, so catch up and try again.
+			//
+
+			if( difference < 0 )
+				return 0;
+
+			current = position.load( std::memory_order_relaxed );
+			continue;
+		}
+
+		if( position.compare_exchange_weak( current, current + numSlots, std::memory_order_relaxed ) )
+		{
+			firstPosition = current;
+			return numSlots;
+		}
+	}
+}
+
+#endif // __TC_MPMC_QUEUE_HPP__
@@ -0,0 +1,77 @@
+//
+// TCSPSCQueue.h
+// This file will declare a bounded queue for passing objects from one thread to one other thread without locks.
+//
+
+#ifndef __TC_SPSC_QUEUE_H__
+#define __TC_SPSC_QUEUE_H__
+
+//
+// Includes
+//
+
+#include "TCPlatformPrecompilerSymbols.h"
+#include "TCMemUtils.h"
+
+#include <atomic>
+
+//
+// Defines
+//
+
+//
+// Class Declaration
+//		- Exactly one thread may push and exactly one other thread may pop, use TCMPMCQueue when more threads share a side.
+//		- The capacity is rounded up to a power of two and never changes, pushing to a full queue fails instead of growing.
+//		- The producer and consumer indices live on separate cache lines, and each side keeps a cached copy of the other
+//		  side's index so it only touches the shared line when the cached copy says the queue is full or empty.
+//
+
+template< typename Object >
+class TCSPSCQueue
+{
+	public:		// Members
+	public:		// Methods
+							TCSPSCQueue( unsigned int capacity );
+							~TCSPSCQueue();
+
+		unsigned int		Capacity() const				{ return mMask + 1; }
+		unsigned int		Count() const;
+		bool				IsEmpty() const					{ return Count() == 0; }
+
+		// Producer thread only.
+		bool				Push( const Object& object );
+		bool				Push( Object&& object );
+		int					PushRange( const Object* objects, int count );
+
+		// Consumer thread only.
+		bool				Pop( Object& object );
+		int					PopRange( Object* objects, int maxCount );
+
+	private:	// Members
+		Object*						mObjects;
+		unsigned int				mMask;
+		char						mPadding0[ TC_CACHE_LINE_SIZE ];
+
+		// Written by the producer.
+		std::atomic< unsigned int >	mTail;
+		unsigned int				mCachedHead;
+		char						mPadding1[ TC_CACHE_LINE_SIZE ];
+
+		// Written by the consumer.
+		std::atomic< unsigned int >	mHead;
+		unsigned int				mCachedTail;
+		char						mPadding2[ TC_CACHE_LINE_SIZE ];
+
+	private:	// Methods
+		// Queues are shared between threads by address, so they can't be copied.
+							TCSPSCQueue( const TCSPSCQueue& queue );
+		TCSPSCQueue&		operator=( const TCSPSCQueue& queue );
+
+		unsigned int		FreeSlots( unsigned int tail, unsigned int wanted );
+		unsigned int		ReadySlots( unsigned int head, unsigned int wanted );
+};
+
+#include "TCSPSCQueue.hpp"
+
+#endif // __TC_SPSC_QUEUE_H__
@@ -0,0 +1,259 @@
+//
+// TCSPSCQueue.hpp
+// This file will define the methods declared for a single producer, single consumer queue.
+//
+
+#ifndef __TC_SPSC_QUEUE_HPP__
+#define __TC_SPSC_QUEUE_HPP__
+
+//
+// Includes
+//
+
+#include "TCSPSCQueue.h"
+#include "TCLogger.h"
+
+//
+// Defines
+//
+
+#define TC_SPSC_QUEUE_MIN_CAPACITY	(2)
+
+//
+// Constructor
+//		- Will allocate room for the objects, the capacity is rounded up to a power of two so indices wrap with a mask.
+// Inputs:
+//		- unsigned int capacity: The most objects the queue holds at once.
+// Outputs:
+//		- None.
+//
+
+template< class Object >
+TCSPSCQueue< Object >::TCSPSCQueue( unsigned int capacity )
+{
+	if( capacity > ( 1u << 31 ) )
+	{
+		TCLogger::GetInstance()->LogFailure("Provided an invalid capacity to the SPSC queue.");
+		capacity = 1u << 31;
+	}
+
+	unsigned int roundedCapacity = TC_SPSC_QUEUE_MIN_CAPACITY;
+	while( roundedCapacity < capacity )
+	{
+		roundedCapacity <<= 1;
+	}
+
+	mObjects	= new Object[ roundedCapacity ];
+	mMask		= roundedCapacity - 1;
+
+	mTail.store( 0, std::memory_order_relaxed );
+	mCachedHead	= 0;
+	mHead.store( 0, std::memory_order_relaxed );
+	mCachedTail	= 0;
+}
+
+//
+// Destructor
+//		- Will free the objects, no thread may be using the queue.
+// Inputs:
+//		- None.
+// Outputs:
+//		- None.
+//
+
+template< class Object >
+TCSPSCQueue< Object >::~TCSPSCQueue()
+{
+	TC_SAFE_DELETE_ARRAY( mObjects );
+}
+
+//
+// Count
+//		- Will return the number of objects in the queue, it may already be out of date if the other thread is working.
+// Inputs:
+//		- None.
+// Outputs:
+//		- unsigned int: The number of objects.
+//
+
+template< class Object >
+unsigned int TCSPSCQueue< Object >::Count() const
+{
+	unsigned int head = mHead.load( std::memory_order_acquire );
+	unsigned int tail = mTail.load( std::memory_order_acquire );
+
+	return tail - head;
+}
+
+//
+// Push
+//		- Will add an object to the back of the queue.
+// Inputs:
+//		- const Object& object: The object to add.
+// Outputs:
+//		- bool: False if the queue was full.
+//
+
+template< class Object >
+bool TCSPSCQueue< Object >::Push( const Object& object )
+{
+	unsigned int tail = mTail.load( std::memory_order_relaxed );
+	if( FreeSlots( tail, 1 ) == 0 )
+		return false;
+
+	mObjects[ tail & mMask ] = object;
+	mTail.store( tail + 1, std::memory_order_release );
+
+	return true;
+}
+
+//
+// Push
+//		- Will move an object to the back of the queue.
+// Inputs:
+//		- Object&& object: The object to move in, it is left untouched if the queue was full.
+// Outputs:
+//		- bool: False if the queue was full.
+//
+
+template< class Object >
+bool TCSPSCQueue< Object >::Push( Object&& object )
+{
+	unsigned int tail = mTail.load( std::memory_order_relaxed );
+	if( FreeSlots( tail, 1 ) == 0 )
+		return false;
+
+	mObjects[ tail & mMask ] = TCMove( object );
+	mTail.store( tail + 1, std::memory_order_release );
+
+	return true;
+}
+
+//
+// PushRange
+//		- Will add as many objects as fit, the consumer sees the whole batch at once.
+// Inputs:
+//		- const Object* objects: The first object to add.
+//		- int count: The number of objects to add.
+// Outputs:
+//		- int: The number of objects added, the first ones in the run.
+//
+
+template< class Object >
+int TCSPSCQueue< Object >::PushRange( const Object* objects, int count )
+{
+	if( count <= 0 )
+		return 0;
+
+	unsigned int tail = mTail.load( std::memory_order_relaxed );
+	unsigned int numObjects = FreeSlots( tail, (unsigned int)count );
+
+	for( unsigned int currentObject = 0; currentObject < numObjects; ++currentObject )
+	{
+		mObjects[ ( tail + currentObject ) & mMask ] = objects[ currentObject ];
+	}
+
+	mTail.store( tail + numObjects, std::memory_order_release );
+
+	return (int)numObjects;
+}
+
+//
+// Pop
+//		- Will take the object at the front of the queue.
+// Inputs:
+//		- Object& object: Set to the object, untouched if the queue was empty.
+// Outputs:
+//		- bool: False if the queue was empty.
+//
+
+template< class Object >
+bool TCSPSCQueue< Object >::Pop( Object& object )
+{
+	unsigned int head = mHead.load( std::memory_order_relaxed );
+	if( ReadySlots( head, 1 ) == 0 )
+		return false;
+
+	object = TCMove( mObjects[ head & mMask ] );
+	mHead.store( head + 1, std::memory_order_release );
+
+	return true;
+}
+
+//
+// PopRange
+//		- Will take as many objects as are ready, up to the number requested.
+// Inputs:
+//		- Object* objects: Room for the objects taken.
+//		- int maxCount: The most objects to take.
+// Outputs:
+//		- int: The number of objects taken.
+//
+
+template< class Object >
+int TCSPSCQueue< Object >::PopRange( Object* objects, int maxCount )
+{
+	if( maxCount <= 0 )
+		return 0;
+
+	unsigned int head = mHead.load( std::memory_order_relaxed );
+	unsigned int numObjects = ReadySlots( head, (unsigned int)maxCount );
+
+	for( unsigned int currentObject = 0; currentObject < numObjects; ++currentObject )
+	{
+		objects[ currentObject ] = TCMove( mObjects[ ( head + currentObject ) & mMask ] );
+	}
+
+	mHead.store( head + numObjects, std::memory_order_release );
+
+	return (int)numObjects;
+}
+
+//
+// FreeSlots
+//		- Will find how many slots the producer can fill, the consumer's index is only reloaded when the cached one is too old.
+// Inputs:
+//		- unsigned int tail: The producer's index.
+//		- unsigned int wanted: The number of slots wanted.
+// Outputs:
+//		- unsigned int: The number of free slots, no more than wanted.
+//
+
+template< class Object >
+unsigned int TCSPSCQueue< Object >::FreeSlots( unsigned int tail, unsigned int wanted )
+{
+	unsigned int capacity = mMask + 1;
+	unsigned int freeSlots = capacity - ( tail - mCachedHead );
+	if( freeSlots < wanted )
+	{
+		mCachedHead = mHead.load( std::memory_order_acquire );
+		freeSlots = capacity - ( tail - mCachedHead );
+	}
+
+	return ( freeSlots < wanted ) ? freeSlots : wanted;
+}
+
+//
+// ReadySlots
+//		- Will find how many objects the consumer can take, the producer's index is only reloaded when the cached one is too old.
+// Inputs:
+//		- unsigned int head: The consumer's index.
+//		- unsigned int wanted: The number of objects wanted.
+// Outputs:
+//		- unsigned int: The number of ready objects, no more than wanted.
+//
+
+template< class Object >
+unsigned int TCSPSCQueue< Object >::ReadySlots( unsigned int head, unsigned int wanted )
+{
+	unsigned int readySlots = mCachedTail - head;
+	if( readySlots < wanted )
+	{
+		mCachedTail = mTail.load( std::memory_order_acquire );
+		readySlots = mCachedTail - head;
+	}
+
+	return ( readySlots < wanted ) ? readySlots : wanted;
+}
+
+#endif // __TC_SPSC_QUEUE_HPP__
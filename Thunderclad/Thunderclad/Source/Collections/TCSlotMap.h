@@ -0,0 +1,98 @@
+//
+// TCSlotMap.h
+// This file will declare a container that stores objects densely and refers to them with generational handles.
+//
+
+#ifndef __TC_SLOT_MAP_H__
+#define __TC_SLOT_MAP_H__
+
+//
+// Includes
+//
+
+#include "TCPlatformPrecompilerSymbols.h"
+#include "TCList.h"
+
+//
+// Defines
+//
+
+//
+// TCSlotHandleTraits
+//		- Will split a handle into a slot index in the low bits and a generation in the high bits.
+//		- 32 bit handles allow about a million live objects and 4095 reuses of a slot before a stale handle could match again.
+//
+
+template< typename Handle > struct TCSlotHandleTraits;
+template<> struct TCSlotHandleTraits< unsigned int >		{ enum { IndexBits = 20, GenerationBits = 12 }; };
+template<> struct TCSlotHandleTraits< unsigned long long >	{ enum { IndexBits = 32, GenerationBits = 32 }; };
+
+//
+// Class Declaration
+//		- Objects are kept packed in one list so walking them touches contiguous memory, removing swaps the last object
+//		  into the hole. Handles go through a slot table, so they stay valid while objects move around.
+//		- Every slot has a generation that changes when its object is removed, a handle from an older generation is stale
+//		  and Get returns NULL for it instead of another object.
+//		- A handle of 0 is never given out, so it can be used as a null handle.
+//
+
+template< typename Object, typename Handle = unsigned int >
+class TCSlotMap
+{
+	public:		// Members
+		typedef Object*			Iterator;
+		typedef const Object*	ConstIterator;
+
+		static const Handle		InvalidHandle = 0;
+
+	public:		// Methods
+								TCSlotMap();
+
+		inline int				Count() const					{ return mObjects.Count(); }
+		void					Reserve( int capacity );
+		void					Clear();
+
+		Handle					Add( const Object& object );
+		Handle					Add( Object&& object );
+		template< typename... Args >
+		Handle					Emplace( Args&&... args );
+		bool					Remove( Handle handle );
+
+		bool					Contains( Handle handle ) const;
+		Object*					Get( Handle handle );
+		const Object*			Get( Handle handle ) const;
+
+		// Dense access, the order changes when objects are removed.
+		inline Object&			operator[]( int index )			{ return mObjects[ index ]; }
+		Handle					GetHandle( int index ) const;
+
+		// Lower case so slot maps work with range-for and <algorithm>.
+		Iterator				begin()							{ return mObjects.begin(); }
+		Iterator				end()							{ return mObjects.end(); }
+		ConstIterator			begin() const					{ return mObjects.begin(); }
+		ConstIterator			end() const						{ return mObjects.end(); }
+
+	private:	// Members
+		struct Slot
+		{
+			unsigned int		denseIndex;		// Where the object lives, or the next free slot once it is removed.
+			unsigned int		generation;
+			bool				occupied;		// Generations wrap, so a stale handle can match a free slot without this.
+		};
+
+		TCList< Object >		mObjects;
+		TCList< unsigned int >	mObjectSlots;	// The slot of each object, so a moved object's slot can be updated.
+		TCList< Slot >			mSlots;
+		int						mFreeSlot;		// The first free slot, -1 if every slot is used.
+
+	private:	// Methods
+		int						AllocateSlot();
+		int						FindSlot( Handle handle ) const;
+
+		static Handle			MakeHandle( unsigned int slot, unsigned int generation );
+		static unsigned int		NextGeneration( unsigned int generation );
+};
+
+#include "TCSlotMap.hpp"
+
+#endif // __TC_SLOT_MAP_H__
@@ -0,0 +1,354 @@
+//
+// TCSlotMap.hpp
+// This file will define the methods declared for a slot map.
+//
+
+#ifndef __TC_SLOT_MAP_HPP__
+#define __TC_SLOT_MAP_HPP__
+
+//
+// Includes
+//
+
+#include "TCSlotMap.h"
+#include "TCLogger.h"
+#include "TCMemUtils.h"
+
+//
+// Defines
+//
+
+template< class Object, class Handle >
+const Handle TCSlotMap< Object, Handle >::InvalidHandle;
+
+//
+// Default Constructor
+//		- Initializes the slot map to a safe, empty state.
+// Inputs:
+//		- None.
+// Outputs:
+//		- None.
+//
+
+template< class Object, class Handle >
+TCSlotMap< Object, Handle >::TCSlotMap()
+{
+	mFreeSlot = -1;
+}
+
+//
+// Reserve
+//		- Will make room for a number of objects so adding them doesn't allocate.
+// Inputs:
+//		- int capacity: The number of objects to make room for.
+// Outputs:
+//		- None.
+//
+
+template< class Object, class Handle >
+void TCSlotMap< Object, Handle >::Reserve( int capacity )
+{
+	mObjects.Reserve( capacity );
+	mObjectSlots.Reserve( capacity );
+	mSlots.Reserve( capacity );
+}
+
+//
+// Clear
+//		- Will remove every object, every handle given out so far becomes stale. The storage is kept for reuse.
+// Inputs:
+//		- None.
+// Outputs:
+//		- None.
+//
+
+template< class Object, class Handle >
+void TCSlotMap< Object, Handle >::Clear()
+{
+	for( int currentObject = 0; currentObject < mObjectSlots.Count(); ++currentObject )
+	{
+		unsigned int slot = mObjectSlots[ currentObject ];
+		mSlots[ slot ].generation	= NextGeneration( mSlots[ slot ].generation );
+		mSlots[ slot ].denseIndex	= (unsigned int)mFreeSlot;
+		mSlots[ slot ].occupied		= false;
+		mFreeSlot = (int)slot;
+	}
+
+	mObjects.RemoveRange( 0, mObjects.Count() );
+	mObjectSlots.RemoveRange( 0, mObjectSlots.Count() );
+}
+
+//
+// Add
+//		- Will copy an object into the slot map.
+// Inputs:
+//		- const Object& object: The object to add.
+// Outputs:
+//		- Handle: The handle for the object, InvalidHandle if there are no slots left.
+//
+
+template< class Object, class Handle >
+Handle TCSlotMap< Object, Handle >::Add( const Object& object )
+{
+	int slot = AllocateSlot();
+	if( slot < 0 )
+		return InvalidHandle;
+
+	mSlots[ slot ].denseIndex = (unsigned int)mObjects.Count();
+	mObjects.Append( object );
+	mObjectSlots.Append( (unsigned int)slot );
+
+	return MakeHandle( (unsigned int)slot, mSlots[ slot ].generation );
+}
+
+//
+// Add
+//		- Will move an object into the slot map.
+// Inputs:
+//		- Object&& object: The object to move in.
+// Outputs:
+//		- Handle: The handle for the object, InvalidHandle if there are no slots left.
+//
+
+template< class Object, class Handle >
+Handle TCSlotMap< Object, Handle >::Add( Object&& object )
+{
+	int slot = AllocateSlot();
+	if( slot < 0 )
+		return InvalidHandle;
+
+	mSlots[ slot ].denseIndex = (unsigned int)mObjects.Count();
+	mObjects.Append( TCMove( object ) );
+	mObjectSlots.Append( (unsigned int)slot );
+
+	return MakeHandle( (unsigned int)slot, mSlots[ slot ].generation );
+}
+
+//
+// Emplace
+//		- Will construct an object in place in the slot map.
+// Inputs:
+//		- Args&&... args: The arguments for the object's constructor.
+// Outputs:
+//		- Handle: The handle for the object, InvalidHandle if there are no slots left.
+//
+
+template< class Object, class Handle >
+template< typename... Args >
+Handle TCSlotMap< Object, Handle >::Emplace( Args&&... args )
+{
+	int slot = AllocateSlot();
+	if( slot < 0 )
+		return InvalidHandle;
+
+	mSlots[ slot ].denseIndex = (unsigned int)mObjects.Count();
+	mObjects.EmplaceBack( TCForward< Args >( args )... );
+	mObjectSlots.Append( (unsigned int)slot );
+
+	return MakeHandle( (unsigned int)slot, mSlots[ slot ].generation );
+}
+
+//
+// Remove
+//		- Will remove an object, the last object moves into its place and every handle to it becomes stale.
+// Inputs:
+//		- Handle handle: The handle of the object to remove.
+// Outputs:
+//		- bool: False if the handle was already stale.
+//
+
+template< class Object, class Handle >
+bool TCSlotMap< Object, Handle >::Remove( Handle handle )
+{
+	int slot = FindSlot( handle );
+	if( slot < 0 )
+		return false;
+
+	unsigned int denseIndex = mSlots[ slot ].denseIndex;
+	unsigned int lastIndex = (unsigned int)mObjects.Count() - 1;
+	if( denseIndex != lastIndex )
+	{
+		mSlots[ mObjectSlots[ lastIndex ] ].denseIndex = denseIndex;
+	}
+
+	mObjects.RemoveAtSwap( (int)denseIndex );
+	mObjectSlots.RemoveAtSwap( (int)denseIndex );
+
+	mSlots[ slot ].generation	= NextGeneration( mSlots[ slot ].generation );
+	mSlots[ slot ].denseIndex	= (unsigned int)mFreeSlot;
+	mSlots[ slot ].occupied		= false;
+	mFreeSlot = slot;
+
+	return true;
+}
+
+//
+// Contains
+//		- Will tell if a handle still refers to an object.
+// Inputs:
+//		- Handle handle: The handle to check.
+// Outputs:
+//		- bool: False if the handle is stale or invalid.
+//
+
+template< class Object, class Handle >
+bool TCSlotMap< Object, Handle >::Contains( Handle handle ) const
+{
+	return FindSlot( handle ) >= 0;
+}
+
+//
+// Get
+//		- Will find the object a handle refers to, the pointer is only good until the next Add or Remove.
+// Inputs:
+//		- Handle handle: The handle of the object.
+// Outputs:
+//		- Object*: The object, NULL if the handle is stale or invalid.
+//
+
+template< class Object, class Handle >
+Object* TCSlotMap< Object, Handle >::Get( Handle handle )
+{
+	int slot = FindSlot( handle );
+	if( slot < 0 )
+		return NULL;
+
+	return &mObjects[ mSlots[ slot ].denseIndex ];
+}
+
+//
+// Get
+//		- Will find the object a handle refers to, the pointer is only good until the next Add or Remove.
+// Inputs:
+//		- Handle handle: The handle of the object.
+// Outputs:
+//		- const Object*: The object, NULL if the handle is stale or invalid.
+//
+
+template< class Object, class Handle >
+const Object* TCSlotMap< Object, Handle >::Get( Handle handle ) const
+{
+	int slot = FindSlot( handle );
+	if( slot < 0 )
+		return NULL;
+
+	return &mObjects.begin()[ mSlots[ slot ].denseIndex ];
+}
+
+//
+// GetHandle
+//		- Will return the handle of an object found by walking the objects densely.
+// Inputs:
+//		- int index: The dense index of the object.
+// Outputs:
+//		- Handle: The handle of the object.
+//
+
+template< class Object, class Handle >
+Handle TCSlotMap< Object, Handle >::GetHandle( int index ) const
+{
+	TC_ASSERT( index >= 0 && index < mObjectSlots.Count() );
+
+	unsigned int slot = mObjectSlots.begin()[ index ];
+	return MakeHandle( slot, mSlots.begin()[ slot ].generation );
+}
+
+//
+// AllocateSlot
+//		- Will take a slot from the free list, or add a new one. The slot is marked occupied.
+// Inputs:
+//		- None.
+// Outputs:
+//		- int: The slot, -1 if the handle has no room for another slot index.
+//
+
+template< class Object, class Handle >
+int TCSlotMap< Object, Handle >::AllocateSlot()
+{
+	if( mFreeSlot >= 0 )
+	{
+		int slot = mFreeSlot;
+		mFreeSlot = (int)mSlots[ slot ].denseIndex;
+		mSlots[ slot ].occupied = true;
+		return slot;
+	}
+
+	unsigned long long maxSlots = 1ull << TCSlotHandleTraits< Handle >::IndexBits;
+	if( (unsigned long long)mSlots.Count() >= maxSlots || mSlots.Count() == 0x7FFFFFFF )
+	{
+		TCLogger::GetInstance()->LogFailure("Slot map is out of handles.");
+		return -1;
+	}
+
+	Slot slot;
+	slot.denseIndex	= 0;
+	slot.generation	= 1;	// Generation 0 is never used, so no handle is ever 0.
+	slot.occupied	= true;
+	mSlots.Append( slot );
+
+	return mSlots.Count() - 1;
+}
+
+//
+// FindSlot
+//		- Will find the slot a handle refers to if the handle is still current. A free slot is never found, even when a
+//		  stale handle's generation has wrapped around to match it.
+// Inputs:
+//		- Handle handle: The handle to look up.
+// Outputs:
+//		- int: The slot, -1 if the handle is stale or invalid.
+//
+
+template< class Object, class Handle >
+int TCSlotMap< Object, Handle >::FindSlot( Handle handle ) const
+{
+	unsigned long long index = (unsigned long long)handle & ( ( 1ull << TCSlotHandleTraits< Handle >::IndexBits ) - 1 );
+	unsigned int generation = (unsigned int)( (unsigned long long)handle >> TCSlotHandleTraits< Handle >::IndexBits );
+
+	if( index >= (unsigned long long)mSlots.Count() )
+		return -1;
+
+	const Slot& slot = mSlots.begin()[ index ];
+	if( !slot.occupied || slot.generation != generation )
+		return -1;
+
+	TC_ASSERT( slot.denseIndex < (unsigned int)mObjects.Count() && "Slot map slot points past its objects" );
+
+	return (int)index;
+}
+
+//
+// MakeHandle
+//		- Will pack a slot index and generation into a handle.
+// Inputs:
+//		- unsigned int slot: The slot index.
+//		- unsigned int generation: The generation of the slot.
+// Outputs:
+//		- Handle: The handle.
+//
+
+template< class Object, class Handle >
+Handle TCSlotMap< Object, Handle >::MakeHandle( unsigned int slot, unsigned int generation )
+{
+	return (Handle)( ( (unsigned long long)generation << TCSlotHandleTraits< Handle >::IndexBits ) | slot );
+}
+
+//
+// NextGeneration
+//		- Will advance a generation, wrapping within the handle's generation bits and skipping 0.
+// Inputs:
+//		- unsigned int generation: The current generation.
+// Outputs:
+//		- unsigned int: The next generation.
+//
+
+template< class Object, class Handle >
+unsigned int TCSlotMap< Object, Handle >::NextGeneration( unsigned int generation )
+{
+	unsigned long long mask = ( 1ull << TCSlotHandleTraits< Handle >::GenerationBits ) - 1;
+	unsigned int next = (unsigned int)( ( generation + 1ull ) & mask );
+
+	return ( next == 0 ) ? 1 : next;
+}
+
+#endif // __TC_SLOT_MAP_HPP__
@@ -0,0 +1,69 @@
+//
+// TCSortedList.h
+// This file will declare a list that keeps its objects in order so they can be found with a binary search.
+//
+
+#ifndef __TC_SORTED_LIST_H__
+#define __TC_SORTED_LIST_H__
+
+//
+// Includes
+//
+
+#include "TCPlatformPrecompilerSymbols.h"
+#include "TCCompareTraits.h"
+#include "TCList.h"
+
+//
+// Defines
+//
+
+//
+// Class Declaration
+//		- Objects are kept ordered by the Compare policy, see TCCompareTraits.h, equal objects keep the order they were added in.
+//		- Objects can't be changed in place since that could break the order, remove and add them again instead.
+//
+
+template< typename Object, typename Compare = TCLess< Object > >
+class TCSortedList
+{
+	public:		// Members
+		typedef const Object*	Iterator;		// Plain pointers, so sorted lists work with range-for and <algorithm>.
+
+	public:		// Methods
+								TCSortedList();
+
+		inline const Object&	operator[]( int index )				{ return mList[ index ]; }
+
+		int						Count()								{ return mList.Count(); }
+		int						Capacity()							{ return mList.Capacity(); }
+
+		Iterator				begin()								{ return mList.begin(); }
+		Iterator				end()								{ return mList.end(); }
+
+		int						Add( const Object& object );
+		void					AddRange( const Object* objects, int count );
+		void					Merge( TCSortedList& list );
+		void					Remove( const Object& object );
+		void					RemoveAt( int index );
+		void					RemoveRange( int index, int count );
+		void					Clear();
+		void					Reserve( int capacity );
+
+		bool					Contains( const Object& object );
+		int						Find( const Object& object );
+		int						LowerBound( const Object& object );
+		int						UpperBound( const Object& object );
+
+	private:	// Members
+		TCList< Object >		mList;
+		TCList< Object >		mScratch;		// Kept between merges so bulk adds don't allocate every time.
+
+	private:	// Methods
+		void					MergeSorted( const Object* objects, int count );
+		static void				Sort( Object* objects, int count, Object* scratch );
+};
+
+#include "TCSortedList.hpp"
+
+#endif // __TC_SORTED_LIST_H__
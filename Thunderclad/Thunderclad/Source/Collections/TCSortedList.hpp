@@ -0,0 +1,450 @@
+//
+// TCSortedList.hpp
+// This file will define the methods declared for a sorted list.
+//
+
+#ifndef __TC_SORTED_LIST_HPP__
+#define __TC_SORTED_LIST_HPP__
+
+//
+// Includes
+//
+
+#include "TCSortedList.h"
+#include "TCMemUtils.h"
+#include "TCMathUtils.h"
+
+//
+// Defines
+//
+
+#define TC_SORTED_LIST_INSERTION_RUN	(16)	// Runs this short are insertion sorted before they are merged.
+#define TC_SORTED_LIST_SMALL_RANGE		(8)		// Ranges this short are added one at a time instead of merged.
+
+//
+// Default Constructor
+//		- Initializes the list to a safe state.
+// Inputs:
+//		- None.
+// Outputs:
+//		- None.
+//
+
+template< class Object, class Compare >
+TCSortedList< Object, Compare >::TCSortedList()
+{
+}
+
+//
+// Add
+//		- Will add an object after any objects equal to it.
+// Inputs:
+//		- const Object& object: The object to add.
+// Outputs:
+//		- int: The index the object was added at.
+//
+
+template< class Object, class Compare >
+int TCSortedList< Object, Compare >::Add( const Object& object )
+{
+	int index = UpperBound( object );
+	mList.Insert( object, index );
+
+	return index;
+}
+
+//
+// AddRange
+//		- Will add a run of objects in any order, the run is sorted on its own and then merged in one pass.
+// Inputs:
+//		- const Object* objects: The first object to add.
+//		- int count: The number of objects to add.
+// Outputs:
+//		- None.
+//
+
+template< class Object, class Compare >
+void TCSortedList< Object, Compare >::AddRange( const Object* objects, int count )
+{
+	if( count <= 0 )
+		return;
+
+	if( count <= TC_SORTED_LIST_SMALL_RANGE )
+	{
+		for( int currentObject = 0; currentObject < count; ++currentObject )
+		{
+			Add( objects[ currentObject ] );
+		}
+		return;
+	}
+
+	//
+	// Sort the new objects at the end of the list, then merge them in from the back so the list and the scratch
+	// storage are reused and nothing else is allocated.
+	//
+
+	int numObjects = mList.Count();
+	mList.AppendRange( objects, count );
+
+	mScratch.Resize( count );
+	Sort( mList.begin() + numObjects, count, mScratch.begin() );
+
+	for( int currentIncoming = 0; currentIncoming < count; ++currentIncoming )
+	{
+		mScratch[ currentIncoming ] = TCMove( mList[ numObjects + currentIncoming ] );
+	}
+
+	int currentObject	= numObjects - 1;
+	int currentIncoming	= count - 1;
+	int currentTarget	= numObjects + count - 1;
+	while( currentIncoming >= 0 )
+	{
+		// Equal objects already in the list stay in front of the new ones, the same as MergeSorted.
+		if( currentObject >= 0 && Compare::Less( mScratch[ currentIncoming ], mList[ currentObject ] ) )
+		{
+			mList[ currentTarget-- ] = TCMove( mList[ currentObject-- ] );
+		}
+		else
+		{
+			mList[ currentTarget-- ] = TCMove( mScratch[ currentIncoming-- ] );
+		}
+	}
+
+	mScratch.Resize( 0 );
+}
+
+//
+// Merge
+//		- Will add every object of another sorted list in one pass, the other list is left unchanged.
+// Inputs:
+//		- TCSortedList& list: The list to merge in.
+// Outputs:
+//		- None.
+//
+
+template< class Object, class Compare >
+void TCSortedList< Object, Compare >::Merge( TCSortedList& list )
+{
+	if( &list == this )
+	{
+		TCSortedList copy( list );
+		MergeSorted( copy.mList.begin(), copy.Count() );
+		return;
+	}
+
+	MergeSorted( list.mList.begin(), list.Count() );
+}
+
+//
+// Remove
+//		- Will remove the first object equal to the object provided.
+// Inputs:
+//		- const Object& object: The object to remove.
+// Outputs:
+//		- None.
+//
+
+template< class Object, class Compare >
+void TCSortedList< Object, Compare >::Remove( const Object& object )
+{
+	int index = Find( object );
+	if( index >= 0 )
+	{
+		mList.RemoveAt( index );
+	}
+}
+
+//
+// RemoveAt
+//		- Will remove an object, the objects after it keep their order.
+// Inputs:
+//		- int index: The index of the object to remove.
+// Outputs:
+//		- None.
+//
+
+template< class Object, class Compare >
+void TCSortedList< Object, Compare >::RemoveAt( int index )
+{
+	mList.RemoveAt( index );
+}
+
+//
+// RemoveRange
+//		- Will remove a run of objects, LowerBound and UpperBound give the run of objects within a range.
+// Inputs:
+//		- int index: The index of the first object to remove.
+//		- int count: The number of objects to remove.
+// Outputs:
+//		- None.
+//
+
+template< class Object, class Compare >
+void TCSortedList< Object, Compare >::RemoveRange( int index, int count )
+{
+	mList.RemoveRange( index, count );
+}
+
+//
+// Clear
+//		- Will remove all objects and release the list resources.
+// Inputs:
+//		- None.
+// Outputs:
+//		- None.
+//
+
+template< class Object, class Compare >
+void TCSortedList< Object, Compare >::Clear()
+{
+	mList.Clear();
+	mScratch.Clear();
+}
+
+//
+// Reserve
+//		- Will increase the capacity of the list to the size provided.
+// Inputs:
+//		- int capacity: The new capacity.
+// Outputs:
+//		- None.
+//
+
+template< class Object, class Compare >
+void TCSortedList< Object, Compare >::Reserve( int capacity )
+{
+	mList.Reserve( capacity );
+}
+
+//
+// Contains
+//		- Will return whether or not an object equal to the object provided is in the list.
+// Inputs:
+//		- const Object& object: The object to search for.
+// Outputs:
+//		- bool: Was the object found or not.
+//
+
+template< class Object, class Compare >
+bool TCSortedList< Object, Compare >::Contains( const Object& object )
+{
+	return Find( object ) != -1;
+}
+
+//
+// Find
+//		- Will binary search for the first object equal to the object provided.
+// Inputs:
+//		- const Object& object: The object to search for.
+// Outputs:
+//		- int: The index of the object, -1 if not found.
+//
+
+template< class Object, class Compare >
+int TCSortedList< Object, Compare >::Find( const Object& object )
+{
+	int index = LowerBound( object );
+	if( index < mList.Count() && !Compare::Less( object, mList[ index ] ) )
+	{
+		return index;
+	}
+
+	return -1;	// We didn't find it.
+}
+
+//
+// LowerBound
+//		- Will binary search for the first object that does not order before the object provided.
+// Inputs:
+//		- const Object& object: The object to search for.
+// Outputs:
+//		- int: The index, the count of the list if every object orders before it.
+//
+
+template< class Object, class Compare >
+int TCSortedList< Object, Compare >::LowerBound( const Object& object )
+{
+	int first = 0;
+	int count = mList.Count();
+	while( count > 0 )
+	{
+		int step = count / 2;
+		if( Compare::Less( mList[ first + step ], object ) )
+		{
+			first += step + 1;
+			count -= step + 1;
+		}
+		else
+		{
+			count = step;
+		}
+	}
+
+	return first;
+}
+
+//
+// UpperBound
+//		- Will binary search for the first object that orders after the object provided.
+// Inputs:
+//		- const Object& object: The object to search for.
+// Outputs:
+//		- int: The index, the count of the list if no object orders after it.
+//
+
+template< class Object, class Compare >
+int TCSortedList< Object, Compare >::UpperBound( const Object& object )
+{
+	int first = 0;
+	int count = mList.Count();
+	while( count > 0 )
+	{
+		int step = count / 2;
+		if( !Compare::Less( object, mList[ first + step ] ) )
+		{
+			first += step + 1;
+			count -= step + 1;
+		}
+		else
+		{
+			count = step;
+		}
+	}
+
+	return first;
+}
+
+//
+// MergeSorted
+//		- Will merge a sorted run of objects into the list in one pass, on ties the objects already in the list come first.
+// Inputs:
+//		- const Object* objects: The first object of the sorted run.
+//		- int count: The number of objects in the run.
+// Outputs:
+//		- None.
+//
+
+template< class Object, class Compare >
+void TCSortedList< Object, Compare >::MergeSorted( const Object* objects, int count )
+{
+	if( count <= 0 )
+		return;
+
+	int numObjects = mList.Count();
+
+	mScratch.Resize( 0 );
+	mScratch.Reserve( numObjects + count );
+
+	int currentObject = 0;
+	int currentIncoming = 0;
+	while( currentObject < numObjects && currentIncoming < count )
+	{
+		if( Compare::Less( objects[ currentIncoming ], mList[ currentObject ] ) )
+		{
+			mScratch.Append( objects[ currentIncoming++ ] );
+		}
+		else
+		{
+			mScratch.Append( TCMove( mList[ currentObject++ ] ) );
+		}
+	}
+
+	for( ; currentObject < numObjects; ++currentObject )
+	{
+		mScratch.Append( TCMove( mList[ currentObject ] ) );
+	}
+
+	mScratch.AppendRange( objects + currentIncoming, count - currentIncoming );
+
+	//
+	// The merged objects become the list, the old storage is kept for the next merge.
+	//
+
+	TCList< Object > oldList( TCMove( mList ) );
+	mList		= TCMove( mScratch );
+	mScratch	= TCMove( oldList );
+	mScratch.Resize( 0 );
+}
+
+//
+// Sort
+//		- Will stable sort a run of objects, short runs are insertion sorted and then merged bottom up.
+// Inputs:
+//		- Object* objects: The objects to sort.
+//		- int count: The number of objects.
+//		- Object* scratch: Room for count objects to merge through.
+// Outputs:
+//		- None.
+//
+
+template< class Object, class Compare >
+void TCSortedList< Object, Compare >::Sort( Object* objects, int count, Object* scratch )
+{
+	for( int start = 0; start < count; start += TC_SORTED_LIST_INSERTION_RUN )
+	{
+		int end = TC_MIN( start + TC_SORTED_LIST_INSERTION_RUN, count );
+		for( int currentObject = start + 1; currentObject < end; ++currentObject )
+		{
+			Object object = TCMove( objects[ currentObject ] );
+
+			int target = currentObject;
+			while( target > start && Compare::Less( object, objects[ target - 1 ] ) )
+			{
+				objects[ target ] = TCMove( objects[ target - 1 ] );
+				target--;
+			}
+
+			objects[ target ] = TCMove( object );
+		}
+	}
+
+	Object* from = objects;
+	Object* to = scratch;
+	for( int width = TC_SORTED_LIST_INSERTION_RUN; width < count; width *= 2 )
+	{
+		for( int left = 0; left < count; left += width * 2 )
+		{
+			int middle	= TC_MIN( left + width, count );
+			int right	= TC_MIN( left + width * 2, count );
+
+			int currentLeft		= left;
+			int currentRight	= middle;
+			int currentTarget	= left;
+			while( currentLeft < middle && currentRight < right )
+			{
+				if( Compare::Less( from[ currentRight ], from[ currentLeft ] ) )
+				{
+					to[ currentTarget++ ] = TCMove( from[ currentRight++ ] );
+				}
+				else
+				{
+					to[ currentTarget++ ] = TCMove( from[ currentLeft++ ] );
+				}
+			}
+
+			while( currentLeft < middle )
+			{
+				to[ currentTarget++ ] = TCMove( from[ currentLeft++ ] );
+			}
+
+			while( currentRight < right )
+			{
+				to[ currentTarget++ ] = TCMove( from[ currentRight++ ] );
+			}
+		}
+
+		Object* swap = from;
+		from	= to;
+		to		= swap;
+	}
+
+	if( from != objects )
+	{
+		for( int currentObject = 0; currentObject < count; ++currentObject )
+		{
+			objects[ currentObject ] = TCMove( from[ currentObject ] );
+		}
+	}
+}
+
+#endif // __TC_SORTED_LIST_HPP__
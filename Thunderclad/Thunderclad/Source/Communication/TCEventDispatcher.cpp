@@ -10,11 +10,23 @@
 #include "TCEventDispatcher.h"
 #include "TCEventListener.h"
 #include "TCLogger.h"
+#include "TCNodePool.h"
 
 //
 // Defines
 //
 
+//
+// GetSubscriptionPool
+//		- Every subscription comes from this pool, so input devices resubscribing to new windows don't hit the heap.
+//
+
+static TCNodePool< TCEventSubscription >& GetSubscriptionPool()
+{
+	static TCNodePool< TCEventSubscription > gSubscriptionPool;
+	return gSubscriptionPool;
+}
+
 //
 // Default Constructor
 //		- Initializes this object to a safe default state.
@@ -25,8 +37,10 @@
 //
 
 TCEventDispatcher::TCEventDispatcher()
+	: mDispatchDepth( 0 ), mHasRemovedSubscriptions( false )
 {
-	mEventListeners.SetGrowthRate( 2.0f );	// This will exand quickly when adding a bunch of listeners.
+	// Make sure the pool is constructed first so it outlives static dispatchers.
+	GetSubscriptionPool();
 }
 
 //
@@ -39,7 +53,9 @@ TCEventDispatcher::TCEventDispatcher()
 //
 
 TCEventDispatcher::TCEventDispatcher( const TCEventDispatcher& inRef )
+	: mDispatchDepth( 0 ), mHasRemovedSubscriptions( false )
 {
+	GetSubscriptionPool();
 	Clone( inRef );
 }
 
@@ -99,15 +115,28 @@ TCResult TCEventDispatcher::FireEvent( TCEventID eventID, void* eventData )
 	}
 
 	//
-	// Notify all listeners.
+	// Notify all listeners. A listener can unsubscribe itself or any other listener while handling the event, the
+	// subscription stays linked with no listener until the outermost dispatch ends so stepping past it is safe.
 	//
 
-	for( int currentListener = 0; currentListener < mEventListeners.Count(); ++currentListener )
+	mDispatchDepth++;
+
+	TCEventSubscription* subscription = mSubscriptions.First();
+	while( subscription != NULL )
 	{
-		if( mEventListeners[ currentListener ] != NULL )
+		if( subscription->listener != NULL )
 		{
-			mEventListeners[ currentListener ]->OnEventFired( eventID, eventData );
+			subscription->listener->OnEventFired( eventID, eventData );
 		}
+
+		subscription = TCDispatcherSubscriptions::Next( subscription );
+	}
+
+	mDispatchDepth--;
+
+	if( mDispatchDepth == 0 && mHasRemovedSubscriptions )
+	{
+		FreeRemovedSubscriptions();
 	}
 
 	return Success;
@@ -136,7 +165,20 @@ TCResult TCEventDispatcher::AddListener( TCEventListener* listener )
 		return Failure_InvalidParameter;
 	}
 
-	mEventListeners.Append( listener );
+	if( listener->FindSubscription( this ) != NULL )
+	{
+		gLogger->LogWarning("Tried to add the same listener to an event dispatcher twice.");
+		return Failure_InvalidParameter;
+	}
+
+	//
+	// Link the subscription into both sides.
+	//
+
+	TCEventSubscription* subscription = GetSubscriptionPool().Allocate( listener, this );
+	mSubscriptions.PushBack( subscription );
+	listener->mSubscriptions.PushBack( subscription );
+
 	return Success;
 }
 
@@ -163,11 +205,12 @@ TCResult TCEventDispatcher::RemoveListener( TCEventListener* listener )
 		return Failure_InvalidParameter;
 	}
 
-	//
-	// Remove the listener.
-	//
+	TCEventSubscription* subscription = listener->FindSubscription( this );
+	if( subscription != NULL )
+	{
+		RemoveSubscription( subscription );
+	}
 
-	mEventListeners.Remove( listener );
 	return Success;
 }
 
@@ -182,22 +225,24 @@ TCResult TCEventDispatcher::RemoveListener( TCEventListener* listener )
 
 void TCEventDispatcher::CleanUp()
 {
-	TCList< TCEventListener* > listenersToRemove = mEventListeners; 
-	for( int currentListener = 0; currentListener < listenersToRemove.Count(); ++currentListener )
+	TCEventSubscription* subscription = FindLiveSubscription( mSubscriptions.First() );
+	while( subscription != NULL )
 	{
-		if( listenersToRemove[ currentListener ] != NULL )
+		subscription->listener->UnsubscribeFrom( this );
+
+		// Don't leave a dangling subscription behind if the listener refused.
+		if( FindLiveSubscription( mSubscriptions.First() ) == subscription )
 		{
-			listenersToRemove[ currentListener ]->UnsubscribeFrom( this );
+			RemoveSubscription( subscription );
 		}
-	}
 
-	listenersToRemove.Clear();
-	mEventListeners.Clear();
+		subscription = FindLiveSubscription( mSubscriptions.First() );
+	}
 }
 
 //
 // Clone
-//		- Will copy another TCEventDispatcher&
+//		- Will copy another TCEventDispatcher&, the same listeners are subscribed to this dispatcher.
 // Inputs:
 //		- TCEventDispatcher& inRef: The dispatcher to copy.
 // Outputs:
@@ -206,5 +251,85 @@ void TCEventDispatcher::CleanUp()
 
 void TCEventDispatcher::Clone( const TCEventDispatcher& inRef )
 {
-	mEventListeners = inRef.mEventListeners;
+	for( TCEventSubscription& subscription : inRef.mSubscriptions )
+	{
+		if( subscription.listener != NULL )
+		{
+			AddListener( subscription.listener );
+		}
+	}
+}
+
+//
+// RemoveSubscription
+//		- Will unlink a subscription from its listener and dispatcher and return it to the pool. While the dispatcher
+//		  is firing an event the subscription only loses its listener, the dispatcher frees it once the event is done.
+// Inputs:
+//		- TCEventSubscription* subscription: The subscription to remove.
+// Outputs:
+//		- None.
+//
+
+void TCEventDispatcher::RemoveSubscription( TCEventSubscription* subscription )
+{
+	TCEventDispatcher* dispatcher = subscription->dispatcher;
+
+	subscription->listener->mSubscriptions.Remove( subscription );
+	subscription->listener = NULL;
+
+	if( dispatcher->mDispatchDepth > 0 )
+	{
+		dispatcher->mHasRemovedSubscriptions = true;
+		return;
+	}
+
+	dispatcher->mSubscriptions.Remove( subscription );
+	GetSubscriptionPool().Free( subscription );
+}
+
+//
+// FindLiveSubscription
+//		- Will skip past subscriptions that were removed during a dispatch.
+// Inputs:
+//		- TCEventSubscription* subscription: The subscription to start from.
+// Outputs:
+//		- TCEventSubscription*: The first subscription at or after the one provided that still has a listener, NULL if
+//		  there isn't one.
+//
+
+TCEventSubscription* TCEventDispatcher::FindLiveSubscription( TCEventSubscription* subscription )
+{
+	while( subscription != NULL && subscription->listener == NULL )
+	{
+		subscription = TCDispatcherSubscriptions::Next( subscription );
+	}
+
+	return subscription;
+}
+
+//
+// FreeRemovedSubscriptions
+//		- Will unlink and free the subscriptions that were removed while an event was firing.
+// Inputs:
+//		- None.
+// Outputs:
+//		- None.
+//
+
+void TCEventDispatcher::FreeRemovedSubscriptions()
+{
+	TCEventSubscription* subscription = mSubscriptions.First();
+	while( subscription != NULL )
+	{
+		TCEventSubscription* nextSubscription = TCDispatcherSubscriptions::Next( subscription );
+		if( subscription->listener == NULL )
+		{
+			mSubscriptions.Remove( subscription );
+			GetSubscriptionPool().Free( subscription );
+		}
+
+		subscription = nextSubscription;
+	}
+
+	mHasRemovedSubscriptions = false;
 }
\ No newline at end of file
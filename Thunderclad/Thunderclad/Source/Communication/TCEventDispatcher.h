@@ -11,6 +11,7 @@
 //
 
 #include "TCList.h"
+#include "TCEventSubscription.h"
 #include "TCResultCode.h"
 
 //
@@ -48,10 +49,19 @@ class TCEventDispatcher
 		virtual void				CleanUp();
 
 	private:	// Members
-		TCList< TCEventListener* > mEventListeners;	
+		TCDispatcherSubscriptions	mSubscriptions;
+		int							mDispatchDepth;				// How many FireEvent calls are walking the subscriptions.
+		bool						mHasRemovedSubscriptions;	// Removed during a dispatch, still linked until it ends.
 		
 	protected:	// Methods
 		virtual void Clone( const TCEventDispatcher& inRef );
+
+	private:	// Methods
+		static void					RemoveSubscription( TCEventSubscription* subscription );
+		static TCEventSubscription*	FindLiveSubscription( TCEventSubscription* subscription );
+		void						FreeRemovedSubscriptions();
+
+		friend class TCEventListener;
 };
 
 #endif // __TCEVENT_DISPATCHER_H__
\ No newline at end of file
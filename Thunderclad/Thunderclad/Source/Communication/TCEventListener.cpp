@@ -92,14 +92,14 @@ void TCEventListener::SubscribeTo( TCEventDispatcher* dispatcher )
 		// Check for duplication.
 		//
 
-		if( mEventDispatchers.Contains( dispatcher) )
+		if( FindSubscription( dispatcher ) != NULL )
 		{
 			gLogger->LogWarning( "Tried to subscribe to the same event dispatcher twice:" );
 			return;
 		}
 
 		//
-		// Subscribe to the dispatcher.
+		// Subscribe to the dispatcher, it links the subscription into both sides.
 		//
 
 		TCResult result = dispatcher->AddListener( this );
@@ -108,8 +108,6 @@ void TCEventListener::SubscribeTo( TCEventDispatcher* dispatcher )
 			gLogger->LogError( "Failed to subscribe to an event." );
 			return;
 		}
-		
-		mEventDispatchers.Append( dispatcher );
 	}
 }
 
@@ -124,7 +122,7 @@ void TCEventListener::SubscribeTo( TCEventDispatcher* dispatcher )
 
 void TCEventListener::UnsubscribeFrom( TCEventDispatcher* dispatcher )
 {
-	if( dispatcher != NULL && mEventDispatchers.Contains( dispatcher ) )
+	if( dispatcher != NULL && FindSubscription( dispatcher ) != NULL )
 	{
 		TCResult result = dispatcher->RemoveListener( this );
 		if( TC_FAILED( result ) )
@@ -132,8 +130,6 @@ void TCEventListener::UnsubscribeFrom( TCEventDispatcher* dispatcher )
 			gLogger->LogError("Failed to unsubscribe from event");
 			return;
 		}
-
-		mEventDispatchers.Remove( dispatcher );
 	}
 }
 
@@ -148,16 +144,22 @@ void TCEventListener::UnsubscribeFrom( TCEventDispatcher* dispatcher )
 
 void TCEventListener::UnsubscribeFromAll()
 {
-	for( int currentDispatcher = 0; currentDispatcher < mEventDispatchers.Count(); ++currentDispatcher )
+	while( !mSubscriptions.IsEmpty() )
 	{
-		mEventDispatchers[ currentDispatcher ]->RemoveListener( this );
+		TCEventSubscription* subscription = mSubscriptions.First();
+		subscription->dispatcher->RemoveListener( this );
+
+		// Don't leave a dangling subscription behind if the dispatcher refused.
+		if( mSubscriptions.First() == subscription )
+		{
+			TCEventDispatcher::RemoveSubscription( subscription );
+		}
 	}
-	mEventDispatchers.Clear();
 }
 
 //
 // Clone
-//		- Will copy from another TCEventListener into this one.
+//		- Will copy from another TCEventListener into this one, this listener subscribes to the same dispatchers.
 // Inputs:
 //		- const TCEventListener& inRef.
 // Outputs:
@@ -166,5 +168,28 @@ void TCEventListener::UnsubscribeFromAll()
 
 void TCEventListener::Clone( const TCEventListener& inRef )
 {
-	mEventDispatchers = inRef.mEventDispatchers;
+	for( TCEventSubscription& subscription : inRef.mSubscriptions )
+	{
+		SubscribeTo( subscription.dispatcher );
+	}
+}
+
+//
+// FindSubscription
+//		- Will find this listener's subscription to a dispatcher, listeners only subscribe to a few dispatchers.
+// Inputs:
+//		- TCEventDispatcher* dispatcher: The dispatcher to look for.
+// Outputs:
+//		- TCEventSubscription*: The subscription, NULL if this listener isn't subscribed.
+//
+
+TCEventSubscription* TCEventListener::FindSubscription( TCEventDispatcher* dispatcher )
+{
+	for( TCEventSubscription& subscription : mSubscriptions )
+	{
+		if( subscription.dispatcher == dispatcher )
+			return &subscription;
+	}
+
+	return NULL;
 }
\ No newline at end of file
@@ -10,7 +10,7 @@
 // Includes
 //
 
-#include "TCList.h"
+#include "TCEventSubscription.h"
 
 //
 // Defines
@@ -48,10 +48,15 @@ class TCEventListener
 		virtual void				OnEventFired( TCEventID eventId, void* eventData ) = 0;
 
 	private:	// Members
-		TCList< TCEventDispatcher* >	mEventDispatchers;
+		TCListenerSubscriptions		mSubscriptions;
 
 	protected:	// Methods
 		virtual void				Clone( const TCEventListener& inRef );
+
+	private:	// Methods
+		TCEventSubscription*		FindSubscription( TCEventDispatcher* dispatcher );
+
+		friend class TCEventDispatcher;
 };
 
 #endif // __TC_EVENT_LISTENER_H__
\ No newline at end of file
@@ -0,0 +1,43 @@
+//
+// TCEventSubscription.h
+// This file will define the record that ties one event listener to one event dispatcher.
+//
+
+#ifndef __TC_EVENT_SUBSCRIPTION_H__
+#define __TC_EVENT_SUBSCRIPTION_H__
+
+//
+// Includes
+//
+
+#include "TCIntrusiveList.h"
+
+//
+// Forward Declarations
+//
+
+class TCEventListener;
+class TCEventDispatcher;
+
+//
+// Class Declaration
+//		- One subscription sits in two intrusive lists at once, the dispatcher's list of listeners and the listener's
+//		  list of dispatchers, so either side can unlink it in O(1) without searching the other side.
+//		- Subscriptions come from a shared TCNodePool in TCEventDispatcher.cpp, subscribing never allocates once it is warm.
+//
+
+struct TCEventSubscription
+{
+	TCEventListener*						listener;
+	TCEventDispatcher*						dispatcher;
+	TCIntrusiveLink< TCEventSubscription >	listenerLink;		// Links the subscriptions of one listener.
+	TCIntrusiveLink< TCEventSubscription >	dispatcherLink;		// Links the subscriptions of one dispatcher.
+
+	TCEventSubscription( TCEventListener* inListener, TCEventDispatcher* inDispatcher )
+		: listener( inListener ), dispatcher( inDispatcher ) {}
+};
+
+typedef TCIntrusiveList< TCEventSubscription, &TCEventSubscription::listenerLink >		TCListenerSubscriptions;
+typedef TCIntrusiveList< TCEventSubscription, &TCEventSubscription::dispatcherLink >	TCDispatcherSubscriptions;
+
+#endif // __TC_EVENT_SUBSCRIPTION_H__
@@ -462,12 +462,15 @@ TCResult TCFile_Win32::Open( TCFileManager::FileDescription& desc )
 	//
 
 	TCString mode = GetModeString( desc );
+	char16 wideMode[ 8 ];
+	mode.ToUTF16( wideMode );
 
 	//
-	//	Try and open the file.
+	//	Try and open the file, the wide functions read non-ASCII paths correctly.
 	//
 
-	mFile = _fsopen( desc.path.Data(), mode.Data(), _SH_DENYNO );
+	TCWidePath widePath( desc.path );
+	mFile = _wfsopen( widePath.Data(), (const wchar_t*)wideMode, _SH_DENYNO );
 	if( mFile == NULL )
 	{
 		return Failure_InvalidPath;
@@ -477,8 +480,8 @@ TCResult TCFile_Win32::Open( TCFileManager::FileDescription& desc )
 	// Get our file length.
 	//
 
-	struct stat statBuffer;
-    int result = stat( desc.path.Data(), &statBuffer );
+	struct _stat statBuffer;
+    int result = _wstat( widePath.Data(), &statBuffer );
     mFileLength =  result == 0 ? statBuffer.st_size : -1;
 
 	//
@@ -192,7 +192,7 @@ TCResult TCFileManager_Win32::CreateFile( const TCString& path,
 	// Create the file!
 	//
 
-	HANDLE hFile = CreateFileA( path.Data(),
+	HANDLE hFile = CreateFileW( TCWidePath( path ).Data(),
 							    sysAccessFlags,
 							    sysShareFlags,
 							    NULL,
@@ -335,7 +335,7 @@ TCResult TCFileManager_Win32::DeleteFile( const TCString& path )
 		return Failure_InvalidPath;
 	}
 
-	BOOL result = DeleteFileA( path.Data() );
+	BOOL result = DeleteFileW( TCWidePath( path ).Data() );
 	if( result == FALSE )
 	{
 		gLogger->LogError( TCString( "[TCFile] Failed to remove a file: " ) + path.Data() );
@@ -364,7 +364,7 @@ TCResult TCFileManager_Win32::CreateDirectory( const TCString& path )
 		return Failure_AlreadyExists;
 	}
 
-	BOOL result = CreateDirectoryA( path.Data(), NULL );
+	BOOL result = CreateDirectoryW( TCWidePath( path ).Data(), NULL );
 	if( result == FALSE )
 	{
 		DWORD lastError = GetLastError();
@@ -399,27 +399,33 @@ TCResult TCFileManager_Win32::DeleteDirectory( const TCString& path )
 	// Make sure you double terminate the filepath.
 	//
 
-	char pathToUse[ MAX_PATH + 1 ];
-	TCStringUtils::Copy( pathToUse, path.Data() );
-	pathToUse[ path.Length() + 1 ] = NULL_TERMINATOR;
+	if( path.Length() >= MAX_PATH )
+	{
+		gLogger->LogError( TCString( "[TCFile] Failed to delete directory, the path is too long: " ) + path );
+		return Failure_InvalidPath;
+	}
+
+	char16 pathToUse[ MAX_PATH + 1 ];
+	int pathLength = path.ToUTF16( pathToUse );
+	pathToUse[ pathLength + 1 ] = NULL_TERMINATOR;
 
 	//
 	// Launch a shell operation to remove the directory silently and without UI.
 	//
 
-	SHFILEOPSTRUCT shellOp = {
+	SHFILEOPSTRUCTW shellOp = {
         NULL,
         FO_DELETE,
-        pathToUse,
+        (const wchar_t*)pathToUse,
         NULL,
         FOF_NOCONFIRMATION |
         FOF_NOERRORUI |
         FOF_SILENT,
         false,
         0,
-        "" };
+        L"" };
 
-    int result = SHFileOperation(&shellOp);
+    int result = SHFileOperationW(&shellOp);
 	if( result != 0 )
 	{
 		if( result == 2 )	// FILE_NOT_FOUND_ERROR
@@ -475,7 +481,7 @@ TCResult TCFileManager_Win32::CopyFile( const TCString& pathToFile, const TCStri
 	// Copy the file!
 	//
 
-	BOOL result = CopyFileA( pathToFile.Data(), pathToDestination.Data(), FALSE );
+	BOOL result = CopyFileW( TCWidePath( pathToFile ).Data(), TCWidePath( pathToDestination ).Data(), FALSE );
 	if( result == FALSE )
 	{
 		gLogger->LogError( "[TCFile] Failed to copy the file!" );
@@ -517,8 +523,8 @@ TCResult TCFileManager_Win32::EnumerateDirectory( const TCString& pathToDirector
 	// Get the files in the directory.
 	//
 
-	WIN32_FIND_DATA findData;
-	HANDLE hFoundFile = FindFirstFileA( pathToDirectory.Data(), & findData );
+	WIN32_FIND_DATAW findData;
+	HANDLE hFoundFile = FindFirstFileW( TCWidePath( pathToDirectory ).Data(), & findData );
 	if( hFoundFile == INVALID_HANDLE_VALUE )
 	{
 		DWORD error = GetLastError();
@@ -530,18 +536,20 @@ TCResult TCFileManager_Win32::EnumerateDirectory( const TCString& pathToDirector
 	// Walk all the files in the directory.
 	//
 
+	TCString fileName;
 	do
 	{
+		fileName.CopyUTF16( (const char16*)findData.cFileName, (int)wcslen( findData.cFileName ) );
 		if( findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY )
 		{
-			directories.Append( findData.cFileName );
+			directories.Append( fileName );
 		}
 		else if( findData.dwFileAttributes & FILE_ATTRIBUTE_NORMAL )
 		{
-			files.Append( findData.cFileName );
+			files.Append( fileName );
 		}
 	}
-	while( FindNextFile( hFoundFile, &findData ) != 0 );
+	while( FindNextFileW( hFoundFile, &findData ) != 0 );
 
 	//
 	// Ensure that there were no errors.
@@ -569,7 +577,7 @@ TCResult TCFileManager_Win32::EnumerateDirectory( const TCString& pathToDirector
 
 TCFileAttributeFlag TCFileManager_Win32::GetFileAccessType( const TCString& path )
 {
-	DWORD fileAttributes = GetFileAttributes( path.Data() );
+	DWORD fileAttributes = GetFileAttributesW( TCWidePath( path ).Data() );
 	TCFileAttributeFlag outFileAttributes = FileAttribute_Unknown;
 
 	if( fileAttributes & FILE_ATTRIBUTE_READONLY )
@@ -611,7 +619,7 @@ TCFileAttributeFlag TCFileManager_Win32::GetFileAccessType( const TCString& path
 
 bool TCFileManager_Win32::FileExists( const TCString& path )
 {
-	DWORD fileAttributes = GetFileAttributes( path.Data() );
+	DWORD fileAttributes = GetFileAttributesW( TCWidePath( path ).Data() );
 	if( fileAttributes == INVALID_FILE_ATTRIBUTES || (fileAttributes & FILE_ATTRIBUTE_DIRECTORY) )
 		return false;
 
@@ -629,7 +637,7 @@ bool TCFileManager_Win32::FileExists( const TCString& path )
 
 bool TCFileManager_Win32::DirectoryExists( const TCString& path )
 {
-	DWORD fileAttributes = GetFileAttributes( path.Data() );
+	DWORD fileAttributes = GetFileAttributesW( TCWidePath( path ).Data() );
 	if( fileAttributes == INVALID_FILE_ATTRIBUTES )
 		return false;
 
@@ -666,11 +674,10 @@ TCString TCFileManager_Win32::GetProgramDirectory()
 {
 	if( mProgramDirectory.IsEmpty() )
 	{
-		char buffer[ _MAX_PATH ];
-		char* bufferPtr = buffer;
-		if( _get_pgmptr( &bufferPtr ) == 0 )
+		wchar_t* bufferPtr = NULL;
+		if( _get_wpgmptr( &bufferPtr ) == 0 && bufferPtr != NULL )
 		{
-			mProgramDirectory = bufferPtr;	// This will get us a path to the executable.
+			mProgramDirectory.CopyUTF16( (const char16*)bufferPtr, (int)wcslen( bufferPtr ) );	// This will get us a path to the executable.
 			int directoryStartIndex = mProgramDirectory.FindLastIndexOf( '\\' );
 			mProgramDirectory.Substring( 0, directoryStartIndex - 1, mProgramDirectory );
 			mProgramDirectory.ReplaceAllInstances( '\\', '/' );
@@ -692,4 +699,37 @@ TCString TCFileManager_Win32::GetProgramDirectory()
 void TCFileManager_Win32::Clone( const TCFileManager& inRef )
 {
 	TCFileManager::Clone( inRef );
-}
\ No newline at end of file
+}
+
+//
+// TCWidePath Constructor
+//		- Will convert a UTF-8 path to NULL terminated UTF-16.
+// Inputs:
+//		- const TCString& path: The path to convert.
+// Outputs:
+//		- None.
+//
+
+TCWidePath::TCWidePath( const TCString& path )
+{
+	// UTF-16 never needs more units than UTF-8 has bytes.
+	mPath = ( path.Length() < TC_WIDE_PATH_INLINE_LENGTH ) ? mInlinePath : new char16[ path.Length() + 1 ];
+	path.ToUTF16( mPath );
+}
+
+//
+// TCWidePath Destructor
+//		- Will free the converted path if it didn't fit inline.
+// Inputs:
+//		- None.
+// Outputs:
+//		- None.
+//
+
+TCWidePath::~TCWidePath()
+{
+	if( mPath != mInlinePath )
+	{
+		delete[] mPath;
+	}
+}
@@ -16,6 +16,8 @@
 // Defines
 //
 
+#define TC_WIDE_PATH_INLINE_LENGTH	(260)	// MAX_PATH, the longest path the Win32 file functions take without a \\?\ prefix.
+
 //
 // Forward Declarations
 //
@@ -69,4 +71,28 @@ class TCFileManager_Win32 :
 		friend class TCFile_Win32;
 };
 
+//
+// TCWidePath
+//		- The engine keeps paths as UTF-8 and Windows only reads non-ASCII names correctly through its wide functions, so
+//		  each call converts its path with one of these. Paths that fit TC_WIDE_PATH_INLINE_LENGTH never allocate.
+//
+
+class TCWidePath
+{
+	public:		// Members
+	public:		// Methods
+		explicit					TCWidePath( const TCString& path );
+									~TCWidePath();
+
+		inline const wchar_t*		Data() const			{ return (const wchar_t*)mPath; }
+
+	private:	// Members
+		char16*						mPath;
+		char16						mInlinePath[ TC_WIDE_PATH_INLINE_LENGTH ];
+
+	private:	// Methods
+									TCWidePath( const TCWidePath& inRef );				// Not copyable, mPath may point into this object.
+		TCWidePath&					operator=( const TCWidePath& inRef );
+};
+
 #endif // __TC_FILE_MANAGER_WIN_32_H__
\ No newline at end of file
@@ -11,6 +11,8 @@
 #include "TCLogger.h"
 #include "TCFileManager.h"
 #include "TCFile.h"
+#include "TCFrameArena.h"
+#include "TCMemoryTracker.h"
 #include "yaml.h"
 
 //
@@ -105,13 +107,15 @@ TCShaderImporter::~TCShaderImporter()
 // TCShaderImporter::Initialize
 //		- Will import the shader specified.
 // Inputs:
-//		- TCString filepath: The filepath for the shader to import.
+//		- const TCString& filepath: The filepath for the shader to import.
 // Outputs:
 //		- TCResult: The result of the operation.
 //
 
-TCResult TCShaderImporter::Import( TCString filepath, TCShaderImporter::Output** output )
+TCResult TCShaderImporter::Import( const TCString& filepath, TCShaderImporter::Output** output )
 {
+	TCMemoryTagScope memoryTag( TCMemoryTracker::kMemoryTagShaderImporter );
+
 	//
 	// First we need to see if we have a file manager that is valid.
 	//
@@ -200,18 +204,18 @@ void TCShaderImporter::Clone( const TCShaderImporter& toCopy )
 // GetShaderName
 //		- This will determine the shader name from the filepath.
 // Inputs:
-//		- TCString& filepath: The filepath of the shader.
+//		- const TCStringView& filepath: The filepath of the shader.
 // Outputs:
 //		- TCString name: The name of the shader
 //
 
-TCString TCShaderImporter::GetShaderName( TCString& filepath )
+TCString TCShaderImporter::GetShaderName( const TCStringView& filepath )
 {
 	TCString name;
-	int lastIndexOf = filepath.FindLastIndexOf( '\\' ) + 1;
+	int lastIndexOf = filepath.FindLast( '\\' ) + 1;
 	if( lastIndexOf > 0 )
 	{
-		filepath.Substring( lastIndexOf, name );
+		name = filepath.Substring( lastIndexOf );
 	}
 
 	return name;
@@ -221,13 +225,13 @@ TCString TCShaderImporter::GetShaderName( TCString& filepath )
 // ParseYAMLFile
 //		- This is the entry point for the YAML processor.
 // Inputs:
-//		- TCString& filepath: The path to the file.
+//		- const TCString& filepath: The path to the file.
 //		- TCShaderImporter::Output* output: The output.
 // Outputs:
 //		- TCResult: The result of the operation.
 //
 
-TCResult TCShaderImporter::ParseYAMLFile( TCString& filepath, TCShaderImporter::Output* output )
+TCResult TCShaderImporter::ParseYAMLFile( const TCString& filepath, TCShaderImporter::Output* output )
 {
 	//
 	// First we need to see if we can open up the file.
@@ -519,7 +523,7 @@ TCResult TCShaderImporter::ParseShaderUniforms( YAML::Node& node, Output* output
 
 		if( uniformNode[ kUniformConstantBufferOffsetNodeId ] )
 		{
-			output->mUniformData[ currentUniform ].constantBufferOffset = TCStringUtils::AtoI( TCString( uniformNode[ kUniformConstantBufferOffsetNodeId ].Scalar().c_str() ) );
+			output->mUniformData[ currentUniform ].constantBufferOffset = TCStringUtils::AtoI( uniformNode[ kUniformConstantBufferOffsetNodeId ].Scalar().c_str() );
 		}
 
 	}
@@ -541,8 +545,10 @@ TCResult TCShaderImporter::ParseShaderUniforms( YAML::Node& node, Output* output
 
 TCResult TCShaderImporter::ReadBool( bool*& output, TCString& uniformString, TCString& uniformName, unsigned int numElements )
 {
-	TCList< TCString > boolStrings;
-	uniformString.Split( ',', boolStrings );
+	// The pieces are only needed while parsing, so they are built in the frame arena and released on the way out.
+	TCLinearArena::Scope scratch( gFrameArena->Current() );
+	TCList< TCStringView, TCFrameAllocator > boolStrings;
+	TCStringView( uniformString ).Split( ',', boolStrings );
 
 	if( boolStrings.Count() != numElements )
 	{
@@ -552,11 +558,11 @@ TCResult TCShaderImporter::ReadBool( bool*& output, TCString& uniformString, TCS
 
 	for( int currentBool = 0; currentBool < boolStrings.Count(); ++currentBool )
 	{
-		if( boolStrings[ currentBool ] == "true" )
+		if( boolStrings[ currentBool ].TrimWhitespace() == "true" )
 		{
 			output[ currentBool ] = true;
 		}
-		else if( boolStrings[ currentBool ] == "false" )
+		else if( boolStrings[ currentBool ].TrimWhitespace() == "false" )
 		{
 			output[ currentBool ] = false;
 		}
@@ -583,19 +589,19 @@ TCResult TCShaderImporter::ReadBool( bool*& output, TCString& uniformString, TCS
 
 TCResult TCShaderImporter::ReadFloat( float*& output, TCString& uniformString, TCString& uniformName, unsigned int numElements )
 {
-	TCList< TCString > floatStrings;
-	uniformString.Split( ',', floatStrings );
-
-	if( floatStrings.Count() != numElements )
+	int numRead = TCStringUtils::ParseFloatArray( uniformString, ',', output, numElements );
+	if( numRead < 0 )
 	{
-		TC_SHADER_IMPORTER_LOG_ERROR( TCString("Failed to import shader: ") + mCurrentName + TCString(", uniform: ") + uniformName + TCString(", uniform default value element count was mismatched.") );
+		TC_SHADER_IMPORTER_LOG_ERROR( TCString("Failed to import shader: ") + mCurrentName + TCString(", uniform: ") + uniformName + TCString(", uniform default value was malformed.") );
 		return Failure_MalformedData;
 	}
 
-	for( int currentFloat = 0; currentFloat < floatStrings.Count(); ++currentFloat )
+	if( numRead != (int)numElements )
 	{
-		output[ currentFloat ] = TCStringUtils::AtoF( floatStrings[ currentFloat ] );
+		TC_SHADER_IMPORTER_LOG_ERROR( TCString("Failed to import shader: ") + mCurrentName + TCString(", uniform: ") + uniformName + TCString(", uniform default value element count was mismatched.") );
+		return Failure_MalformedData;
 	}
+
 	return Success;
 }
 
@@ -613,19 +619,19 @@ TCResult TCShaderImporter::ReadFloat( float*& output, TCString& uniformString, T
 
 TCResult TCShaderImporter::ReadHalf( float*& output, TCString& uniformString, TCString& uniformName, unsigned int numElements )
 {
-	TCList< TCString > floatStrings;
-	uniformString.Split( ',', floatStrings );
-
-	if( floatStrings.Count() != numElements )
+	int numRead = TCStringUtils::ParseFloatArray( uniformString, ',', output, numElements );
+	if( numRead < 0 )
 	{
-		TC_SHADER_IMPORTER_LOG_ERROR( TCString("Failed to import shader: ") + mCurrentName + TCString(", uniform: ") + uniformName + TCString(", uniform default value element count was mismatched.") );
+		TC_SHADER_IMPORTER_LOG_ERROR( TCString("Failed to import shader: ") + mCurrentName + TCString(", uniform: ") + uniformName + TCString(", uniform default value was malformed.") );
 		return Failure_MalformedData;
 	}
 
-	for( int currentFloat = 0; currentFloat < floatStrings.Count(); ++currentFloat )
+	if( numRead != (int)numElements )
 	{
-		output[ currentFloat ] = TCStringUtils::AtoF( floatStrings[ currentFloat ] );
+		TC_SHADER_IMPORTER_LOG_ERROR( TCString("Failed to import shader: ") + mCurrentName + TCString(", uniform: ") + uniformName + TCString(", uniform default value element count was mismatched.") );
+		return Failure_MalformedData;
 	}
+
 	return Success;
 }
 
@@ -643,19 +649,19 @@ TCResult TCShaderImporter::ReadHalf( float*& output, TCString& uniformString, TC
 
 TCResult TCShaderImporter::ReadInt( int*& output, TCString& uniformString, TCString& uniformName, unsigned int numElements )
 {
-	TCList< TCString > intStrings;
-	uniformString.Split( ',', intStrings );
-
-	if( intStrings.Count() != numElements )
+	int numRead = TCStringUtils::ParseIntArray( uniformString, ',', output, numElements );
+	if( numRead < 0 )
 	{
-		TC_SHADER_IMPORTER_LOG_ERROR( TCString("Failed to import shader: ") + mCurrentName + TCString(", uniform: ") + uniformName + TCString(", uniform default value element count was mismatched.") );
+		TC_SHADER_IMPORTER_LOG_ERROR( TCString("Failed to import shader: ") + mCurrentName + TCString(", uniform: ") + uniformName + TCString(", uniform default value was malformed.") );
 		return Failure_MalformedData;
 	}
 
-	for( int currentFloat = 0; currentFloat < intStrings.Count(); ++currentFloat )
+	if( numRead != (int)numElements )
 	{
-		output[ currentFloat ] = TCStringUtils::AtoI( intStrings[ currentFloat ] );
+		TC_SHADER_IMPORTER_LOG_ERROR( TCString("Failed to import shader: ") + mCurrentName + TCString(", uniform: ") + uniformName + TCString(", uniform default value element count was mismatched.") );
+		return Failure_MalformedData;
 	}
+
 	return Success;
 }
 
@@ -795,7 +801,7 @@ TCResult TCShaderImporter::ParseShaderConstantBuffers( YAML::Node& node, Output*
 		}
 		else
 		{
-			output->mConstantBufferData[ currentConstantBuffer ].bufferRegister = TCStringUtils::AtoI( TCString( constantBufferNode[ kConstantBufferRegisterNodeId ].Scalar().c_str() ) );
+			output->mConstantBufferData[ currentConstantBuffer ].bufferRegister = TCStringUtils::AtoI( constantBufferNode[ kConstantBufferRegisterNodeId ].Scalar().c_str() );
 		}
 
 		//
@@ -804,7 +810,7 @@ TCResult TCShaderImporter::ParseShaderConstantBuffers( YAML::Node& node, Output*
 
 		if( constantBufferNode[ kConstantBufferSizeNodeId ] )
 		{
-			output->mConstantBufferData[ currentConstantBuffer ].bufferSize = TCStringUtils::AtoI( TCString( constantBufferNode[ kConstantBufferSizeNodeId ].Scalar().c_str() ) );
+			output->mConstantBufferData[ currentConstantBuffer ].bufferSize = TCStringUtils::AtoI( constantBufferNode[ kConstantBufferSizeNodeId ].Scalar().c_str() );
 		}
 		else
 		{
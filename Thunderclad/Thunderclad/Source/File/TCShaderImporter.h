@@ -72,7 +72,7 @@ class TCShaderImporter
 							~TCShaderImporter();
 		TCShaderImporter&	operator=( const TCShaderImporter& toCopy );
 
-		TCResult			Import( TCString filepath, Output** output );
+		TCResult			Import( const TCString& filepath, Output** output );
 		TCResult			Release();
 
 	private:	// Members
@@ -82,8 +82,8 @@ class TCShaderImporter
 	
 	private:	// Methods
 		void			Clone( const TCShaderImporter& toCopy );
-		TCString		GetShaderName( TCString& shaderFilepath );
-		TCResult		ParseYAMLFile( TCString& filepath, Output* output );
+		TCString		GetShaderName( const TCStringView& shaderFilepath );
+		TCResult		ParseYAMLFile( const TCString& filepath, Output* output );
 		TCResult		ParseShaderProperties( YAML::Node node, Output* output );
 		TCResult		ParseShaderUniforms( YAML::Node& node, Output* output );
 		TCResult		ParseShaderUniformDefaultValue( YAML::Node& defaultNode, TCShaderUniform::Description* uniform, TCShaderUniform::Type type );
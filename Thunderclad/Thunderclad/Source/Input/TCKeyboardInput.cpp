@@ -25,10 +25,6 @@
 
 TCKeyboardInput::TCKeyboardInput()
 {
-	for( int currentKey = 0; currentKey < TC_MAX_KEYCODES; ++currentKey )
-	{
-		mKeyStates[ currentKey ] = false;
-	}
 }
 
 //
@@ -149,10 +145,7 @@ void TCKeyboardInput::Clone( const TCKeyboardInput& inRef )
 	TCEventDispatcher::Clone( inRef );
 	TCEventListener::Clone( inRef );
 
-	for( int currentKey = 0; currentKey < TC_MAX_KEYCODES; ++currentKey )
-	{
-		mKeyStates[ currentKey ] = inRef.mKeyStates[ currentKey ];
-	}
+	mKeyStates = inRef.mKeyStates;
 }
 
 //
@@ -170,11 +163,11 @@ void TCKeyboardInput::OnKeyDown( TCKeyCode keyCode )
 	// Update the key state.
 	//
 
-	if( mKeyStates[ keyCode ] == false )
+	if( !mKeyStates.Test( keyCode ) )
 	{
 		OnKeyClicked( keyCode );
 	}
-	mKeyStates[ keyCode ] = true;
+	mKeyStates.Set( keyCode );
 
 	//
 	// Send off the event.
@@ -216,7 +209,7 @@ void TCKeyboardInput::OnKeyClicked( TCKeyCode keyCode )
 
 void TCKeyboardInput::OnKeyUp( TCKeyCode keyCode )
 {
-	mKeyStates[ keyCode ] = false;
+	mKeyStates.Reset( keyCode );
 
 	KeyUpEvent upEvent;
 	upEvent.keyCode = keyCode;
@@ -14,6 +14,7 @@
 #include "TCResultCode.h"
 #include "TCEventDispatcher.h"
 #include "TCEventListener.h"
+#include "TCBitSet.h"
 
 //
 // Defines
@@ -68,11 +69,11 @@ class TCKeyboardInput :
 
 		virtual void				OnEventFired( TCEventID eventID, void* eventData );
 
-		inline bool					IsKeyDown( TCKeyCode keyCode )						{ return mKeyStates[ keyCode ]; }
-		inline bool					IsKeyUp( TCKeyCode keyCode )						{ return !mKeyStates[ keyCode ]; }
+		inline bool					IsKeyDown( TCKeyCode keyCode )						{ return mKeyStates.Test( keyCode ); }
+		inline bool					IsKeyUp( TCKeyCode keyCode )						{ return !mKeyStates.Test( keyCode ); }
 
 	protected:	// Members
-		bool mKeyStates[ TC_MAX_KEYCODES ];
+		TCBitSet< TC_MAX_KEYCODES > mKeyStates;		// One bit per key, set while the key is down.
 
 	protected:	// Methods
 		virtual void				Clone( const TCKeyboardInput& inRef );
@@ -9,6 +9,7 @@
 #include "TCGraphicsContext_DX11.h"
 #include "TCWindow.Win32.h"
 #include "TCLogger.h"
+#include "TCMemoryTracker.h"
 #include "TCVertexBuffer.h"
 #include "TCIndexBuffer.h"
 
@@ -108,6 +109,8 @@ TCGraphicsContext_DX11::TCBufferContext_DX11::TCBufferContext_DX11( TCGraphicsCo
 
 TCResult TCGraphicsContext_DX11::TCBufferContext_DX11::CreateVertexBuffer( void* description, TCVertexBuffer* bufferToCreate )
 {
+	TCMemoryTagScope memoryTag( TCMemoryTracker::kMemoryTagGraphics );
+
 	if( mDX11GraphicsContext == NULL )			return Failure_InvalidState;
 	if( mDX11GraphicsContext->mDevice == NULL )	return Failure_InvalidState;
 
@@ -171,6 +174,8 @@ TCResult TCGraphicsContext_DX11::TCBufferContext_DX11::CreateVertexBuffer( void*
 
 TCResult TCGraphicsContext_DX11::TCBufferContext_DX11::CreateIndexBuffer( void* description, TCIndexBuffer* indexBuffer )
 {
+	TCMemoryTagScope memoryTag( TCMemoryTracker::kMemoryTagGraphics );
+
 	if( mDX11GraphicsContext == NULL )			return Failure_InvalidState;
 	if( mDX11GraphicsContext->mDevice == NULL )	return Failure_InvalidState;
 
@@ -453,6 +458,8 @@ TCResult TCGraphicsContext_DX11::TCBufferContext_DX11::Unlock( IGraphicsBuffer*
 
 TCResult TCGraphicsContext_DX11::TCBufferContext_DX11::Fill( IGraphicsBuffer* buffer, void* data, unsigned int dataSize )
 {
+	if( data == NULL )		return Failure_InvalidParameter;
+
 	//
 	// Lock the vertex buffer first.
 	//
@@ -466,10 +473,10 @@ TCResult TCGraphicsContext_DX11::TCBufferContext_DX11::Fill( IGraphicsBuffer* bu
 	}
 
 	//
-	// Copy the memory into the resource
+	// Copy the memory into the resource, the mapping is write combined and never read back so it bypasses the cache.
 	//
 
-	TCMemoryUtils::MemCopy( data, outputData, dataSize );
+	TCMemoryUtils::CopyStreaming( data, outputData, dataSize );
 
 	//
 	// Unlock the vertex buffer.
@@ -10,6 +10,7 @@
 #include "TCGraphicsContext_DX11.h"
 #include "TCWindow.Win32.h"
 #include "TCLogger.h"
+#include "TCMemoryTracker.h"
 #include "TCVertexBuffer.h"
 #include "TCIndexBuffer.h"
 
@@ -72,6 +73,8 @@ TCGraphicsContext_DX11::~TCGraphicsContext_DX11()
 
 TCResult TCGraphicsContext_DX11::Initialize( TCGraphicsContext::Description& desc )
 {
+	TCMemoryTagScope memoryTag( TCMemoryTracker::kMemoryTagGraphics );
+
 	//
 	// Call the base initialize.
 	//
@@ -148,6 +151,12 @@ TCResult TCGraphicsContext_DX11::Initialize( TCGraphicsContext::Description& des
 
 TCResult TCGraphicsContext_DX11::Destroy()
 {
+	//
+	// Resources queued this frame still need the contexts to release their platform data.
+	//
+
+	DestroyRemainingResources();
+
 	if (mBufferContext != NULL)
 	{
 		mBufferContext->Release();
@@ -205,6 +214,14 @@ TCResult TCGraphicsContext_DX11::BeginFrame()
 TCResult TCGraphicsContext_DX11::EndFrame()
 {
 	TCResult result = SwapBuffers();
+
+	//
+	// The frame's draws have been submitted, so resources released during it can go. The runtime keeps the
+	// underlying objects alive until the gpu is done with them.
+	//
+
+	DestroyQueuedResources();
+
 	if( TC_FAILED( result ) )
 	{
 		return result;
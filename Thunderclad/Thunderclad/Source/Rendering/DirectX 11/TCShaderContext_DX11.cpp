@@ -16,6 +16,7 @@
 #include "TCFileManager.h"
 #include "TCFile.h"
 #include "TCLogger.h"
+#include "TCMemoryTracker.h"
 
 #include <D3DCompiler.h>
 //
@@ -173,6 +174,8 @@ HRESULT TCGraphicsContext_DX11::TCShaderContext_DX11::ShaderIncludeFinder::Close
 
 TCResult TCGraphicsContext_DX11::TCShaderContext_DX11::CreateVertexShader( void* description, TCShader* shaderToCreate )
 {
+	TCMemoryTagScope memoryTag( TCMemoryTracker::kMemoryTagGraphics );
+
 	TCShader::Description* shaderDesc = (TCShader::Description*)description;
 	TCFileManager* fileManager = mContext->GetFileManager();
 
@@ -273,6 +276,8 @@ D3D_SHADER_MACRO* TCGraphicsContext_DX11::TCShaderContext_DX11::CreateMacroArray
 
 TCResult TCGraphicsContext_DX11::TCShaderContext_DX11::CreatePixelShader( void* description, TCShader* shaderToCreate )
 {
+	TCMemoryTagScope memoryTag( TCMemoryTracker::kMemoryTagGraphics );
+
 	TCShader::Description* shaderDesc = (TCShader::Description*)description;
 	TCFileManager* fileManager = mContext->GetFileManager();
 
@@ -415,6 +420,8 @@ TCResult TCGraphicsContext_DX11::TCShaderContext_DX11::CreateShaderProgram( void
 
 TCResult TCGraphicsContext_DX11::TCShaderContext_DX11::CreateConstantBuffer( void* description, TCConstantBuffer* constantBufferToCreate )
 {
+	TCMemoryTagScope memoryTag( TCMemoryTracker::kMemoryTagGraphics );
+
 	TCConstantBuffer::Description* cbDescription = (TCConstantBuffer::Description*)description;
 
 	//
@@ -544,6 +551,7 @@ TCResult TCGraphicsContext_DX11::TCShaderContext_DX11::ReleasePixelShader( TCSha
 		delete platformData;
 	}
 
+	shader->SetGraphicsResources( NULL );	// A second release finds nothing left to release.
 	mShaders.Remove(shader);
 	return Success;
 }
@@ -572,6 +580,7 @@ TCResult TCGraphicsContext_DX11::TCShaderContext_DX11::ReleaseVertexShader( TCSh
 		delete platformData;
 	}
 
+	shader->SetGraphicsResources( NULL );	// A second release finds nothing left to release.
 	mShaders.Remove(shader);
 	return Success;
 }
@@ -590,26 +599,9 @@ TCResult TCGraphicsContext_DX11::TCShaderContext_DX11::ReleaseShaderProgram( TCS
 	if( program == NULL )
 		return Failure_InvalidParameter;
 
-	TCResult result = Success;
-	if( program->mVertexShader != NULL )
-	{
-		result = program->mVertexShader->Release();
-		if( TC_FAILED( result ) )
-		{
-			TCLogger::GetInstance()->LogError( TCString( "[TCShaderProgram] Failed to release vertex shader: ") + TCResultUtils::ResultToString( result ) );
-			return result;
-		}
-	}
-
-	if( program->mPixelShader != NULL )
-	{
-		result = program->mPixelShader->Release();
-		if( TC_FAILED( result ) )
-		{
-			TCLogger::GetInstance()->LogError( TCString( "[TCShaderProgram] Failed to release pixel shader: ") + TCResultUtils::ResultToString( result ) );
-			return result;
-		}
-	}
+	//
+	// The program only references its shaders, they're released when their last reference goes.
+	//
 
 	return Success;
 }
@@ -638,6 +630,7 @@ TCResult TCGraphicsContext_DX11::TCShaderContext_DX11::ReleaseConstantBuffer( TC
 		delete platformData;
 	}
 
+	buffer->SetGraphicsResources( NULL );	// A second release finds nothing left to release.
 	mConstantBuffers.Remove(buffer);
 	return Success;
 }
@@ -699,7 +692,7 @@ TCResult TCGraphicsContext_DX11::TCShaderContext_DX11::BindShaderProgram( TCShad
 	// Bind the vertex shader.
 	//
 
-	if( program->mVertexShader != NULL )
+	if( program->mVertexShader.IsValid() )
 	{
 		TCResult result = program->mVertexShader->Bind();
 		if( TC_FAILED( result ) )
@@ -713,7 +706,7 @@ TCResult TCGraphicsContext_DX11::TCShaderContext_DX11::BindShaderProgram( TCShad
 	// Bind the pixel shader.
 	//
 
-	if( program->mPixelShader != NULL )
+	if( program->mPixelShader.IsValid() )
 	{
 		TCResult result = program->mPixelShader->Bind();
 		if( TC_FAILED( result ) )
@@ -747,7 +740,7 @@ TCResult TCGraphicsContext_DX11::TCShaderContext_DX11::UnbindShaderProgram( TCSh
 	// Unbind the vertex shader.
 	//
 
-	if( program->mVertexShader != NULL )
+	if( program->mVertexShader.IsValid() )
 	{
 		TCResult result = program->mVertexShader->Unbind();
 		if( TC_FAILED( result ) )
@@ -761,7 +754,7 @@ TCResult TCGraphicsContext_DX11::TCShaderContext_DX11::UnbindShaderProgram( TCSh
 	// Unbind the pixel shader.
 	//
 
-	if( program->mPixelShader != NULL )
+	if( program->mPixelShader.IsValid() )
 	{
 		TCResult result = program->mPixelShader->Unbind();
 		if( TC_FAILED( result ) )
@@ -1034,9 +1027,13 @@ TCResult TCGraphicsContext_DX11::TCShaderContext_DX11::SetShaderAttribute( TCSha
 
 TCShader* TCGraphicsContext_DX11::TCShaderContext_DX11::GetShader( TCString& shaderName )
 {
+	TCStringAtom shaderAtom = TCStringAtom::Find( shaderName );
+	if( shaderAtom.IsEmpty() )
+		return NULL;
+
 	for( int currentShader = 0; currentShader < mShaders.Count(); ++currentShader )
 	{
-		if( mShaders[ currentShader ]->GetName() == shaderName )
+		if( mShaders[ currentShader ]->GetNameAtom() == shaderAtom )
 		{
 			return mShaders[ currentShader ];
 		}
@@ -1056,9 +1053,13 @@ TCShader* TCGraphicsContext_DX11::TCShaderContext_DX11::GetShader( TCString& sha
 
 TCConstantBuffer* TCGraphicsContext_DX11::TCShaderContext_DX11::GetConstantBuffer( TCString& constantBufferName )
 {
+	TCStringAtom constantBufferAtom = TCStringAtom::Find( constantBufferName );
+	if( constantBufferAtom.IsEmpty() )
+		return NULL;
+
 	for( int currentConstantBuffer = 0; currentConstantBuffer < mConstantBuffers.Count(); ++currentConstantBuffer )
 	{
-		if( mConstantBuffers[ currentConstantBuffer ]->GetName() == constantBufferName )
+		if( mConstantBuffers[ currentConstantBuffer ]->GetNameAtom() == constantBufferAtom )
 		{
 			return mConstantBuffers[ currentConstantBuffer ];
 		}
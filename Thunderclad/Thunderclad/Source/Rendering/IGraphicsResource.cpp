@@ -24,6 +24,7 @@
 //
 
 IGraphicsResource::IGraphicsResource( TCGraphicsContext* context )
+	: mNumReferences( 0 )
 {
 	TC_ASSERT( context );
 	mGraphicsContext	= context;
@@ -40,6 +41,7 @@ IGraphicsResource::IGraphicsResource( TCGraphicsContext* context )
 //
 
 IGraphicsResource::IGraphicsResource( const IGraphicsResource& inRef )
+	: mNumReferences( 0 )
 {
 	Clone( inRef );
 }
@@ -55,6 +57,7 @@ IGraphicsResource::IGraphicsResource( const IGraphicsResource& inRef )
 
 IGraphicsResource::~IGraphicsResource()
 {
+	TC_ASSERT( mNumReferences.load( std::memory_order_relaxed ) == 0 && "Deleted a graphics resource that is still referenced" );
 	Release();
 }
 
@@ -72,6 +75,50 @@ TCResult IGraphicsResource::Release()
 	return Success;
 }
 
+//
+// AddReference
+//		- Will add a reference to this resource. Safe to call from any thread that already holds a reference. The first
+//		  reference is counted by the context, so it can tell when a ref to one of its resources outlives it.
+// Inputs:
+//		- None.
+// Outputs:
+//		- int: The number of references after this one was added.
+//
+
+int IGraphicsResource::AddReference()
+{
+	int numReferences = mNumReferences.fetch_add( 1, std::memory_order_relaxed ) + 1;
+	if( numReferences == 1 )
+	{
+		mGraphicsContext->AddReferencedResource();
+	}
+
+	return numReferences;
+}
+
+//
+// RemoveReference
+//		- Will remove a reference to this resource, the last one queues the resource to be destroyed at the end of
+//		  the frame. Safe to call from any thread.
+// Inputs:
+//		- None.
+// Outputs:
+//		- int: The number of references left.
+//
+
+int IGraphicsResource::RemoveReference()
+{
+	int numReferences = mNumReferences.fetch_sub( 1, std::memory_order_acq_rel ) - 1;
+	TC_ASSERT( numReferences >= 0 && "Removed more references from a graphics resource than were added" );
+
+	if( numReferences == 0 )
+	{
+		mGraphicsContext->QueueDestroy( this );
+	}
+
+	return numReferences;
+}
+
 //
 // Assignment Operator
 //		- This will set this instance to another.
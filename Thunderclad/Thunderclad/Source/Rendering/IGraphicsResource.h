@@ -12,6 +12,8 @@
 
 #include "TCResultCode.h"
 
+#include <atomic>
+
 //
 // Forward Declaration
 //
@@ -27,6 +29,9 @@ class TCBufferContext;
 
 //
 // Class Declaration
+//		- Resources count their own references so they can be held by TCRef. When the last reference goes away the
+//		  resource is queued on its context and deleted at the end of the frame, after the frame's draws are submitted.
+//		  A resource that was never held by a TCRef is owned by whoever made it, as before.
 //
 
 class IGraphicsResource
@@ -40,9 +45,14 @@ class IGraphicsResource
 
 		virtual TCResult				Release() = 0;
 
+				int						AddReference();
+				int						RemoveReference();
+				int						GetNumReferences() const				{ return mNumReferences.load( std::memory_order_acquire ); }
+
 	protected:	// Members
 		TCGraphicsContext*				mGraphicsContext;
 		void*							mResourceBlob;
+		std::atomic< int >				mNumReferences;		// Belongs to this object, copies start with none.
 
 	protected:	// Methods
 		virtual void					Clone( const IGraphicsResource& graphicsResource );
@@ -56,6 +56,7 @@ TCConstantBuffer::TCConstantBuffer( TCGraphicsContext* context )
 	mContext		= context->GetShaderContext();
 	mRegister		= kInvalidRegister;
 	mName			= "";
+	mNameAtom		= TCStringAtom();
 	mIsBound		= false;
 	mShaderType		= TCShader::kShaderTypeUnknown;
 }
@@ -160,6 +161,7 @@ TCResult TCConstantBuffer::Initialize( TCConstantBuffer::Description* descriptio
 	//
 
 	mName		= description->name;
+	mNameAtom	= TCStringAtom( mName );
 	mRegister	= description->bufferRegister;
 
 	//
@@ -186,12 +188,9 @@ TCResult TCConstantBuffer::Release()
 
 	//
 	// Constant Buffer assume ownership of all shader uniforms, since on DX11 they don't cross buffer boundaries.
+	// Dropping the references destroys them at the end of the frame.
 	//
 
-	for( int currentShaderUniform = 0; currentShaderUniform < mShaderUniforms.Count(); ++currentShaderUniform )
-	{
-		mShaderUniforms[ currentShaderUniform ]->Release();
-	}
 	mShaderUniforms.Clear();
 	
 	//
@@ -322,7 +321,7 @@ TCResult TCConstantBuffer::UpdateShaderUniform( TCShaderUniform* uniform )
 	// Make sure the uniform is owned by us
 	//
 
-	if( GetShaderUniform( uniform->GetName().Data() ) == NULL )
+	if( GetShaderUniform( uniform->GetNameAtom() ) == NULL )
 	{
 		TC_CONSTANT_BUFFER_LOG_ERROR( "Failed to update shader uniform: Uniform isn't managed by this constant buffer." );
 		return Failure_InvalidParameter;
@@ -359,6 +358,36 @@ TCResult TCConstantBuffer::UpdateShaderUniform( TCShaderUniform* uniform )
 //
 
 TCResult TCConstantBuffer::UpdateShaderUniform( const char8* uniformName, void* uniformData, unsigned int uniformDataSize )
+{
+	//
+	// A name that was never interned can't belong to any uniform.
+	//
+
+	TCStringAtom uniformAtom = TCStringAtom::Find( uniformName );
+	if( uniformAtom.IsEmpty() )
+		return Failure_InvalidParameter;
+
+	return UpdateShaderUniform( uniformAtom, uniformData, uniformDataSize );
+}
+
+//
+// UpdateShaderUniform
+//		- This will update a specific shader uniform that is managed by this constant buffer, without touching the characters
+//		  of its name. Use TC_STRING_ATOM for names known at compile time.
+// Inputs:
+//		- TCStringAtom uniformName: The interned name of the uniform to update.
+//		- void* uniformData: The data to update the uniform with.
+//		- unsigned int uniformDataSize: The size of the data in the uniform.
+// Outputs:
+//		- TCResult: The result of the operation.
+//			- Failed_InvalidState: The context is invalid.
+//			- Failed_InvalidParameter: The specified shader uniform isn't managed by this constant buffer, or the shader uniform provided is null.
+//				- If the uniformData is NULL.
+//				- If the size of the uniform data doesn't match the uniform specified's data size.
+//			- For more information check the platform layer information.
+//
+
+TCResult TCConstantBuffer::UpdateShaderUniform( TCStringAtom uniformName, void* uniformData, unsigned int uniformDataSize )
 {	
 	//
 	// Get the shader uniform specified. 
@@ -410,14 +439,36 @@ TCResult TCConstantBuffer::UpdateShaderUniform( const char8* uniformName, void*
 TCShaderUniform* TCConstantBuffer::GetShaderUniform( const char8* uniformName )
 {
 	//
-	// Search our list of shader uniforms for a uniform with the name provided.
+	// A name that was never interned can't belong to any uniform.
+	//
+
+	TCStringAtom uniformAtom = TCStringAtom::Find( uniformName );
+	if( uniformAtom.IsEmpty() )
+		return NULL;
+
+	return GetShaderUniform( uniformAtom );
+}
+
+//
+// GetShaderUniform
+//		- This function will return a uniform with the name specified if managed by this constant buffer.
+// Inputs:
+//		- TCStringAtom uniformName: The interned name of the uniform.
+// Outputs:
+//		- TCShaderUniform* uniform: The uniform found, NULL if not found.
+//
+
+TCShaderUniform* TCConstantBuffer::GetShaderUniform( TCStringAtom uniformName )
+{
+	//
+	// Search our list of shader uniforms for a uniform with the name provided, each check is an integer compare.
 	//
 
 	for( int currentShaderUniform = 0; currentShaderUniform < mShaderUniforms.Count(); ++currentShaderUniform )
 	{
-		if( mShaderUniforms[ currentShaderUniform ] != NULL && mShaderUniforms[ currentShaderUniform ]->GetName().Equal( uniformName ) )
+		if( mShaderUniforms[ currentShaderUniform ].IsValid() && mShaderUniforms[ currentShaderUniform ]->GetNameAtom() == uniformName )
 		{
-			return mShaderUniforms[ currentShaderUniform ];
+			return mShaderUniforms[ currentShaderUniform ].Get();
 		}
 	}
 
@@ -435,9 +486,9 @@ TCShaderUniform* TCConstantBuffer::GetShaderUniform( const char8* uniformName )
 
 TCShaderUniform* TCConstantBuffer::GetShaderUniform( unsigned int uniformIndex )
 {
-	if( uniformIndex > (unsigned int)mShaderUniforms.Count() ) return NULL;
+	if( uniformIndex >= (unsigned int)mShaderUniforms.Count() ) return NULL;
 
-	return mShaderUniforms[ uniformIndex ];
+	return mShaderUniforms[ uniformIndex ].Get();
 }
 
 //
@@ -457,6 +508,7 @@ void TCConstantBuffer::Clone( const TCConstantBuffer& toCopy )
 	mContext		= toCopy.mContext;
 	mIsBound		= toCopy.mIsBound;
 	mName			= toCopy.mName;
+	mNameAtom		= toCopy.mNameAtom;
 	mRegister		= toCopy.mRegister;
 	mShaderType		= toCopy.mShaderType;
 }
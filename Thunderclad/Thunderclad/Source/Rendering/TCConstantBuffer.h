@@ -12,8 +12,11 @@
 
 #include "TCGraphicsContext.h"
 #include "TCString.h"
+#include "TCStringAtom.h"
 #include "TCList.h"
 #include "IGraphicsResource.h"
+#include "TCPoolAllocator.h"
+#include "TCRef.h"
 
 //
 // Defines
@@ -30,7 +33,8 @@ class TCShader;
 //
 
 class TCConstantBuffer
-	: public IGraphicsResource
+	: public IGraphicsResource,
+	  public TCPooledObject< TCConstantBuffer, TC_POOL_DEFAULT_BLOCKS_PER_CHUNK, TCMemoryTracker::kMemoryTagGraphics >
 {
 	public:		// Members
 		struct Description
@@ -57,15 +61,19 @@ class TCConstantBuffer
 		TCResult			Unbind();
 		TCResult			UpdateShaderUniform( TCShaderUniform* uniform );
 		TCResult			UpdateShaderUniform( const char8* uniformName, void* uniformData, unsigned int uniformSize );
+		TCResult			UpdateShaderUniform( TCStringAtom uniformName, void* uniformData, unsigned int uniformSize );
 		
 		TCShaderUniform*	GetShaderUniform( const char8* uniformName );
+		TCShaderUniform*	GetShaderUniform( TCStringAtom uniformName );
 		TCShaderUniform*	GetShaderUniform( unsigned int uniformIndex );
 		unsigned int		GetNumShaderUniforms()							{ return mShaderUniforms.Count(); }
 		const TCString&		GetName()										{ return mName; }
+		TCStringAtom		GetNameAtom() const								{ return mNameAtom; }
 
 	protected:	// Members
-		TCList< TCShaderUniform* >			mShaderUniforms;
+		TCList< TCRef< TCShaderUniform > >	mShaderUniforms;
 		TCString							mName;
+		TCStringAtom						mNameAtom;
 		unsigned int						mRegister;
 		TCGraphicsContext::TCShaderContext* mContext;
 		bool								mIsBound;
@@ -9,6 +9,8 @@
 
 #include "TCGraphicsContext.h"
 #include "TCPlatformPrecompilerSymbols.h"
+#include "IGraphicsResource.h"
+#include "TCLogger.h"
 
 //
 // Defines
@@ -24,6 +26,7 @@
 //
 
 TCGraphicsContext::TCGraphicsContext()
+	: mNumReferencedResources( 0 )
 {
 	mWindow = NULL;
 	mFileManager = NULL;
@@ -96,6 +99,8 @@ TCResult TCGraphicsContext::Initialize( TCGraphicsContext::Description& descript
 
 TCResult TCGraphicsContext::Destroy()
 {
+	DestroyRemainingResources();
+
 	return TCResult::Success;
 }
 
@@ -126,6 +131,8 @@ TCResult TCGraphicsContext::BeginFrame()
 
 TCResult TCGraphicsContext::EndFrame()
 {
+	DestroyQueuedResources();
+
 	return TCResult::Success;
 }
 
@@ -171,4 +178,92 @@ bool TCGraphicsContext::IsValidDescription( TCGraphicsContext::Description& desc
 	}
 
 	return true;
+}
+
+//
+// AddReferencedResource
+//		- Will count a resource that just got its first reference, it's uncounted again when it's queued to be deleted.
+// Inputs:
+//		- None.
+// Outputs:
+//		- None.
+//
+
+void TCGraphicsContext::AddReferencedResource()
+{
+	mNumReferencedResources.fetch_add( 1, std::memory_order_relaxed );
+}
+
+//
+// QueueDestroy
+//		- Will queue a resource that lost its last reference to be deleted at the end of the frame. The frame's draws
+//		  may still use it, so deleting it right away could stall on or break the frame in flight.
+// Inputs:
+//		- IGraphicsResource* resource: The resource to delete.
+// Outputs:
+//		- None.
+//
+
+void TCGraphicsContext::QueueDestroy( IGraphicsResource* resource )
+{
+	std::lock_guard< std::mutex > lock( mDestroyLock );
+	mDestroyQueue.Append( resource );
+	mNumReferencedResources.fetch_sub( 1, std::memory_order_relaxed );
+}
+
+//
+// DestroyQueuedResources
+//		- Will delete every queued resource. Deleting a resource can drop the last reference to the resources it held,
+//		  which queues them in turn, so this repeats until the queue stays empty. Called by the render thread at the
+//		  end of the frame.
+// Inputs:
+//		- None.
+// Outputs:
+//		- None.
+//
+
+void TCGraphicsContext::DestroyQueuedResources()
+{
+	TCList< IGraphicsResource* > resources;
+
+	for( ;; )
+	{
+		{
+			std::lock_guard< std::mutex > lock( mDestroyLock );
+			if( mDestroyQueue.Count() == 0 )
+				return;
+
+			resources = TCMove( mDestroyQueue );
+		}
+
+		for( int currentResource = 0; currentResource < resources.Count(); ++currentResource )
+		{
+			TC_ASSERT( resources[ currentResource ]->GetNumReferences() == 0 && "A graphics resource was referenced again after its last reference was removed" );
+			delete resources[ currentResource ];
+		}
+
+		resources.Clear();
+	}
+}
+
+//
+// DestroyRemainingResources
+//		- Will delete every queued resource when the context is destroyed. Every ref to the context's resources must
+//		  be gone by then, a ref that outlived the context would queue its resource on a context that no longer exists.
+// Inputs:
+//		- None.
+// Outputs:
+//		- None.
+//
+
+void TCGraphicsContext::DestroyRemainingResources()
+{
+	DestroyQueuedResources();
+
+	int numReferencedResources = mNumReferencedResources.load( std::memory_order_acquire );
+	if( numReferencedResources != 0 )
+	{
+		TCLogger::GetInstance()->LogError( TCString( "[TCGraphicsContext] Destroyed while refs still hold " ) + numReferencedResources + " of its resources." );
+		TC_ASSERT( 0 && "Destroyed a graphics context while refs still hold its resources" );
+	}
 }
\ No newline at end of file
@@ -15,6 +15,9 @@
 #include "TCString.h"
 #include "TCList.h"
 
+#include <atomic>
+#include <mutex>
+
 //
 // Defines
 //
@@ -167,11 +170,21 @@ class TCGraphicsContext
 		TCShaderContext*		mShaderContext;
 		TCFileManager*			mFileManager;
 
+		std::mutex							mDestroyLock;		// Guards mDestroyQueue, resources are queued from any thread.
+		TCList< IGraphicsResource* >		mDestroyQueue;
+		std::atomic< int >					mNumReferencedResources;	// Resources held by a TCRef, none may be left at Destroy.
+
 
 	protected:		// Functions
 		virtual bool					IsValidDescription( Description& desc );
 
+				void					AddReferencedResource();
+				void					QueueDestroy( IGraphicsResource* resource );
+				void					DestroyQueuedResources();
+				void					DestroyRemainingResources();
+
 		// Friends
+		friend class IGraphicsResource;
 		friend class TCVertexBuffer;
 		friend class TCIndexBuffer;
 		friend class TCShader;
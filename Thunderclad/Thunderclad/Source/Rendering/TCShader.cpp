@@ -113,6 +113,7 @@ TCResult TCShader::Initialize( TCShader::Description& desc )
 {
 	mType = desc.shaderType;
 	mName = desc.shaderName;
+	mNameAtom = TCStringAtom( mName );
 
 	TCResult result = Success;
 
@@ -206,14 +207,24 @@ TCResult TCShader::Release()
 	if( mShaderContext == NULL )
 		return Failure_InvalidState;
 
+	//
+	// Drop the sub components, any the other copies of this shader don't share are destroyed at the end of the frame.
+	//
+
+	mUniforms.Clear();
+	mConstantBuffers.Clear();
+	mInputAttributes.Clear();
+
 	TCResult result = Success;
 	switch( mType )
 	{
 		case kShaderTypeVertex:
 			result = mShaderContext->ReleaseVertexShader( this );
+			break;
 
 		case kShaderTypePixel:
 			result = mShaderContext->ReleasePixelShader( this );
+			break;
 
 		default: 
 		{
@@ -501,6 +512,7 @@ void TCShader::Clone( const TCShader& toCopy )
 	mProfile		= toCopy.mProfile;
 	mModel			= toCopy.mModel;
 	mName			= toCopy.mName;
+	mNameAtom		= toCopy.mNameAtom;
 
 	mConstantBuffers = toCopy.mConstantBuffers;
 	mInputAttributes = toCopy.mInputAttributes;
@@ -604,8 +616,8 @@ TCResult TCShader::PopulateConstantBuffers( void* output )
 
 	for( int currentConstantBuffer = 0; currentConstantBuffer < importData->mConstantBufferData.Count(); ++currentConstantBuffer )
 	{
-		TCConstantBuffer* constantBuffer = new TCConstantBuffer( mGraphicsContext );
-		if( constantBuffer == NULL )
+		TCRef< TCConstantBuffer > constantBuffer = TCMakeRef< TCConstantBuffer >( mGraphicsContext );
+		if( !constantBuffer.IsValid() )
 		{
 			return Failure_OutOfMemory;
 		}
@@ -655,8 +667,8 @@ TCResult TCShader::PopulateShaderUniforms( void* output )
 
 	for( int currentUniform = 0; currentUniform < importData->mUniformData.Count(); ++currentUniform )
 	{
-		TCShaderUniform* uniform = new TCShaderUniform( mGraphicsContext );
-		if( uniform == NULL )
+		TCRef< TCShaderUniform > uniform = TCMakeRef< TCShaderUniform >( mGraphicsContext );
+		if( !uniform.IsValid() )
 		{
 			return Failure_OutOfMemory;
 		}
@@ -705,8 +717,8 @@ TCResult TCShader::PopulateShaderAttributes( void* output )
 
 	for( int currentShaderAttribute = 0; currentShaderAttribute < importData->mAttributeData.Count(); ++currentShaderAttribute )
 	{
-		TCShaderAttribute* attribute = new TCShaderAttribute( mGraphicsContext );
-		if( attribute == NULL )
+		TCRef< TCShaderAttribute > attribute = TCMakeRef< TCShaderAttribute >( mGraphicsContext );
+		if( !attribute.IsValid() )
 		{
 			return Failure_OutOfMemory;
 		}
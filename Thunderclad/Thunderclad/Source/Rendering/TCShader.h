@@ -12,13 +12,17 @@
 
 #include "TCGraphicsContext.h"
 #include "TCString.h"
+#include "TCStringAtom.h"
 #include "TCVertexFormat.h"
 #include "IGraphicsResource.h"
+#include "TCRef.h"
 
 //
 // Defines
 //
 
+#define TC_SHADER_INLINE_RESOURCES	(8)		// Most shaders bind fewer resources than this, so their lists never touch the heap.
+
 //
 // Forward Declarations
 //
@@ -128,6 +132,7 @@ class TCShader
 				Type		GetType()			{ return mType; }
 				Model		GetModel()			{ return mModel; }
 		const   TCString&	GetName()			{ return mName; }
+		TCStringAtom		GetNameAtom() const	{ return mNameAtom; }
 
 		static	Type		TypeStringToEnum( TCString& string );
 		static	TCString	TypeEnumToString( Type type );
@@ -141,10 +146,11 @@ class TCShader
 		Profile								mProfile;
 		Model								mModel;
 		TCGraphicsContext::TCShaderContext*	mShaderContext;
-		TCList< TCShaderUniform* >			mUniforms;
-		TCList< TCConstantBuffer* >			mConstantBuffers;
-		TCList< TCShaderAttribute* >		mInputAttributes;
+		TCInlineList< TCRef< TCShaderUniform >, TC_SHADER_INLINE_RESOURCES >		mUniforms;
+		TCInlineList< TCRef< TCConstantBuffer >, TC_SHADER_INLINE_RESOURCES >		mConstantBuffers;
+		TCInlineList< TCRef< TCShaderAttribute >, TC_SHADER_INLINE_RESOURCES >	mInputAttributes;
 		TCString							mName;
+		TCStringAtom						mNameAtom;
 		bool								mIsBound;
 
 	protected: // Methods
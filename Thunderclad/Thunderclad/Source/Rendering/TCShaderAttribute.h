@@ -12,6 +12,7 @@
 
 #include "TCGraphicsContext.h"
 #include "IGraphicsResource.h"
+#include "TCPoolAllocator.h"
 
 //
 // Defines
@@ -26,7 +27,8 @@
 //
 
 class TCShaderAttribute
-	: IGraphicsResource
+	: public IGraphicsResource,
+	  public TCPooledObject< TCShaderAttribute, TC_POOL_DEFAULT_BLOCKS_PER_CHUNK, TCMemoryTracker::kMemoryTagGraphics >
 {
 	public:		// Members
 		
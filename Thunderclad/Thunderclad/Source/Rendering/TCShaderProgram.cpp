@@ -37,8 +37,6 @@ TCShaderProgram::TCShaderProgram( TCGraphicsContext* context )
 	mContext = context->GetShaderContext();
 	mIsBound = false;
 	mVertexFormat = NULL;
-	mVertexShader = NULL;
-	mPixelShader = NULL;
 }
 
 //
@@ -104,13 +102,13 @@ TCResult TCShaderProgram::Initialize( TCShaderProgramDescription* description )
 	if( description == NULL )
 		return Failure_InvalidParameter;
 
-	if( description->mVertexShader == NULL )
+	if( !description->mVertexShader.IsValid() )
 	{
 		TC_SHADER_PROGRAM_LOG_ERROR( "Failed to initialize shader program: a NULL vertex shader was provided." );
 		return Failure_InvalidParameter;
 	}
 
-	if( description->mPixelShader == NULL )
+	if( !description->mPixelShader.IsValid() )
 	{
 		TC_SHADER_PROGRAM_LOG_ERROR( "Failed to initialize shader program: a NULL pixel shader was provided." );
 		return Failure_InvalidParameter;
@@ -149,6 +147,9 @@ TCResult TCShaderProgram::Release()
 		return result;
 	}
 
+	mVertexShader.Reset();
+	mPixelShader.Reset();
+
 	return IGraphicsResource::Release();
 }
 
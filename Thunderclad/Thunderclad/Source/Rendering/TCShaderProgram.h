@@ -13,6 +13,7 @@
 #include "TCGraphicsContext.h"
 #include "TCShader.h"
 #include "IGraphicsResource.h"
+#include "TCRef.h"
 
 //
 // Forward Declarations
@@ -29,15 +30,15 @@ class TCVertexFormat;
 //
 
 class TCShaderProgram
-	: IGraphicsResource
+	: public IGraphicsResource
 {
 	public:		// Members
 		struct TCShaderProgramDescription
 		{
-			TCShader*		mVertexShader;
-			TCShader*		mPixelShader;
-			TCVertexFormat* mVertexFormat;
-			TCString		mProgramName;
+			TCRef< TCShader >	mVertexShader;		// The program references both shaders, so they must come from new.
+			TCRef< TCShader >	mPixelShader;
+			TCVertexFormat*		mVertexFormat;
+			TCString			mProgramName;
 		};
 
 	public:		// Methods
@@ -54,8 +55,8 @@ class TCShaderProgram
 		const	TCString&			GetName() const		{ return mProgramName; }
 
 	protected:	// Members
-		TCShader*							mVertexShader;
-		TCShader*							mPixelShader;
+		TCRef< TCShader >					mVertexShader;
+		TCRef< TCShader >					mPixelShader;
 		TCVertexFormat*						mVertexFormat;
 		bool								mIsBound;
 		TCString							mProgramName;
@@ -48,6 +48,7 @@ TCShaderUniform::TCShaderUniform( TCGraphicsContext* context )
 	mDefaultValue			= NULL;
 	mParentConstantBuffer	= NULL;
 	mName					= "";
+	mNameAtom				= TCStringAtom();
 	mType					= kShaderUniformTypeUnknown;
 	mUsage					= kShaderUniformUsageUnknown;
 	mRegister				= -1;
@@ -168,6 +169,7 @@ TCResult TCShaderUniform::Initialize( TCShaderUniform::Description* description
 
 	mType = description->type;
 	mName = description->name;
+	mNameAtom = TCStringAtom( mName );
 	mRegister = description->constantBufferName.IsEmpty() ? description->globalRegister : description->constantBufferOffset;
 	
 	//
@@ -438,6 +440,7 @@ void TCShaderUniform::Clone( const TCShaderUniform& uniformToCopy )
 
 	mType					= uniformToCopy.mType;
 	mName					= uniformToCopy.mName;
+	mNameAtom				= uniformToCopy.mNameAtom;
 	mContext				= uniformToCopy.mContext;
 	mUsage					= uniformToCopy.mUsage;
 	mRegister				= uniformToCopy.mRegister;
@@ -12,7 +12,9 @@
 
 #include "TCGraphicsContext.h"
 #include "TCString.h"
+#include "TCStringAtom.h"
 #include "IGraphicsResource.h"
+#include "TCPoolAllocator.h"
 
 //
 // Defines
@@ -29,7 +31,8 @@ class TCConstantBuffer;
 //
 
 class TCShaderUniform
-	: IGraphicsResource
+	: public IGraphicsResource,
+	  public TCPooledObject< TCShaderUniform, TC_POOL_DEFAULT_BLOCKS_PER_CHUNK, TCMemoryTracker::kMemoryTagGraphics >
 {
 	public: // Members
 		enum Type
@@ -91,6 +94,7 @@ class TCShaderUniform
 		TCResult			Release();
 
 		const TCString&		GetName()					{ return mName; }
+		TCStringAtom		GetNameAtom() const			{ return mNameAtom; }
 		const Type			GetType()					{ return mType; }
 		const Usage			GetUsage()					{ return mUsage; }
 		const void*			GetDefaultData()			{ return mDefaultValue; }
@@ -106,6 +110,7 @@ class TCShaderUniform
 
 	protected: // Members
 		TCString							mName;
+		TCStringAtom						mNameAtom;			// Interned when initialized, so lookups by name are an integer compare.
 		Type								mType;
 		Usage								mUsage;
 		void*								mData;
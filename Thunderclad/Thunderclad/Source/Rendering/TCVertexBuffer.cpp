@@ -74,7 +74,7 @@ TCResult TCVertexBuffer::Initialize( IGraphicsBuffer::Description& inDesc )
 	if( !desc.mDiscardVerts )
 	{
 		mVertices = new unsigned char[ dataSize ];
-		TCMemoryUtils::MemCopy( mVertices, desc.mData, dataSize );
+		TCMemoryUtils::MemCopy( desc.mData, mVertices, dataSize );
 	}
 
 	//
@@ -177,5 +177,5 @@ void TCVertexBuffer::Clone( const TCVertexBuffer& inRef )
 
 	unsigned int dataSize = mNumVertices * mVertexFormat->Size();
 	mVertices = new unsigned char[ dataSize ];
-	TCMemoryUtils::MemCopy( mVertices, inRef.mVertices, dataSize );
+	TCMemoryUtils::MemCopy( inRef.mVertices, mVertices, dataSize );
 }
\ No newline at end of file
@@ -0,0 +1,341 @@
+//
+// TCHashFunctions_Benchmark.cpp
+// This file will define the benchmark for the hash functions.
+//
+
+//
+// Includes
+//
+
+#include "TCHashFunctions_Benchmark.h"
+#include "TCFlatHashTable.h"
+#include "TCMathUtils.h"
+#include "TCLogger.h"
+#include "TCTestRandom.h"
+
+//
+// Defines
+//
+
+#define THROUGHPUT_BUFFER_SIZE		(1024 * 1024)
+#define THROUGHPUT_TARGET_BYTES		(16 * 1024 * 1024)	// How many bytes to hash per function and size.
+#define AVALANCHE_KEY_SIZE			16
+#define AVALANCHE_NUM_KEYS			2000
+#define HASH_BITS					32
+
+static const unsigned int	gThroughputSizes[]		= { 8, 16, 32, 64, 4 * 1024, 64 * 1024, 1024 * 1024 };
+static const unsigned int	gPrimeCapacityHints[]	= { 101, 1009, 10007 };
+
+static const TCHashFunctions_Benchmark::HashFunction gHashFunctions[] =
+{
+	{ "AdditiveHash",		TCHashFunctions::AdditiveHash },
+	{ "XorHash",			TCHashFunctions::XorHash },
+	{ "RotatingHash",		TCHashFunctions::RotatingHash },
+	{ "BernsteinHash",		TCHashFunctions::BernsteinHash },
+	{ "ShiftAddXorHash",	TCHashFunctions::ShiftAddXorHash },
+	{ "FNVHash",			TCHashFunctions::FNVHash },
+	{ "OneAtATimeHash",		TCHashFunctions::OneAtATimeHash },
+	{ "XXHash",				TCHashFunctions::XXHash },
+	{ "CRC32CHash",			TCHashFunctions::CRC32CHash },
+};
+
+#define NUM_HASH_FUNCTIONS	( sizeof( gHashFunctions ) / sizeof( gHashFunctions[ 0 ] ) )
+
+//
+// StartTest
+//		- This function will run the benchmark for this module.
+// Inputs:
+//		- None.
+// Outputs:
+//		- TCUnitTest::Result: The result of the operation.
+//
+
+TCUnitTest::Result TCHashFunctions_Benchmark::StartTest()
+{
+	TCList< TCString > filePaths;
+	TCList< TCString > uniformNames;
+
+	GenerateFilePaths( filePaths );
+	GenerateUniformNames( uniformNames );
+
+	for( unsigned int currentHash = 0; currentHash < NUM_HASH_FUNCTIONS; ++currentHash )
+	{
+		const HashFunction& hash = gHashFunctions[ currentHash ];
+
+		MeasureThroughput( hash );
+		MeasureAvalanche( hash );
+		MeasureDistribution( hash, filePaths, "file paths" );
+		MeasureDistribution( hash, uniformNames, "uniform names" );
+	}
+
+	return TCUnitTest::TestResult_Success;
+}
+
+//
+// MeasureThroughput
+//		- Will log how many bytes per second a hash can consume for small keys and large blobs.
+// Inputs:
+//		- const HashFunction& hash: The hash to measure.
+// Outputs:
+//		- None.
+//
+
+void TCHashFunctions_Benchmark::MeasureThroughput( const HashFunction& hash )
+{
+	unsigned char* buffer = new unsigned char[ THROUGHPUT_BUFFER_SIZE ];
+	unsigned int random = 0x12345678;
+	for( unsigned int currentByte = 0; currentByte < THROUGHPUT_BUFFER_SIZE; ++currentByte )
+	{
+		buffer[ currentByte ] = (unsigned char)TCTestRandom::NextXorshift( random );
+	}
+
+	//
+	// Sum every result so the optimizer can't throw the work away.
+	//
+
+	volatile unsigned int sink = 0;
+
+	for( unsigned int currentSize = 0; currentSize < sizeof( gThroughputSizes ) / sizeof( gThroughputSizes[ 0 ] ); ++currentSize )
+	{
+		unsigned int size		= gThroughputSizes[ currentSize ];
+		unsigned int iterations	= THROUGHPUT_TARGET_BYTES / size;
+		unsigned int result		= 0;
+
+		double start = GetTime();
+		for( unsigned int currentIteration = 0; currentIteration < iterations; ++currentIteration )
+		{
+			unsigned int offset = ( currentIteration * size ) & ( THROUGHPUT_BUFFER_SIZE - 1 );	// Walk the buffer so small keys differ.
+			result += hash.function( buffer + offset, size );
+		}
+		double elapsed = GetTime() - start;
+
+		sink += result;
+
+		double bytesPerSecond = ( elapsed > 0.0 ) ? (double)iterations * size / elapsed : 0.0;
+		LogResult( TCString( hash.name ) + " throughput " + (int)size + " B", bytesPerSecond / ( 1024.0 * 1024.0 ), "MB/s" );
+	}
+
+	delete[] buffer;
+}
+
+//
+// MeasureAvalanche
+//		- Will log how close flipping one input bit comes to flipping each output bit half the time.
+// Inputs:
+//		- const HashFunction& hash: The hash to measure.
+// Outputs:
+//		- None.
+//
+
+void TCHashFunctions_Benchmark::MeasureAvalanche( const HashFunction& hash )
+{
+	static unsigned int flipCounts[ AVALANCHE_KEY_SIZE * 8 ][ HASH_BITS ];
+	for( int inputBit = 0; inputBit < AVALANCHE_KEY_SIZE * 8; ++inputBit )
+	{
+		for( int outputBit = 0; outputBit < HASH_BITS; ++outputBit )
+		{
+			flipCounts[ inputBit ][ outputBit ] = 0;
+		}
+	}
+
+	unsigned int random = 0x9E3779B9;
+	unsigned char key[ AVALANCHE_KEY_SIZE ];
+
+	for( int currentKey = 0; currentKey < AVALANCHE_NUM_KEYS; ++currentKey )
+	{
+		for( int currentByte = 0; currentByte < AVALANCHE_KEY_SIZE; ++currentByte )
+		{
+			key[ currentByte ] = (unsigned char)TCTestRandom::NextXorshift( random );
+		}
+
+		unsigned int original = hash.function( key, AVALANCHE_KEY_SIZE );
+		for( int inputBit = 0; inputBit < AVALANCHE_KEY_SIZE * 8; ++inputBit )
+		{
+			key[ inputBit / 8 ] ^= (unsigned char)( 1 << ( inputBit % 8 ) );
+			unsigned int flipped = original ^ hash.function( key, AVALANCHE_KEY_SIZE );
+			key[ inputBit / 8 ] ^= (unsigned char)( 1 << ( inputBit % 8 ) );
+
+			for( int outputBit = 0; outputBit < HASH_BITS; ++outputBit )
+			{
+				flipCounts[ inputBit ][ outputBit ] += ( flipped >> outputBit ) & 1;
+			}
+		}
+	}
+
+	//
+	// Bias is 0% when an output bit flips exactly half the time and 100% when it always or never flips.
+	//
+
+	double totalBias = 0.0;
+	double worstBias = 0.0;
+	for( int inputBit = 0; inputBit < AVALANCHE_KEY_SIZE * 8; ++inputBit )
+	{
+		for( int outputBit = 0; outputBit < HASH_BITS; ++outputBit )
+		{
+			double probability = (double)flipCounts[ inputBit ][ outputBit ] / AVALANCHE_NUM_KEYS;
+			double bias = fabs( probability - 0.5 ) * 2.0;
+
+			totalBias += bias;
+			worstBias = TC_MAX( worstBias, bias );
+		}
+	}
+
+	LogResult( TCString( hash.name ) + " avalanche mean bias", totalBias * 100.0 / ( AVALANCHE_KEY_SIZE * 8 * HASH_BITS ), "%" );
+	LogResult( TCString( hash.name ) + " avalanche worst bias", worstBias * 100.0, "%" );
+}
+
+//
+// MeasureDistribution
+//		- Will log collisions and bucket spread for a set of realistic keys.
+// Inputs:
+//		- const HashFunction& hash: The hash to measure.
+//		- TCList< TCString >& keys: The keys to hash.
+//		- const char8* keySetName: The name of the key set for the log.
+// Outputs:
+//		- None.
+//
+
+void TCHashFunctions_Benchmark::MeasureDistribution( const HashFunction& hash, TCList< TCString >& keys, const char8* keySetName )
+{
+	int numKeys = keys.Count();
+	TCList< unsigned int > hashes;
+	hashes.Reserve( numKeys );
+
+	//
+	// Count keys that share a full 32 bit hash.
+	//
+
+	TCFlatHashTable< unsigned int, int > uniqueHashes( numKeys );
+	for( int currentKey = 0; currentKey < numKeys; ++currentKey )
+	{
+		unsigned int keyHash = hash.function( keys[ currentKey ].Data(), keys[ currentKey ].Length() );
+		hashes.Append( keyHash );
+
+		if( !uniqueHashes.ContainsKey( keyHash ) )
+		{
+			uniqueHashes.AddValue( keyHash, currentKey );
+		}
+	}
+
+	TCString label = TCString( hash.name ) + " " + keySetName;
+	LogResult( label + " full collisions", TCString( numKeys - uniqueHashes.Count() ) + " of " + numKeys );
+
+	//
+	// Spread the keys across prime capacities the way TCHashTable does, and power of two capacities
+	// the way TCFlatHashTable does. A chi squared per degree of freedom near 1.0 is a uniform spread.
+	//
+
+	int powerOfTwoCapacity = 1;
+	while( powerOfTwoCapacity < numKeys )
+	{
+		powerOfTwoCapacity <<= 1;
+	}
+
+	int numCapacities = sizeof( gPrimeCapacityHints ) / sizeof( gPrimeCapacityHints[ 0 ] ) + 1;
+	for( int currentCapacity = 0; currentCapacity < numCapacities; ++currentCapacity )
+	{
+		bool isPowerOfTwo = ( currentCapacity == numCapacities - 1 );
+		unsigned int capacity = isPowerOfTwo ? powerOfTwoCapacity : gPrimeCapacityHints[ currentCapacity ];
+		while( !isPowerOfTwo && !TCMathUtils::IsPrime( capacity ) )
+		{
+			capacity += 2;
+		}
+
+		TCList< int > buckets;
+		buckets.Resize( capacity );
+		for( unsigned int currentBucket = 0; currentBucket < capacity; ++currentBucket )
+		{
+			buckets[ currentBucket ] = 0;
+		}
+
+		for( int currentKey = 0; currentKey < numKeys; ++currentKey )
+		{
+			unsigned int bucket = isPowerOfTwo ? ( hashes[ currentKey ] & ( capacity - 1 ) ) : ( ( hashes[ currentKey ] & 0x7FFFFFFF ) % capacity );
+			buckets[ bucket ]++;
+		}
+
+		double expected = (double)numKeys / capacity;
+		double chiSquared = 0.0;
+		int usedBuckets = 0;
+		for( unsigned int currentBucket = 0; currentBucket < capacity; ++currentBucket )
+		{
+			double difference = buckets[ currentBucket ] - expected;
+			chiSquared += difference * difference / expected;
+			usedBuckets += ( buckets[ currentBucket ] > 0 ) ? 1 : 0;
+		}
+
+		TCString capacityLabel = label + ( isPowerOfTwo ? " pow2 capacity " : " prime capacity " ) + (int)capacity;
+		LogResult( capacityLabel + " chi2/df", chiSquared / ( capacity - 1 ), "" );
+		LogResult( capacityLabel + " bucket collisions", TCString( numKeys - usedBuckets ) );
+	}
+}
+
+//
+// GenerateFilePaths
+//		- Will fill a list with asset paths shaped like the ones the file manager loads.
+// Inputs:
+//		- TCList< TCString >& keys: The list to fill.
+// Outputs:
+//		- None.
+//
+
+void TCHashFunctions_Benchmark::GenerateFilePaths( TCList< TCString >& keys )
+{
+	const char8* directories[]	= { "Resources/Shaders/HLSL/", "Resources/Shaders/GLSL/", "Resources/Textures/Environment/", "Resources/Textures/Characters/", "Resources/Meshes/Props/", "Resources/Audio/Ambient/" };
+	const char8* stems[]		= { "rock", "tree", "crate", "barrel", "wall", "floor", "hero", "enemy", "sky", "water" };
+	const char8* extensions[]	= { "_diffuse.dds", "_normal.dds", ".rvs", ".rps", ".mesh", ".wav" };
+
+	for( int currentDirectory = 0; currentDirectory < 6; ++currentDirectory )
+	{
+		for( int currentStem = 0; currentStem < 10; ++currentStem )
+		{
+			for( int currentIndex = 0; currentIndex < 100; ++currentIndex )
+			{
+				TCString path = directories[ currentDirectory ];
+				path += stems[ currentStem ];
+				path += '_';
+				path += currentIndex;
+				path += extensions[ ( currentIndex + currentStem ) % 6 ];
+
+				keys.Append( path );
+			}
+		}
+	}
+}
+
+//
+// GenerateUniformNames
+//		- Will fill a list with names shaped like the uniforms in our shaders.
+// Inputs:
+//		- TCList< TCString >& keys: The list to fill.
+// Outputs:
+//		- None.
+//
+
+void TCHashFunctions_Benchmark::GenerateUniformNames( TCList< TCString >& keys )
+{
+	const char8* prefixes[]	= { "g", "u" };
+	const char8* names[]	= { "World", "View", "Projection", "WorldViewProjection", "LightColor", "LightDirection", "LightPosition", "DiffuseColor", "SpecularColor", "SpecularPower", "Time", "CameraPosition", "Bones", "Shadow", "Fog" };
+	const char8* members[]	= { "", ".position", ".color", ".range" };
+
+	for( int currentPrefix = 0; currentPrefix < 2; ++currentPrefix )
+	{
+		for( int currentName = 0; currentName < 15; ++currentName )
+		{
+			for( int currentIndex = 0; currentIndex < 32; ++currentIndex )
+			{
+				for( int currentMember = 0; currentMember < 4; ++currentMember )
+				{
+					TCString name = prefixes[ currentPrefix ];
+					name += names[ currentName ];
+					name += '[';
+					name += currentIndex;
+					name += ']';
+					name += members[ currentMember ];
+
+					keys.Append( name );
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,49 @@
+//
+// TCHashFunctions_Benchmark.h
+// This file will define the benchmark for the hash functions.
+//
+
+#ifndef __TC_HASH_FUNCTIONS_BENCHMARK_H__
+#define __TC_HASH_FUNCTIONS_BENCHMARK_H__
+
+//
+// Includes
+//
+
+#include "TCBenchmark.h"
+#include "TCHashFunctions.h"
+#include "TCList.h"
+
+//
+// Defines
+//
+
+//
+// Class Declaration
+//		- Measures throughput, avalanche, bucket distribution and collisions for every TCHashFunction.
+//
+
+class TCHashFunctions_Benchmark : public TCBenchmark
+{
+	public:		// Members
+		struct HashFunction
+		{
+			const char8*	name;
+			TCHashFunction	function;
+		};
+
+	public:		// Methods
+		virtual Result		StartTest();
+		virtual TCString	GetName()		{ return "TCHashFunctions_Benchmark"; }
+
+	private:	// Members
+	private:	// Methods
+		void				MeasureThroughput( const HashFunction& hash );
+		void				MeasureAvalanche( const HashFunction& hash );
+		void				MeasureDistribution( const HashFunction& hash, TCList< TCString >& keys, const char8* keySetName );
+
+		void				GenerateFilePaths( TCList< TCString >& keys );
+		void				GenerateUniformNames( TCList< TCString >& keys );
+};
+
+#endif // __TC_HASH_FUNCTIONS_BENCHMARK_H__
@@ -0,0 +1,152 @@
+//
+// TCMemUtils_Benchmark.cpp
+// This file will define the benchmark for the memory copy and fill routines.
+//
+
+//
+// Includes
+//
+
+#include "TCMemUtils_Benchmark.h"
+#include "TCLogger.h"
+
+#include <string.h>
+
+//
+// Defines
+//
+
+#define BUFFER_SIZE				(32 * 1024 * 1024)	// Larger than the last level cache, so the largest size streams from memory.
+#define CACHED_WINDOW_SIZE		(16 * 1024)			// Sizes below this walk a window that stays in the L1 cache.
+#define TARGET_BYTES			(256 * 1024 * 1024)	// How many bytes to move per routine and size.
+
+static const unsigned int gSizes[] = { 8, 16, 32, 64, 256, 4 * 1024, 64 * 1024, 1024 * 1024, BUFFER_SIZE };
+
+#define NUM_SIZES	( sizeof( gSizes ) / sizeof( gSizes[ 0 ] ) )
+
+//
+// Routines
+//		- Everything is called through a pointer, so the libc routines can't be inlined where ours can't be either.
+//
+
+typedef void	(*TCCopyRoutine)( const void* source, void* dest, size_t size );
+typedef void	(*TCFillRoutine)( void* dest, unsigned char value, size_t size );
+
+static void	LibcCopy( const void* source, void* dest, size_t size )				{ memcpy( dest, source, size ); }
+static void	LibcFill( void* dest, unsigned char value, size_t size )			{ memset( dest, value, size ); }
+
+static const struct { const char8* name; TCCopyRoutine routine; } gCopyRoutines[] =
+{
+	{ "memcpy",			LibcCopy },
+	{ "Copy",			TCMemoryUtils::Copy },
+	{ "CopyStreaming",	TCMemoryUtils::CopyStreaming },
+};
+
+static const struct { const char8* name; TCFillRoutine routine; } gFillRoutines[] =
+{
+	{ "memset",			LibcFill },
+	{ "Fill",			TCMemoryUtils::Fill },
+	{ "FillStreaming",	TCMemoryUtils::FillStreaming },
+};
+
+//
+// GetOffset
+//		- Will step small sizes through the cached window, a few bytes off alignment like uniforms packed in a buffer.
+//
+
+static inline unsigned int GetOffset( unsigned int iteration, unsigned int size )
+{
+	return ( size < CACHED_WINDOW_SIZE ) ? ( iteration * ( size + 4 ) ) & ( CACHED_WINDOW_SIZE - 1 ) : 0;
+}
+
+//
+// StartTest
+//		- This function will run the benchmark for this module.
+// Inputs:
+//		- None.
+// Outputs:
+//		- TCUnitTest::Result: The result of the operation.
+//
+
+TCUnitTest::Result TCMemUtils_Benchmark::StartTest()
+{
+	// Room past the window for the largest small size.
+	mSource = new unsigned char[ BUFFER_SIZE + CACHED_WINDOW_SIZE ];
+	mDest = new unsigned char[ BUFFER_SIZE + CACHED_WINDOW_SIZE ];
+
+	memset( mSource, 0x3C, BUFFER_SIZE + CACHED_WINDOW_SIZE );
+	memset( mDest, 0x3C, BUFFER_SIZE + CACHED_WINDOW_SIZE );
+
+	MeasureCopy();
+	MeasureFill();
+
+	delete[] mSource;
+	delete[] mDest;
+
+	return TCUnitTest::TestResult_Success;
+}
+
+//
+// MeasureCopy
+//		- Will log the throughput of every copy routine at every size.
+// Inputs:
+//		- None.
+// Outputs:
+//		- None.
+//
+
+void TCMemUtils_Benchmark::MeasureCopy()
+{
+	for( unsigned int currentRoutine = 0; currentRoutine < sizeof( gCopyRoutines ) / sizeof( gCopyRoutines[ 0 ] ); ++currentRoutine )
+	{
+		for( unsigned int currentSize = 0; currentSize < NUM_SIZES; ++currentSize )
+		{
+			unsigned int size		= gSizes[ currentSize ];
+			unsigned int iterations	= TARGET_BYTES / size;
+			TCCopyRoutine routine	= gCopyRoutines[ currentRoutine ].routine;
+
+			double start = GetTime();
+			for( unsigned int currentIteration = 0; currentIteration < iterations; ++currentIteration )
+			{
+				unsigned int offset = GetOffset( currentIteration, size );
+				routine( mSource + offset, mDest + offset, size );
+			}
+			double elapsed = GetTime() - start;
+
+			double bytesPerSecond = ( elapsed > 0.0 ) ? (double)iterations * size / elapsed : 0.0;
+			LogResult( TCString( gCopyRoutines[ currentRoutine ].name ) + " " + (int)size + " B", bytesPerSecond / ( 1024.0 * 1024.0 * 1024.0 ), "GB/s" );
+		}
+	}
+}
+
+//
+// MeasureFill
+//		- Will log the throughput of every fill routine at every size.
+// Inputs:
+//		- None.
+// Outputs:
+//		- None.
+//
+
+void TCMemUtils_Benchmark::MeasureFill()
+{
+	for( unsigned int currentRoutine = 0; currentRoutine < sizeof( gFillRoutines ) / sizeof( gFillRoutines[ 0 ] ); ++currentRoutine )
+	{
+		for( unsigned int currentSize = 0; currentSize < NUM_SIZES; ++currentSize )
+		{
+			unsigned int size		= gSizes[ currentSize ];
+			unsigned int iterations	= TARGET_BYTES / size;
+			TCFillRoutine routine	= gFillRoutines[ currentRoutine ].routine;
+
+			double start = GetTime();
+			for( unsigned int currentIteration = 0; currentIteration < iterations; ++currentIteration )
+			{
+				routine( mDest + GetOffset( currentIteration, size ), (unsigned char)currentIteration, size );
+			}
+			double elapsed = GetTime() - start;
+
+			double bytesPerSecond = ( elapsed > 0.0 ) ? (double)iterations * size / elapsed : 0.0;
+			LogResult( TCString( gFillRoutines[ currentRoutine ].name ) + " " + (int)size + " B", bytesPerSecond / ( 1024.0 * 1024.0 * 1024.0 ), "GB/s" );
+		}
+	}
+}
@@ -0,0 +1,42 @@
+//
+// TCMemUtils_Benchmark.h
+// This file will define the benchmark for the memory copy and fill routines.
+//
+
+#ifndef __TC_MEM_UTILS_BENCHMARK_H__
+#define __TC_MEM_UTILS_BENCHMARK_H__
+
+//
+// Includes
+//
+
+#include "TCBenchmark.h"
+#include "TCMemUtils.h"
+
+//
+// Defines
+//
+
+//
+// Class Declaration
+//		- Measures the throughput of TCMemoryUtils' copy and fill against memcpy and memset, from
+//		  uniform sized copies up to buffers larger than the cache.
+//
+
+class TCMemUtils_Benchmark : public TCBenchmark
+{
+	public:		// Members
+	public:		// Methods
+		virtual Result		StartTest();
+		virtual TCString	GetName()		{ return "TCMemUtils_Benchmark"; }
+
+	private:	// Members
+		unsigned char*		mSource;
+		unsigned char*		mDest;
+
+	private:	// Methods
+		void				MeasureCopy();
+		void				MeasureFill();
+};
+
+#endif // __TC_MEM_UTILS_BENCHMARK_H__
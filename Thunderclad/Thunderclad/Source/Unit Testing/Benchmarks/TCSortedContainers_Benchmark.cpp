@@ -0,0 +1,295 @@
+//
+// TCSortedContainers_Benchmark.cpp
+// This file will define the benchmark for the sorted containers.
+//
+
+//
+// Includes
+//
+
+#include "TCSortedContainers_Benchmark.h"
+#include "TCSortedList.h"
+#include "TCBTreeMap.h"
+#include "TCHashTable.h"
+#include "TCFlatHashTable.h"
+#include "TCMathUtils.h"
+#include "TCLogger.h"
+#include "TCTestRandom.h"
+
+//
+// Defines
+//
+
+#define TARGET_LOOKUPS		(1024 * 1024)	// How many lookups to time per container and size.
+#define NUM_RANGE_QUERIES	(256)
+#define RANGE_QUERY_WIDTH	(64)			// How many keys each range query spans.
+
+static const int gKeyCounts[] = { 64, 4096, 32768 };
+
+//
+// StartTest
+//		- This function will run the benchmark for this module.
+// Inputs:
+//		- None.
+// Outputs:
+//		- TCUnitTest::Result: The result of the operation.
+//
+
+TCUnitTest::Result TCSortedContainers_Benchmark::StartTest()
+{
+	for( unsigned int currentCount = 0; currentCount < sizeof( gKeyCounts ) / sizeof( gKeyCounts[ 0 ] ); ++currentCount )
+	{
+		int numKeys = gKeyCounts[ currentCount ];
+
+		//
+		// Even keys are added and odd keys are missed, both are shuffled so no container sees them in order.
+		//
+
+		mKeys.Resize( 0 );
+		mMissingKeys.Resize( 0 );
+		for( int currentKey = 0; currentKey < numKeys; ++currentKey )
+		{
+			mKeys.Append( currentKey * 2 );
+			mMissingKeys.Append( currentKey * 2 + 1 );
+		}
+
+		unsigned int random = 0x12345678;
+		for( int currentKey = numKeys - 1; currentKey > 0; --currentKey )
+		{
+			int swapKey = TCTestRandom::NextXorshift( random ) % ( currentKey + 1 );
+			int key = mKeys[ currentKey ];
+			mKeys[ currentKey ] = mKeys[ swapKey ];
+			mKeys[ swapKey ] = key;
+
+			swapKey = TCTestRandom::NextXorshift( random ) % ( currentKey + 1 );
+			key = mMissingKeys[ currentKey ];
+			mMissingKeys[ currentKey ] = mMissingKeys[ swapKey ];
+			mMissingKeys[ swapKey ] = key;
+		}
+
+		TCLogger::GetInstance()->LogInfo( TCString( "TCSortedContainers_Benchmark " ) + numKeys + " keys" );
+
+		MeasureSortedList();
+
+		TCBTreeMap< int, int > treeMap;
+		MeasureMap( treeMap, "TCBTreeMap" );
+
+		TCHashTable< int, int > hashTable;
+		MeasureMap( hashTable, "TCHashTable" );
+
+		TCFlatHashTable< int, int > flatHashTable;
+		MeasureMap( flatHashTable, "TCFlatHashTable" );
+
+		MeasureRangeQueries();
+	}
+
+	return TCUnitTest::TestResult_Success;
+}
+
+//
+// MeasureSortedList
+//		- Will log the cost of adding keys one at a time and in bulk, then of finding keys with a binary search.
+// Inputs:
+//		- None.
+// Outputs:
+//		- None.
+//
+
+void TCSortedContainers_Benchmark::MeasureSortedList()
+{
+	int numKeys = mKeys.Count();
+	volatile int sink = 0;
+
+	TCSortedList< int > list;
+	double start = GetTime();
+	for( int currentKey = 0; currentKey < numKeys; ++currentKey )
+	{
+		list.Add( mKeys[ currentKey ] );
+	}
+	double elapsed = GetTime() - start;
+	LogResult( TCString( "TCSortedList Add " ) + numKeys, elapsed * 1e9 / numKeys, "ns/key" );
+
+	TCSortedList< int > bulkList;
+	start = GetTime();
+	bulkList.AddRange( mKeys.begin(), numKeys );
+	elapsed = GetTime() - start;
+	LogResult( TCString( "TCSortedList AddRange " ) + numKeys, elapsed * 1e9 / numKeys, "ns/key" );
+
+	int passes = TC_MAX( 1, TARGET_LOOKUPS / numKeys );
+	int found = 0;
+
+	start = GetTime();
+	for( int currentPass = 0; currentPass < passes; ++currentPass )
+	{
+		for( int currentKey = 0; currentKey < numKeys; ++currentKey )
+		{
+			found += ( list.Find( mKeys[ currentKey ] ) >= 0 ) ? 1 : 0;
+		}
+	}
+	elapsed = GetTime() - start;
+	LogResult( TCString( "TCSortedList Find hit " ) + numKeys, elapsed * 1e9 / ( (double)passes * numKeys ), "ns/lookup" );
+
+	start = GetTime();
+	for( int currentPass = 0; currentPass < passes; ++currentPass )
+	{
+		for( int currentKey = 0; currentKey < numKeys; ++currentKey )
+		{
+			found += ( list.Find( mMissingKeys[ currentKey ] ) >= 0 ) ? 1 : 0;
+		}
+	}
+	elapsed = GetTime() - start;
+	LogResult( TCString( "TCSortedList Find miss " ) + numKeys, elapsed * 1e9 / ( (double)passes * numKeys ), "ns/lookup" );
+
+	int sum = 0;
+	start = GetTime();
+	for( int currentPass = 0; currentPass < passes; ++currentPass )
+	{
+		for( TCSortedList< int >::Iterator key = list.begin(); key != list.end(); ++key )
+		{
+			sum += *key;
+		}
+	}
+	elapsed = GetTime() - start;
+	LogResult( TCString( "TCSortedList iterate " ) + numKeys, elapsed * 1e9 / ( (double)passes * numKeys ), "ns/key" );
+
+	sink += found + sum;
+}
+
+//
+// MeasureMap
+//		- Will log the cost of adding keys, finding present and missing keys and iterating every entry of a map.
+// Inputs:
+//		- Map& map: An empty map to fill, any map with AddValue, GetValue and Entry iterators.
+//		- const char8* name: The name of the map for the log.
+// Outputs:
+//		- None.
+//
+
+template< class Map >
+void TCSortedContainers_Benchmark::MeasureMap( Map& map, const char8* name )
+{
+	int numKeys = mKeys.Count();
+	volatile int sink = 0;
+
+	double start = GetTime();
+	for( int currentKey = 0; currentKey < numKeys; ++currentKey )
+	{
+		map.AddValue( mKeys[ currentKey ], currentKey );
+	}
+	double elapsed = GetTime() - start;
+	LogResult( TCString( name ) + " AddValue " + numKeys, elapsed * 1e9 / numKeys, "ns/key" );
+
+	int passes = TC_MAX( 1, TARGET_LOOKUPS / numKeys );
+	int found = 0;
+	int* value = NULL;
+
+	start = GetTime();
+	for( int currentPass = 0; currentPass < passes; ++currentPass )
+	{
+		for( int currentKey = 0; currentKey < numKeys; ++currentKey )
+		{
+			found += map.GetValue( mKeys[ currentKey ], &value ) ? 1 : 0;
+		}
+	}
+	elapsed = GetTime() - start;
+	LogResult( TCString( name ) + " GetValue hit " + numKeys, elapsed * 1e9 / ( (double)passes * numKeys ), "ns/lookup" );
+
+	start = GetTime();
+	for( int currentPass = 0; currentPass < passes; ++currentPass )
+	{
+		for( int currentKey = 0; currentKey < numKeys; ++currentKey )
+		{
+			found += map.GetValue( mMissingKeys[ currentKey ], &value ) ? 1 : 0;
+		}
+	}
+	elapsed = GetTime() - start;
+	LogResult( TCString( name ) + " GetValue miss " + numKeys, elapsed * 1e9 / ( (double)passes * numKeys ), "ns/lookup" );
+
+	int sum = 0;
+	start = GetTime();
+	for( int currentPass = 0; currentPass < passes; ++currentPass )
+	{
+		for( typename Map::Iterator entry = map.begin(); entry != map.end(); ++entry )
+		{
+			sum += entry->key;
+		}
+	}
+	elapsed = GetTime() - start;
+	LogResult( TCString( name ) + " iterate " + numKeys, elapsed * 1e9 / ( (double)passes * numKeys ), "ns/key" );
+
+	sink += found + sum;
+}
+
+//
+// MeasureRangeQueries
+//		- Will log the cost of visiting every key inside a window. The sorted containers seek to the start of the
+//		  window, the hash tables have no order so they have to check every entry.
+// Inputs:
+//		- None.
+// Outputs:
+//		- None.
+//
+
+void TCSortedContainers_Benchmark::MeasureRangeQueries()
+{
+	int numKeys = mKeys.Count();
+	volatile int sink = 0;
+
+	TCSortedList< int > list;
+	list.AddRange( mKeys.begin(), numKeys );
+
+	TCBTreeMap< int, int > treeMap;
+	TCFlatHashTable< int, int > flatHashTable;
+	for( int currentKey = 0; currentKey < numKeys; ++currentKey )
+	{
+		treeMap.AddValue( mKeys[ currentKey ], currentKey );
+		flatHashTable.AddValue( mKeys[ currentKey ], currentKey );
+	}
+
+	// Keys are the even numbers below numKeys * 2, so a window this wide holds RANGE_QUERY_WIDTH keys.
+	int width = RANGE_QUERY_WIDTH * 2;
+	int sum = 0;
+
+	double start = GetTime();
+	for( int currentQuery = 0; currentQuery < NUM_RANGE_QUERIES; ++currentQuery )
+	{
+		int low = mMissingKeys[ currentQuery % numKeys ];
+		int last = list.LowerBound( low + width );
+		for( int currentKey = list.LowerBound( low ); currentKey < last; ++currentKey )
+		{
+			sum += list[ currentKey ];
+		}
+	}
+	double elapsed = GetTime() - start;
+	LogResult( TCString( "TCSortedList range query " ) + numKeys, elapsed * 1e9 / NUM_RANGE_QUERIES, "ns/query" );
+
+	start = GetTime();
+	for( int currentQuery = 0; currentQuery < NUM_RANGE_QUERIES; ++currentQuery )
+	{
+		int low = mMissingKeys[ currentQuery % numKeys ];
+		TCBTreeMap< int, int >::Iterator last = treeMap.LowerBound( low + width );
+		for( TCBTreeMap< int, int >::Iterator entry = treeMap.LowerBound( low ); entry != last; ++entry )
+		{
+			sum += entry->key;
+		}
+	}
+	elapsed = GetTime() - start;
+	LogResult( TCString( "TCBTreeMap range query " ) + numKeys, elapsed * 1e9 / NUM_RANGE_QUERIES, "ns/query" );
+
+	start = GetTime();
+	for( int currentQuery = 0; currentQuery < NUM_RANGE_QUERIES; ++currentQuery )
+	{
+		int low = mMissingKeys[ currentQuery % numKeys ];
+		for( TCFlatHashTable< int, int >::Iterator entry = flatHashTable.begin(); entry != flatHashTable.end(); ++entry )
+		{
+			if( entry->key >= low && entry->key < low + width )
+			{
+				sum += entry->key;
+			}
+		}
+	}
+	elapsed = GetTime() - start;
+	LogResult( TCString( "TCFlatHashTable range query " ) + numKeys, elapsed * 1e9 / NUM_RANGE_QUERIES, "ns/query" );
+
+	sink += sum;
+}
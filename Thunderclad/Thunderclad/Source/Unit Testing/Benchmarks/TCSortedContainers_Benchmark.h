@@ -0,0 +1,43 @@
+//
+// TCSortedContainers_Benchmark.h
+// This file will define the benchmark for the sorted containers.
+//
+
+#ifndef __TC_SORTED_CONTAINERS_BENCHMARK_H__
+#define __TC_SORTED_CONTAINERS_BENCHMARK_H__
+
+//
+// Includes
+//
+
+#include "TCBenchmark.h"
+#include "TCList.h"
+
+//
+// Defines
+//
+
+//
+// Class Declaration
+//		- Compares inserts, lookups, iteration and range queries of TCSortedList and TCBTreeMap against the hash tables.
+//
+
+class TCSortedContainers_Benchmark : public TCBenchmark
+{
+	public:		// Members
+	public:		// Methods
+		virtual Result		StartTest();
+		virtual TCString	GetName()		{ return "TCSortedContainers_Benchmark"; }
+
+	private:	// Members
+		TCList< int >		mKeys;			// Every key, in a scrambled order.
+		TCList< int >		mMissingKeys;	// Keys that are never added, in a scrambled order.
+
+	private:	// Methods
+		void				MeasureSortedList();
+		template< class Map >
+		void				MeasureMap( Map& map, const char8* name );
+		void				MeasureRangeQueries();
+};
+
+#endif // __TC_SORTED_CONTAINERS_BENCHMARK_H__
@@ -0,0 +1,188 @@
+//
+// TCBenchmark.cpp
+// This file will define benchmarking functionality.
+//
+
+//
+// Includes
+//
+
+#include "TCBenchmark.h"
+#include "TCLogger.h"
+#include "TCPlatformPrecompilerSymbols.h"
+
+#if TC_PLATFORM_WIN32
+	#include <Windows.h>
+#endif
+
+//
+// Defines
+//
+
+//
+// Default Constructor
+//		- Initializes the class to a safe state.
+// Inputs:
+//		- None.
+// Outputs:
+//		- None.
+//
+
+TCBenchmark::TCBenchmark()
+{
+
+}
+
+//
+// Destructor
+//		- Frees all resources associated with this object.
+// Inputs:
+//		- None.
+// Outputs:
+//		- None.
+//
+
+TCBenchmark::~TCBenchmark()
+{
+
+}
+
+//
+// GetTime
+//		- Will return a high resolution time stamp, only the difference between two stamps is meaningful.
+// Inputs:
+//		- None.
+// Outputs:
+//		- double: The time stamp in seconds.
+//
+
+double TCBenchmark::GetTime()
+{
+#if TC_PLATFORM_WIN32
+	static LARGE_INTEGER frequency = { 0 };
+	if( frequency.QuadPart == 0 )
+	{
+		QueryPerformanceFrequency( &frequency );
+	}
+
+	LARGE_INTEGER counter;
+	QueryPerformanceCounter( &counter );
+	return (double)counter.QuadPart / (double)frequency.QuadPart;
+#else
+	return 0.0;
+#endif
+}
+
+//
+// FormatNumber
+//		- Will format a number with a fixed number of decimals.
+// Inputs:
+//		- double value: The value to format.
+//		- int decimals: The number of digits after the decimal point.
+// Outputs:
+//		- TCString: The formatted number.
+//
+
+TCString TCBenchmark::FormatNumber( double value, int decimals )
+{
+	TCString result;
+	if( value < 0.0 )
+	{
+		result += '-';
+		value = -value;
+	}
+
+	//
+	// Round at the last decimal, then split into whole and fractional parts.
+	//
+
+	long long scale = 1;
+	for( int currentDecimal = 0; currentDecimal < decimals; ++currentDecimal )
+	{
+		scale *= 10;
+	}
+
+	long long scaled = (long long)( value * (double)scale + 0.5 );
+	long long whole = scaled / scale;
+	long long fraction = scaled % scale;
+
+	//
+	// ItoA works on ints, so build the whole part a group of digits at a time.
+	//
+
+	TCString wholeString;
+	do
+	{
+		int group = (int)( whole % 1000 );
+		whole /= 1000;
+
+		TCString groupString = TCStringUtils::ItoA( group );
+		while( whole > 0 && groupString.Length() < 3 )
+		{
+			groupString = TCString( "0" ) + groupString;
+		}
+
+		wholeString = groupString + wholeString;
+	} while( whole > 0 );
+
+	result += wholeString;
+
+	if( decimals > 0 )
+	{
+		TCString fractionString = TCStringUtils::ItoA( (int)fraction );
+		while( fractionString.Length() < decimals )
+		{
+			fractionString = TCString( "0" ) + fractionString;
+		}
+
+		result += '.';
+		result += fractionString;
+	}
+
+	return result;
+}
+
+//
+// LogResult
+//		- Will log a single measurement.
+// Inputs:
+//		- const TCString& label: What was measured.
+//		- double value: The measurement.
+//		- const char8* units: The units of the measurement.
+// Outputs:
+//		- None.
+//
+
+void TCBenchmark::LogResult( const TCString& label, double value, const char8* units )
+{
+	TCString output = FormatNumber( value );
+	if( units != NULL && units[ 0 ] != NULL_TERMINATOR )
+	{
+		output += ' ';
+		output += units;
+	}
+
+	LogResult( label, output );
+}
+
+//
+// LogResult
+//		- Will log a single measurement.
+// Inputs:
+//		- const TCString& label: What was measured.
+//		- const TCString& value: The measurement.
+// Outputs:
+//		- None.
+//
+
+void TCBenchmark::LogResult( const TCString& label, const TCString& value )
+{
+	TCString output = "[";
+	output += GetName();
+	output += "] ";
+	output += label;
+	output += ": ";
+	output += value;
+
+	gLogger->LogInfo( output );
+}
@@ -0,0 +1,42 @@
+//
+// TCBenchmark.h
+// This file will define the root for all benchmarks, a benchmark is a unit test that measures rather than checks.
+//
+
+#ifndef __TC_BENCHMARK_H__
+#define __TC_BENCHMARK_H__
+
+//
+// Includes
+//
+
+#include "TCUnitTest.h"
+#include "TCString.h"
+
+//
+// Defines
+//
+
+//
+// Class Declaration
+//
+
+class TCBenchmark : public TCUnitTest
+{
+	public:		// Members
+	public:		// Methods
+							TCBenchmark();
+		virtual				~TCBenchmark();
+
+		virtual TCString	GetCategory()	{ return "Benchmark"; }
+
+		static double		GetTime();
+		static TCString		FormatNumber( double value, int decimals = 2 );
+
+	protected:	// Members
+	protected:	// Methods
+		void				LogResult( const TCString& label, double value, const char8* units );
+		void				LogResult( const TCString& label, const TCString& value );
+};
+
+#endif // __TC_BENCHMARK_H__
@@ -0,0 +1,57 @@
+//
+// TCTestRandom.h
+// This file will define the small deterministic generators shared by the unit tests and benchmarks.
+//
+
+#ifndef __TC_TEST_RANDOM_H__
+#define __TC_TEST_RANDOM_H__
+
+//
+// Includes
+//
+
+//
+// Defines
+//
+
+//
+// Every generator is seeded by the caller and gives the same sequence on every run, so a failing test can be
+// repeated and every benchmark run measures the same data.
+//
+
+namespace TCTestRandom
+{
+	//
+	// NextLCG
+	//		- Will step a linear congruential generator, the low bits are dropped since they repeat quickly.
+	// Inputs:
+	//		- unsigned int& seed: The generator's state.
+	// Outputs:
+	//		- unsigned int: The next value, 24 bits wide.
+	//
+
+	inline unsigned int NextLCG( unsigned int& seed )
+	{
+		seed = seed * 1664525 + 1013904223;
+		return seed >> 8;
+	}
+
+	//
+	// NextXorshift
+	//		- Will step a 32 bit xorshift generator.
+	// Inputs:
+	//		- unsigned int& state: The generator's state, it must not be zero.
+	// Outputs:
+	//		- unsigned int: The next value.
+	//
+
+	inline unsigned int NextXorshift( unsigned int& state )
+	{
+		state ^= state << 13;
+		state ^= state >> 17;
+		state ^= state << 5;
+		return state;
+	}
+}
+
+#endif // __TC_TEST_RANDOM_H__
@@ -0,0 +1,218 @@
+//
+// TCBTreeMap_UnitTest.cpp
+// This file will define the unit test for a B-tree map.
+//
+
+//
+// Includes
+//
+
+#include "TCBTreeMap_UnitTest.h"
+#include "TCLogger.h"
+#include "TCString.h"
+
+#include <algorithm>
+
+//
+// Defines
+//
+
+#define RETURN_UNIT_TEST_FAILURE( x ) { TCLogger::GetInstance()->LogError( x ); return TCUnitTest::TestResult_Failed; }
+
+#define NUM_STRESS_KEYS		(20000)	// Enough keys for a tree three levels deep.
+#define STRESS_STRIDE		(7919)	// Coprime to NUM_STRESS_KEYS, so multiplying by it scrambles the order.
+
+//
+// StartTest
+//		- This function will run the unit test for this module.
+// Inputs:
+//		- None.
+// Outputs:
+//		- TCUnitTest::Result: The result of the operation.
+//
+
+TCUnitTest::Result TCBTreeMap_UnitTest::StartTest()
+{
+	//
+	// Test basic addition, removal and retrieval.
+	//
+
+	TCBTreeMap< int, int > intMap;
+	for( int currentKey = 12; currentKey >= -1; --currentKey )
+	{
+		intMap.AddValue( currentKey, currentKey * 10 );
+	}
+
+	intMap.RemoveValue( 0 );
+	intMap.RemoveValue( 1 );
+	intMap.RemoveValue( 100 );
+
+	if( intMap.Count() != 12 )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCBTreeMap_UnitTest failed! intMap count is not accurate.");
+	}
+
+	int* value = NULL;
+	if( intMap.GetValue( -1, &value ) == false || *value != -10 )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCBTreeMap_UnitTest failed! intMap::GetValue provided a wrong output.");
+	}
+
+	if( intMap.GetValue( 1, &value ) == true || value != NULL || intMap.ContainsKey( 0 ) || !intMap.ContainsKey( 12 ) )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCBTreeMap_UnitTest failed! intMap found a removed key.");
+	}
+
+	//
+	// Test that iteration visits the keys in order.
+	//
+
+	int previousKey = -100;
+	for( TCBTreeMap< int, int >::Entry& entry : intMap )
+	{
+		if( entry.key <= previousKey || entry.value != entry.key * 10 )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCBTreeMap_UnitTest failed! Iteration did not visit the keys in order.");
+		}
+		previousKey = entry.key;
+	}
+
+	//
+	// Test that strings order by their characters.
+	//
+
+	TCBTreeMap< TCString, int > stringMap;
+	stringMap.AddValue( "pear", 3 );
+	stringMap.AddValue( "apple", 1 );
+	stringMap.AddValue( "banana", 2 );
+
+	TCBTreeMap< TCString, int >::Iterator stringIterator = stringMap.begin();
+	if( stringIterator->key != "apple" || (++stringIterator)->key != "banana" || (++stringIterator)->key != "pear" || ++stringIterator != stringMap.end() )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCBTreeMap_UnitTest failed! Strings were not ordered by their characters.");
+	}
+
+	if( stringMap.LowerBound( "b" )->key != "banana" || stringMap.UpperBound( "pear" ) != stringMap.end() )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCBTreeMap_UnitTest failed! String bounds provided a wrong entry.");
+	}
+
+	//
+	// Stress test, add keys in a scrambled order so the tree splits everywhere.
+	//
+
+	TCBTreeMap< int, int > stressMap;
+	for( int currentKey = 0; currentKey < NUM_STRESS_KEYS; ++currentKey )
+	{
+		int key = ( currentKey * STRESS_STRIDE ) % NUM_STRESS_KEYS;
+		stressMap.AddValue( key * 2, key );
+	}
+
+	if( stressMap.Count() != NUM_STRESS_KEYS || std::distance( stressMap.begin(), stressMap.end() ) != NUM_STRESS_KEYS )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCBTreeMap_UnitTest failed! stressMap count is not accurate.");
+	}
+
+	int expectedKey = 0;
+	for( TCBTreeMap< int, int >::Entry& entry : stressMap )
+	{
+		if( entry.key != expectedKey || entry.value != expectedKey / 2 )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCBTreeMap_UnitTest failed! stressMap iteration did not visit the keys in order.");
+		}
+		expectedKey += 2;
+	}
+
+	//
+	// Test the bounds, the keys are all even so odd keys fall between entries.
+	//
+
+	if( stressMap.LowerBound( 101 )->key != 102 || stressMap.LowerBound( 102 )->key != 102 || stressMap.UpperBound( 102 )->key != 104 )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCBTreeMap_UnitTest failed! LowerBound or UpperBound provided a wrong entry.");
+	}
+
+	if( stressMap.LowerBound( -5 ) != stressMap.begin() || stressMap.LowerBound( NUM_STRESS_KEYS * 2 ) != stressMap.end() )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCBTreeMap_UnitTest failed! Bounds outside of the keys provided a wrong entry.");
+	}
+
+	// Every key from 1000 up to but not including 3000.
+	if( std::distance( stressMap.LowerBound( 1000 ), stressMap.LowerBound( 3000 ) ) != 1000 )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCBTreeMap_UnitTest failed! A range query visited the wrong number of entries.");
+	}
+
+	//
+	// Test removal, take out every key not a multiple of 4 in a scrambled order so nodes borrow and merge.
+	//
+
+	for( int currentKey = 0; currentKey < NUM_STRESS_KEYS; ++currentKey )
+	{
+		int key = ( currentKey * STRESS_STRIDE ) % NUM_STRESS_KEYS;
+		if( key % 2 == 1 )
+		{
+			stressMap.RemoveValue( key * 2 );
+		}
+	}
+
+	if( stressMap.Count() != NUM_STRESS_KEYS / 2 )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCBTreeMap_UnitTest failed! stressMap count is not accurate after removal.");
+	}
+
+	for( int currentKey = 0; currentKey < NUM_STRESS_KEYS * 2; currentKey += 2 )
+	{
+		bool found = stressMap.GetValue( currentKey, &value );
+		if( found != ( currentKey % 4 == 0 ) || ( found && *value != currentKey / 2 ) )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCBTreeMap_UnitTest failed! stressMap provided a wrong output after removal.");
+		}
+	}
+
+	expectedKey = 0;
+	for( TCBTreeMap< int, int >::Entry& entry : stressMap )
+	{
+		if( entry.key != expectedKey )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCBTreeMap_UnitTest failed! stressMap iteration was wrong after removal.");
+		}
+		expectedKey += 4;
+	}
+
+	//
+	// Test copying, then empty the original so the tree shrinks back down to nothing.
+	//
+
+	TCBTreeMap< int, int > copyMap( stressMap );
+
+	for( int currentKey = 0; currentKey < NUM_STRESS_KEYS * 2; currentKey += 4 )
+	{
+		stressMap.RemoveValue( currentKey );
+	}
+
+	if( stressMap.Count() != 0 || stressMap.begin() != stressMap.end() || stressMap.ContainsKey( 0 ) )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCBTreeMap_UnitTest failed! stressMap was not empty after removing every key.");
+	}
+
+	if( copyMap.Count() != NUM_STRESS_KEYS / 2 || !copyMap.ContainsKey( 400 ) || copyMap.ContainsKey( 402 ) )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCBTreeMap_UnitTest failed! The copied map provided a wrong output.");
+	}
+
+	// The emptied map must still be usable.
+	stressMap.AddValue( 7, 7 );
+	if( stressMap.Count() != 1 || stressMap.begin()->key != 7 )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCBTreeMap_UnitTest failed! An emptied map could not be added to.");
+	}
+
+	copyMap.Clear();
+	if( copyMap.Count() != 0 || copyMap.begin() != copyMap.end() )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCBTreeMap_UnitTest failed! Clear did not empty the map.");
+	}
+
+	return TCUnitTest::TestResult_Success;
+}
@@ -0,0 +1,34 @@
+//
+// TCBTreeMap_UnitTest.h
+// This file will define the unit test for TCBTreeMap
+//
+
+#ifndef __TC_BTREE_MAP_UNIT_TEST_H__
+#define __TC_BTREE_MAP_UNIT_TEST_H__
+
+//
+// Includes
+//
+
+#include "TCUnitTest.h"
+#include "TCBTreeMap.h"
+
+//
+// Defines
+//
+
+//
+// Class Declaration
+//
+
+class TCBTreeMap_UnitTest : public TCUnitTest
+{
+	public:		// Members
+	public:		// Methods
+		virtual Result StartTest();
+
+	private:	// Members
+	private:	// Methods
+};
+
+#endif // __TC_BTREE_MAP_UNIT_TEST_H__
@@ -0,0 +1,239 @@
+//
+// TCBitSet_UnitTest.cpp
+// This file will define the unit test for the fixed and dynamic bit containers.
+//
+
+//
+// Includes
+//
+
+#include "TCBitSet_UnitTest.h"
+#include "TCLogger.h"
+#include "TCTestRandom.h"
+#include "TCMemUtils.h"
+
+//
+// Defines
+//
+
+#define RETURN_UNIT_TEST_FAILURE( x ) { TCLogger::GetInstance()->LogError( x ); return TCUnitTest::TestResult_Failed; }
+
+#define NUM_TEST_BITS		(300)	// Not a multiple of 64, and long enough for the AVX2 path.
+#define NUM_DYNAMIC_BITS	(1000)
+
+//
+// StartTest
+//		- This function will run the unit test for this module.
+// Inputs:
+//		- None.
+// Outputs:
+//		- TCUnitTest::Result: The result of the operation.
+//
+
+TCUnitTest::Result TCBitSet_UnitTest::StartTest()
+{
+	//
+	// Test single bits against a bool array.
+	//
+
+	TCBitSet< NUM_TEST_BITS > first;
+	TCBitSet< NUM_TEST_BITS > second;
+	bool firstBools[ NUM_TEST_BITS ];
+	bool secondBools[ NUM_TEST_BITS ];
+
+	if( first.Any() || first.Count() != 0 || first.FindFirstSet() != -1 || first.begin() != first.end() )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCBitSet_UnitTest failed! A new bit set wasn't empty.");
+	}
+
+	unsigned int seed = 12345;
+	for( int currentBit = 0; currentBit < NUM_TEST_BITS; ++currentBit )
+	{
+		firstBools[ currentBit ]	= TCTestRandom::NextLCG( seed ) % 3 == 0;
+		secondBools[ currentBit ]	= TCTestRandom::NextLCG( seed ) % 2 == 0;
+		first.Set( currentBit, firstBools[ currentBit ] );
+		second.Set( currentBit, secondBools[ currentBit ] );
+	}
+
+	int expectedCount = 0;
+	for( int currentBit = 0; currentBit < NUM_TEST_BITS; ++currentBit )
+	{
+		expectedCount += firstBools[ currentBit ] ? 1 : 0;
+		if( first[ currentBit ] != firstBools[ currentBit ] )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCBitSet_UnitTest failed! Test provided a wrong bit.");
+		}
+	}
+
+	if( first.Count() != expectedCount )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCBitSet_UnitTest failed! Count provided a wrong number of bits.");
+	}
+
+	//
+	// Test that iterating and FindFirstSet visit exactly the set bits in order.
+	//
+
+	int previousBit = -1;
+	int visitedCount = 0;
+	for( int bit : first )
+	{
+		if( bit <= previousBit || !firstBools[ bit ] || first.FindFirstSet( previousBit + 1 ) != bit )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCBitSet_UnitTest failed! The set bits were visited wrong.");
+		}
+
+		for( int skippedBit = previousBit + 1; skippedBit < bit; ++skippedBit )
+		{
+			if( firstBools[ skippedBit ] )
+			{
+				RETURN_UNIT_TEST_FAILURE("TCBitSet_UnitTest failed! A set bit was skipped.");
+			}
+		}
+
+		previousBit = bit;
+		visitedCount++;
+	}
+
+	if( visitedCount != expectedCount || first.FindFirstSet( previousBit + 1 ) != -1 )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCBitSet_UnitTest failed! The iterator visited a wrong number of bits.");
+	}
+
+	//
+	// Test the bulk operations.
+	//
+
+	TCBitSet< NUM_TEST_BITS > andBits = first;
+	TCBitSet< NUM_TEST_BITS > orBits = first;
+	TCBitSet< NUM_TEST_BITS > xorBits = first;
+	TCBitSet< NUM_TEST_BITS > andNotBits = first;
+	andBits &= second;
+	orBits |= second;
+	xorBits ^= second;
+	andNotBits.AndNot( second );
+
+	for( int currentBit = 0; currentBit < NUM_TEST_BITS; ++currentBit )
+	{
+		bool lhs = firstBools[ currentBit ];
+		bool rhs = secondBools[ currentBit ];
+		if( andBits[ currentBit ] != ( lhs && rhs ) || orBits[ currentBit ] != ( lhs || rhs ) ||
+			xorBits[ currentBit ] != ( lhs != rhs ) || andNotBits[ currentBit ] != ( lhs && !rhs ) )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCBitSet_UnitTest failed! A bulk operation provided a wrong bit.");
+		}
+	}
+
+	if( andBits == orBits || !( andBits == andBits ) || xorBits != orBits.AndNot( andBits ) )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCBitSet_UnitTest failed! Comparing bit sets gave the wrong answer.");
+	}
+
+	//
+	// Test the whole set operations, the bits past the end must stay clear.
+	//
+
+	first.FlipAll();
+	if( first.Count() != NUM_TEST_BITS - expectedCount )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCBitSet_UnitTest failed! FlipAll changed bits past the end.");
+	}
+
+	first.SetAll();
+	if( !first.All() || first.Count() != NUM_TEST_BITS || first.FindFirstSet( NUM_TEST_BITS - 1 ) != NUM_TEST_BITS - 1 )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCBitSet_UnitTest failed! SetAll provided a wrong number of bits.");
+	}
+
+	first.ResetAll();
+	first.Flip( 64 );
+	first.Set( 299 );
+	if( first.Count() != 2 || first.FindFirstSet() != 64 || first.FindFirstSet( 65 ) != 299 || !first.Any() || first.None() )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCBitSet_UnitTest failed! Flip or Set changed the wrong bit.");
+	}
+
+	//
+	// Test the dynamic array, growing keeps the old bits and fills the new ones.
+	//
+
+	TCDynamicBitArray dynamicBits( 70, true );
+	if( dynamicBits.Size() != 70 || dynamicBits.Count() != 70 || !dynamicBits.All() )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCDynamicBitArray failed! The constructor provided wrong bits.");
+	}
+
+	dynamicBits.Reset( 3 );
+	dynamicBits.Resize( 10 );
+	dynamicBits.Resize( 200, false );
+	dynamicBits.Resize( 300, true );
+
+	if( dynamicBits.Size() != 300 || dynamicBits.Count() != 9 + 100 || dynamicBits.Test( 3 ) || dynamicBits.Test( 10 ) ||
+		dynamicBits.Test( 69 ) || !dynamicBits.Test( 200 ) || dynamicBits.FindFirstSet( 10 ) != 200 )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCDynamicBitArray failed! Resize left stale or missing bits.");
+	}
+
+	//
+	// Test the dynamic bulk operations against a bool array.
+	//
+
+	TCDynamicBitArray lhsBits( NUM_DYNAMIC_BITS );
+	TCDynamicBitArray rhsBits( NUM_DYNAMIC_BITS );
+	bool lhsBools[ NUM_DYNAMIC_BITS ];
+	bool rhsBools[ NUM_DYNAMIC_BITS ];
+
+	for( int currentBit = 0; currentBit < NUM_DYNAMIC_BITS; ++currentBit )
+	{
+		lhsBools[ currentBit ] = TCTestRandom::NextLCG( seed ) % 2 == 0;
+		rhsBools[ currentBit ] = TCTestRandom::NextLCG( seed ) % 4 == 0;
+		lhsBits.Set( currentBit, lhsBools[ currentBit ] );
+		rhsBits.Set( currentBit, rhsBools[ currentBit ] );
+	}
+
+	TCDynamicBitArray dynamicAnd = lhsBits;
+	TCDynamicBitArray dynamicOr = lhsBits;
+	TCDynamicBitArray dynamicXor( lhsBits );
+	TCDynamicBitArray dynamicAndNot( lhsBits );
+	dynamicAnd &= rhsBits;
+	dynamicOr |= rhsBits;
+	dynamicXor ^= rhsBits;
+	dynamicAndNot.AndNot( rhsBits );
+
+	int expectedOrCount = 0;
+	for( int currentBit = 0; currentBit < NUM_DYNAMIC_BITS; ++currentBit )
+	{
+		bool lhs = lhsBools[ currentBit ];
+		bool rhs = rhsBools[ currentBit ];
+		expectedOrCount += ( lhs || rhs ) ? 1 : 0;
+		if( dynamicAnd[ currentBit ] != ( lhs && rhs ) || dynamicOr[ currentBit ] != ( lhs || rhs ) ||
+			dynamicXor[ currentBit ] != ( lhs != rhs ) || dynamicAndNot[ currentBit ] != ( lhs && !rhs ) )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCDynamicBitArray failed! A bulk operation provided a wrong bit.");
+		}
+	}
+
+	if( dynamicOr.Count() != expectedOrCount || dynamicAnd == dynamicOr || dynamicAnd != dynamicAnd )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCDynamicBitArray failed! Count or compare gave the wrong answer.");
+	}
+
+	//
+	// Test moving and clearing.
+	//
+
+	TCDynamicBitArray movedBits( TCMove( dynamicOr ) );
+	if( movedBits.Count() != expectedOrCount || dynamicOr.Size() != 0 || dynamicOr.Any() )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCDynamicBitArray failed! Moving didn't take the bits.");
+	}
+
+	movedBits.Clear();
+	movedBits.Resize( 5 );
+	if( movedBits.Size() != 5 || movedBits.Any() )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCDynamicBitArray failed! Clear left stale bits.");
+	}
+
+	return TCUnitTest::TestResult_Success;
+}
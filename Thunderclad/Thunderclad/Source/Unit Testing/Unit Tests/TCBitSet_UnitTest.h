@@ -0,0 +1,35 @@
+//
+// TCBitSet_UnitTest.h
+// This file will define the unit test for TCBitSet
+//
+
+#ifndef __TC_BIT_SET_UNIT_TEST_H__
+#define __TC_BIT_SET_UNIT_TEST_H__
+
+//
+// Includes
+//
+
+#include "TCUnitTest.h"
+#include "TCBitSet.h"
+#include "TCDynamicBitArray.h"
+
+//
+// Defines
+//
+
+//
+// Class Declaration
+//
+
+class TCBitSet_UnitTest : public TCUnitTest
+{
+	public:		// Members
+	public:		// Methods
+		virtual Result StartTest();
+
+	private:	// Members
+	private:	// Methods
+};
+
+#endif // __TC_BIT_SET_UNIT_TEST_H__
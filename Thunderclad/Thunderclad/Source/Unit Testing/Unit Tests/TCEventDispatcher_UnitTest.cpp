@@ -0,0 +1,182 @@
+//
+// TCEventDispatcher_UnitTest.cpp
+// This file will define the unit test for subscribing event listeners to event dispatchers.
+//
+
+//
+// Includes
+//
+
+#include "TCEventDispatcher_UnitTest.h"
+#include "TCEventListener.h"
+#include "TCLogger.h"
+
+//
+// Defines
+//
+
+#define RETURN_UNIT_TEST_FAILURE( x ) { TCLogger::GetInstance()->LogError( x ); return TCUnitTest::TestResult_Failed; }
+
+//
+// TCCountingListener
+//		- Counts the events it receives, and can unsubscribe itself or another listener from the dispatcher that fired.
+//
+
+class TCCountingListener : public TCEventListener
+{
+	public:		// Members
+		int					eventsFired;
+		TCEventDispatcher*	unsubscribeOnFire;
+		TCEventListener*	unsubscribeOther;	// Unsubscribed instead of this listener when set.
+
+	public:		// Methods
+							TCCountingListener() : eventsFired( 0 ), unsubscribeOnFire( NULL ), unsubscribeOther( NULL ) {}
+
+		virtual void		OnEventFired( TCEventID eventId, void* eventData )
+		{
+			eventsFired++;
+			if( unsubscribeOnFire != NULL )
+			{
+				TCEventListener* listener = unsubscribeOther != NULL ? unsubscribeOther : this;
+				listener->UnsubscribeFrom( unsubscribeOnFire );
+			}
+		}
+};
+
+//
+// StartTest
+//		- This function will run the unit test for this module.
+// Inputs:
+//		- None.
+// Outputs:
+//		- TCUnitTest::Result: The result of the operation.
+//
+
+TCUnitTest::Result TCEventDispatcher_UnitTest::StartTest()
+{
+	//
+	// Test firing to several listeners, a listener can only subscribe once.
+	//
+
+	TCEventDispatcher dispatcher;
+	TCCountingListener first;
+	TCCountingListener second;
+
+	first.SubscribeTo( &dispatcher );
+	first.SubscribeTo( &dispatcher );
+	second.SubscribeTo( &dispatcher );
+
+	if( dispatcher.AddListener( &second ) != Failure_InvalidParameter || dispatcher.AddListener( NULL ) != Failure_InvalidParameter )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCEventDispatcher_UnitTest failed! Adding a duplicate or NULL listener succeeded.");
+	}
+
+	dispatcher.FireEvent( 1 );
+	if( first.eventsFired != 1 || second.eventsFired != 1 )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCEventDispatcher_UnitTest failed! The listeners received a wrong number of events.");
+	}
+
+	//
+	// Test unsubscribing, including from inside the event.
+	//
+
+	first.UnsubscribeFrom( &dispatcher );
+	second.unsubscribeOnFire = &dispatcher;
+
+	dispatcher.FireEvent( 2 );
+	dispatcher.FireEvent( 3 );
+	if( first.eventsFired != 1 || second.eventsFired != 2 )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCEventDispatcher_UnitTest failed! An unsubscribed listener received an event.");
+	}
+
+	//
+	// Test a listener unsubscribing the listener after it while the event is firing.
+	//
+
+	{
+		TCEventDispatcher otherDispatcher;
+		TCCountingListener unsubscriber;
+		TCCountingListener unsubscribed;
+
+		unsubscriber.SubscribeTo( &otherDispatcher );
+		unsubscribed.SubscribeTo( &otherDispatcher );
+		unsubscriber.unsubscribeOnFire = &otherDispatcher;
+		unsubscriber.unsubscribeOther = &unsubscribed;
+
+		otherDispatcher.FireEvent( 1 );
+		unsubscribed.SubscribeTo( &otherDispatcher );
+		unsubscriber.unsubscribeOnFire = NULL;
+		otherDispatcher.FireEvent( 2 );
+
+		if( unsubscriber.eventsFired != 2 || unsubscribed.eventsFired != 1 )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCEventDispatcher_UnitTest failed! A listener unsubscribed during an event still received it, or couldn't subscribe again.");
+		}
+
+		unsubscriber.unsubscribeOnFire = &otherDispatcher;
+		otherDispatcher.FireEvent( 3 );
+		unsubscriber.UnsubscribeFrom( &otherDispatcher );
+		otherDispatcher.FireEvent( 4 );
+
+		if( unsubscriber.eventsFired != 3 || unsubscribed.eventsFired != 1 )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCEventDispatcher_UnitTest failed! A listener removed during an event was left subscribed.");
+		}
+	}
+
+	//
+	// Test that copies subscribe the same listeners, the copied listener picks up both dispatchers from the first listener.
+	//
+
+	second.unsubscribeOnFire = NULL;
+	first.SubscribeTo( &dispatcher );
+
+	TCEventDispatcher copiedDispatcher( dispatcher );
+	TCCountingListener copiedListener( first );
+	copiedListener.eventsFired = 0;
+
+	copiedDispatcher.FireEvent( 4 );
+	if( first.eventsFired != 2 || second.eventsFired != 2 || copiedListener.eventsFired != 1 )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCEventDispatcher_UnitTest failed! The copied dispatcher has the wrong listeners.");
+	}
+
+	dispatcher.FireEvent( 5 );
+	if( first.eventsFired != 3 || copiedListener.eventsFired != 2 )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCEventDispatcher_UnitTest failed! The copied listener isn't subscribed.");
+	}
+
+	//
+	// Test that destroying either side unsubscribes it from the other.
+	//
+
+	{
+		TCEventDispatcher scopedDispatcher;
+		TCCountingListener scopedListener;
+
+		first.SubscribeTo( &scopedDispatcher );
+		scopedListener.SubscribeTo( &dispatcher );
+		scopedListener.SubscribeTo( &scopedDispatcher );
+	}
+
+	dispatcher.FireEvent( 6 );
+	if( first.eventsFired != 4 || copiedListener.eventsFired != 3 )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCEventDispatcher_UnitTest failed! A destroyed listener was left subscribed.");
+	}
+
+	first.UnsubscribeFromAll();
+	copiedDispatcher.CleanUp();
+
+	dispatcher.FireEvent( 7 );
+	copiedDispatcher.FireEvent( 7 );
+	if( first.eventsFired != 4 || copiedListener.eventsFired != 4 )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCEventDispatcher_UnitTest failed! UnsubscribeFromAll or CleanUp left a subscription behind.");
+	}
+
+	return TCUnitTest::TestResult_Success;
+}
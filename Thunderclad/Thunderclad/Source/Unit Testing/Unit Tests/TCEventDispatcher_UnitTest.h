@@ -0,0 +1,34 @@
+//
+// TCEventDispatcher_UnitTest.h
+// This file will define the unit test for TCEventDispatcher
+//
+
+#ifndef __TC_EVENT_DISPATCHER_UNIT_TEST_H__
+#define __TC_EVENT_DISPATCHER_UNIT_TEST_H__
+
+//
+// Includes
+//
+
+#include "TCUnitTest.h"
+#include "TCEventDispatcher.h"
+
+//
+// Defines
+//
+
+//
+// Class Declaration
+//
+
+class TCEventDispatcher_UnitTest : public TCUnitTest
+{
+	public:		// Members
+	public:		// Methods
+		virtual Result StartTest();
+
+	private:	// Members
+	private:	// Methods
+};
+
+#endif // __TC_EVENT_DISPATCHER_UNIT_TEST_H__
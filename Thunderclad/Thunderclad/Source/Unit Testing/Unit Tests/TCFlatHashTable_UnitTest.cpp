@@ -0,0 +1,242 @@
+//
+// TCFlatHashTable_UnitTest.cpp
+// This file will define the unit test for a flat hash table.
+//
+
+//
+// Includes
+//
+
+#include "TCFlatHashTable_UnitTest.h"
+
+#include <algorithm>
+
+//
+// Defines
+//
+
+#define RETURN_UNIT_TEST_FAILURE( x ) { TCLogger::GetInstance()->LogError( x ); return TCUnitTest::TestResult_Failed; }
+
+#define NUM_STRESS_KEYS	5000
+
+//
+// StartTest
+//		- This function will run the unit test for this module.
+// Inputs:
+//		- None.
+// Outputs:
+//		- TCUnitTest::Result: The result of the operation.
+//
+
+TCUnitTest::Result TCFlatHashTable_UnitTest::StartTest()
+{
+	TCFlatHashTable< int, int > intTable;
+	TCFlatHashTable< float, TCString > stringTable;
+
+	//
+	// Test basic addition and removal.
+	//
+
+	for( int currentKey = -1; currentKey <= 12; ++currentKey )
+	{
+		intTable.AddValue( currentKey, currentKey + 1 );
+	}
+
+	stringTable.AddValue( 0.0f, "0.0f" );
+	stringTable.AddValue( 1.0f, "1.0f" );
+	stringTable.AddValue( 2.0f, "2.0f" );
+	stringTable.AddValue( 3.0f, "3.0f" );
+
+	intTable.RemoveValue( 0 );
+	intTable.RemoveValue( 1 );
+	intTable.RemoveValue( 100 );
+
+	stringTable.RemoveValue( 1.0f );
+	stringTable.RemoveValue( 2.5f );
+
+	if( intTable.Count() != 12 )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCFlatHashTable_UnitTest failed! intTable count is not accurate.");
+	}
+
+	if( stringTable.Count() != 3 )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCFlatHashTable_UnitTest failed! stringTable count is not accurate.");
+	}
+
+	//
+	// Test retrieval.
+	//
+
+	int* value = NULL;
+	if( intTable.GetValue( -1, &value ) == false || *value != 0 )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCFlatHashTable_UnitTest failed! intTable::GetValue provided a wrong output.");
+	}
+
+	if( intTable.GetValue( 12, &value ) == false || *value != 13 )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCFlatHashTable_UnitTest failed! intTable::GetValue provided a wrong output.");
+	}
+
+	if( intTable.GetValue( 1, &value ) || value != NULL )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCFlatHashTable_UnitTest failed! intTable::GetValue found a removed key.");
+	}
+
+	TCString* stringValue = NULL;
+	if( stringTable.GetValue( 3.0f, &stringValue ) == false || *stringValue != "3.0f" )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCFlatHashTable_UnitTest failed! Wrong value was found");
+	}
+
+	//
+	// Test contains.
+	//
+
+	if( stringTable.ContainsKey( 2.0f ) != true || stringTable.ContainsValue( "2.0f" ) != true )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCFlatHashTable_UnitTest failed! Contain test failed.");
+	}
+
+	if( intTable.ContainsKey( -1000 ) || stringTable.ContainsValue( "1.0f" ) )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCFlatHashTable_UnitTest failed, contain test returned false positive.");
+	}
+
+	//
+	// Stress the table with enough keys to force several rehashes, then remove every other key
+	// so the backward shifting is exercised across long probe runs.
+	//
+
+	TCFlatHashTable< int, int > stressTable;
+	for( int currentKey = 0; currentKey < NUM_STRESS_KEYS; ++currentKey )
+	{
+		stressTable.AddValue( currentKey * 7, currentKey );
+	}
+
+	for( int currentKey = 0; currentKey < NUM_STRESS_KEYS; currentKey += 2 )
+	{
+		stressTable.RemoveValue( currentKey * 7 );
+	}
+
+	if( stressTable.Count() != NUM_STRESS_KEYS / 2 )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCFlatHashTable_UnitTest failed! stressTable count is not accurate.");
+	}
+
+	for( int currentKey = 0; currentKey < NUM_STRESS_KEYS; ++currentKey )
+	{
+		bool found = stressTable.GetValue( currentKey * 7, &value );
+		if( found != ( currentKey % 2 == 1 ) || ( found && *value != currentKey ) )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCFlatHashTable_UnitTest failed! stressTable lost a key.");
+		}
+	}
+
+	//
+	// Test string keys, these must hash their characters rather than their buffers.
+	//
+
+	TCFlatHashTable< TCString, int > nameTable;
+	TCFlatHashTable< const char8*, int > literalTable;
+
+	nameTable.AddValue( "DiffuseColor", 0 );
+	nameTable.AddValue( "WorldViewProjection", 1 );
+	nameTable.AddValue( "", 2 );
+
+	char8 diffuseName[] = "DiffuseColor";
+	literalTable.AddValue( "DiffuseColor", 0 );
+
+	TCString lookupName = "World";
+	lookupName += "ViewProjection";
+
+	if( nameTable.GetValue( lookupName, &value ) == false || *value != 1 )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCFlatHashTable_UnitTest failed! nameTable didn't hash by value.");
+	}
+
+	if( nameTable.ContainsKey( TCString() ) == false || nameTable.ContainsKey( "diffusecolor" ) )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCFlatHashTable_UnitTest failed! nameTable contain test failed.");
+	}
+
+	if( literalTable.ContainsKey( diffuseName ) == false )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCFlatHashTable_UnitTest failed! literalTable didn't compare by value.");
+	}
+
+	//
+	// Positive and negative zero are the same key.
+	//
+
+	if( stringTable.ContainsKey( -0.0f ) == false )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCFlatHashTable_UnitTest failed! Negative zero wasn't found.");
+	}
+
+	//
+	// Test iteration, every entry left in the table should be visited exactly once.
+	//
+
+	int numVisited = 0;
+	long long keySum = 0;
+	for( TCFlatHashTable< int, int >::Entry& entry : stressTable )
+	{
+		if( entry.key != entry.value * 7 )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCFlatHashTable_UnitTest failed! Iteration gave a mismatched entry.");
+		}
+
+		numVisited++;
+		keySum += entry.key;
+	}
+
+	long long expectedKeySum = 0;
+	for( int currentKey = 1; currentKey < NUM_STRESS_KEYS; currentKey += 2 )
+	{
+		expectedKeySum += currentKey * 7;
+	}
+
+	if( numVisited != stressTable.Count() || keySum != expectedKeySum )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCFlatHashTable_UnitTest failed! Iteration didn't visit every entry once.");
+	}
+
+	if( std::count_if( stressTable.begin(), stressTable.end(), []( const TCFlatHashTable< int, int >::Entry& entry ) { return entry.value % 4 == 1; } ) != NUM_STRESS_KEYS / 4 )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCFlatHashTable_UnitTest failed! Iteration didn't work with <algorithm>.");
+	}
+
+	TCFlatHashTable< int, int > emptyTable;
+	if( emptyTable.begin() != emptyTable.end() )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCFlatHashTable_UnitTest failed! An empty table iterated.");
+	}
+
+	//
+	// Test copies.
+	//
+
+	TCFlatHashTable< float, TCString > copiedTable( stringTable );
+	stringTable.Clear();
+	if( copiedTable.Count() != 3 || copiedTable.GetValue( 0.0f, &stringValue ) == false || *stringValue != "0.0f" )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCFlatHashTable_UnitTest failed! Copy test failed.");
+	}
+
+	//
+	// Test clears.
+	//
+
+	intTable.Clear();
+	stressTable.Clear();
+	copiedTable.Clear();
+
+	if( intTable.Count() != 0 || intTable.ContainsKey( -1 ) )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCFlatHashTable_UnitTest failed! Clear test failed.");
+	}
+
+	return TCUnitTest::TestResult_Success;
+}
@@ -0,0 +1,34 @@
+//
+// TCFlatHashTable_UnitTest.h
+// This file will define the unit test for TCFlatHashTable
+//
+
+#ifndef __TC_FLAT_HASH_TABLE_UNIT_TEST_H__
+#define __TC_FLAT_HASH_TABLE_UNIT_TEST_H__
+
+//
+// Includes
+//
+
+#include "TCUnitTest.h"
+#include "TCFlatHashTable.h"
+
+//
+// Defines
+//
+
+//
+// Class Declaration
+//
+
+class TCFlatHashTable_UnitTest : public TCUnitTest
+{
+	public:		// Members
+	public:		// Methods
+		virtual Result StartTest();
+
+	private:	// Members
+	private:	// Methods
+};
+
+#endif // __TC_FLAT_HASH_TABLE_UNIT_TEST_H__
@@ -0,0 +1,99 @@
+//
+// TCHashFunctions_UnitTest.cpp
+// This file will define the unit test for the hash functions.
+//
+
+//
+// Includes
+//
+
+#include "TCHashFunctions_UnitTest.h"
+#include "TCLogger.h"
+
+//
+// Defines
+//
+
+#define RETURN_UNIT_TEST_FAILURE( x ) { TCLogger::GetInstance()->LogError( x ); return TCUnitTest::TestResult_Failed; }
+
+#define STREAM_TEST_SIZE	1000
+
+//
+// StartTest
+//		- This function will run the unit test for this module.
+// Inputs:
+//		- None.
+// Outputs:
+//		- TCUnitTest::Result: The result of the operation.
+//
+
+TCUnitTest::Result TCHashFunctions_UnitTest::StartTest()
+{
+	//
+	// Check against the published reference values.
+	//
+
+	const char8* sentence = "Nobody inspects the spammish repetition";
+
+	if( TCHashFunctions::XXHash64( "", 0 ) != 0xEF46DB3751D8E999ULL ||
+		TCHashFunctions::XXHash64( "abc", 3 ) != 0x44BC2CF5AD770999ULL ||
+		TCHashFunctions::XXHash64( sentence, TCStringUtils::Length( sentence ) ) != 0xFBCEA83C8A378BF1ULL )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCHashFunctions_UnitTest failed! XXHash64 doesn't match the reference.");
+	}
+
+	if( TCHashFunctions::CRC32C( "123456789", 9 ) != 0xE3069283 )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCHashFunctions_UnitTest failed! CRC32C doesn't match the reference.");
+	}
+
+	//
+	// Hashing in chunks must give the same result as hashing everything at once.
+	//
+
+	unsigned char data[ STREAM_TEST_SIZE ];
+	for( int currentByte = 0; currentByte < STREAM_TEST_SIZE; ++currentByte )
+	{
+		data[ currentByte ] = (unsigned char)( currentByte * 31 + 7 );
+	}
+
+	unsigned long long wholeHash = TCHashFunctions::XXHash64( data, STREAM_TEST_SIZE, 42 );
+	unsigned int wholeCRC = TCHashFunctions::CRC32C( data, STREAM_TEST_SIZE );
+
+	for( unsigned int chunkSize = 1; chunkSize < 70; chunkSize += 3 )
+	{
+		TCHashFunctions::XXHash64State state;
+		TCHashFunctions::XXHash64Begin( state, 42 );
+
+		unsigned int crc = 0;
+		for( unsigned int offset = 0; offset < STREAM_TEST_SIZE; offset += chunkSize )
+		{
+			unsigned int length = ( offset + chunkSize > STREAM_TEST_SIZE ) ? STREAM_TEST_SIZE - offset : chunkSize;
+			TCHashFunctions::XXHash64Update( state, data + offset, length );
+			crc = TCHashFunctions::CRC32C( data + offset, length, crc );
+		}
+
+		if( TCHashFunctions::XXHash64End( state ) != wholeHash )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCHashFunctions_UnitTest failed! Streaming XXHash64 doesn't match.");
+		}
+
+		if( crc != wholeCRC )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCHashFunctions_UnitTest failed! Chunked CRC32C doesn't match.");
+		}
+	}
+
+	//
+	// The 32 bit wrappers should be usable by the hash tables.
+	//
+
+	int key = 1234;
+	if( TCHashFunctions::XXHash( &key, sizeof( key ) ) == TCHashFunctions::XXHash( data, sizeof( key ) ) ||
+		TCHashFunctions::CRC32CHash( &key, sizeof( key ) ) != TCHashFunctions::CRC32C( &key, sizeof( key ) ) )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCHashFunctions_UnitTest failed! 32 bit wrappers are inconsistent.");
+	}
+
+	return TCUnitTest::TestResult_Success;
+}
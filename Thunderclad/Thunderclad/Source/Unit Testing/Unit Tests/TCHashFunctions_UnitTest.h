@@ -0,0 +1,34 @@
+//
+// TCHashFunctions_UnitTest.h
+// This file will define the unit test for the hash functions.
+//
+
+#ifndef __TC_HASH_FUNCTIONS_UNIT_TEST_H__
+#define __TC_HASH_FUNCTIONS_UNIT_TEST_H__
+
+//
+// Includes
+//
+
+#include "TCUnitTest.h"
+#include "TCHashFunctions.h"
+
+//
+// Defines
+//
+
+//
+// Class Declaration
+//
+
+class TCHashFunctions_UnitTest : public TCUnitTest
+{
+	public:		// Members
+	public:		// Methods
+		virtual Result StartTest();
+
+	private:	// Members
+	private:	// Methods
+};
+
+#endif // __TC_HASH_FUNCTIONS_UNIT_TEST_H__
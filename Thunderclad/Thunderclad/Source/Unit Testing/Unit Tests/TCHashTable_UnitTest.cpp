@@ -9,6 +9,8 @@
 
 #include "TCHashTable_UnitTest.h"
 
+#include <algorithm>
+
 //
 // Defines
 //
@@ -158,6 +160,99 @@ TCUnitTest::Result TCHashTable_UnitTest::StartTest()
 		RETURN_UNIT_TEST_FAILURE("TCHashTable_UnitTest failed, contain test returned false positive.");
 	}
 	
+	//
+	// Test removal and iteration across many buckets.
+	//
+
+	TCHashTable< int, int > bucketTable( 101 );
+	for( int currentKey = 0; currentKey < 1000; ++currentKey )
+	{
+		bucketTable.AddValue( currentKey, currentKey * 2 );
+	}
+
+	for( int currentKey = 0; currentKey < 1000; currentKey += 3 )
+	{
+		bucketTable.RemoveValue( currentKey );
+	}
+
+	for( int currentKey = 0; currentKey < 1000; ++currentKey )
+	{
+		bool found = bucketTable.GetValue( currentKey, &value );
+		if( found != ( currentKey % 3 != 0 ) || ( found && *value != currentKey * 2 ) )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCHashTable_UnitTest failed! Removal lost or kept the wrong key.");
+		}
+	}
+
+	int numVisited = 0;
+	for( const TCHashTable< int, int >::Entry& entry : bucketTable )
+	{
+		if( entry.value != entry.key * 2 || entry.key % 3 == 0 )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCHashTable_UnitTest failed! Iteration gave a wrong entry.");
+		}
+
+		numVisited++;
+	}
+
+	if( numVisited != bucketTable.Count() || std::count_if( bucketTable.begin(), bucketTable.end(), []( const TCHashTable< int, int >::Entry& entry ) { return entry.key < 10; } ) != 6 )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCHashTable_UnitTest failed! Iteration didn't visit every entry once.");
+	}
+
+	for( int currentKey = 0; currentKey < bucketTable.GetNumKeys(); ++currentKey )
+	{
+		if( bucketTable.GetValue( bucketTable.GetKey( currentKey ), &value ) == false )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCHashTable_UnitTest failed! The key list is out of date after removal.");
+		}
+	}
+
+	//
+	// Test that keys added before the table grows can still be found after it.
+	//
+
+	const unsigned int startingCapacities[] = { 1, 2, 4, 8, 10, 16 };
+	for( int currentCapacity = 0; currentCapacity < sizeof( startingCapacities ) / sizeof( startingCapacities[ 0 ] ); ++currentCapacity )
+	{
+		TCHashTable< int, int > growingTable( startingCapacities[ currentCapacity ] );
+		for( int currentKey = 0; currentKey < 200; ++currentKey )
+		{
+			growingTable.AddValue( currentKey, currentKey + 1 );
+		}
+
+		for( int currentKey = 0; currentKey < 200; currentKey += 25 )
+		{
+			growingTable.AddValue( currentKey, -1 );
+		}
+
+		if( growingTable.Count() != 200 || growingTable.GetNumKeys() != 200 )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCHashTable_UnitTest failed! A key added again after the table grew wasn't rejected.");
+		}
+
+		for( int currentKey = 0; currentKey < 200; ++currentKey )
+		{
+			if( growingTable.ContainsKey( currentKey ) == false || growingTable.GetValue( currentKey, &value ) == false || *value != currentKey + 1 )
+			{
+				RETURN_UNIT_TEST_FAILURE("TCHashTable_UnitTest failed! A key was lost when the table grew.");
+			}
+		}
+
+		for( int currentKey = 0; currentKey < 200; currentKey += 2 )
+		{
+			growingTable.RemoveValue( currentKey );
+		}
+
+		for( int currentKey = 0; currentKey < 200; ++currentKey )
+		{
+			if( growingTable.ContainsKey( currentKey ) != ( currentKey % 2 != 0 ) )
+			{
+				RETURN_UNIT_TEST_FAILURE("TCHashTable_UnitTest failed! Removal after the table grew lost or kept the wrong key.");
+			}
+		}
+	}
+
 	//
 	// Test clears.
 	//
@@ -0,0 +1,196 @@
+//
+// TCIntrusiveList_UnitTest.cpp
+// This file will define the unit test for an intrusive list and the node pool its objects usually come from.
+//
+
+//
+// Includes
+//
+
+#include "TCIntrusiveList_UnitTest.h"
+#include "TCNodePool.h"
+#include "TCLogger.h"
+
+//
+// Defines
+//
+
+#define RETURN_UNIT_TEST_FAILURE( x ) { TCLogger::GetInstance()->LogError( x ); return TCUnitTest::TestResult_Failed; }
+
+#define NUM_STRESS_NODES	(1000)
+
+struct TCIntrusiveTestNode
+{
+	int									value;
+	TCIntrusiveLink< TCIntrusiveTestNode >	firstLink;
+	TCIntrusiveLink< TCIntrusiveTestNode >	secondLink;
+
+	TCIntrusiveTestNode( int inValue ) : value( inValue ) {}
+};
+
+typedef TCIntrusiveList< TCIntrusiveTestNode, &TCIntrusiveTestNode::firstLink >		TCFirstTestList;
+typedef TCIntrusiveList< TCIntrusiveTestNode, &TCIntrusiveTestNode::secondLink >	TCSecondTestList;
+
+//
+// StartTest
+//		- This function will run the unit test for this module.
+// Inputs:
+//		- None.
+// Outputs:
+//		- TCUnitTest::Result: The result of the operation.
+//
+
+TCUnitTest::Result TCIntrusiveList_UnitTest::StartTest()
+{
+	//
+	// Test adding to both ends and inserting in the middle.
+	//
+
+	TCNodePool< TCIntrusiveTestNode, 4 > pool;
+	TCFirstTestList firstList;
+
+	TCIntrusiveTestNode* one	= pool.Allocate( 1 );
+	TCIntrusiveTestNode* two	= pool.Allocate( 2 );
+	TCIntrusiveTestNode* three	= pool.Allocate( 3 );
+	TCIntrusiveTestNode* four	= pool.Allocate( 4 );
+	TCIntrusiveTestNode* five	= pool.Allocate( 5 );
+
+	if( pool.Count() != 5 || pool.Capacity() != 8 )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCIntrusiveList_UnitTest failed! The node pool provided a wrong count or capacity.");
+	}
+
+	firstList.PushBack( two );
+	firstList.PushBack( four );
+	firstList.PushFront( one );
+	firstList.InsertAfter( two, three );
+	firstList.InsertAfter( four, five );
+
+	int expected = 1;
+	for( TCIntrusiveTestNode& node : firstList )
+	{
+		if( node.value != expected++ )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCIntrusiveList_UnitTest failed! The objects are in the wrong order.");
+		}
+	}
+
+	if( expected != 6 || firstList.Count() != 5 || firstList.First() != one || firstList.Last() != five )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCIntrusiveList_UnitTest failed! The list has a wrong count or wrong ends.");
+	}
+
+	//
+	// Test that one object can be in two lists at once and removing from one leaves the other alone.
+	//
+
+	TCSecondTestList secondList;
+	secondList.PushBack( five );
+	secondList.PushBack( three );
+	secondList.PushBack( one );
+
+	firstList.Remove( three );
+	firstList.Remove( one );
+	firstList.Remove( five );
+
+	if( firstList.Count() != 2 || firstList.First() != two || firstList.Last() != four || TCFirstTestList::Next( two ) != four || firstList.Contains( three ) )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCIntrusiveList_UnitTest failed! Remove left the list broken.");
+	}
+
+	if( secondList.Count() != 3 || secondList.First() != five || TCSecondTestList::Next( five ) != three || TCSecondTestList::Previous( one ) != three )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCIntrusiveList_UnitTest failed! Removing from one list changed another list.");
+	}
+
+	if( secondList.PopFront() != five || secondList.First() != three || ( five->secondLink.prev != NULL || five->secondLink.next != NULL ) )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCIntrusiveList_UnitTest failed! PopFront provided a wrong object.");
+	}
+
+	//
+	// Test clearing, the objects must be free to go into another list afterwards.
+	//
+
+	firstList.Clear();
+	secondList.Clear();
+
+	if( !firstList.IsEmpty() || !secondList.IsEmpty() || firstList.First() != NULL || secondList.Last() != NULL )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCIntrusiveList_UnitTest failed! Clear left objects in the list.");
+	}
+
+	firstList.PushBack( three );
+	firstList.PushBack( two );
+	if( firstList.Count() != 2 || TCFirstTestList::Next( three ) != two )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCIntrusiveList_UnitTest failed! A cleared object couldn't be added again.");
+	}
+	firstList.Clear();
+
+	//
+	// Test that freed nodes are handed out again before the pool grows.
+	//
+
+	pool.Free( five );
+	pool.Free( four );
+
+	TCIntrusiveTestNode* reused = pool.Allocate( 6 );
+	if( reused != four || reused->value != 6 || pool.Count() != 4 || pool.Capacity() != 8 )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCIntrusiveList_UnitTest failed! The node pool didn't reuse a freed node.");
+	}
+
+	pool.Free( one );
+	pool.Free( two );
+	pool.Free( three );
+	pool.Free( reused );
+
+	//
+	// Stress test, remove every other object and check what's left.
+	//
+
+	TCNodePool< TCIntrusiveTestNode > stressPool;
+	TCFirstTestList stressList;
+
+	for( int currentNode = 0; currentNode < NUM_STRESS_NODES; ++currentNode )
+	{
+		stressList.PushBack( stressPool.Allocate( currentNode ) );
+	}
+
+	TCIntrusiveTestNode* node = stressList.First();
+	while( node != NULL )
+	{
+		TCIntrusiveTestNode* nextNode = TCFirstTestList::Next( node );
+		if( node->value % 2 == 1 )
+		{
+			stressList.Remove( node );
+			stressPool.Free( node );
+		}
+
+		node = nextNode;
+	}
+
+	expected = 0;
+	for( TCIntrusiveTestNode& current : stressList )
+	{
+		if( current.value != expected )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCIntrusiveList_UnitTest failed! Removing while walking the list broke it.");
+		}
+
+		expected += 2;
+	}
+
+	if( stressList.Count() != NUM_STRESS_NODES / 2 || stressPool.Count() != NUM_STRESS_NODES / 2 )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCIntrusiveList_UnitTest failed! The stress test ended with a wrong count.");
+	}
+
+	while( !stressList.IsEmpty() )
+	{
+		stressPool.Free( stressList.PopFront() );
+	}
+
+	return TCUnitTest::TestResult_Success;
+}
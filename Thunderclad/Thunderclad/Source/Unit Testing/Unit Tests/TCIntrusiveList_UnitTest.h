@@ -0,0 +1,34 @@
+//
+// TCIntrusiveList_UnitTest.h
+// This file will define the unit test for TCIntrusiveList
+//
+
+#ifndef __TC_INTRUSIVE_LIST_UNIT_TEST_H__
+#define __TC_INTRUSIVE_LIST_UNIT_TEST_H__
+
+//
+// Includes
+//
+
+#include "TCUnitTest.h"
+#include "TCIntrusiveList.h"
+
+//
+// Defines
+//
+
+//
+// Class Declaration
+//
+
+class TCIntrusiveList_UnitTest : public TCUnitTest
+{
+	public:		// Members
+	public:		// Methods
+		virtual Result StartTest();
+
+	private:	// Members
+	private:	// Methods
+};
+
+#endif // __TC_INTRUSIVE_LIST_UNIT_TEST_H__
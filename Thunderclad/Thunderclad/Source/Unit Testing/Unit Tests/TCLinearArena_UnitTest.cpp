@@ -0,0 +1,206 @@
+//
+// TCLinearArena_UnitTest.cpp
+// This file will define the unit test for the linear and frame arenas.
+//
+
+//
+// Includes
+//
+
+#include "TCLinearArena_UnitTest.h"
+#include "TCFrameArena.h"
+#include "TCList.h"
+#include "TCLogger.h"
+
+#include <string.h>
+
+//
+// Defines
+//
+
+#define RETURN_UNIT_TEST_FAILURE( x ) { TCLogger::GetInstance()->LogError( x ); return TCUnitTest::TestResult_Failed; }
+
+#define ARENA_TEST_CAPACITY		(4096)
+
+//
+// StartTest
+//		- This function will run the unit test for this module.
+// Inputs:
+//		- None.
+// Outputs:
+//		- TCUnitTest::Result: The result of the operation.
+//
+
+TCUnitTest::Result TCLinearArena_UnitTest::StartTest()
+{
+	//
+	// Test that an arena without memory fails cleanly.
+	//
+
+	TCLinearArena emptyArena;
+	if( emptyArena.Allocate( 16 ) != NULL || emptyArena.NumFailedAllocations() != 1 || emptyArena.Owns( &emptyArena ) )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCLinearArena_UnitTest failed! An arena without memory handed something out.");
+	}
+
+	//
+	// Test that allocations are aligned, don't overlap and are owned by the arena.
+	//
+
+	TCLinearArena arena( ARENA_TEST_CAPACITY );
+	unsigned int alignments[] = { 1, 2, 4, 8, 16, 32, 64 };
+	char* previousEnd = NULL;
+	for( int currentAlignment = 0; currentAlignment < 7; ++currentAlignment )
+	{
+		char* memory = (char*)arena.Allocate( 3, alignments[ currentAlignment ] );
+		if( memory == NULL || ( (size_t)memory & ( alignments[ currentAlignment ] - 1 ) ) != 0 || !arena.Owns( memory ) || memory < previousEnd )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCLinearArena_UnitTest failed! An allocation was misaligned or overlapped another.");
+		}
+
+		memset( memory, currentAlignment, 3 );
+		previousEnd = memory + 3;
+	}
+
+	double* doubles = arena.AllocateArray< double >( 8 );
+	if( doubles == NULL || ( (size_t)doubles & ( TC_ALIGNOF( double ) - 1 ) ) != 0 || arena.Used() == 0 || arena.CheckGuards() == false )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCLinearArena_UnitTest failed! AllocateArray gave the wrong memory.");
+	}
+
+	//
+	// Test that rewinding to a marker hands the same memory out again and keeps what came before.
+	//
+
+	arena.Reset();
+	int* kept = arena.AllocateArray< int >( 4 );
+	kept[ 0 ] = 1; kept[ 1 ] = 2; kept[ 2 ] = 3; kept[ 3 ] = 4;
+
+	TCLinearArena::Marker marker = arena.GetMarker();
+	void* first = arena.Allocate( 100 );
+	arena.Allocate( 200 );
+	unsigned int highWaterMark = arena.HighWaterMark();
+
+	arena.Rewind( marker );
+	if( arena.Used() != marker || arena.Allocate( 100 ) != first || kept[ 0 ] != 1 || kept[ 3 ] != 4 )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCLinearArena_UnitTest failed! Rewinding released the wrong memory.");
+	}
+
+	//
+	// Test that a scope rewinds when it ends.
+	//
+
+	marker = arena.GetMarker();
+	{
+		TCLinearArena::Scope scratch( arena );
+		arena.Allocate( 64 );
+		arena.Allocate( 64 );
+	}
+
+	if( arena.GetMarker() != marker )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCLinearArena_UnitTest failed! A scope didn't rewind the arena.");
+	}
+
+	//
+	// Test the high water mark and failed allocations.
+	//
+
+	if( arena.HighWaterMark() != highWaterMark || arena.HighWaterMark() < 300 || arena.NumFailedAllocations() != 0 )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCLinearArena_UnitTest failed! The high water mark was wrong.");
+	}
+
+	if( arena.Allocate( ARENA_TEST_CAPACITY ) != NULL || arena.NumFailedAllocations() != 1 || arena.Used() != marker )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCLinearArena_UnitTest failed! An allocation that didn't fit wasn't refused.");
+	}
+
+	arena.Reset();
+	arena.ResetStatistics();
+	if( arena.Used() != 0 || arena.HighWaterMark() != 0 || arena.NumFailedAllocations() != 0 )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCLinearArena_UnitTest failed! Resetting the statistics didn't clear them.");
+	}
+
+	//
+	// Test that the guards catch a write past the end of an allocation.
+	//
+
+#if TC_BUILD_CONFIGURATION_DEBUG
+	char* overrun = (char*)arena.Allocate( 10 );
+	char saved = overrun[ 10 ];
+	overrun[ 10 ] = 0;
+	bool caught = !arena.CheckGuards();
+	overrun[ 10 ] = saved;
+
+	if( !caught || !arena.CheckGuards() )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCLinearArena_UnitTest failed! The guards didn't catch an overrun.");
+	}
+
+	arena.Reset();
+#endif
+
+	//
+	// Test that a list drawing from an arena falls back to the heap once the arena is full.
+	//
+
+	{
+		TCLinearArena::Scope scratch( arena );
+		TCArenaAllocator allocator( &arena );
+		TCList< int, TCArenaAllocator > numbers( allocator );
+		for( int currentNumber = 0; currentNumber < ARENA_TEST_CAPACITY; ++currentNumber )
+		{
+			numbers.Append( currentNumber );
+		}
+
+		if( arena.NumFailedAllocations() == 0 || arena.Owns( numbers.begin() ) || numbers[ ARENA_TEST_CAPACITY - 1 ] != ARENA_TEST_CAPACITY - 1 )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCLinearArena_UnitTest failed! An arena list didn't move to the heap when the arena filled.");
+		}
+
+		TCList< int, TCArenaAllocator > moved( TCMove( numbers ) );
+		if( moved.Count() != ARENA_TEST_CAPACITY || numbers.Count() != 0 || moved[ 10 ] != 10 )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCLinearArena_UnitTest failed! Moving an arena list lost its objects.");
+		}
+	}
+
+	//
+	// Test that frame memory lives through the next frame and is reused the frame after.
+	//
+
+	gFrameArena->Initialize( ARENA_TEST_CAPACITY );
+
+	gFrameArena->BeginFrame();
+	int* frameOne = gFrameArena->AllocateArray< int >( 4 );
+	frameOne[ 0 ] = 42;
+
+	{
+		TCList< int, TCFrameAllocator > drawList;
+		drawList.Append( 7 );
+		if( frameOne == NULL || !gFrameArena->Current().Owns( frameOne ) || !gFrameArena->Current().Owns( drawList.begin() ) )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCLinearArena_UnitTest failed! Frame memory didn't come from the frame arena.");
+		}
+
+		gFrameArena->BeginFrame();
+		int* frameTwo = gFrameArena->AllocateArray< int >( 4 );
+		if( frameTwo == frameOne || frameOne[ 0 ] != 42 || drawList[ 0 ] != 7 || !gFrameArena->Previous().Owns( frameOne ) )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCLinearArena_UnitTest failed! Frame memory didn't survive into the next frame.");
+		}
+	}
+
+	gFrameArena->BeginFrame();
+	if( gFrameArena->AllocateArray< int >( 4 ) != frameOne || gFrameArena->FrameNumber() != 3 || gFrameArena->HighWaterMark() == 0 )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCLinearArena_UnitTest failed! Frame memory wasn't reused two frames later.");
+	}
+
+	gFrameArena->Destroy();
+
+	return TCUnitTest::TestResult_Success;
+}
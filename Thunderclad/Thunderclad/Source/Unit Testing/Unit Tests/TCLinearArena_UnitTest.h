@@ -0,0 +1,34 @@
+//
+// TCLinearArena_UnitTest.h
+// This file will define the unit test for TCLinearArena and TCFrameArena
+//
+
+#ifndef __TC_LINEAR_ARENA_UNIT_TEST_H__
+#define __TC_LINEAR_ARENA_UNIT_TEST_H__
+
+//
+// Includes
+//
+
+#include "TCUnitTest.h"
+#include "TCLinearArena.h"
+
+//
+// Defines
+//
+
+//
+// Class Declaration
+//
+
+class TCLinearArena_UnitTest : public TCUnitTest
+{
+	public:		// Members
+	public:		// Methods
+		virtual Result StartTest();
+
+	private:	// Members
+	private:	// Methods
+};
+
+#endif // __TC_LINEAR_ARENA_UNIT_TEST_H__
@@ -10,10 +10,68 @@
 #include "TCList_UnitTest.h"
 #include "TCLogger.h"
 
+#include <algorithm>
+
 //
 // Define
 //
 
+#define RETURN_UNIT_TEST_FAILURE( x ) { TCLogger::GetInstance()->LogError( x ); return TCUnitTest::TestResult_Failed; }
+
+//
+// TCList_TrackedObject
+//		- Counts how many objects are alive and how often one was copied, so the test can tell a move from a copy.
+//
+
+class TCList_TrackedObject
+{
+	public:
+		static int sLiveCount;
+		static int sCopyCount;
+
+		int value;
+
+		TCList_TrackedObject()										: value( 0 )								{ sLiveCount++; }
+		TCList_TrackedObject( int inValue )							: value( inValue )							{ sLiveCount++; }
+		TCList_TrackedObject( int lhs, int rhs )					: value( lhs + rhs )						{ sLiveCount++; }
+		TCList_TrackedObject( const TCList_TrackedObject& object )	: value( object.value )						{ sLiveCount++; sCopyCount++; }
+		TCList_TrackedObject( TCList_TrackedObject&& object )		: value( object.value )						{ sLiveCount++; object.value = -1; }
+		~TCList_TrackedObject()																					{ sLiveCount--; }
+
+		TCList_TrackedObject& operator=( const TCList_TrackedObject& object )	{ value = object.value; sCopyCount++; return *this; }
+		TCList_TrackedObject& operator=( TCList_TrackedObject&& object )		{ value = object.value; object.value = -1; return *this; }
+		bool operator==( const TCList_TrackedObject& object ) const				{ return value == object.value; }
+};
+
+int TCList_TrackedObject::sLiveCount = 0;
+int TCList_TrackedObject::sCopyCount = 0;
+
+//
+// TCList_CountingAllocator
+//		- Draws from the heap like the default allocator, but counts the allocations so the test can see the policy in use.
+//
+
+class TCList_CountingAllocator : public TCHeapAllocator
+{
+	public:
+		static int sAllocations;
+
+		void* Allocate( unsigned int size )		{ sAllocations++; return TCHeapAllocator::Allocate( size ); }
+};
+
+int TCList_CountingAllocator::sAllocations = 0;
+
+//
+// IsInline
+//		- Will tell if an object is stored inside another object, used to check where an inline list keeps its objects.
+//
+
+template< typename Object, typename Owner >
+static bool IsInline( Object& object, Owner& owner )
+{
+	return (char*)&object >= (char*)&owner && (char*)&object < (char*)( &owner + 1 );
+}
+
 //
 // StartTest
 //		- Will run the test 
@@ -243,5 +301,194 @@ TCUnitTest::Result TCList_UnitTest::StartTest()
 		return TCUnitTest::TestResult_Failed;
 	}
 
+	//
+	// Growing, inserting and removing should move objects, never copy them.
+	//
+
+	TCLogger::GetInstance()->LogInfo( "Starting Move Test" );
+
+	{
+		TCList< TCList_TrackedObject > trackedList;
+		for( int currentObject = 0; currentObject < 100; ++currentObject )
+		{
+			trackedList.Append( TCList_TrackedObject( currentObject ) );
+		}
+
+		if( TCList_TrackedObject::sCopyCount != 0 )
+			RETURN_UNIT_TEST_FAILURE( "Move Test Failed: growing the list copied its objects." );
+
+		if( TCList_TrackedObject::sLiveCount != trackedList.Count() )
+			RETURN_UNIT_TEST_FAILURE( "Move Test Failed: the list constructed objects it does not hold." );
+
+		if( trackedList.EmplaceBack( 2, 3 ).value != 5 || trackedList[ 100 ].value != 5 )
+			RETURN_UNIT_TEST_FAILURE( "Emplace Test Failed" );
+
+		trackedList.Insert( TCList_TrackedObject( -5 ), 10 );
+		trackedList.RemoveAt( 0 );
+		trackedList.Remove( TCList_TrackedObject( 50 ) );
+		if( TCList_TrackedObject::sCopyCount != 0 || trackedList[ 9 ].value != -5 || trackedList.Contains( TCList_TrackedObject( 50 ) ) )
+			RETURN_UNIT_TEST_FAILURE( "Move Test Failed: insert and remove should move objects." );
+
+		if( TCList_TrackedObject::sLiveCount != trackedList.Count() )
+			RETURN_UNIT_TEST_FAILURE( "Move Test Failed: insert and remove leaked objects." );
+
+		//
+		// Appending an object from the list while the list grows should copy it before the storage moves.
+		//
+
+		while( trackedList.Count() < trackedList.Capacity() )
+		{
+			trackedList.EmplaceBack( 0 );
+		}
+
+		trackedList.Append( trackedList[ 9 ] );
+		if( trackedList[ trackedList.Count() - 1 ].value != -5 || TCList_TrackedObject::sCopyCount != 1 )
+			RETURN_UNIT_TEST_FAILURE( "Append Test Failed: appending an object from the same list." );
+
+		TCList< TCList_TrackedObject > movedList( TCMove( trackedList ) );
+		if( trackedList.Count() != 0 || trackedList.Capacity() != 0 || movedList[ 9 ].value != -5 || TCList_TrackedObject::sCopyCount != 1 )
+			RETURN_UNIT_TEST_FAILURE( "Move Test Failed: moving a list should take its storage." );
+
+		movedList.Resize( 10 );
+		if( TCList_TrackedObject::sLiveCount != 10 )
+			RETURN_UNIT_TEST_FAILURE( "Resize Test Failed: shrinking should destroy the objects past the end." );
+
+		trackedList = TCMove( movedList );
+		trackedList.Resize( 20 );
+		if( TCList_TrackedObject::sLiveCount != 20 || trackedList[ 19 ].value != 0 || movedList.Count() != 0 )
+			RETURN_UNIT_TEST_FAILURE( "Resize Test Failed: growing should default construct the new objects." );
+	}
+
+	if( TCList_TrackedObject::sLiveCount != 0 )
+		RETURN_UNIT_TEST_FAILURE( "Move Test Failed: destroying the list leaked objects." );
+
+	//
+	// The default growth should be geometric, a thousand appends should only take a handful of allocations.
+	//
+
+	TCLogger::GetInstance()->LogInfo( "Starting Growth Test" );
+
+	TCList< int, TCList_CountingAllocator > growthList;
+	for( int currentObject = 0; currentObject < 1000; ++currentObject )
+	{
+		growthList.Append( currentObject );
+	}
+
+	if( TCList_CountingAllocator::sAllocations > 20 || growthList.GetGrowthRate() != DEFAULT_GROWTH_RATE )
+		RETURN_UNIT_TEST_FAILURE( "Growth Test Failed: appends should grow the list geometrically." );
+
+	growthList.ShrinkToFit();
+	if( growthList.Capacity() != 1000 || growthList[ 999 ] != 999 )
+		RETURN_UNIT_TEST_FAILURE( "ShrinkToFit Test Failed" );
+
+	growthList.Resize( 0 );
+	growthList.ShrinkToFit();
+	if( growthList.Capacity() != 0 )
+		RETURN_UNIT_TEST_FAILURE( "ShrinkToFit Test Failed: an empty list should release its storage." );
+
+	//
+	// An inline list keeps small counts inside itself and only moves to the heap once it outgrows its buffer.
+	//
+
+	TCLogger::GetInstance()->LogInfo( "Starting Inline List Test" );
+
+	TCInlineList< TCString, 4 > inlineList;
+	inlineList.Append( "1" );
+	inlineList.Append( "2" );
+	inlineList.Append( "3" );
+	inlineList.Append( "4" );
+	if( inlineList.Capacity() != 4 || !IsInline( inlineList[ 0 ], inlineList ) )
+		RETURN_UNIT_TEST_FAILURE( "Inline List Test Failed: a small list should be stored inline." );
+
+	inlineList.Append( "5" );
+	if( IsInline( inlineList[ 0 ], inlineList ) || inlineList[ 0 ] != "1" || inlineList[ 4 ] != "5" )
+		RETURN_UNIT_TEST_FAILURE( "Inline List Test Failed: outgrowing the buffer should move the list to the heap." );
+
+	inlineList.RemoveAt( 0 );
+	inlineList.RemoveAt( 0 );
+	inlineList.ShrinkToFit();
+	if( !IsInline( inlineList[ 0 ], inlineList ) || inlineList[ 0 ] != "3" || inlineList.Count() != 3 )
+		RETURN_UNIT_TEST_FAILURE( "Inline List Test Failed: shrinking should move the list back inline." );
+
+	TCInlineList< TCString, 4 > copiedList( inlineList );
+	TCInlineList< TCString, 4 > movedList( TCMove( inlineList ) );
+	if( !IsInline( copiedList[ 0 ], copiedList ) || !IsInline( movedList[ 0 ], movedList ) || movedList[ 2 ] != "5" || inlineList.Count() != 0 )
+		RETURN_UNIT_TEST_FAILURE( "Inline List Test Failed: copies and moves should use their own buffer." );
+
+	//
+	// Swap removal, ranges and RemoveIf, on a trivially copyable type and on a type that is not.
+	//
+
+	TCLogger::GetInstance()->LogInfo( "Starting Bulk Operation Test" );
+
+	int numbers[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+	TCList< int > numberList;
+	numberList.AppendRange( numbers, 10 );
+	numberList.RemoveAtSwap( 2 );
+	numberList.RemoveSwap( 0 );
+	if( numberList.Count() != 8 || numberList[ 0 ] != 8 || numberList[ 2 ] != 9 || numberList[ 7 ] != 7 )
+		RETURN_UNIT_TEST_FAILURE( "RemoveSwap Test Failed" );
+
+	numberList.RemoveRange( 1, 3 );
+	numberList.InsertRange( numbers, 3, 1 );
+	int expectedNumbers[] = { 8, 0, 1, 2, 4, 5, 6, 7 };
+	for( int currentObject = 0; currentObject < 8; ++currentObject )
+	{
+		if( numberList[ currentObject ] != expectedNumbers[ currentObject ] )
+			RETURN_UNIT_TEST_FAILURE( "Range Test Failed" );
+	}
+
+	numberList.AppendRange( numberList );
+	if( numberList.Count() != 16 || numberList[ 8 ] != 8 || numberList[ 15 ] != 7 )
+		RETURN_UNIT_TEST_FAILURE( "AppendRange Test Failed: appending a list to itself." );
+
+	if( numberList.RemoveIf( []( int number ) { return ( number % 2 ) != 0; } ) != 6 || numberList.Count() != 10 || numberList[ 3 ] != 4 || numberList[ 9 ] != 6 )
+		RETURN_UNIT_TEST_FAILURE( "RemoveIf Test Failed" );
+
+	{
+		TCList< TCList_TrackedObject > trackedList;
+		for( int currentObject = 0; currentObject < 10; ++currentObject )
+		{
+			trackedList.EmplaceBack( currentObject );
+		}
+
+		trackedList.InsertRange( &trackedList[ 6 ], 3, 2 );
+		trackedList.RemoveRange( 0, 2 );
+		int expectedObjects[] = { 6, 7, 8, 2, 3, 4, 5, 6, 7, 8, 9 };
+		for( int currentObject = 0; currentObject < 11; ++currentObject )
+		{
+			if( trackedList[ currentObject ].value != expectedObjects[ currentObject ] )
+				RETURN_UNIT_TEST_FAILURE( "Range Test Failed: inserting objects from the same list." );
+		}
+
+		trackedList.RemoveIf( []( const TCList_TrackedObject& object ) { return object.value > 5; } );
+		trackedList.RemoveAtSwap( 0 );
+		if( trackedList.Count() != 3 || trackedList[ 0 ].value != 5 || TCList_TrackedObject::sLiveCount != 3 )
+			RETURN_UNIT_TEST_FAILURE( "RemoveIf Test Failed: removed objects should be destroyed." );
+	}
+
+	if( TCList_TrackedObject::sLiveCount != 0 )
+		RETURN_UNIT_TEST_FAILURE( "Bulk Operation Test Failed: objects were leaked." );
+
+	//
+	// Lists iterate with plain pointers, so range-for and <algorithm> work on them.
+	//
+
+	TCLogger::GetInstance()->LogInfo( "Starting Iterator Test" );
+
+	int numberSum = 0;
+	for( int number : numberList )
+	{
+		numberSum += number;
+	}
+
+	std::sort( numberList.begin(), numberList.end() );
+	if( numberSum != 40 || numberList[ 0 ] != 0 || numberList[ 9 ] != 8 || std::count( numberList.begin(), numberList.end(), 8 ) != 2 )
+		RETURN_UNIT_TEST_FAILURE( "Iterator Test Failed" );
+
+	TCList< TCString > emptyList;
+	if( emptyList.begin() != emptyList.end() )
+		RETURN_UNIT_TEST_FAILURE( "Iterator Test Failed: an empty list iterated." );
+
 	return TCUnitTest::TestResult_Success;
 }
\ No newline at end of file
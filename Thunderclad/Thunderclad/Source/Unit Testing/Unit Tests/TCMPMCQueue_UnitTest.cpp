@@ -0,0 +1,225 @@
+//
+// TCMPMCQueue_UnitTest.cpp
+// This file will define the unit test for a multiple producer, multiple consumer queue.
+//
+
+//
+// Includes
+//
+
+#include "TCMPMCQueue_UnitTest.h"
+#include "TCLogger.h"
+#include "TCString.h"
+
+#include <thread>
+
+//
+// Defines
+//
+
+#define RETURN_UNIT_TEST_FAILURE( x ) { TCLogger::GetInstance()->LogError( x ); return TCUnitTest::TestResult_Failed; }
+
+#define NUM_STRESS_THREADS		(4)			// Producers, and the same number of consumers.
+#define NUM_STRESS_OBJECTS		(50000)		// Objects pushed by each producer.
+#define STRESS_BATCH_SIZE		(8)
+
+//
+// StartTest
+//		- This function will run the unit test for this module.
+// Inputs:
+//		- None.
+// Outputs:
+//		- TCUnitTest::Result: The result of the operation.
+//
+
+TCUnitTest::Result TCMPMCQueue_UnitTest::StartTest()
+{
+	//
+	// Test that the capacity is rounded up to a power of two, with room for at least two objects.
+	//
+
+	TCMPMCQueue< int > intQueue( 6 );
+	TCMPMCQueue< int > tinyQueue( 1 );
+	if( intQueue.Capacity() != 8 || tinyQueue.Capacity() != 2 || !intQueue.IsEmpty() )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCMPMCQueue_UnitTest failed! The capacity was not rounded up to a power of two.");
+	}
+
+	//
+	// Test push and pop order, and that a full queue refuses objects, over several laps of the slots.
+	//
+
+	int value = -1;
+	for( int currentLap = 0; currentLap < 3; ++currentLap )
+	{
+		for( int currentObject = 0; currentObject < 8; ++currentObject )
+		{
+			if( !intQueue.Push( currentLap * 8 + currentObject ) )
+			{
+				RETURN_UNIT_TEST_FAILURE("TCMPMCQueue_UnitTest failed! Push failed before the queue was full.");
+			}
+		}
+
+		if( intQueue.Push( -1 ) || intQueue.Count() != 8 )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCMPMCQueue_UnitTest failed! A full queue accepted an object.");
+		}
+
+		for( int currentObject = 0; currentObject < 8; ++currentObject )
+		{
+			if( !intQueue.Pop( value ) || value != currentLap * 8 + currentObject )
+			{
+				RETURN_UNIT_TEST_FAILURE("TCMPMCQueue_UnitTest failed! Pop did not return the objects in order.");
+			}
+		}
+
+		value = -1;
+		if( intQueue.Pop( value ) || value != -1 || !intQueue.IsEmpty() )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCMPMCQueue_UnitTest failed! An empty queue returned an object.");
+		}
+	}
+
+	//
+	// Test the batch operations, including runs that wrap past the end of the slots.
+	//
+
+	int objects[ 12 ] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 };
+	int results[ 12 ] = {};
+
+	if( intQueue.PushRange( objects, 5 ) != 5 || intQueue.PopRange( results, 3 ) != 3 || results[ 2 ] != 2 )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCMPMCQueue_UnitTest failed! Batch operations provided a wrong count.");
+	}
+
+	// 2 objects are in the queue, so only 6 of these fit.
+	if( intQueue.PushRange( objects + 5, 7 ) != 6 )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCMPMCQueue_UnitTest failed! PushRange did not stop at the capacity.");
+	}
+
+	if( intQueue.PopRange( results, 12 ) != 8 )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCMPMCQueue_UnitTest failed! PopRange did not stop at the end of the queue.");
+	}
+
+	for( int currentObject = 0; currentObject < 8; ++currentObject )
+	{
+		if( results[ currentObject ] != currentObject + 3 )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCMPMCQueue_UnitTest failed! Batch operations did not keep the objects in order.");
+		}
+	}
+
+	//
+	// Test that objects are moved through the queue.
+	//
+
+	TCMPMCQueue< TCString > stringQueue( 4 );
+	TCString message = "load texture";
+	stringQueue.Push( TCMove( message ) );
+
+	TCString received;
+	if( !stringQueue.Pop( received ) || received != "load texture" )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCMPMCQueue_UnitTest failed! A string did not survive the queue.");
+	}
+
+	//
+	// Stress test, several producers and consumers share a small queue. Each object encodes its producer and
+	// sequence, every object must arrive exactly once and each consumer must see a producer's objects in order.
+	//
+
+	TCMPMCQueue< int > stressQueue( 64 );
+	long long sums[ NUM_STRESS_THREADS ] = {};
+	int counts[ NUM_STRESS_THREADS ] = {};
+	bool inOrder[ NUM_STRESS_THREADS ] = {};
+	std::atomic< int > numConsumed( 0 );
+
+	std::thread threads[ NUM_STRESS_THREADS * 2 ];
+	for( int currentThread = 0; currentThread < NUM_STRESS_THREADS; ++currentThread )
+	{
+		threads[ currentThread ] = std::thread( [ &stressQueue, currentThread ]()
+		{
+			for( int currentObject = 0; currentObject < NUM_STRESS_OBJECTS; )
+			{
+				int batch[ STRESS_BATCH_SIZE ];
+				int batchSize = ( currentThread % 2 == 0 ) ? 1 : STRESS_BATCH_SIZE;	// Half the producers push in batches.
+				if( currentObject + batchSize > NUM_STRESS_OBJECTS )
+				{
+					batchSize = NUM_STRESS_OBJECTS - currentObject;
+				}
+
+				for( int currentBatch = 0; currentBatch < batchSize; ++currentBatch )
+				{
+					batch[ currentBatch ] = currentThread * NUM_STRESS_OBJECTS + currentObject + currentBatch;
+				}
+
+				int numPushed = stressQueue.PushRange( batch, batchSize );
+				currentObject += numPushed;
+				if( numPushed == 0 )
+				{
+					std::this_thread::yield();
+				}
+			}
+		} );
+
+		threads[ NUM_STRESS_THREADS + currentThread ] = std::thread( [ &stressQueue, &sums, &counts, &inOrder, &numConsumed, currentThread ]()
+		{
+			int lastSeen[ NUM_STRESS_THREADS ];
+			for( int currentProducer = 0; currentProducer < NUM_STRESS_THREADS; ++currentProducer )
+			{
+				lastSeen[ currentProducer ] = -1;
+			}
+
+			inOrder[ currentThread ] = true;
+			while( numConsumed.load() < NUM_STRESS_THREADS * NUM_STRESS_OBJECTS )
+			{
+				int batch[ STRESS_BATCH_SIZE ];
+				int numObjects = ( currentThread % 2 == 0 ) ? ( stressQueue.Pop( batch[ 0 ] ) ? 1 : 0 ) : stressQueue.PopRange( batch, STRESS_BATCH_SIZE );
+				for( int currentObject = 0; currentObject < numObjects; ++currentObject )
+				{
+					int producer = batch[ currentObject ] / NUM_STRESS_OBJECTS;
+					int sequence = batch[ currentObject ] % NUM_STRESS_OBJECTS;
+					inOrder[ currentThread ] = inOrder[ currentThread ] && ( sequence > lastSeen[ producer ] );
+					lastSeen[ producer ] = sequence;
+
+					sums[ currentThread ] += batch[ currentObject ];
+					counts[ currentThread ]++;
+				}
+
+				if( numObjects == 0 )
+				{
+					std::this_thread::yield();
+				}
+				numConsumed += numObjects;
+			}
+		} );
+	}
+
+	for( int currentThread = 0; currentThread < NUM_STRESS_THREADS * 2; ++currentThread )
+	{
+		threads[ currentThread ].join();
+	}
+
+	long long totalObjects = (long long)NUM_STRESS_THREADS * NUM_STRESS_OBJECTS;
+	long long sum = 0;
+	int count = 0;
+	for( int currentThread = 0; currentThread < NUM_STRESS_THREADS; ++currentThread )
+	{
+		if( !inOrder[ currentThread ] )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCMPMCQueue_UnitTest failed! A consumer saw a producer's objects out of order.");
+		}
+
+		sum += sums[ currentThread ];
+		count += counts[ currentThread ];
+	}
+
+	if( count != totalObjects || sum != totalObjects * ( totalObjects - 1 ) / 2 || !stressQueue.IsEmpty() )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCMPMCQueue_UnitTest failed! Objects were lost or duplicated between threads.");
+	}
+
+	return TCUnitTest::TestResult_Success;
+}
@@ -0,0 +1,34 @@
+//
+// TCMPMCQueue_UnitTest.h
+// This file will define the unit test for TCMPMCQueue
+//
+
+#ifndef __TC_MPMC_QUEUE_UNIT_TEST_H__
+#define __TC_MPMC_QUEUE_UNIT_TEST_H__
+
+//
+// Includes
+//
+
+#include "TCUnitTest.h"
+#include "TCMPMCQueue.h"
+
+//
+// Defines
+//
+
+//
+// Class Declaration
+//
+
+class TCMPMCQueue_UnitTest : public TCUnitTest
+{
+	public:		// Members
+	public:		// Methods
+		virtual Result StartTest();
+
+	private:	// Members
+	private:	// Methods
+};
+
+#endif // __TC_MPMC_QUEUE_UNIT_TEST_H__
@@ -0,0 +1,176 @@
+//
+// TCMemUtils_UnitTest.cpp
+// This file will define the unit test for the memory copy and fill routines.
+//
+
+//
+// Includes
+//
+
+#include "TCMemUtils_UnitTest.h"
+#include "TCLogger.h"
+#include "TCTestRandom.h"
+
+#include <string.h>
+
+//
+// Defines
+//
+
+#define MAX_SMALL_SIZE			(300)		// Every size up to this is tested, covering each size class and the loops.
+#define MAX_OFFSET				(32)		// Every alignment of an AVX2 register.
+#define GUARD_SIZE				(64)
+#define BUFFER_SIZE				(70000 + MAX_OFFSET + 2 * GUARD_SIZE)
+#define GUARD_BYTE				(0xEE)
+
+static const size_t gLargeSizes[] = { 4095, 4096, 4097, 12345, 65536, 70000 };
+
+//
+// CheckGuards
+//		- Will check that nothing outside [ start, start + size ) was written.
+//
+
+static bool CheckGuards( const unsigned char* buffer, size_t start, size_t size )
+{
+	for( size_t currentByte = 0; currentByte < start; ++currentByte )
+	{
+		if( buffer[ currentByte ] != GUARD_BYTE )
+			return false;
+	}
+
+	for( size_t currentByte = start + size; currentByte < start + size + GUARD_SIZE; ++currentByte )
+	{
+		if( buffer[ currentByte ] != GUARD_BYTE )
+			return false;
+	}
+
+	return true;
+}
+
+//
+// StartTest
+//		- This function will run the unit test for this module.
+// Inputs:
+//		- None.
+// Outputs:
+//		- TCUnitTest::Result: The result of the operation.
+//
+
+TCUnitTest::Result TCMemUtils_UnitTest::StartTest()
+{
+	unsigned char* source = new unsigned char[ BUFFER_SIZE ];
+	unsigned char* dest = new unsigned char[ BUFFER_SIZE ];
+	Result result = TestResult_Success;
+
+	unsigned int random = 0x2545F491;
+	for( int currentByte = 0; currentByte < BUFFER_SIZE; ++currentByte )
+	{
+		source[ currentByte ] = (unsigned char)TCTestRandom::NextXorshift( random );
+	}
+
+	//
+	// Test every small size at every alignment, against the guards on both sides.
+	//
+
+	for( size_t size = 0; size <= MAX_SMALL_SIZE && result == TestResult_Success; ++size )
+	{
+		for( size_t offset = 0; offset < MAX_OFFSET && result == TestResult_Success; ++offset )
+		{
+			size_t start = GUARD_SIZE + offset;
+			const unsigned char* sourceStart = source + GUARD_SIZE + ( ( offset * 7 ) % MAX_OFFSET );
+
+			memset( dest, GUARD_BYTE, start + size + GUARD_SIZE );
+			TCMemoryUtils::Copy( sourceStart, dest + start, size );
+			if( memcmp( dest + start, sourceStart, size ) != 0 || !CheckGuards( dest, start, size ) )
+			{
+				TCLogger::GetInstance()->LogError( "TCMemUtils_UnitTest failed! Copy wrote the wrong bytes." );
+				result = TestResult_Failed;
+			}
+
+			memset( dest, GUARD_BYTE, start + size + GUARD_SIZE );
+			TCMemoryUtils::Fill( dest + start, (unsigned char)size, size );
+			for( size_t currentByte = 0; currentByte < size; ++currentByte )
+			{
+				if( dest[ start + currentByte ] != (unsigned char)size )
+				{
+					result = TestResult_Failed;
+				}
+			}
+
+			if( result != TestResult_Success || !CheckGuards( dest, start, size ) )
+			{
+				TCLogger::GetInstance()->LogError( "TCMemUtils_UnitTest failed! Fill wrote the wrong bytes." );
+				result = TestResult_Failed;
+			}
+		}
+	}
+
+	//
+	// Test large and streaming copies and fills, which go through the aligned loops.
+	//
+
+	for( size_t currentSize = 0; currentSize < sizeof( gLargeSizes ) / sizeof( gLargeSizes[ 0 ] ) && result == TestResult_Success; ++currentSize )
+	{
+		size_t size = gLargeSizes[ currentSize ];
+		for( size_t offset = 0; offset < MAX_OFFSET && result == TestResult_Success; offset += 5 )
+		{
+			size_t start = GUARD_SIZE + offset;
+			const unsigned char* sourceStart = source + GUARD_SIZE + ( MAX_OFFSET - 1 - offset );
+
+			memset( dest, GUARD_BYTE, start + size + GUARD_SIZE );
+			TCMemoryUtils::Copy( sourceStart, dest + start, size );
+			bool copied = memcmp( dest + start, sourceStart, size ) == 0 && CheckGuards( dest, start, size );
+
+			memset( dest, GUARD_BYTE, start + size + GUARD_SIZE );
+			TCMemoryUtils::CopyStreaming( sourceStart, dest + start, size );
+			bool streamed = memcmp( dest + start, sourceStart, size ) == 0 && CheckGuards( dest, start, size );
+
+			if( !copied || !streamed )
+			{
+				TCLogger::GetInstance()->LogError( "TCMemUtils_UnitTest failed! A large copy wrote the wrong bytes." );
+				result = TestResult_Failed;
+			}
+
+			memset( dest, GUARD_BYTE, start + size + GUARD_SIZE );
+			TCMemoryUtils::FillStreaming( dest + start, 0x5A, size );
+			for( size_t currentByte = 0; currentByte < size; ++currentByte )
+			{
+				if( dest[ start + currentByte ] != 0x5A )
+				{
+					result = TestResult_Failed;
+				}
+			}
+
+			if( result != TestResult_Success || !CheckGuards( dest, start, size ) )
+			{
+				TCLogger::GetInstance()->LogError( "TCMemUtils_UnitTest failed! A streaming fill wrote the wrong bytes." );
+				result = TestResult_Failed;
+			}
+		}
+	}
+
+	//
+	// Test that MemCopy copies adjacent memory and refuses overlapping memory.
+	//
+
+	if( result == TestResult_Success )
+	{
+		memcpy( dest, source, 64 );
+		if( !TCMemoryUtils::MemCopy( dest, dest + 32, 32 ) || memcmp( dest + 32, source, 32 ) != 0 )
+		{
+			TCLogger::GetInstance()->LogError( "TCMemUtils_UnitTest failed! MemCopy refused adjacent memory." );
+			result = TestResult_Failed;
+		}
+
+		if( TCMemoryUtils::MemCopy( dest, dest + 16, 32 ) || TCMemoryUtils::MemCopy( dest + 16, dest, 32 ) || TCMemoryUtils::MemCopySafe( dest, NULL, 32 ) )
+		{
+			TCLogger::GetInstance()->LogError( "TCMemUtils_UnitTest failed! MemCopy accepted overlapping memory or a NULL pointer." );
+			result = TestResult_Failed;
+		}
+	}
+
+	delete[] source;
+	delete[] dest;
+
+	return result;
+}
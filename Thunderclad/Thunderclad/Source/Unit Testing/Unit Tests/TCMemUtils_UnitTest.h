@@ -0,0 +1,34 @@
+//
+// TCMemUtils_UnitTest.h
+// This file will define the unit test for TCMemUtils
+//
+
+#ifndef __TC_MEM_UTILS_UNIT_TEST_H__
+#define __TC_MEM_UTILS_UNIT_TEST_H__
+
+//
+// Includes
+//
+
+#include "TCUnitTest.h"
+#include "TCMemUtils.h"
+
+//
+// Defines
+//
+
+//
+// Class Declaration
+//
+
+class TCMemUtils_UnitTest : public TCUnitTest
+{
+	public:		// Members
+	public:		// Methods
+		virtual Result StartTest();
+
+	private:	// Members
+	private:	// Methods
+};
+
+#endif // __TC_MEM_UTILS_UNIT_TEST_H__
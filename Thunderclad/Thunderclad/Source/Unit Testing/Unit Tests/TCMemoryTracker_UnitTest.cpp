@@ -0,0 +1,179 @@
+//
+// TCMemoryTracker_UnitTest.cpp
+// This file will define the unit test for the memory tracker.
+//
+
+//
+// Includes
+//
+
+#include "TCMemoryTracker_UnitTest.h"
+#include "TCLogger.h"
+
+#include <string.h>
+#include <thread>
+
+//
+// Defines
+//
+
+#define RETURN_UNIT_TEST_FAILURE( x ) { TCLogger::GetInstance()->LogError( x ); return TCUnitTest::TestResult_Failed; }
+
+//
+// StartTest
+//		- This function will run the unit test for this module.
+// Inputs:
+//		- None.
+// Outputs:
+//		- TCUnitTest::Result: The result of the operation.
+//
+
+TCUnitTest::Result TCMemoryTracker_UnitTest::StartTest()
+{
+	//
+	// Allocate and Free work whether or not tracking is on.
+	//
+
+	char* memory = (char*)TCMemoryTracker::Allocate( 100, TCMemoryTracker::kMemoryTagString );
+	if( memory == NULL || ( (size_t)memory & 15 ) != 0 )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCMemoryTracker_UnitTest failed! Allocate returned no memory or misaligned memory.");
+	}
+
+	memset( memory, 0xAB, 100 );
+	TCMemoryTracker::Free( memory );
+	TCMemoryTracker::Free( NULL );
+
+#if TC_MEMORY_TRACKING
+	//
+	// Test that allocations are counted against their tag.
+	//
+
+	{
+		TCMemoryTracker::Stats before = TCMemoryTracker::GetStats( TCMemoryTracker::kMemoryTagString );
+		void* first = TCMemoryTracker::Allocate( 100, TCMemoryTracker::kMemoryTagString );
+		void* second = TCMemoryTracker::Allocate( 50, TCMemoryTracker::kMemoryTagString );
+		TCMemoryTracker::Stats during = TCMemoryTracker::GetStats( TCMemoryTracker::kMemoryTagString );
+
+		if( during.liveBytes != before.liveBytes + 150 || during.numLiveAllocations != before.numLiveAllocations + 2 ||
+			during.numAllocations != before.numAllocations + 2 || during.peakBytes < during.liveBytes )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCMemoryTracker_UnitTest failed! Allocations weren't counted against their tag.");
+		}
+
+		TCMemoryTracker::Free( first );
+		TCMemoryTracker::Free( second );
+		TCMemoryTracker::Stats after = TCMemoryTracker::GetStats( TCMemoryTracker::kMemoryTagString );
+
+		if( after.liveBytes != before.liveBytes || after.numLiveAllocations != before.numLiveAllocations ||
+			after.numAllocations != during.numAllocations || after.peakBytes < during.liveBytes )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCMemoryTracker_UnitTest failed! Freeing didn't uncount the memory, or the peak was lost.");
+		}
+	}
+
+	//
+	// Test that the innermost scope tags allocations, including new, and that closing it restores the outer tag.
+	//
+
+	{
+		TCMemoryTracker::Stats graphicsBefore = TCMemoryTracker::GetStats( TCMemoryTracker::kMemoryTagGraphics );
+		TCMemoryTracker::Stats importerBefore = TCMemoryTracker::GetStats( TCMemoryTracker::kMemoryTagShaderImporter );
+
+		TCMemoryTagScope graphicsScope( TCMemoryTracker::kMemoryTagGraphics );
+		void* numbers = operator new( sizeof( int ) * 16 );		// Called directly, a new expression whose result isn't used can be optimized out.
+		void* memory = TCMemoryTracker::Allocate( 32, TCMemoryTracker::kMemoryTagString );
+
+		void* importerMemory = NULL;
+		{
+			TCMemoryTagScope importerScope( TCMemoryTracker::kMemoryTagShaderImporter );
+			importerMemory = TCMemoryTracker::Allocate( 8, TCMemoryTracker::kMemoryTagGeneral );
+		}
+
+		void* graphicsMemory = TCMemoryTracker::Allocate( 8, TCMemoryTracker::kMemoryTagGeneral );
+
+		TCMemoryTracker::Stats graphicsDuring = TCMemoryTracker::GetStats( TCMemoryTracker::kMemoryTagGraphics );
+		TCMemoryTracker::Stats importerDuring = TCMemoryTracker::GetStats( TCMemoryTracker::kMemoryTagShaderImporter );
+
+		operator delete( numbers );
+		TCMemoryTracker::Free( memory );
+		TCMemoryTracker::Free( importerMemory );
+		TCMemoryTracker::Free( graphicsMemory );
+
+		if( graphicsDuring.numLiveAllocations != graphicsBefore.numLiveAllocations + 3 || graphicsDuring.liveBytes < graphicsBefore.liveBytes + sizeof( int ) * 16 + 40 )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCMemoryTracker_UnitTest failed! A scope didn't tag the allocations made inside it.");
+		}
+
+		if( importerDuring.numLiveAllocations != importerBefore.numLiveAllocations + 1 || importerDuring.liveBytes != importerBefore.liveBytes + 8 )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCMemoryTracker_UnitTest failed! A nested scope didn't tag its allocations.");
+		}
+
+		if( TCMemoryTracker::GetStats( TCMemoryTracker::kMemoryTagGraphics ).liveBytes != graphicsBefore.liveBytes )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCMemoryTracker_UnitTest failed! Deleting didn't uncount memory from its tag.");
+		}
+	}
+
+	//
+	// Test that a scope only tags the thread that opened it.
+	//
+
+	{
+		TCMemoryTagScope graphicsScope( TCMemoryTracker::kMemoryTagGraphics );
+		size_t liveBytesDelta = 0;
+
+		std::thread thread( [ &liveBytesDelta ]()
+		{
+			size_t before = TCMemoryTracker::GetStats( TCMemoryTracker::kMemoryTagString ).liveBytes;
+			void* memory = TCMemoryTracker::Allocate( 64, TCMemoryTracker::kMemoryTagString );
+			liveBytesDelta = TCMemoryTracker::GetStats( TCMemoryTracker::kMemoryTagString ).liveBytes - before;
+			TCMemoryTracker::Free( memory );
+		} );
+
+		thread.join();
+		if( liveBytesDelta != 64 )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCMemoryTracker_UnitTest failed! A scope tagged memory allocated on another thread.");
+		}
+	}
+
+	//
+	// Test that memory allocated after the checkpoint and still live is reported, except permanent memory.
+	//
+
+	{
+		TCMemoryTracker::SetLeakCheckpoint();
+		if( TCMemoryTracker::ReportLeaks() != 0 )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCMemoryTracker_UnitTest failed! Leaks were reported right after the checkpoint.");
+		}
+
+		void* leaked = TCMemoryTracker::Allocate( 24, TCMemoryTracker::kMemoryTagCollections );
+
+		void* permanent = NULL;
+		{
+			TCMemoryTagScope permanentScope( TCMemoryTracker::kMemoryTagPermanent );
+			permanent = TCMemoryTracker::Allocate( 24, TCMemoryTracker::kMemoryTagCollections );
+		}
+
+		int numLeaks = TCMemoryTracker::ReportLeaks();
+
+		TCMemoryTracker::Free( leaked );
+		TCMemoryTracker::Free( permanent );
+
+		if( numLeaks != 1 )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCMemoryTracker_UnitTest failed! The leak report counted the wrong allocations.");
+		}
+
+		if( TCMemoryTracker::ReportLeaks() != 0 )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCMemoryTracker_UnitTest failed! Freed memory was still reported as leaked.");
+		}
+	}
+#endif
+
+	return TCUnitTest::TestResult_Success;
+}
@@ -0,0 +1,34 @@
+//
+// TCMemoryTracker_UnitTest.h
+// This file will define the unit test for TCMemoryTracker
+//
+
+#ifndef __TC_MEMORY_TRACKER_UNIT_TEST_H__
+#define __TC_MEMORY_TRACKER_UNIT_TEST_H__
+
+//
+// Includes
+//
+
+#include "TCUnitTest.h"
+#include "TCMemoryTracker.h"
+
+//
+// Defines
+//
+
+//
+// Class Declaration
+//
+
+class TCMemoryTracker_UnitTest : public TCUnitTest
+{
+	public:		// Members
+	public:		// Methods
+		virtual Result StartTest();
+
+	private:	// Members
+	private:	// Methods
+};
+
+#endif // __TC_MEMORY_TRACKER_UNIT_TEST_H__
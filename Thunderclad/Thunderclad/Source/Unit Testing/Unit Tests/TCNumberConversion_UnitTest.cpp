@@ -0,0 +1,303 @@
+//
+// TCNumberConversion_UnitTest.cpp
+// This file will define the unit test for the number parsing and formatting in TCStringUtils.
+//
+
+//
+// Includes
+//
+
+#include "TCNumberConversion_UnitTest.h"
+#include "TCString.h"
+#include "TCStringView.h"
+#include "TCLogger.h"
+#include "TCTestRandom.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+//
+// Defines
+//
+
+#define RETURN_UNIT_TEST_FAILURE( x ) { TCLogger::GetInstance()->LogError( x ); return TCUnitTest::TestResult_Failed; }
+
+#define NUM_RANDOM_VALUES		(200000)
+#define MAX_RANDOM_DIGITS		(30)		// Past the 19 digits the parser keeps, so the halfway check is exercised.
+#define TEST_BUFFER_SIZE		(64)
+
+//
+// FloatBits
+//		- Will give the bits of a float, so -0 and NaN compare the way the tests need.
+//
+
+static unsigned int FloatBits( float value )
+{
+	unsigned int bits;
+	memcpy( &bits, &value, sizeof( bits ) );
+	return bits;
+}
+
+//
+// CountSignificantDigits
+//		- Will count the digits from the first nonzero digit to the last nonzero digit, ignoring any exponent.
+//
+
+static int CountSignificantDigits( const char8* string )
+{
+	int first = -1;
+	int last = -1;
+	int numDigits = 0;
+	for( ; *string != NULL_TERMINATOR && *string != 'e'; ++string )
+	{
+		if( *string < '0' || *string > '9' )
+			continue;
+
+		if( *string != '0' )
+		{
+			first = first < 0 ? numDigits : first;
+			last = numDigits;
+		}
+		numDigits++;
+	}
+
+	return first < 0 ? 0 : last - first + 1;
+}
+
+//
+// StartTest
+//		- This function will run the unit test for this module.
+// Inputs:
+//		- None.
+// Outputs:
+//		- TCUnitTest::Result: The result of the operation.
+//
+
+TCUnitTest::Result TCNumberConversion_UnitTest::StartTest()
+{
+	char8 buffer[ TEST_BUFFER_SIZE ];
+	char8 reference[ TEST_BUFFER_SIZE ];
+	unsigned int seed = 1234;
+
+	//
+	// Test integers against the C library.
+	//
+
+	for( int currentValue = 0; currentValue < NUM_RANDOM_VALUES; ++currentValue )
+	{
+		int value = (int)( ( TCTestRandom::NextLCG( seed ) << 8 ) ^ TCTestRandom::NextLCG( seed ) ) >> ( currentValue % 32 );
+		int length = TCStringUtils::FormatInt( value, buffer );
+		snprintf( reference, TEST_BUFFER_SIZE, "%d", value );
+		if( strcmp( buffer, reference ) != 0 || length != (int)strlen( reference ) )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCNumberConversion_UnitTest failed! FormatInt didn't match the C library.");
+		}
+
+		int parsed = 0;
+		if( TCStringUtils::ParseInt( buffer, length, parsed ) != length || parsed != value )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCNumberConversion_UnitTest failed! ParseInt didn't read back a formatted integer.");
+		}
+	}
+
+	int parsed = 7;
+	if( TCStringUtils::FormatInt( -2147483647 - 1, buffer ) != 11 || strcmp( buffer, "-2147483648" ) != 0 ||
+		TCStringUtils::FormatInt( -1, buffer, 16 ) != 8 || strcmp( buffer, "ffffffff" ) != 0 ||
+		TCStringUtils::FormatInt( -2147483647 - 1, buffer, 2 ) != 32 || TCStringUtils::FormatInt( 35, buffer, 36 ) != 1 || buffer[ 0 ] != 'z' )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCNumberConversion_UnitTest failed! FormatInt wrote an edge case wrong.");
+	}
+
+	if( TCStringUtils::ParseInt( "2147483648", 10, parsed ) != 0 || TCStringUtils::ParseInt( "-2147483649", 11, parsed ) != 0 ||
+		TCStringUtils::ParseInt( "99999999999999999999", 20, parsed ) != 0 || TCStringUtils::ParseInt( "-", 1, parsed ) != 0 ||
+		TCStringUtils::ParseInt( "", 0, parsed ) != 0 || parsed != 7 ||
+		TCStringUtils::ParseInt( "+12x", 4, parsed ) != 3 || parsed != 12 || TCStringUtils::ParseInt( "-2147483648", 11, parsed ) != 11 ||
+		parsed != -2147483647 - 1 || TCStringUtils::ParseInt( "123", 2, parsed ) != 2 || parsed != 12 )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCNumberConversion_UnitTest failed! ParseInt read an edge case wrong.");
+	}
+
+	//
+	// Test that the shortest float text always reads back to the same float, and is never longer than the C library needs.
+	//
+
+	for( int currentValue = 0; currentValue < NUM_RANDOM_VALUES; ++currentValue )
+	{
+		unsigned int bits = ( TCTestRandom::NextLCG( seed ) << 8 ) ^ TCTestRandom::NextLCG( seed );
+		if( ( bits & 0x7F800000 ) == 0x7F800000 )
+			continue;
+
+		float value;
+		memcpy( &value, &bits, sizeof( value ) );
+
+		int length = TCStringUtils::FormatFloat( value, buffer );
+		float parsedFloat = 0.0f;
+		if( length != (int)strlen( buffer ) || FloatBits( strtof( buffer, NULL ) ) != bits ||
+			TCStringUtils::ParseFloat( buffer, length, parsedFloat ) != length || FloatBits( parsedFloat ) != bits )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCNumberConversion_UnitTest failed! FormatFloat didn't read back to the same float.");
+		}
+
+		int shortestDigits = 1;
+		for( ; shortestDigits < 9; ++shortestDigits )
+		{
+			snprintf( reference, TEST_BUFFER_SIZE, "%.*e", shortestDigits - 1, value );
+			if( FloatBits( strtof( reference, NULL ) ) == bits )
+				break;
+		}
+
+		if( CountSignificantDigits( buffer ) > shortestDigits )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCNumberConversion_UnitTest failed! FormatFloat didn't write the shortest text.");
+		}
+	}
+
+	const char8* shortestCases[][ 2 ] =
+	{
+		{ "0.1", "0.1" }, { "100", "100" }, { "-0", "-0" }, { "1e10", "1e+10" }, { "123456789", "123456790" },
+		{ "0.00001", "0.00001" }, { "0.000001", "0.000001" }, { "0.0000001", "1e-7" }, { "3.4028235e38", "3.4028235e+38" }, { "1.4e-45", "1e-45" },
+		{ "-1.5", "-1.5" }, { "1234.5", "1234.5" }, { "Inf", "Inf" }, { "-Inf", "-Inf" }, { "NaN", "NaN" },
+	};
+
+	for( int currentCase = 0; currentCase < (int)( sizeof( shortestCases ) / sizeof( shortestCases[ 0 ] ) ); ++currentCase )
+	{
+		float value = 0.0f;
+		int length = TCStringUtils::Length( shortestCases[ currentCase ][ 0 ] );
+		if( TCStringUtils::ParseFloat( shortestCases[ currentCase ][ 0 ], length, value ) != length ||
+			TCStringUtils::FormatFloat( value, buffer ) != TCStringUtils::Length( shortestCases[ currentCase ][ 1 ] ) ||
+			strcmp( buffer, shortestCases[ currentCase ][ 1 ] ) != 0 )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCNumberConversion_UnitTest failed! FormatFloat wrote a fixed case wrong.");
+		}
+	}
+
+	//
+	// Test fixed precision against the C library, which also rounds the exact value half to even.
+	//
+
+	for( int currentValue = 0; currentValue < NUM_RANDOM_VALUES; ++currentValue )
+	{
+		unsigned int bits = ( ( TCTestRandom::NextLCG( seed ) << 8 ) ^ TCTestRandom::NextLCG( seed ) ) % 0x5E000000;		// Positive and below 2^61.
+		float value;
+		memcpy( &value, &bits, sizeof( value ) );
+
+		int precision = currentValue % 10;
+		if( (double)value * 1e9 >= 9e18 )
+			continue;
+
+		int length = TCStringUtils::FormatFloat( value, precision, buffer );
+		snprintf( reference, TEST_BUFFER_SIZE, "%.*f", precision, value );
+		if( strcmp( buffer, reference ) != 0 || length != (int)strlen( reference ) )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCNumberConversion_UnitTest failed! FormatFloat with a precision didn't match the C library.");
+		}
+	}
+
+	if( TCStringUtils::FormatFloat( -0.001f, 2, buffer ) != 4 || strcmp( buffer, "0.00" ) != 0 ||
+		TCStringUtils::FormatFloat( 0.125f, 2, buffer ) != 4 || strcmp( buffer, "0.12" ) != 0 ||
+		TCStringUtils::FormatFloat( -2.5f, 0, buffer ) != 2 || strcmp( buffer, "-2" ) != 0 ||
+		TCStringUtils::FormatFloat( 1e30f, 2, buffer ) != 5 || strcmp( buffer, "1e+30" ) != 0 )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCNumberConversion_UnitTest failed! FormatFloat with a precision wrote a fixed case wrong.");
+	}
+
+	//
+	// Test parsing random decimal text against the C library, with more digits than fit in 64 bits and exponents
+	// around the edges of the float range.
+	//
+
+	for( int currentValue = 0; currentValue < NUM_RANDOM_VALUES; ++currentValue )
+	{
+		int length = 0;
+		if( TCTestRandom::NextLCG( seed ) % 2 == 0 )
+		{
+			buffer[ length++ ] = '-';
+		}
+
+		int numDigits = 1 + TCTestRandom::NextLCG( seed ) % MAX_RANDOM_DIGITS;
+		int pointPosition = TCTestRandom::NextLCG( seed ) % ( numDigits + 1 );
+		for( int currentDigit = 0; currentDigit < numDigits; ++currentDigit )
+		{
+			if( currentDigit == pointPosition )
+			{
+				buffer[ length++ ] = '.';
+			}
+
+			// Long runs of 0s and 9s land right beside the halfway points.
+			unsigned int digitKind = TCTestRandom::NextLCG( seed ) % 4;
+			buffer[ length++ ] = (char8)( '0' + ( digitKind == 0 ? 0 : ( digitKind == 1 ? 9 : TCTestRandom::NextLCG( seed ) % 10 ) ) );
+		}
+
+		length += snprintf( buffer + length, TEST_BUFFER_SIZE - length, "e%d", (int)( TCTestRandom::NextLCG( seed ) % 110 ) - 70 );
+
+		float value = 0.0f;
+		if( TCStringUtils::ParseFloat( buffer, length, value ) != length || FloatBits( value ) != FloatBits( strtof( buffer, NULL ) ) )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCNumberConversion_UnitTest failed! ParseFloat didn't match the C library.");
+		}
+	}
+
+	const char8* parseCases[] =
+	{
+		"1.00000005960464477539062499", "1.000000059604644775390625", "1.00000005960464477539062500001", "1.000000178813934326171875",
+		"3.4028235e38", "3.40282356779733661637539395458142568448e38", "3.4028236e38", "1e39", "7e-46", "7.1e-46", "1e-50",
+		"1.17549435e-38", "0.0000000000000000000000000000000000000000000014012984643248170709237295832899161312802619418765e0",
+		"123456789012345678901234567890", ".5", "5.", "0e999999999999", "1e-99999999999", "00000000000000000000000000001",
+	};
+
+	for( int currentCase = 0; currentCase < (int)( sizeof( parseCases ) / sizeof( parseCases[ 0 ] ) ); ++currentCase )
+	{
+		float value = 0.0f;
+		int length = TCStringUtils::Length( parseCases[ currentCase ] );
+		if( TCStringUtils::ParseFloat( parseCases[ currentCase ], length, value ) != length ||
+			FloatBits( value ) != FloatBits( strtof( parseCases[ currentCase ], NULL ) ) )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCNumberConversion_UnitTest failed! ParseFloat read a fixed case wrong.");
+		}
+	}
+
+	float value = 2.0f;
+	if( TCStringUtils::ParseFloat( "1.0f", 4, value ) != 4 || value != 1.0f || TCStringUtils::ParseFloat( "2e", 2, value ) != 1 || value != 2.0f ||
+		TCStringUtils::ParseFloat( "3e+x", 4, value ) != 1 || TCStringUtils::ParseFloat( ".", 1, value ) != 0 ||
+		TCStringUtils::ParseFloat( "-", 1, value ) != 0 || TCStringUtils::ParseFloat( "", 0, value ) != 0 || value != 3.0f ||
+		TCStringUtils::ParseFloat( "1.5e3", 3, value ) != 3 || value != 1.5f )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCNumberConversion_UnitTest failed! ParseFloat stopped in the wrong place.");
+	}
+
+	//
+	// Test reading lists.
+	//
+
+	float floats[ 4 ];
+	int ints[ 2 ];
+	if( TCStringUtils::ParseFloatArray( TCStringView( " 1.5, -2 ,3e2f\t" ), ',', floats, 4 ) != 3 || floats[ 0 ] != 1.5f ||
+		floats[ 1 ] != -2.0f || floats[ 2 ] != 300.0f || TCStringUtils::ParseFloatArray( TCStringView( "   " ), ',', floats, 4 ) != 0 ||
+		TCStringUtils::ParseFloatArray( TCStringView( "1,,2" ), ',', floats, 4 ) != -1 ||
+		TCStringUtils::ParseFloatArray( TCStringView( "1,2," ), ',', floats, 4 ) != -1 ||
+		TCStringUtils::ParseFloatArray( TCStringView( "1 2" ), ',', floats, 4 ) != -1 ||
+		TCStringUtils::ParseFloatArray( TCStringView( "1,2,3,4,5" ), ',', floats, 4 ) != 5 || floats[ 3 ] != 4.0f )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCNumberConversion_UnitTest failed! ParseFloatArray read a list wrong.");
+	}
+
+	if( TCStringUtils::ParseIntArray( TCStringView( "4, -5,6" ), ',', ints, 2 ) != 3 || ints[ 0 ] != 4 || ints[ 1 ] != -5 ||
+		TCStringUtils::ParseIntArray( TCStringView( "4,5.5" ), ',', ints, 2 ) != -1 )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCNumberConversion_UnitTest failed! ParseIntArray read a list wrong.");
+	}
+
+	//
+	// Test the TCString wrappers, these only accept text that is entirely a number.
+	//
+
+	if( TCStringUtils::FtoA( 0.1f ) != "0.1" || TCStringUtils::FtoA( 1.5f, 2 ) != "1.50" || TCStringUtils::ItoA( -255, 16 ) != "ffffff01" ||
+		TCStringUtils::AtoF( "1.0f" ) != 1.0f || TCStringUtils::AtoF( "1.0x" ) != 0.0f || TCStringUtils::AtoI( "12a" ) != 0 ||
+		TCStringUtils::AtoI( "-12" ) != -12 || TCString( -42 ) != "-42" || !( TCString( 17 ) == 17 ) )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCNumberConversion_UnitTest failed! A TCString wrapper was wrong.");
+	}
+
+	return TCUnitTest::TestResult_Success;
+}
@@ -0,0 +1,34 @@
+//
+// TCNumberConversion_UnitTest.h
+// This file will define the unit test for the number parsing and formatting in TCStringUtils
+//
+
+#ifndef __TC_NUMBER_CONVERSION_UNIT_TEST_H__
+#define __TC_NUMBER_CONVERSION_UNIT_TEST_H__
+
+//
+// Includes
+//
+
+#include "TCUnitTest.h"
+#include "TCStringUtils.h"
+
+//
+// Defines
+//
+
+//
+// Class Declaration
+//
+
+class TCNumberConversion_UnitTest : public TCUnitTest
+{
+	public:		// Members
+	public:		// Methods
+		virtual Result StartTest();
+
+	private:	// Members
+	private:	// Methods
+};
+
+#endif // __TC_NUMBER_CONVERSION_UNIT_TEST_H__
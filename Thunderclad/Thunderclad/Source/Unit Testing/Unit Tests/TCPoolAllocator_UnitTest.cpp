@@ -0,0 +1,269 @@
+//
+// TCPoolAllocator_UnitTest.cpp
+// This file will define the unit test for the block pool.
+//
+
+//
+// Includes
+//
+
+#include "TCPoolAllocator_UnitTest.h"
+#include "TCList.h"
+#include "TCLogger.h"
+
+#include <string.h>
+#include <thread>
+
+//
+// Defines
+//
+
+#define RETURN_UNIT_TEST_FAILURE( x ) { TCLogger::GetInstance()->LogError( x ); return TCUnitTest::TestResult_Failed; }
+
+#define NUM_TEST_BLOCKS			(1000)
+#define NUM_STRESS_THREADS		(TC_POOL_MAX_THREAD_CACHES + 4)		// More threads than caches, so some share the list.
+#define NUM_STRESS_ROUNDS		(200)
+#define NUM_STRESS_BLOCKS		(50)
+
+//
+// TCPooledTestObject
+//		- An object whose new and delete go through its own pool.
+//
+
+struct TCPooledTestObject : public TCPooledObject< TCPooledTestObject, 8 >
+{
+	int		values[ 5 ];
+};
+
+struct TCPooledTestObjectLarger : public TCPooledTestObject
+{
+	int		moreValues[ 64 ];
+};
+
+//
+// StartTest
+//		- This function will run the unit test for this module.
+// Inputs:
+//		- None.
+// Outputs:
+//		- TCUnitTest::Result: The result of the operation.
+//
+
+TCUnitTest::Result TCPoolAllocator_UnitTest::StartTest()
+{
+	//
+	// Test that blocks are aligned, distinct and recycled.
+	//
+
+	{
+		TCPoolAllocator pool( 20, 64 );
+		if( pool.BlockSize() != 32 || pool.Count() != 0 || pool.Capacity() != 0 )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCPoolAllocator_UnitTest failed! A new pool had the wrong size.");
+		}
+
+		static void* blocks[ NUM_TEST_BLOCKS ];		// Static, they're checked against each other after every allocation.
+		for( int currentBlock = 0; currentBlock < NUM_TEST_BLOCKS; ++currentBlock )
+		{
+			blocks[ currentBlock ] = pool.Allocate();
+			if( blocks[ currentBlock ] == NULL || ( (size_t)blocks[ currentBlock ] & ( TC_POOL_BLOCK_ALIGNMENT - 1 ) ) != 0 || !pool.Owns( blocks[ currentBlock ] ) )
+			{
+				RETURN_UNIT_TEST_FAILURE("TCPoolAllocator_UnitTest failed! A block was missing or misaligned.");
+			}
+
+			memset( blocks[ currentBlock ], currentBlock & 0xFF, pool.BlockSize() );
+		}
+
+		for( int currentBlock = 0; currentBlock < NUM_TEST_BLOCKS; ++currentBlock )
+		{
+			unsigned char* bytes = (unsigned char*)blocks[ currentBlock ];
+			if( bytes[ 0 ] != ( currentBlock & 0xFF ) || bytes[ pool.BlockSize() - 1 ] != ( currentBlock & 0xFF ) )
+			{
+				RETURN_UNIT_TEST_FAILURE("TCPoolAllocator_UnitTest failed! Two blocks overlapped.");
+			}
+		}
+
+		if( pool.Count() != NUM_TEST_BLOCKS || pool.Capacity() < NUM_TEST_BLOCKS || pool.Owns( &pool ) )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCPoolAllocator_UnitTest failed! The pool counted its blocks wrong.");
+		}
+
+		int capacity = pool.Capacity();
+		for( int currentBlock = 0; currentBlock < NUM_TEST_BLOCKS; ++currentBlock )
+		{
+			pool.Free( blocks[ currentBlock ] );
+		}
+
+		for( int currentBlock = 0; currentBlock < NUM_TEST_BLOCKS; ++currentBlock )
+		{
+			blocks[ currentBlock ] = pool.Allocate();
+		}
+
+		if( pool.Capacity() != capacity || pool.Count() != NUM_TEST_BLOCKS )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCPoolAllocator_UnitTest failed! Freed blocks weren't reused.");
+		}
+
+		for( int currentBlock = 0; currentBlock < NUM_TEST_BLOCKS; ++currentBlock )
+		{
+			pool.Free( blocks[ currentBlock ] );
+		}
+
+		pool.Free( NULL );
+		if( pool.Count() != 0 )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCPoolAllocator_UnitTest failed! Freeing every block didn't empty the pool.");
+		}
+	}
+
+	//
+	// Stress test, threads allocate and free at once, some handing their blocks to the next thread to free.
+	//
+
+	{
+		TCPoolAllocator pool( sizeof( int ) * 4, 32 );
+		void* handedOver[ NUM_STRESS_THREADS ][ NUM_STRESS_BLOCKS ];
+		bool corrupted[ NUM_STRESS_THREADS ] = {};
+		std::thread threads[ NUM_STRESS_THREADS ];
+
+		for( int currentThread = 0; currentThread < NUM_STRESS_THREADS; ++currentThread )
+		{
+			threads[ currentThread ] = std::thread( [ &pool, &handedOver, &corrupted, currentThread ]()
+			{
+				void* blocks[ NUM_STRESS_BLOCKS ];
+				for( int currentRound = 0; currentRound < NUM_STRESS_ROUNDS; ++currentRound )
+				{
+					for( int currentBlock = 0; currentBlock < NUM_STRESS_BLOCKS; ++currentBlock )
+					{
+						int* values = (int*)pool.Allocate();
+						values[ 0 ] = currentThread;
+						values[ 3 ] = currentBlock;
+						blocks[ currentBlock ] = values;
+					}
+
+					for( int currentBlock = 0; currentBlock < NUM_STRESS_BLOCKS; ++currentBlock )
+					{
+						int* values = (int*)blocks[ currentBlock ];
+						corrupted[ currentThread ] |= ( values[ 0 ] != currentThread || values[ 3 ] != currentBlock );
+						pool.Free( values );
+					}
+				}
+
+				for( int currentBlock = 0; currentBlock < NUM_STRESS_BLOCKS; ++currentBlock )
+				{
+					handedOver[ currentThread ][ currentBlock ] = pool.Allocate();
+				}
+			} );
+		}
+
+		for( int currentThread = 0; currentThread < NUM_STRESS_THREADS; ++currentThread )
+		{
+			threads[ currentThread ].join();
+			if( corrupted[ currentThread ] )
+			{
+				RETURN_UNIT_TEST_FAILURE("TCPoolAllocator_UnitTest failed! Two threads were handed the same block.");
+			}
+		}
+
+		if( pool.Count() != NUM_STRESS_THREADS * NUM_STRESS_BLOCKS )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCPoolAllocator_UnitTest failed! The threads left the wrong number of blocks.");
+		}
+
+		for( int currentThread = 0; currentThread < NUM_STRESS_THREADS; ++currentThread )
+		{
+			threads[ currentThread ] = std::thread( [ &pool, &handedOver, currentThread ]()
+			{
+				int owner = ( currentThread + 1 ) % NUM_STRESS_THREADS;
+				for( int currentBlock = 0; currentBlock < NUM_STRESS_BLOCKS; ++currentBlock )
+				{
+					pool.Free( handedOver[ owner ][ currentBlock ] );
+				}
+			} );
+		}
+
+		for( int currentThread = 0; currentThread < NUM_STRESS_THREADS; ++currentThread )
+		{
+			threads[ currentThread ].join();
+		}
+
+		if( pool.Count() != 0 )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCPoolAllocator_UnitTest failed! Blocks freed on other threads weren't counted.");
+		}
+	}
+
+	//
+	// Test that a list draws small storage from the pool and large storage from the heap.
+	//
+
+	{
+		TCPoolAllocator pool( sizeof( int ) * 8 );
+		TCPoolBackedAllocator allocator( &pool );
+		TCList< int, TCPoolBackedAllocator > numbers( allocator );
+		numbers.Reserve( 8 );
+		numbers.Append( 1 );
+		if( !pool.Owns( numbers.begin() ) || pool.Count() != 1 )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCPoolAllocator_UnitTest failed! A small list didn't use the pool.");
+		}
+
+		for( int currentNumber = 2; currentNumber <= 100; ++currentNumber )
+		{
+			numbers.Append( currentNumber );
+		}
+
+		if( pool.Owns( numbers.begin() ) || pool.Count() != 0 || numbers[ 99 ] != 100 )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCPoolAllocator_UnitTest failed! A large list didn't move to the heap.");
+		}
+	}
+
+#if TC_MEMORY_TRACKING
+	//
+	// Test that a pool's chunks are counted against its tag.
+	//
+
+	{
+		TCMemoryTracker::Stats before = TCMemoryTracker::GetStats( TCMemoryTracker::kMemoryTagGraphics );
+
+		{
+			TCPoolAllocator pool( 32, 16, TCMemoryTracker::kMemoryTagGraphics );
+			void* block = pool.Allocate();
+			TCMemoryTracker::Stats during = TCMemoryTracker::GetStats( TCMemoryTracker::kMemoryTagGraphics );
+			if( during.numLiveAllocations != before.numLiveAllocations + 1 || during.liveBytes < before.liveBytes + 32 * 16 )
+			{
+				RETURN_UNIT_TEST_FAILURE("TCPoolAllocator_UnitTest failed! A pool's chunk wasn't counted against its tag.");
+			}
+
+			pool.Free( block );
+		}
+
+		TCMemoryTracker::Stats after = TCMemoryTracker::GetStats( TCMemoryTracker::kMemoryTagGraphics );
+		if( after.numLiveAllocations != before.numLiveAllocations || after.liveBytes != before.liveBytes )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCPoolAllocator_UnitTest failed! Destroying a pool didn't uncount its chunks.");
+		}
+	}
+#endif
+
+	//
+	// Test that pooled objects come from their pool, and a larger subclass doesn't.
+	//
+
+	TCPooledTestObject* object = new TCPooledTestObject();
+	TCPooledTestObject* larger = new TCPooledTestObjectLarger();
+	if( !TCPooledTestObject::GetPool().Owns( object ) || TCPooledTestObject::GetPool().Owns( larger ) || TCPooledTestObject::GetPool().Count() != 1 )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCPoolAllocator_UnitTest failed! A pooled object came from the wrong place.");
+	}
+
+	delete object;
+	delete (TCPooledTestObjectLarger*)larger;
+	if( TCPooledTestObject::GetPool().Count() != 0 )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCPoolAllocator_UnitTest failed! Deleting a pooled object didn't free its block.");
+	}
+
+	return TCUnitTest::TestResult_Success;
+}
@@ -0,0 +1,34 @@
+//
+// TCPoolAllocator_UnitTest.h
+// This file will define the unit test for TCPoolAllocator
+//
+
+#ifndef __TC_POOL_ALLOCATOR_UNIT_TEST_H__
+#define __TC_POOL_ALLOCATOR_UNIT_TEST_H__
+
+//
+// Includes
+//
+
+#include "TCUnitTest.h"
+#include "TCPoolAllocator.h"
+
+//
+// Defines
+//
+
+//
+// Class Declaration
+//
+
+class TCPoolAllocator_UnitTest : public TCUnitTest
+{
+	public:		// Members
+	public:		// Methods
+		virtual Result StartTest();
+
+	private:	// Members
+	private:	// Methods
+};
+
+#endif // __TC_POOL_ALLOCATOR_UNIT_TEST_H__
@@ -0,0 +1,205 @@
+//
+// TCRef_UnitTest.cpp
+// This file will define the unit test for TCRef and deferred graphics resource destruction.
+//
+
+//
+// Includes
+//
+
+#include "TCRef_UnitTest.h"
+#include "TCGraphicsContext.h"
+#include "IGraphicsResource.h"
+#include "TCLogger.h"
+
+#include <atomic>
+#include <thread>
+
+//
+// Defines
+//
+
+#define RETURN_UNIT_TEST_FAILURE( x ) { TCLogger::GetInstance()->LogError( x ); return TCUnitTest::TestResult_Failed; }
+
+#define NUM_THREADS				(4)
+#define NUM_COPIES_PER_THREAD	(20000)
+
+//
+// TestContext
+//		- A context with no platform behind it, EndFrame destroys the queued resources.
+//
+
+class TestContext : public TCGraphicsContext
+{
+	public:
+		virtual TCResult	Initialize( Description& desc )		{ return Success; }
+		int					GetNumReferencedResources()			{ return mNumReferencedResources; }
+};
+
+//
+// TestResource
+//		- Counts how many resources have been destroyed, and can hold another resource the way a shader holds its
+//		  constant buffers.
+//
+
+static std::atomic< int > gNumDestroyed( 0 );
+
+class TestResource : public IGraphicsResource
+{
+	public:
+							TestResource( TCGraphicsContext* context ) : IGraphicsResource( context )	{}
+		virtual				~TestResource()																{ ++gNumDestroyed; }
+		virtual TCResult	Release()																	{ return Success; }
+
+		TCRef< TestResource >	mChild;
+};
+
+//
+// StartTest
+//		- This function will run the unit test for this module.
+// Inputs:
+//		- None.
+// Outputs:
+//		- TCUnitTest::Result: The result of the operation.
+//
+
+TCUnitTest::Result TCRef_UnitTest::StartTest()
+{
+	TestContext context;
+	gNumDestroyed = 0;
+
+	//
+	// Test that refs count their copies and the resource waits for the end of the frame.
+	//
+
+	{
+		TestResource* resource = new TestResource( &context );
+		if( resource->GetNumReferences() != 0 )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCRef_UnitTest failed! A new resource started with references.");
+		}
+
+		TCRef< TestResource > first( resource );
+		TCRef< TestResource > second = first;
+		TCRef< IGraphicsResource > base = first;
+		if( resource->GetNumReferences() != 3 || second.Get() != resource || !( first == second ) || context.GetNumReferencedResources() != 1 )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCRef_UnitTest failed! Copying a ref didn't add a reference.");
+		}
+
+		TCRef< TestResource > moved = TCMove( second );
+		if( resource->GetNumReferences() != 3 || second.IsValid() || moved.Get() != resource )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCRef_UnitTest failed! Moving a ref changed the count or left the source holding it.");
+		}
+
+		first = first;
+		first.Reset( resource );
+		moved = TCMove( moved );
+		if( resource->GetNumReferences() != 3 || gNumDestroyed != 0 )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCRef_UnitTest failed! Assigning a ref to itself changed the count.");
+		}
+
+		first.Reset();
+		moved.Reset();
+		base.Reset();
+		if( gNumDestroyed != 0 || context.GetNumReferencedResources() != 0 )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCRef_UnitTest failed! A resource was destroyed before the end of the frame.");
+		}
+
+		context.EndFrame();
+		if( gNumDestroyed != 1 )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCRef_UnitTest failed! The end of the frame didn't destroy the released resource.");
+		}
+
+		context.EndFrame();
+		if( gNumDestroyed != 1 )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCRef_UnitTest failed! A resource was destroyed twice.");
+		}
+	}
+
+	//
+	// Test that a resource holding the last reference to another takes it along in the same frame.
+	//
+
+	{
+		gNumDestroyed = 0;
+
+		TCRef< TestResource > parent = TCMakeRef< TestResource >( &context );
+		parent->mChild = TCMakeRef< TestResource >( &context );
+		parent->mChild->mChild = TCMakeRef< TestResource >( &context );
+
+		TCRef< TestResource > shared = parent->mChild;
+		parent.Reset();
+		context.EndFrame();
+		if( gNumDestroyed != 1 || shared->GetNumReferences() != 1 )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCRef_UnitTest failed! Destroying a resource dropped references it didn't hold alone.");
+		}
+
+		shared.Reset();
+		context.EndFrame();
+		if( gNumDestroyed != 3 )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCRef_UnitTest failed! The end of the frame left resources released by destroyed resources.");
+		}
+	}
+
+	//
+	// Test that copies made and dropped on several threads destroy the resource exactly once.
+	//
+
+	{
+		gNumDestroyed = 0;
+
+		TCRef< TestResource > resource = TCMakeRef< TestResource >( &context );
+		std::thread threads[ NUM_THREADS ];
+
+		for( int currentThread = 0; currentThread < NUM_THREADS; ++currentThread )
+		{
+			TCRef< TestResource > threadRef = resource;
+			threads[ currentThread ] = std::thread( [ threadRef ]()
+			{
+				for( int currentCopy = 0; currentCopy < NUM_COPIES_PER_THREAD; ++currentCopy )
+				{
+					TCRef< TestResource > copy = threadRef;
+					TCRef< TestResource > moved = TCMove( copy );
+				}
+			} );
+		}
+
+		resource.Reset();
+		for( int currentThread = 0; currentThread < NUM_THREADS; ++currentThread )
+		{
+			threads[ currentThread ].join();
+		}
+
+		context.EndFrame();
+		if( gNumDestroyed != 1 )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCRef_UnitTest failed! Refs shared across threads didn't destroy the resource exactly once.");
+		}
+	}
+
+	//
+	// Test that destroying the context destroys what's still queued.
+	//
+
+	{
+		gNumDestroyed = 0;
+
+		TCRef< TestResource > resource = TCMakeRef< TestResource >( &context );
+		resource.Reset();
+		context.Destroy();
+		if( gNumDestroyed != 1 || context.GetNumReferencedResources() != 0 )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCRef_UnitTest failed! Destroying the context left queued resources.");
+		}
+	}
+
+	return TCUnitTest::TestResult_Success;
+}
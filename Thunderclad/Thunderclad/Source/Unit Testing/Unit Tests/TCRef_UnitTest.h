@@ -0,0 +1,34 @@
+//
+// TCRef_UnitTest.h
+// This file will define the unit test for TCRef and deferred graphics resource destruction
+//
+
+#ifndef __TC_REF_UNIT_TEST_H__
+#define __TC_REF_UNIT_TEST_H__
+
+//
+// Includes
+//
+
+#include "TCUnitTest.h"
+#include "TCRef.h"
+
+//
+// Defines
+//
+
+//
+// Class Declaration
+//
+
+class TCRef_UnitTest : public TCUnitTest
+{
+	public:		// Members
+	public:		// Methods
+		virtual Result StartTest();
+
+	private:	// Members
+	private:	// Methods
+};
+
+#endif // __TC_REF_UNIT_TEST_H__
@@ -0,0 +1,190 @@
+//
+// TCSPSCQueue_UnitTest.cpp
+// This file will define the unit test for a single producer, single consumer queue.
+//
+
+//
+// Includes
+//
+
+#include "TCSPSCQueue_UnitTest.h"
+#include "TCLogger.h"
+#include "TCString.h"
+
+#include <thread>
+
+//
+// Defines
+//
+
+#define RETURN_UNIT_TEST_FAILURE( x ) { TCLogger::GetInstance()->LogError( x ); return TCUnitTest::TestResult_Failed; }
+
+#define NUM_STRESS_OBJECTS	(200000)	// Enough objects to wrap a small queue many times while both threads race.
+#define STRESS_BATCH_SIZE	(16)
+
+//
+// StartTest
+//		- This function will run the unit test for this module.
+// Inputs:
+//		- None.
+// Outputs:
+//		- TCUnitTest::Result: The result of the operation.
+//
+
+TCUnitTest::Result TCSPSCQueue_UnitTest::StartTest()
+{
+	//
+	// Test that the capacity is rounded up to a power of two.
+	//
+
+	TCSPSCQueue< int > intQueue( 5 );
+	if( intQueue.Capacity() != 8 || !intQueue.IsEmpty() )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCSPSCQueue_UnitTest failed! The capacity was not rounded up to a power of two.");
+	}
+
+	//
+	// Test push and pop order, and that a full queue refuses objects.
+	//
+
+	for( int currentObject = 0; currentObject < 8; ++currentObject )
+	{
+		if( !intQueue.Push( currentObject ) )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCSPSCQueue_UnitTest failed! Push failed before the queue was full.");
+		}
+	}
+
+	if( intQueue.Push( 8 ) || intQueue.Count() != 8 )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCSPSCQueue_UnitTest failed! A full queue accepted an object.");
+	}
+
+	int value = -1;
+	for( int currentObject = 0; currentObject < 8; ++currentObject )
+	{
+		if( !intQueue.Pop( value ) || value != currentObject )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCSPSCQueue_UnitTest failed! Pop did not return the objects in order.");
+		}
+	}
+
+	value = -1;
+	if( intQueue.Pop( value ) || value != -1 || !intQueue.IsEmpty() )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCSPSCQueue_UnitTest failed! An empty queue returned an object.");
+	}
+
+	//
+	// Test the batch operations, including runs that wrap past the end of the storage.
+	//
+
+	int objects[ 12 ] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 };
+	int results[ 12 ] = {};
+
+	if( intQueue.PushRange( objects, 5 ) != 5 || intQueue.PopRange( results, 3 ) != 3 || results[ 2 ] != 2 )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCSPSCQueue_UnitTest failed! Batch operations provided a wrong count.");
+	}
+
+	// 2 objects are in the queue, so only 6 of these fit.
+	if( intQueue.PushRange( objects + 5, 7 ) != 6 )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCSPSCQueue_UnitTest failed! PushRange did not stop at the capacity.");
+	}
+
+	if( intQueue.PopRange( results, 12 ) != 8 )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCSPSCQueue_UnitTest failed! PopRange did not stop at the end of the queue.");
+	}
+
+	for( int currentObject = 0; currentObject < 8; ++currentObject )
+	{
+		if( results[ currentObject ] != currentObject + 3 )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCSPSCQueue_UnitTest failed! Batch operations did not keep the objects in order.");
+		}
+	}
+
+	//
+	// Test that objects are moved through the queue.
+	//
+
+	TCSPSCQueue< TCString > stringQueue( 4 );
+	TCString message = "render frame";
+	stringQueue.Push( TCMove( message ) );
+
+	TCString received;
+	if( !stringQueue.Pop( received ) || received != "render frame" )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCSPSCQueue_UnitTest failed! A string did not survive the queue.");
+	}
+
+	//
+	// Stress test, one thread pushes while another pops through a small queue.
+	//
+
+	TCSPSCQueue< int > stressQueue( 64 );
+	bool inOrder = true;
+	long long sum = 0;
+
+	std::thread consumer( [ &stressQueue, &inOrder, &sum ]()
+	{
+		int batch[ STRESS_BATCH_SIZE ];
+		int expected = 0;
+		while( expected < NUM_STRESS_OBJECTS )
+		{
+			int numObjects = stressQueue.PopRange( batch, STRESS_BATCH_SIZE );
+			for( int currentObject = 0; currentObject < numObjects; ++currentObject )
+			{
+				inOrder = inOrder && ( batch[ currentObject ] == expected );
+				sum += batch[ currentObject ];
+				expected++;
+			}
+
+			if( numObjects == 0 )
+			{
+				std::this_thread::yield();
+			}
+		}
+	} );
+
+	for( int currentObject = 0; currentObject < NUM_STRESS_OBJECTS; )
+	{
+		// Mix single pushes and batches so both paths race the consumer.
+		if( currentObject % 3 == 0 )
+		{
+			if( stressQueue.Push( currentObject ) )
+			{
+				currentObject++;
+				continue;
+			}
+		}
+		else
+		{
+			int batch[ STRESS_BATCH_SIZE ];
+			int batchSize = 0;
+			while( batchSize < STRESS_BATCH_SIZE && currentObject + batchSize < NUM_STRESS_OBJECTS )
+			{
+				batch[ batchSize ] = currentObject + batchSize;
+				batchSize++;
+			}
+
+			int numPushed = stressQueue.PushRange( batch, batchSize );
+			currentObject += numPushed;
+			if( numPushed > 0 )
+				continue;
+		}
+
+		std::this_thread::yield();
+	}
+
+	consumer.join();
+
+	if( !inOrder || sum != (long long)NUM_STRESS_OBJECTS * ( NUM_STRESS_OBJECTS - 1 ) / 2 || !stressQueue.IsEmpty() )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCSPSCQueue_UnitTest failed! Objects were lost or reordered between threads.");
+	}
+
+	return TCUnitTest::TestResult_Success;
+}
@@ -0,0 +1,34 @@
+//
+// TCSPSCQueue_UnitTest.h
+// This file will define the unit test for TCSPSCQueue
+//
+
+#ifndef __TC_SPSC_QUEUE_UNIT_TEST_H__
+#define __TC_SPSC_QUEUE_UNIT_TEST_H__
+
+//
+// Includes
+//
+
+#include "TCUnitTest.h"
+#include "TCSPSCQueue.h"
+
+//
+// Defines
+//
+
+//
+// Class Declaration
+//
+
+class TCSPSCQueue_UnitTest : public TCUnitTest
+{
+	public:		// Members
+	public:		// Methods
+		virtual Result StartTest();
+
+	private:	// Members
+	private:	// Methods
+};
+
+#endif // __TC_SPSC_QUEUE_UNIT_TEST_H__
@@ -0,0 +1,211 @@
+//
+// TCSlotMap_UnitTest.cpp
+// This file will define the unit test for a slot map.
+//
+
+//
+// Includes
+//
+
+#include "TCSlotMap_UnitTest.h"
+#include "TCLogger.h"
+#include "TCString.h"
+
+//
+// Defines
+//
+
+#define RETURN_UNIT_TEST_FAILURE( x ) { TCLogger::GetInstance()->LogError( x ); return TCUnitTest::TestResult_Failed; }
+
+#define NUM_STRESS_OBJECTS	(5000)
+
+//
+// StartTest
+//		- This function will run the unit test for this module.
+// Inputs:
+//		- None.
+// Outputs:
+//		- TCUnitTest::Result: The result of the operation.
+//
+
+TCUnitTest::Result TCSlotMap_UnitTest::StartTest()
+{
+	//
+	// Test basic addition and lookup.
+	//
+
+	TCSlotMap< TCString > stringMap;
+	unsigned int shader		= stringMap.Add( "shader" );
+	unsigned int buffer		= stringMap.Add( "buffer" );
+	unsigned int uniform	= stringMap.Emplace( "uniform" );
+
+	if( shader == TCSlotMap< TCString >::InvalidHandle || stringMap.Count() != 3 )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCSlotMap_UnitTest failed! Add provided a wrong handle or count.");
+	}
+
+	if( stringMap.Get( shader ) == NULL || *stringMap.Get( shader ) != "shader" || *stringMap.Get( uniform ) != "uniform" )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCSlotMap_UnitTest failed! Get provided a wrong object.");
+	}
+
+	if( stringMap.Get( TCSlotMap< TCString >::InvalidHandle ) != NULL || stringMap.Contains( 12345 ) )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCSlotMap_UnitTest failed! An invalid handle found an object.");
+	}
+
+	//
+	// Test that removing makes the handle stale and leaves the other handles working after the objects move.
+	//
+
+	if( !stringMap.Remove( shader ) || stringMap.Remove( shader ) )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCSlotMap_UnitTest failed! Remove provided a wrong result.");
+	}
+
+	if( stringMap.Get( shader ) != NULL || stringMap.Contains( shader ) || stringMap.Count() != 2 )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCSlotMap_UnitTest failed! A removed handle still found an object.");
+	}
+
+	if( *stringMap.Get( buffer ) != "buffer" || *stringMap.Get( uniform ) != "uniform" )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCSlotMap_UnitTest failed! A moved object could not be found.");
+	}
+
+	//
+	// Test that a reused slot doesn't bring a stale handle back to life.
+	//
+
+	unsigned int texture = stringMap.Add( "texture" );
+	if( ( texture & 0xFFFFF ) != ( shader & 0xFFFFF ) || texture == shader )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCSlotMap_UnitTest failed! A free slot was not reused with a new generation.");
+	}
+
+	if( stringMap.Get( shader ) != NULL || *stringMap.Get( texture ) != "texture" )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCSlotMap_UnitTest failed! A stale handle found the object in its reused slot.");
+	}
+
+	//
+	// Test dense iteration and getting handles back from dense indices.
+	//
+
+	int numVisited = 0;
+	for( TCString& string : stringMap )
+	{
+		numVisited += ( string == "buffer" || string == "uniform" || string == "texture" ) ? 1 : 0;
+	}
+
+	if( numVisited != 3 )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCSlotMap_UnitTest failed! Iteration did not visit every object.");
+	}
+
+	for( int currentObject = 0; currentObject < stringMap.Count(); ++currentObject )
+	{
+		if( stringMap.Get( stringMap.GetHandle( currentObject ) ) != &stringMap[ currentObject ] )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCSlotMap_UnitTest failed! GetHandle provided a wrong handle.");
+		}
+	}
+
+	//
+	// Test that clearing makes every handle stale.
+	//
+
+	stringMap.Clear();
+	if( stringMap.Count() != 0 || stringMap.Contains( buffer ) || stringMap.Contains( texture ) || stringMap.begin() != stringMap.end() )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCSlotMap_UnitTest failed! Clear did not empty the slot map.");
+	}
+
+	//
+	// Stress test with 64 bit handles, remove every third object and check every handle.
+	//
+
+	TCSlotMap< int, unsigned long long > stressMap;
+	TCList< unsigned long long > handles;
+	for( int currentObject = 0; currentObject < NUM_STRESS_OBJECTS; ++currentObject )
+	{
+		handles.Append( stressMap.Add( currentObject ) );
+	}
+
+	for( int currentObject = 0; currentObject < NUM_STRESS_OBJECTS; currentObject += 3 )
+	{
+		stressMap.Remove( handles[ currentObject ] );
+	}
+
+	for( int currentObject = 0; currentObject < NUM_STRESS_OBJECTS; ++currentObject )
+	{
+		int* value = stressMap.Get( handles[ currentObject ] );
+		bool removed = ( currentObject % 3 == 0 );
+		if( ( value == NULL ) != removed || ( value != NULL && *value != currentObject ) )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCSlotMap_UnitTest failed! stressMap provided a wrong output after removal.");
+		}
+	}
+
+	long long sum = 0;
+	for( int& value : stressMap )
+	{
+		sum += value;
+	}
+
+	long long expectedSum = 0;
+	for( int currentObject = 0; currentObject < NUM_STRESS_OBJECTS; ++currentObject )
+	{
+		expectedSum += ( currentObject % 3 == 0 ) ? 0 : currentObject;
+	}
+
+	if( sum != expectedSum || stressMap.Count() != NUM_STRESS_OBJECTS - ( NUM_STRESS_OBJECTS + 2 ) / 3 )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCSlotMap_UnitTest failed! stressMap iteration visited the wrong objects.");
+	}
+
+	//
+	// Test that a slot's generation wraps without ever producing the null handle.
+	//
+
+	TCSlotMap< int > reuseMap;
+	unsigned int firstHandle = reuseMap.Add( 0 );
+	unsigned int handle = firstHandle;
+	for( int currentReuse = 0; currentReuse < 5000; ++currentReuse )
+	{
+		reuseMap.Remove( handle );
+		handle = reuseMap.Add( currentReuse );
+		if( handle == TCSlotMap< int >::InvalidHandle || *reuseMap.Get( handle ) != currentReuse )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCSlotMap_UnitTest failed! Reusing a slot produced an invalid handle.");
+		}
+	}
+
+	//
+	// Test that a stale handle doesn't find a free slot whose generation has wrapped back around to it.
+	//
+
+	TCSlotMap< int > wrapMap;
+	unsigned int staleHandle = wrapMap.Add( 1 );
+	unsigned int keptHandle = wrapMap.Add( 2 );
+	wrapMap.Remove( staleHandle );
+
+	// The removal moved the generation on once, this many more reuses bring it back to the stale handle's generation.
+	const int numReusesToWrap = ( 1 << TCSlotHandleTraits< unsigned int >::GenerationBits ) - 2;
+	for( int currentReuse = 0; currentReuse < numReusesToWrap; ++currentReuse )
+	{
+		wrapMap.Remove( wrapMap.Add( 3 ) );
+	}
+
+	if( wrapMap.Contains( staleHandle ) || wrapMap.Get( staleHandle ) != NULL || wrapMap.Remove( staleHandle ) )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCSlotMap_UnitTest failed! A stale handle found a free slot after its generation wrapped.");
+	}
+
+	if( wrapMap.Count() != 1 || wrapMap.Get( keptHandle ) == NULL || *wrapMap.Get( keptHandle ) != 2 || wrapMap.Add( 4 ) != staleHandle )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCSlotMap_UnitTest failed! The free slot's generation didn't wrap, or the other object was lost.");
+	}
+
+	return TCUnitTest::TestResult_Success;
+}
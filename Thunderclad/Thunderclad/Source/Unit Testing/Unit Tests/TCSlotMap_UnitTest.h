@@ -0,0 +1,34 @@
+//
+// TCSlotMap_UnitTest.h
+// This file will define the unit test for TCSlotMap
+//
+
+#ifndef __TC_SLOT_MAP_UNIT_TEST_H__
+#define __TC_SLOT_MAP_UNIT_TEST_H__
+
+//
+// Includes
+//
+
+#include "TCUnitTest.h"
+#include "TCSlotMap.h"
+
+//
+// Defines
+//
+
+//
+// Class Declaration
+//
+
+class TCSlotMap_UnitTest : public TCUnitTest
+{
+	public:		// Members
+	public:		// Methods
+		virtual Result StartTest();
+
+	private:	// Members
+	private:	// Methods
+};
+
+#endif // __TC_SLOT_MAP_UNIT_TEST_H__
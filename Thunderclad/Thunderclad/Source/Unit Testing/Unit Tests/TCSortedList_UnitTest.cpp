@@ -0,0 +1,220 @@
+//
+// TCSortedList_UnitTest.cpp
+// This file will define the unit test for a sorted list.
+//
+
+//
+// Includes
+//
+
+#include "TCSortedList_UnitTest.h"
+#include "TCLogger.h"
+#include "TCString.h"
+
+#include <algorithm>
+
+//
+// Defines
+//
+
+#define RETURN_UNIT_TEST_FAILURE( x ) { TCLogger::GetInstance()->LogError( x ); return TCUnitTest::TestResult_Failed; }
+
+#define NUM_STRESS_OBJECTS	(4096)	// Enough objects to need several merge passes.
+#define STRESS_STRIDE		(1237)	// Coprime to NUM_STRESS_OBJECTS, so multiplying by it scrambles the order.
+
+//
+// Stable Test Object
+//		- Orders by key only, so objects with the same key show whether their order was kept.
+//
+
+struct TCSortedList_StableObject
+{
+	int key;
+	int order;
+
+	bool operator<( const TCSortedList_StableObject& rhs ) const { return key < rhs.key; }
+};
+
+//
+// StartTest
+//		- This function will run the unit test for this module.
+// Inputs:
+//		- None.
+// Outputs:
+//		- TCUnitTest::Result: The result of the operation.
+//
+
+TCUnitTest::Result TCSortedList_UnitTest::StartTest()
+{
+	//
+	// Test that adding keeps the objects in order.
+	//
+
+	TCSortedList< int > intList;
+	intList.Add( 5 );
+	intList.Add( -2 );
+	intList.Add( 9 );
+	intList.Add( 5 );
+	intList.Add( 0 );
+
+	const int expectedInts[] = { -2, 0, 5, 5, 9 };
+	if( intList.Count() != 5 || !std::equal( intList.begin(), intList.end(), expectedInts ) )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCSortedList_UnitTest failed! Add did not keep the list in order.");
+	}
+
+	//
+	// Test the binary searches.
+	//
+
+	if( intList.Find( 5 ) != 2 || intList.Find( 4 ) != -1 || intList.Find( 10 ) != -1 )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCSortedList_UnitTest failed! Find provided a wrong index.");
+	}
+
+	if( intList.LowerBound( 5 ) != 2 || intList.UpperBound( 5 ) != 4 || intList.LowerBound( -10 ) != 0 || intList.UpperBound( 100 ) != 5 )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCSortedList_UnitTest failed! LowerBound or UpperBound provided a wrong index.");
+	}
+
+	if( !intList.Contains( -2 ) || intList.Contains( 1 ) )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCSortedList_UnitTest failed! Contains provided a wrong output.");
+	}
+
+	//
+	// Test removal.
+	//
+
+	intList.Remove( 5 );
+	intList.Remove( 42 );
+	intList.RemoveAt( 0 );
+
+	const int expectedAfterRemove[] = { 0, 5, 9 };
+	if( intList.Count() != 3 || !std::equal( intList.begin(), intList.end(), expectedAfterRemove ) )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCSortedList_UnitTest failed! Remove left the list in a wrong state.");
+	}
+
+	//
+	// Test that strings order by their characters.
+	//
+
+	TCSortedList< TCString > stringList;
+	stringList.Add( "pear" );
+	stringList.Add( "apple" );
+	stringList.Add( "" );
+	stringList.Add( "banana" );
+
+	if( stringList[ 0 ] != "" || stringList[ 1 ] != "apple" || stringList[ 2 ] != "banana" || stringList[ 3 ] != "pear" )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCSortedList_UnitTest failed! Strings were not ordered by their characters.");
+	}
+
+	if( stringList.Find( "banana" ) != 2 || stringList.Contains( "cherry" ) )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCSortedList_UnitTest failed! String search provided a wrong output.");
+	}
+
+	//
+	// Test a large bulk add, it is sorted and merged instead of added one at a time.
+	//
+
+	TCList< int > scrambled;
+	for( int currentObject = 0; currentObject < NUM_STRESS_OBJECTS; ++currentObject )
+	{
+		scrambled.Append( ( currentObject * STRESS_STRIDE ) % NUM_STRESS_OBJECTS );
+	}
+
+	TCSortedList< int > stressList;
+	stressList.Add( NUM_STRESS_OBJECTS / 2 );
+	stressList.AddRange( scrambled.begin(), scrambled.Count() );
+
+	if( stressList.Count() != NUM_STRESS_OBJECTS + 1 || !std::is_sorted( stressList.begin(), stressList.end() ) )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCSortedList_UnitTest failed! AddRange did not keep the list in order.");
+	}
+
+	for( int currentObject = 0; currentObject < NUM_STRESS_OBJECTS; ++currentObject )
+	{
+		int expectedIndex = ( currentObject <= NUM_STRESS_OBJECTS / 2 ) ? currentObject : currentObject + 1;
+		if( stressList.Find( currentObject ) != expectedIndex )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCSortedList_UnitTest failed! An object added by AddRange was not found.");
+		}
+	}
+
+	//
+	// Test a range removal, everything from 1000 up to but not including 2000.
+	//
+
+	int first = stressList.LowerBound( 1000 );
+	int last = stressList.LowerBound( 2000 );
+	stressList.RemoveRange( first, last - first );
+
+	if( stressList.Count() != NUM_STRESS_OBJECTS + 1 - 1000 || stressList.Contains( 1500 ) || !stressList.Contains( 999 ) || !stressList.Contains( 2000 ) )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCSortedList_UnitTest failed! RemoveRange removed the wrong objects.");
+	}
+
+	//
+	// Test that objects with the same key keep the order they were added in, one at a time, in bulk and when merged.
+	//
+
+	TCList< TCSortedList_StableObject > stableObjects;
+	for( int currentObject = 0; currentObject < NUM_STRESS_OBJECTS; ++currentObject )
+	{
+		TCSortedList_StableObject object = { ( currentObject * STRESS_STRIDE ) % 16, currentObject };
+		stableObjects.Append( object );
+	}
+
+	TCSortedList< TCSortedList_StableObject > stableList;
+	for( int currentObject = 0; currentObject < 32; ++currentObject )
+	{
+		stableList.Add( stableObjects[ currentObject ] );
+	}
+
+	stableList.AddRange( stableObjects.begin() + 32, stableObjects.Count() - 32 );
+
+	TCSortedList< TCSortedList_StableObject > otherList;
+	for( int currentObject = 0; currentObject < 16; ++currentObject )
+	{
+		TCSortedList_StableObject object = { currentObject, NUM_STRESS_OBJECTS + currentObject };
+		otherList.Add( object );
+	}
+
+	stableList.Merge( otherList );
+
+	if( stableList.Count() != NUM_STRESS_OBJECTS + 16 || otherList.Count() != 16 )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCSortedList_UnitTest failed! Merge provided a wrong count.");
+	}
+
+	for( int currentObject = 1; currentObject < stableList.Count(); ++currentObject )
+	{
+		const TCSortedList_StableObject& previous = stableList[ currentObject - 1 ];
+		const TCSortedList_StableObject& current = stableList[ currentObject ];
+		if( previous.key > current.key || ( previous.key == current.key && previous.order > current.order ) )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCSortedList_UnitTest failed! Equal objects did not keep the order they were added in.");
+		}
+	}
+
+	//
+	// Test merging a list with itself.
+	//
+
+	otherList.Merge( otherList );
+	if( otherList.Count() != 32 || !std::is_sorted( otherList.begin(), otherList.end() ) )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCSortedList_UnitTest failed! Merging a list with itself failed.");
+	}
+
+	stressList.Clear();
+	if( stressList.Count() != 0 || stressList.begin() != stressList.end() )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCSortedList_UnitTest failed! Clear did not empty the list.");
+	}
+
+	return TCUnitTest::TestResult_Success;
+}
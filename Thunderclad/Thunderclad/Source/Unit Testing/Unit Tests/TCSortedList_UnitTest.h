@@ -0,0 +1,34 @@
+//
+// TCSortedList_UnitTest.h
+// This file will define the unit test for TCSortedList
+//
+
+#ifndef __TC_SORTED_LIST_UNIT_TEST_H__
+#define __TC_SORTED_LIST_UNIT_TEST_H__
+
+//
+// Includes
+//
+
+#include "TCUnitTest.h"
+#include "TCSortedList.h"
+
+//
+// Defines
+//
+
+//
+// Class Declaration
+//
+
+class TCSortedList_UnitTest : public TCUnitTest
+{
+	public:		// Members
+	public:		// Methods
+		virtual Result StartTest();
+
+	private:	// Members
+	private:	// Methods
+};
+
+#endif // __TC_SORTED_LIST_UNIT_TEST_H__
@@ -0,0 +1,184 @@
+//
+// TCStringAtom_UnitTest.cpp
+// This file will define the unit test for interned strings.
+//
+
+//
+// Includes
+//
+
+#include "TCStringAtom_UnitTest.h"
+#include "TCString.h"
+#include "TCLogger.h"
+
+#include <string.h>
+#include <thread>
+
+//
+// Defines
+//
+
+#define RETURN_UNIT_TEST_FAILURE( x ) { TCLogger::GetInstance()->LogError( x ); return TCUnitTest::TestResult_Failed; }
+
+#define NUM_STRESS_ATOMS	(5000)		// Enough to grow the table several times and fill more than one chunk.
+#define NUM_STRESS_THREADS	(4)
+
+//
+// StartTest
+//		- This function will run the unit test for this module.
+// Inputs:
+//		- None.
+// Outputs:
+//		- TCUnitTest::Result: The result of the operation.
+//
+
+TCUnitTest::Result TCStringAtom_UnitTest::StartTest()
+{
+	//
+	// Test that the empty string is the default atom.
+	//
+
+	TCStringAtom empty;
+	if( !empty.IsEmpty() || empty != TCStringAtom( "" ) || empty.Length() != 0 || strcmp( empty.Data(), "" ) != 0 )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCStringAtom_UnitTest failed! The empty atom was wrong.");
+	}
+
+	//
+	// Test that the same characters always give the same atom, wherever they come from.
+	//
+
+	TCString name = "TCStringAtom_UnitTest.worldMatrix";
+	TCStringAtom fromString( name );
+	TCStringAtom fromLiteral( "TCStringAtom_UnitTest.worldMatrix" );
+	TCStringAtom fromView( TCStringView( "TCStringAtom_UnitTest.worldMatrix.extra", name.Length() ) );
+	if( fromString.IsEmpty() || fromString != fromLiteral || fromString != fromView || fromString.GetId() != fromView.GetId() )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCStringAtom_UnitTest failed! The same string gave different atoms.");
+	}
+
+	if( fromString.Data() == name.Data() || strcmp( fromString.Data(), name.Data() ) != 0 || fromString.Length() != name.Length() ||
+		fromString.View() != name )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCStringAtom_UnitTest failed! The atom didn't keep its own copy of the characters.");
+	}
+
+	TCStringAtom other( "TCStringAtom_UnitTest.worldMatrix2" );
+	if( other == fromString || !( fromString < other ) )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCStringAtom_UnitTest failed! Different strings gave the same atom.");
+	}
+
+	//
+	// Test that finding a string never interns it.
+	//
+
+	int count = TCStringAtom::Count();
+	if( TCStringAtom::Find( name ) != fromString || !TCStringAtom::Find( "TCStringAtom_UnitTest.neverInterned" ).IsEmpty() ||
+		TCStringAtom::Count() != count )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCStringAtom_UnitTest failed! Find provided the wrong atom.");
+	}
+
+	//
+	// Test the compile time hash, it has to match the run time hash to be usable for lookups and case labels.
+	//
+
+	unsigned int hash = TC_STRING_HASH( "TCStringAtom_UnitTest.worldMatrix" );
+	if( hash != TCStringAtom::Hash( name ) || hash != fromString.GetHash() || TC_STRING_HASH( "" ) != empty.GetHash() )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCStringAtom_UnitTest failed! The compile time hash didn't match the run time hash.");
+	}
+
+#if TC_HAS_CONSTEXPR
+	switch( TCStringAtom::Hash( "b" ) )
+	{
+		case TC_STRING_HASH( "a" ):
+			RETURN_UNIT_TEST_FAILURE("TCStringAtom_UnitTest failed! A hash matched the wrong case label.");
+		case TC_STRING_HASH( "b" ):
+			break;
+		default:
+			RETURN_UNIT_TEST_FAILURE("TCStringAtom_UnitTest failed! A hash didn't match its case label.");
+	}
+#endif
+
+	for( int currentRun = 0; currentRun < 2; ++currentRun )
+	{
+		if( TC_STRING_ATOM( "TCStringAtom_UnitTest.worldMatrix" ) != fromString )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCStringAtom_UnitTest failed! TC_STRING_ATOM gave the wrong atom.");
+		}
+	}
+
+	//
+	// Test interning enough strings to grow the table, every earlier atom has to keep its id and characters.
+	//
+
+	TCList< TCStringAtom > atoms;
+	for( int currentAtom = 0; currentAtom < NUM_STRESS_ATOMS; ++currentAtom )
+	{
+		TCString atomName = TCString( "TCStringAtom_UnitTest.stress" ) + TCStringUtils::ItoA( currentAtom );
+		atoms.Append( TCStringAtom( atomName ) );
+	}
+
+	for( int currentAtom = 0; currentAtom < NUM_STRESS_ATOMS; ++currentAtom )
+	{
+		TCString atomName = TCString( "TCStringAtom_UnitTest.stress" ) + TCStringUtils::ItoA( currentAtom );
+		if( TCStringAtom::Find( atomName ) != atoms[ currentAtom ] || !atomName.Equal( atoms[ currentAtom ].Data() ) )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCStringAtom_UnitTest failed! An atom changed after the table grew.");
+		}
+	}
+
+	TCString longName;
+	for( int currentChar = 0; currentChar < 10000; ++currentChar )
+	{
+		longName += (char8)( 'a' + currentChar % 26 );
+	}
+
+	TCStringAtom longAtom( longName );
+	if( longAtom.Length() != longName.Length() || !longName.Equal( longAtom.Data() ) || TCStringAtom( longName ) != longAtom )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCStringAtom_UnitTest failed! A long string wasn't interned correctly.");
+	}
+
+	//
+	// Stress test, several threads intern the same new names at once and must all agree on every id.
+	//
+
+	TCList< TCStringAtom > threadAtoms[ NUM_STRESS_THREADS ];
+	std::thread threads[ NUM_STRESS_THREADS ];
+	for( int currentThread = 0; currentThread < NUM_STRESS_THREADS; ++currentThread )
+	{
+		threads[ currentThread ] = std::thread( [ &threadAtoms, currentThread ]()
+		{
+			for( int currentAtom = 0; currentAtom < NUM_STRESS_ATOMS; ++currentAtom )
+			{
+				// Each thread starts at a different name so they collide on different entries.
+				int atomIndex = ( currentAtom + currentThread * NUM_STRESS_ATOMS / NUM_STRESS_THREADS ) % NUM_STRESS_ATOMS;
+				TCString atomName = TCString( "TCStringAtom_UnitTest.thread" ) + TCStringUtils::ItoA( atomIndex );
+				threadAtoms[ currentThread ].Append( TCStringAtom( atomName ) );
+			}
+		} );
+	}
+
+	for( int currentThread = 0; currentThread < NUM_STRESS_THREADS; ++currentThread )
+	{
+		threads[ currentThread ].join();
+	}
+
+	for( int currentThread = 0; currentThread < NUM_STRESS_THREADS; ++currentThread )
+	{
+		for( int currentAtom = 0; currentAtom < NUM_STRESS_ATOMS; ++currentAtom )
+		{
+			int atomIndex = ( currentAtom + currentThread * NUM_STRESS_ATOMS / NUM_STRESS_THREADS ) % NUM_STRESS_ATOMS;
+			TCString atomName = TCString( "TCStringAtom_UnitTest.thread" ) + TCStringUtils::ItoA( atomIndex );
+			if( TCStringAtom::Find( atomName ) != threadAtoms[ currentThread ][ currentAtom ] )
+			{
+				RETURN_UNIT_TEST_FAILURE("TCStringAtom_UnitTest failed! Threads interning at once disagreed on an atom.");
+			}
+		}
+	}
+
+	return TCUnitTest::TestResult_Success;
+}
@@ -0,0 +1,34 @@
+//
+// TCStringAtom_UnitTest.h
+// This file will define the unit test for TCStringAtom
+//
+
+#ifndef __TC_STRING_ATOM_UNIT_TEST_H__
+#define __TC_STRING_ATOM_UNIT_TEST_H__
+
+//
+// Includes
+//
+
+#include "TCUnitTest.h"
+#include "TCStringAtom.h"
+
+//
+// Defines
+//
+
+//
+// Class Declaration
+//
+
+class TCStringAtom_UnitTest : public TCUnitTest
+{
+	public:		// Members
+	public:		// Methods
+		virtual Result StartTest();
+
+	private:	// Members
+	private:	// Methods
+};
+
+#endif // __TC_STRING_ATOM_UNIT_TEST_H__
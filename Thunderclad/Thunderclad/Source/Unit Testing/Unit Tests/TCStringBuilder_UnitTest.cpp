@@ -0,0 +1,149 @@
+//
+// TCStringBuilder_UnitTest.cpp
+// This file will define the unit test for a string builder and the growth of TCString.
+//
+
+//
+// Includes
+//
+
+#include "TCStringBuilder_UnitTest.h"
+#include "TCLogger.h"
+
+#include <string.h>
+
+//
+// Defines
+//
+
+#define RETURN_UNIT_TEST_FAILURE( x ) { TCLogger::GetInstance()->LogError( x ); return TCUnitTest::TestResult_Failed; }
+
+#define NUM_STRESS_APPENDS	(10000)
+
+//
+// StartTest
+//		- This function will run the unit test for this module.
+// Inputs:
+//		- None.
+// Outputs:
+//		- TCUnitTest::Result: The result of the operation.
+//
+
+TCUnitTest::Result TCStringBuilder_UnitTest::StartTest()
+{
+	//
+	// Test chaining the different kinds of pieces.
+	//
+
+	TCStringBuilder builder;
+	if( !builder.IsEmpty() || builder.Length() != 0 || strcmp( builder.Data(), "" ) != 0 )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCStringBuilder_UnitTest failed! A new builder wasn't empty.");
+	}
+
+	builder.Append( "Frame " ).Append( 42 ).Append( ' ' ).Append( TCString( "took" ) ).Append( " " ).Append( -7 ).Append( "ms", 1 );
+	if( builder.Length() != 17 || strcmp( builder.Data(), "Frame 42 took -7m" ) != 0 )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCStringBuilder_UnitTest failed! Appending pieces built the wrong text.");
+	}
+
+	builder.Append( (const char8*)NULL ).Append( "" );
+	TCString built = builder.ToString();
+	if( built.Length() != builder.Length() || !built.Equal( builder.Data() ) )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCStringBuilder_UnitTest failed! ToString provided the wrong string.");
+	}
+
+	//
+	// Test growing past the inline buffer, then reusing the buffer after Clear.
+	//
+
+	builder.Clear();
+	for( int currentAppend = 0; currentAppend < NUM_STRESS_APPENDS; ++currentAppend )
+	{
+		builder.Append( (char8)( 'a' + currentAppend % 26 ) );
+	}
+
+	if( builder.Length() != NUM_STRESS_APPENDS || builder.Data()[ 26 ] != 'a' || builder.Data()[ NUM_STRESS_APPENDS - 1 ] != 'a' + ( NUM_STRESS_APPENDS - 1 ) % 26 )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCStringBuilder_UnitTest failed! Growing the builder lost characters.");
+	}
+
+	unsigned int grownCapacity = builder.Capacity();
+	builder.Clear();
+	builder.Append( "reused" );
+	if( builder.Capacity() != grownCapacity || strcmp( builder.Data(), "reused" ) != 0 )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCStringBuilder_UnitTest failed! Clear didn't keep the buffer.");
+	}
+
+	builder.ToString( built );
+	if( !built.Equal( "reused" ) )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCStringBuilder_UnitTest failed! ToString into a string failed.");
+	}
+
+	//
+	// Test appending the builder's own characters while it grows, from the inline buffer and from the heap.
+	//
+
+	TCStringBuilder selfBuilder;
+	selfBuilder.Append( "abc" );
+	while( selfBuilder.Length() < 300 )
+	{
+		selfBuilder.Append( selfBuilder.Data() + 1, selfBuilder.Length() - 1 );
+	}
+
+	for( int currentAppend = 0; currentAppend < 4; ++currentAppend )
+	{
+		unsigned int length = selfBuilder.Length();
+		selfBuilder.Append( selfBuilder.Data(), length );
+		if( selfBuilder.Length() != length * 2 || memcmp( selfBuilder.Data(), selfBuilder.Data() + length, length ) != 0 )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCStringBuilder_UnitTest failed! Appending the builder to itself lost characters.");
+		}
+	}
+
+	TCStringBuilder reservedBuilder( 1000 );
+	if( reservedBuilder.Capacity() < 1000 )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCStringBuilder_UnitTest failed! The builder didn't reserve its capacity.");
+	}
+
+	//
+	// Test that appending to a TCString grows its capacity geometrically.
+	//
+
+	TCString appended;
+	int numGrowths = 0;
+	unsigned int previousCapacity = appended.Capacity();
+	for( int currentAppend = 0; currentAppend < NUM_STRESS_APPENDS; ++currentAppend )
+	{
+		appended += 'x';
+		if( appended.Capacity() != previousCapacity )
+		{
+			numGrowths++;
+			previousCapacity = appended.Capacity();
+		}
+	}
+
+	if( appended.Length() != NUM_STRESS_APPENDS || numGrowths > 20 )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCStringBuilder_UnitTest failed! TCString reallocated too often while appending.");
+	}
+
+	TCString reserved;
+	reserved.Reserve( 500 );
+	unsigned int reservedCapacity = reserved.Capacity();
+	for( int currentAppend = 0; currentAppend < 500; ++currentAppend )
+	{
+		reserved += 'y';
+	}
+
+	if( reservedCapacity < 500 || reserved.Capacity() != reservedCapacity )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCStringBuilder_UnitTest failed! TCString reallocated after reserving.");
+	}
+
+	return TCUnitTest::TestResult_Success;
+}
@@ -0,0 +1,34 @@
+//
+// TCStringBuilder_UnitTest.h
+// This file will define the unit test for TCStringBuilder
+//
+
+#ifndef __TC_STRING_BUILDER_UNIT_TEST_H__
+#define __TC_STRING_BUILDER_UNIT_TEST_H__
+
+//
+// Includes
+//
+
+#include "TCUnitTest.h"
+#include "TCStringBuilder.h"
+
+//
+// Defines
+//
+
+//
+// Class Declaration
+//
+
+class TCStringBuilder_UnitTest : public TCUnitTest
+{
+	public:		// Members
+	public:		// Methods
+		virtual Result StartTest();
+
+	private:	// Members
+	private:	// Methods
+};
+
+#endif // __TC_STRING_BUILDER_UNIT_TEST_H__
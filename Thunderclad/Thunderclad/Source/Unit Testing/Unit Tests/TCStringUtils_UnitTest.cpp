@@ -0,0 +1,210 @@
+//
+// TCStringUtils_UnitTest.cpp
+// This file will define the unit test for the string scanning utilities.
+//
+
+//
+// Includes
+//
+
+#include "TCStringUtils_UnitTest.h"
+#include "TCLogger.h"
+#include "TCTestRandom.h"
+
+#include <string.h>
+
+//
+// Defines
+//
+
+#define RETURN_UNIT_TEST_FAILURE( x ) { TCLogger::GetInstance()->LogError( x ); return TCUnitTest::TestResult_Failed; }
+
+#define NUM_TEST_STRINGS		(500)
+#define MAX_TEST_LENGTH			(150)	// Long enough for several AVX2 blocks and a tail.
+#define TEST_BUFFER_SIZE		(8192)
+
+//
+// RandomCharacter
+//		- Will pick from a small alphabet so matches, whitespace and case differences are common.
+//
+
+static char8 RandomCharacter( unsigned int& seed )
+{
+	static const char8 alphabet[] = "aAbBzZ@[`{ \t\r\n01\x80\xFF";
+	return alphabet[ TCTestRandom::NextLCG( seed ) % ( sizeof( alphabet ) - 1 ) ];
+}
+
+//
+// Sign
+//		- Will reduce a compare result to -1, 0 or 1.
+//
+
+static int Sign( int value )
+{
+	return value < 0 ? -1 : ( value > 0 ? 1 : 0 );
+}
+
+//
+// StartTest
+//		- This function will run the unit test for this module.
+// Inputs:
+//		- None.
+// Outputs:
+//		- TCUnitTest::Result: The result of the operation.
+//
+
+TCUnitTest::Result TCStringUtils_UnitTest::StartTest()
+{
+	//
+	// The strings are placed at every alignment, including right up against a page boundary. The buffer spans two
+	// pages, so the last boundary inside it leaves a whole page in front for the string.
+	//
+
+	static char8 buffer[ TEST_BUFFER_SIZE ];
+	static char8 otherBuffer[ TEST_BUFFER_SIZE ];
+	char8* pageEnd = (char8*)( ( (size_t)buffer + TEST_BUFFER_SIZE - 1 ) & ~(size_t)4095 );
+
+	unsigned int seed = 54321;
+	for( int currentTest = 0; currentTest < NUM_TEST_STRINGS; ++currentTest )
+	{
+		int length = TCTestRandom::NextLCG( seed ) % MAX_TEST_LENGTH;
+		char8* string = ( currentTest % 4 == 0 ) ? pageEnd - length - 1 : buffer + TCTestRandom::NextLCG( seed ) % 64;
+		char8* other = otherBuffer + TCTestRandom::NextLCG( seed ) % 64;
+
+		for( int currentChar = 0; currentChar < length; ++currentChar )
+		{
+			string[ currentChar ] = RandomCharacter( seed );
+		}
+		string[ length ] = NULL_TERMINATOR;
+
+		//
+		// Length and Compare against the C library and a scalar loop.
+		//
+
+		if( TCStringUtils::Length( string ) != length )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCStringUtils_UnitTest failed! Length provided the wrong length.");
+		}
+
+		memcpy( other, string, length + 1 );
+		if( length > 0 && TCTestRandom::NextLCG( seed ) % 2 == 0 )
+		{
+			other[ TCTestRandom::NextLCG( seed ) % length ] = RandomCharacter( seed );
+		}
+
+		int expectedCompare = 0;
+		int expectedInsensitive = 0;
+		for( int currentChar = 0; ; ++currentChar )
+		{
+			char8 lhs = string[ currentChar ];
+			char8 rhs = other[ currentChar ];
+			char8 lowerLhs = TCStringUtils::ConvertToLowercase( lhs );
+			char8 lowerRhs = TCStringUtils::ConvertToLowercase( rhs );
+			if( expectedInsensitive == 0 && lowerLhs != lowerRhs )
+			{
+				expectedInsensitive = lowerLhs < lowerRhs ? -1 : 1;
+			}
+			if( expectedCompare == 0 && lhs != rhs )
+			{
+				expectedCompare = lhs < rhs ? -1 : 1;
+			}
+			if( lhs == NULL_TERMINATOR || rhs == NULL_TERMINATOR )
+				break;
+		}
+
+		if( Sign( TCStringUtils::Compare( string, other ) ) != expectedCompare ||
+			Sign( TCStringUtils::CompareInsensitive( string, other ) ) != expectedInsensitive )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCStringUtils_UnitTest failed! Compare gave the wrong order.");
+		}
+
+		//
+		// The run based scans.
+		//
+
+		char8 character = RandomCharacter( seed );
+		const char8* expectedCharacter = length > 0 ? (const char8*)memchr( string, character, length ) : NULL;
+		if( TCStringUtils::FindCharacter( string, length, character ) != ( expectedCharacter != NULL ? (int)( expectedCharacter - string ) : -1 ) )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCStringUtils_UnitTest failed! FindCharacter provided the wrong index.");
+		}
+
+		int findLength = 1 + TCTestRandom::NextLCG( seed ) % 4;
+		int findStart = length > findLength ? TCTestRandom::NextLCG( seed ) % ( length - findLength ) : 0;
+		const char8* stringToFind = ( TCTestRandom::NextLCG( seed ) % 2 == 0 && length >= findLength ) ? string + findStart : "a\tA";
+		findLength = stringToFind == string + findStart ? findLength : 3;
+
+		int expectedFind = -1;
+		for( int currentChar = 0; currentChar + findLength <= length; ++currentChar )
+		{
+			if( memcmp( string + currentChar, stringToFind, findLength ) == 0 )
+			{
+				expectedFind = currentChar;
+				break;
+			}
+		}
+
+		if( TCStringUtils::FindString( string, length, stringToFind, findLength ) != expectedFind )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCStringUtils_UnitTest failed! FindString provided the wrong index.");
+		}
+
+		int expectedWhitespace = -1;
+		int expectedSkip = length;
+		int expectedSkipReverse = 0;
+		for( int currentChar = 0; currentChar < length; ++currentChar )
+		{
+			bool isWhitespace = TCStringUtils::IsWhitespaceCharacter( string[ currentChar ] );
+			if( isWhitespace && expectedWhitespace < 0 )
+			{
+				expectedWhitespace = currentChar;
+			}
+			if( !isWhitespace )
+			{
+				expectedSkip = expectedSkip == length ? currentChar : expectedSkip;
+				expectedSkipReverse = currentChar + 1;
+			}
+		}
+
+		if( TCStringUtils::FindWhitespace( string, 0, length ) != expectedWhitespace ||
+			TCStringUtils::SkipWhitespace( string, 0, length ) != expectedSkip ||
+			TCStringUtils::SkipWhitespaceReverse( string, length ) != expectedSkipReverse )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCStringUtils_UnitTest failed! A whitespace scan provided the wrong index.");
+		}
+
+		memcpy( other, string, length + 1 );
+		TCStringUtils::ToUpper( other, length );
+		for( int currentChar = 0; currentChar <= length; ++currentChar )
+		{
+			if( other[ currentChar ] != TCStringUtils::ConvertToUppercase( string[ currentChar ] ) )
+			{
+				RETURN_UNIT_TEST_FAILURE("TCStringUtils_UnitTest failed! ToUpper converted the wrong characters.");
+			}
+		}
+
+		TCStringUtils::ToLower( other, length );
+		for( int currentChar = 0; currentChar <= length; ++currentChar )
+		{
+			if( other[ currentChar ] != TCStringUtils::ConvertToLowercase( string[ currentChar ] ) )
+			{
+				RETURN_UNIT_TEST_FAILURE("TCStringUtils_UnitTest failed! ToLower converted the wrong characters.");
+			}
+		}
+	}
+
+	//
+	// A few fixed cases, including a whole block of whitespace.
+	//
+
+	const char8* padded = "                                        padded text                                        ";
+	int paddedLength = TCStringUtils::Length( padded );
+	if( TCStringUtils::SkipWhitespace( padded, 0, paddedLength ) != 40 || TCStringUtils::SkipWhitespaceReverse( padded, paddedLength ) != 51 ||
+		TCStringUtils::FindString( padded, paddedLength, "text", 4 ) != 47 || TCStringUtils::FindString( padded, paddedLength, "", 0 ) != 0 ||
+		TCStringUtils::Length( NULL ) != 0 || TCStringUtils::Compare( NULL, "" ) != 0 || TCStringUtils::CompareInsensitive( "ABC", "abd" ) >= 0 )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCStringUtils_UnitTest failed! A fixed case was wrong.");
+	}
+
+	return TCUnitTest::TestResult_Success;
+}
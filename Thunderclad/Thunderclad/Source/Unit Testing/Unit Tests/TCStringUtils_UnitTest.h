@@ -0,0 +1,34 @@
+//
+// TCStringUtils_UnitTest.h
+// This file will define the unit test for TCStringUtils
+//
+
+#ifndef __TC_STRING_UTILS_UNIT_TEST_H__
+#define __TC_STRING_UTILS_UNIT_TEST_H__
+
+//
+// Includes
+//
+
+#include "TCUnitTest.h"
+#include "TCStringUtils.h"
+
+//
+// Defines
+//
+
+//
+// Class Declaration
+//
+
+class TCStringUtils_UnitTest : public TCUnitTest
+{
+	public:		// Members
+	public:		// Methods
+		virtual Result StartTest();
+
+	private:	// Members
+	private:	// Methods
+};
+
+#endif // __TC_STRING_UTILS_UNIT_TEST_H__
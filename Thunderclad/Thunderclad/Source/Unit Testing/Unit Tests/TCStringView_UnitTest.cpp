@@ -0,0 +1,149 @@
+//
+// TCStringView_UnitTest.cpp
+// This file will define the unit test for a string view and the TCString methods that take one.
+//
+
+//
+// Includes
+//
+
+#include "TCStringView_UnitTest.h"
+#include "TCString.h"
+#include "TCLogger.h"
+
+//
+// Defines
+//
+
+#define RETURN_UNIT_TEST_FAILURE( x ) { TCLogger::GetInstance()->LogError( x ); return TCUnitTest::TestResult_Failed; }
+
+//
+// StartTest
+//		- This function will run the unit test for this module.
+// Inputs:
+//		- None.
+// Outputs:
+//		- TCUnitTest::Result: The result of the operation.
+//
+
+TCUnitTest::Result TCStringView_UnitTest::StartTest()
+{
+	//
+	// Test viewing literals, NULL and part of a buffer.
+	//
+
+	TCStringView empty;
+	TCStringView nullView( (const char8*)NULL );
+	if( !empty.IsEmpty() || !nullView.IsEmpty() || empty != nullView || empty.Data() == NULL )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCStringView_UnitTest failed! An empty view wasn't empty.");
+	}
+
+	const char8* buffer = "Hello, World!";
+	TCStringView hello( buffer, 5 );
+	if( hello.Length() != 5 || hello.Data() != buffer || hello[ 4 ] != 'o' || hello != "Hello" || hello == "Hello," )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCStringView_UnitTest failed! A view of part of a buffer was wrong.");
+	}
+
+	//
+	// Test comparing and searching.
+	//
+
+	TCStringView world = "World";
+	if( hello.Compare( world ) >= 0 || world.Compare( hello ) <= 0 || hello.Compare( "Hello" ) != 0 ||
+		hello.Compare( "Hell" ) <= 0 || hello.Compare( "Hello!" ) >= 0 )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCStringView_UnitTest failed! Compare gave the wrong order.");
+	}
+
+	TCStringView full = buffer;
+	if( full.Find( 'o' ) != 4 || full.Find( 'o', 5 ) != 8 || full.Find( 'z' ) != -1 || full.FindLast( 'o' ) != 8 ||
+		full.Find( "World" ) != 7 || full.Find( "Worlds" ) != -1 || full.Find( "l", 4 ) != 10 || full.Find( "" ) != 0 ||
+		!full.Contains( ", W" ) || hello.Contains( "World" ) )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCStringView_UnitTest failed! Find provided the wrong index.");
+	}
+
+	if( !full.StartsWith( hello ) || full.StartsWith( "World" ) || !full.EndsWith( "World!" ) || hello.EndsWith( full ) )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCStringView_UnitTest failed! StartsWith or EndsWith gave the wrong answer.");
+	}
+
+	//
+	// Test substrings, they point into the same buffer.
+	//
+
+	TCStringView sub = full.Substring( 7, 11 );
+	if( sub != world || sub.Data() != buffer + 7 || full.Substring( 7 ) != "World!" ||
+		!full.Substring( 13 ).IsEmpty() || !full.Substring( 5, 4 ).IsEmpty() || !full.Substring( 3, 100 ).IsEmpty() )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCStringView_UnitTest failed! Substring provided the wrong characters.");
+	}
+
+	if( TCStringView( " \t padded \n" ).TrimWhitespace() != "padded" || !TCStringView( "   " ).TrimWhitespace().IsEmpty() )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCStringView_UnitTest failed! TrimWhitespace left whitespace behind.");
+	}
+
+	//
+	// Test splitting, every piece is kept including empty ones and the last one.
+	//
+
+	TCList< TCStringView > pieces;
+	TCStringView( "1.5, 2,,3" ).Split( ',', pieces );
+	if( pieces.Count() != 4 || pieces[ 0 ] != "1.5" || pieces[ 1 ] != " 2" || !pieces[ 2 ].IsEmpty() || pieces[ 3 ] != "3" )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCStringView_UnitTest failed! Split provided the wrong pieces.");
+	}
+
+	pieces.Clear();
+	TCStringView( "trailing," ).Split( ',', pieces );
+	empty.Split( ',', pieces );
+	if( pieces.Count() != 2 || pieces[ 0 ] != "trailing" || !pieces[ 1 ].IsEmpty() )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCStringView_UnitTest failed! Split of the edge cases was wrong.");
+	}
+
+	//
+	// Test the TCString side, converting a string to a view doesn't copy.
+	//
+
+	TCString string = "one,two,three";
+	TCStringView stringView = string;
+	if( stringView.Data() != string.Data() || stringView.Length() != string.Length() )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCStringView_UnitTest failed! Viewing a TCString copied it.");
+	}
+
+	TCList< TCString > ownedPieces;
+	string.Split( ',', ownedPieces );
+	pieces.Clear();
+	string.Split( ',', pieces );
+	if( ownedPieces.Count() != 3 || ownedPieces[ 2 ] != "three" || pieces.Count() != 3 || pieces[ 1 ].Data() != string.Data() + 4 )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCStringView_UnitTest failed! Splitting a TCString was wrong.");
+	}
+
+	TCString fromView( stringView.Substring( 4, 6 ) );
+	fromView += TCStringView( "-suffix", 4 );
+	fromView.Append( stringView.Substring( 8 ) );
+	if( !fromView.Equal( "two-sufthree" ) || !( fromView == TCStringView( "two-sufthree" ) ) || fromView.Compare( stringView ) <= 0 ||
+		!fromView.StartsWith( TCStringView( "two" ) ) || !fromView.Contains( TCStringView( "suf" ) ) )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCStringView_UnitTest failed! A TCString built from views was wrong.");
+	}
+
+	fromView = TCStringView( fromView ).Substring( 4 );
+	if( fromView != "sufthree" )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCStringView_UnitTest failed! Assigning a view of the string itself was wrong.");
+	}
+
+	if( TCStringUtils::AtoI( TCStringView( "1234567", 3 ) ) != 123 || TCStringUtils::AtoI( pieces[ 0 ] ) != 0 )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCStringView_UnitTest failed! AtoI read past the end of a view.");
+	}
+
+	return TCUnitTest::TestResult_Success;
+}
@@ -0,0 +1,34 @@
+//
+// TCStringView_UnitTest.h
+// This file will define the unit test for TCStringView
+//
+
+#ifndef __TC_STRING_VIEW_UNIT_TEST_H__
+#define __TC_STRING_VIEW_UNIT_TEST_H__
+
+//
+// Includes
+//
+
+#include "TCUnitTest.h"
+#include "TCStringView.h"
+
+//
+// Defines
+//
+
+//
+// Class Declaration
+//
+
+class TCStringView_UnitTest : public TCUnitTest
+{
+	public:		// Members
+	public:		// Methods
+		virtual Result StartTest();
+
+	private:	// Members
+	private:	// Methods
+};
+
+#endif // __TC_STRING_VIEW_UNIT_TEST_H__
@@ -9,6 +9,7 @@
 
 #include "TCString_UnitTest.h"
 #include "TCLogger.h"
+#include "TCMemUtils.h"
 
 #include <string>
 
@@ -686,6 +687,75 @@ TCUnitTest::Result TCString_UnitTest::StartTest()
 		RETURN_UNIT_TEST_FAILURE( "[TCString] Non-equivalence test failed for a number!" );
 	}
 
+	//
+	// Inline String Tests.
+	//
+
+	gLogger->LogInfo( "[TCString] Starting inline string tests!" );
+
+	TCString inlineString( "12345678901234567890123" );		// Exactly TC_STRING_INLINE_CAPACITY characters.
+	inlineString.Append( "4" );
+	inlineString.Append( inlineString );
+	if( inlineString.Length() != 48 || strcmp( inlineString.Data(), "123456789012345678901234123456789012345678901234" ) != 0 )
+	{
+		RETURN_UNIT_TEST_FAILURE( "[TCString] Growing out of the inline string or appending a string to itself failed!" );
+	}
+
+	inlineString.Substring( 40, inlineString );
+	if( inlineString.Length() != 8 || !inlineString.Equal( "78901234" ) )
+	{
+		RETURN_UNIT_TEST_FAILURE( "[TCString] Taking a substring of a string into itself failed!" );
+	}
+
+	copyString.Copy( "Hello", 100 );
+	if( copyString.Length() != 5 || !copyString.Equal( "Hello" ) )
+	{
+		RETURN_UNIT_TEST_FAILURE( "[TCString] Copy with a length past the end of the string cached the wrong length!" );
+	}
+
+	copyString.Copy( "  \t Hello World " );
+	copyString.TrimWhitespaceLeft();
+	if( copyString.Length() != 12 || !copyString.Equal( "Hello World " ) )
+	{
+		RETURN_UNIT_TEST_FAILURE( "[TCString] TrimWhitespaceLeft failed to remove the leading whitespace!" );
+	}
+
+	copyString.RemoveAllInstances( 'l' );
+	if( copyString.Length() != 9 || !copyString.Equal( "Heo Word " ) )
+	{
+		RETURN_UNIT_TEST_FAILURE( "[TCString] RemoveAllInstances failed to remove every instance!" );
+	}
+
+	//
+	// Move Tests.
+	//
+
+	gLogger->LogInfo( "[TCString] Starting move tests!" );
+
+	TCString longString( test_longString );
+	const char8* longData = longString.Data();
+	TCString movedLongString( TCMove( longString ) );
+	if( movedLongString.Data() != longData || !movedLongString.Equal( test_longString ) || !longString.IsEmpty() )
+	{
+		RETURN_UNIT_TEST_FAILURE( "[TCString] Moving a heap string didn't hand over its buffer!" );
+	}
+
+	TCString shortString( "Short" );
+	movedLongString = TCMove( shortString );
+	if( !movedLongString.Equal( "Short" ) || shortString.Length() != 0 || !shortString.Equal( "" ) )
+	{
+		RETURN_UNIT_TEST_FAILURE( "[TCString] Moving an inline string failed!" );
+	}
+
+	longString = TCString( test_longString );
+	longString += longString;
+	if( longString.Length() != 2 * (int)strlen( test_longString ) )
+	{
+		RETURN_UNIT_TEST_FAILURE( "[TCString] Move assigning and appending a heap string to itself failed!" );
+	}
+
+	gLogger->LogInfo( "[TCString] Inline string and move tests succeeded!" );
+
 	//
 	// Return success!
 	//
@@ -0,0 +1,268 @@
+//
+// TCUnicode_UnitTest.cpp
+// This file will define the unit test for the UTF-8 and UTF-16 support in TCStringUtils.
+//
+
+//
+// Includes
+//
+
+#include "TCUnicode_UnitTest.h"
+#include "TCString.h"
+#include "TCLogger.h"
+#include "TCTestRandom.h"
+
+#include <string.h>
+
+//
+// Defines
+//
+
+#define RETURN_UNIT_TEST_FAILURE( x ) { TCLogger::GetInstance()->LogError( x ); return TCUnitTest::TestResult_Failed; }
+
+#define NUM_TEST_STRINGS		(2000)
+#define MAX_TEST_CODE_POINTS	(200)		// With ASCII runs this is long enough for several AVX2 blocks.
+#define MAX_ASCII_RUN			(70)
+
+//
+// RandomCodePoint
+//		- Will pick a code point of each encoded length about as often, never a surrogate.
+//
+
+static char32 RandomCodePoint( unsigned int& seed )
+{
+	switch( TCTestRandom::NextLCG( seed ) % 4 )
+	{
+		case 0:		return 0x80 + TCTestRandom::NextLCG( seed ) % ( 0x800 - 0x80 );
+		case 1:		return 0x800 + TCTestRandom::NextLCG( seed ) % ( 0xD800 - 0x800 );
+		case 2:		return 0xE000 + TCTestRandom::NextLCG( seed ) % ( 0x10000 - 0xE000 );
+		default:	return 0x10000 + TCTestRandom::NextLCG( seed ) % ( 0x110000 - 0x10000 );
+	}
+}
+
+//
+// StartTest
+//		- This function will run the unit test for this module.
+// Inputs:
+//		- None.
+// Outputs:
+//		- TCUnitTest::Result: The result of the operation.
+//
+
+TCUnitTest::Result TCUnicode_UnitTest::StartTest()
+{
+	//
+	// Test encoding a few known code points.
+	//
+
+	char8 encoded[ TC_UTF8_MAX_SEQUENCE_LENGTH ];
+	if( TCStringUtils::EncodeUTF8( 'A', encoded ) != 1 || encoded[ 0 ] != 'A' ||
+		TCStringUtils::EncodeUTF8( 0xE9, encoded ) != 2 || memcmp( encoded, "\xC3\xA9", 2 ) != 0 ||
+		TCStringUtils::EncodeUTF8( 0x20AC, encoded ) != 3 || memcmp( encoded, "\xE2\x82\xAC", 3 ) != 0 ||
+		TCStringUtils::EncodeUTF8( 0x1F600, encoded ) != 4 || memcmp( encoded, "\xF0\x9F\x98\x80", 4 ) != 0 ||
+		TCStringUtils::EncodeUTF8( 0xD800, encoded ) != 3 || memcmp( encoded, "\xEF\xBF\xBD", 3 ) != 0 ||
+		TCStringUtils::EncodeUTF8( 0x110000, encoded ) != 3 || memcmp( encoded, "\xEF\xBF\xBD", 3 ) != 0 )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCUnicode_UnitTest failed! EncodeUTF8 wrote a known code point wrong.");
+	}
+
+	//
+	// Test every code point reads back, surrogates can't be encoded so they read back as the replacement character.
+	//
+
+	for( char32 codePoint = 0; codePoint < 0x110000; ++codePoint )
+	{
+		char32 decoded = 0;
+		int numBytes = TCStringUtils::EncodeUTF8( codePoint, encoded );
+		char32 expected = ( codePoint >= 0xD800 && codePoint <= 0xDFFF ) ? TC_UNICODE_REPLACEMENT_CHARACTER : codePoint;
+		if( TCStringUtils::DecodeUTF8( encoded, numBytes, decoded ) != numBytes || decoded != expected ||
+			TCStringUtils::FindInvalidUTF8( encoded, numBytes ) != -1 )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCUnicode_UnitTest failed! A code point didn't read back.");
+		}
+	}
+
+	//
+	// Test malformed sequences, each is cut at its longest valid prefix and read as one replacement character.
+	//
+
+	struct MalformedCase
+	{
+		const char8* string;
+		int invalidIndex;
+		int numCodePoints;
+	};
+
+	MalformedCase malformedCases[] =
+	{
+		{ "\xC0\x80", 0, 2 },				// Overlong, C0 is never a lead byte.
+		{ "\xE0\x80\x80", 0, 3 },			// Overlong three byte form.
+		{ "\xED\xA0\x80", 0, 3 },			// An encoded surrogate.
+		{ "\xF4\x90\x80\x80", 0, 4 },		// Past U+10FFFF.
+		{ "a\xE2\x82", 1, 2 },				// Cut off by the end of the run.
+		{ "\xE2\x82" "A", 0, 2 },			// Cut off by an ASCII character.
+		{ "\xF0\x9F\x98" "\xC3\xA9", 0, 2 },	// Cut off by the next lead byte.
+		{ "\x80\xBF", 0, 2 },				// Stray continuations.
+		{ "ok\xFF", 2, 3 },
+	};
+
+	for( int currentCase = 0; currentCase < (int)( sizeof( malformedCases ) / sizeof( malformedCases[ 0 ] ) ); ++currentCase )
+	{
+		const char8* string = malformedCases[ currentCase ].string;
+		int length = TCStringUtils::Length( string );
+		if( TCStringUtils::FindInvalidUTF8( string, length ) != malformedCases[ currentCase ].invalidIndex ||
+			TCStringUtils::CountCodePoints( string, length ) != malformedCases[ currentCase ].numCodePoints )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCUnicode_UnitTest failed! A malformed sequence was read wrong.");
+		}
+
+		char16 units[ 8 ];
+		if( TCStringUtils::UTF8ToUTF16( string, length, units ) != malformedCases[ currentCase ].numCodePoints )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCUnicode_UnitTest failed! A malformed sequence wasn't replaced.");
+		}
+	}
+
+	//
+	// Test random strings against code points encoded by hand, long ASCII runs take the block paths.
+	//
+
+	unsigned int seed = 4321;
+	static char32 codePoints[ MAX_TEST_CODE_POINTS * MAX_ASCII_RUN ];		// Static, these are too large for the stack.
+	static char32 decodedPoints[ MAX_TEST_CODE_POINTS * MAX_ASCII_RUN ];
+	static char8 utf8[ MAX_TEST_CODE_POINTS * MAX_ASCII_RUN * TC_UTF8_MAX_SEQUENCE_LENGTH + 1 ];
+	static char8 roundTrip[ MAX_TEST_CODE_POINTS * MAX_ASCII_RUN * TC_UTF8_MAX_SEQUENCE_LENGTH + 1 ];
+	static char16 utf16[ MAX_TEST_CODE_POINTS * MAX_ASCII_RUN * 2 + 1 ];
+	static char16 expectedUTF16[ MAX_TEST_CODE_POINTS * MAX_ASCII_RUN * 2 ];
+
+	for( int currentString = 0; currentString < NUM_TEST_STRINGS; ++currentString )
+	{
+		int numCodePoints = 0;
+		int numPieces = 1 + TCTestRandom::NextLCG( seed ) % MAX_TEST_CODE_POINTS;
+		for( int currentPiece = 0; currentPiece < numPieces; ++currentPiece )
+		{
+			if( TCTestRandom::NextLCG( seed ) % 2 == 0 )
+			{
+				int runLength = 1 + TCTestRandom::NextLCG( seed ) % MAX_ASCII_RUN;
+				for( int currentChar = 0; currentChar < runLength; ++currentChar )
+				{
+					codePoints[ numCodePoints++ ] = 1 + TCTestRandom::NextLCG( seed ) % 0x7F;
+				}
+			}
+			else
+			{
+				codePoints[ numCodePoints++ ] = RandomCodePoint( seed );
+			}
+		}
+
+		int length = 0;
+		int numUnits = 0;
+		for( int currentPoint = 0; currentPoint < numCodePoints; ++currentPoint )
+		{
+			char32 codePoint = codePoints[ currentPoint ];
+			length += TCStringUtils::EncodeUTF8( codePoint, utf8 + length );
+			if( codePoint >= 0x10000 )
+			{
+				expectedUTF16[ numUnits++ ] = (char16)( 0xD800 + ( ( codePoint - 0x10000 ) >> 10 ) );
+				expectedUTF16[ numUnits++ ] = (char16)( 0xDC00 + ( ( codePoint - 0x10000 ) & 0x3FF ) );
+			}
+			else
+			{
+				expectedUTF16[ numUnits++ ] = (char16)codePoint;
+			}
+		}
+
+		if( TCStringUtils::FindInvalidUTF8( utf8, length ) != -1 || TCStringUtils::CountCodePoints( utf8, length ) != numCodePoints )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCUnicode_UnitTest failed! A valid string was checked wrong.");
+		}
+
+		if( TCStringUtils::UTF8ToUTF16( utf8, length, utf16 ) != numUnits || memcmp( utf16, expectedUTF16, numUnits * sizeof( char16 ) ) != 0 ||
+			TCStringUtils::UTF16ToUTF8( utf16, numUnits, roundTrip ) != length || memcmp( roundTrip, utf8, length ) != 0 )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCUnicode_UnitTest failed! A string didn't transcode through UTF-16.");
+		}
+
+		if( TCStringUtils::UTF8ToUTF32( utf8, length, decodedPoints ) != numCodePoints ||
+			memcmp( decodedPoints, codePoints, numCodePoints * sizeof( char32 ) ) != 0 ||
+			TCStringUtils::UTF32ToUTF8( codePoints, numCodePoints, roundTrip ) != length || memcmp( roundTrip, utf8, length ) != 0 )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCUnicode_UnitTest failed! A string didn't transcode through UTF-32.");
+		}
+
+		//
+		// Break the string at a code point and make sure the break is found and replaced.
+		//
+
+		int breakPoint = TCTestRandom::NextLCG( seed ) % numCodePoints;
+		int breakIndex = 0;
+		for( int currentPoint = 0; currentPoint < breakPoint; ++currentPoint )
+		{
+			breakIndex += TCStringUtils::EncodeUTF8( codePoints[ currentPoint ], roundTrip );
+		}
+
+		memmove( utf8 + breakIndex + 1, utf8 + breakIndex, length - breakIndex );
+		utf8[ breakIndex ] = (char8)0xFF;
+		if( TCStringUtils::FindInvalidUTF8( utf8, length + 1 ) != breakIndex || TCStringUtils::CountCodePoints( utf8, length + 1 ) != numCodePoints + 1 ||
+			TCStringUtils::UTF8ToUTF32( utf8, length + 1, decodedPoints ) != numCodePoints + 1 ||
+			decodedPoints[ breakPoint ] != TC_UNICODE_REPLACEMENT_CHARACTER || decodedPoints[ breakPoint + 1 ] != codePoints[ breakPoint ] )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCUnicode_UnitTest failed! A broken string was read wrong.");
+		}
+
+		//
+		// Break the UTF-16 with an unpaired surrogate.
+		//
+
+		utf16[ numUnits - 1 ] = 0xD801;
+		int numBytes = TCStringUtils::UTF16ToUTF8( utf16, numUnits, roundTrip );
+		if( numBytes < 3 || memcmp( roundTrip + numBytes - 3, "\xEF\xBF\xBD", 3 ) != 0 )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCUnicode_UnitTest failed! An unpaired surrogate wasn't replaced.");
+		}
+	}
+
+	//
+	// Test that every transcoder writes nothing without a source or a buffer.
+	//
+
+	{
+		char8 utf8[ 4 ] = { 'a', 'b', 'c', 'd' };
+		char16 utf16[ 4 ] = { 'a', 'b', 'c', 'd' };
+		char32 codePoints[ 4 ] = { 'a', 'b', 'c', 'd' };
+		if( TCStringUtils::UTF8ToUTF16( NULL, 4, utf16 ) != 0 || TCStringUtils::UTF8ToUTF16( utf8, 4, NULL ) != 0 ||
+			TCStringUtils::UTF16ToUTF8( NULL, 4, utf8 ) != 0 || TCStringUtils::UTF16ToUTF8( utf16, 4, NULL ) != 0 ||
+			TCStringUtils::UTF8ToUTF32( NULL, 4, codePoints ) != 0 || TCStringUtils::UTF8ToUTF32( utf8, 4, NULL ) != 0 ||
+			TCStringUtils::UTF32ToUTF8( NULL, 4, utf8 ) != 0 || TCStringUtils::UTF32ToUTF8( codePoints, 4, NULL ) != 0 )
+		{
+			RETURN_UNIT_TEST_FAILURE("TCUnicode_UnitTest failed! A transcoder wrote through a NULL pointer.");
+		}
+	}
+
+	//
+	// Test the TCString helpers.
+	//
+
+	TCString name( "Caf\xC3\xA9 \xE6\x97\xA5\xE6\x9C\xAC \xF0\x9F\x98\x80" );
+	char16 wideName[ 32 ];
+	int numWideUnits = name.ToUTF16( wideName );
+	if( name.CodePointCount() != 9 || !name.IsValidUTF8() || numWideUnits != 10 || wideName[ 3 ] != 0xE9 || wideName[ numWideUnits ] != 0 )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCUnicode_UnitTest failed! A TCString helper was wrong.");
+	}
+
+	TCString copied = "short";
+	copied.CopyUTF16( wideName, numWideUnits );
+	if( copied != name || TCString( "\xC3" ).IsValidUTF8() )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCUnicode_UnitTest failed! CopyUTF16 didn't read back the string.");
+	}
+
+	copied.CopyUTF16( expectedUTF16, 0 );
+	if( copied.Length() != 0 || copied != "" )
+	{
+		RETURN_UNIT_TEST_FAILURE("TCUnicode_UnitTest failed! CopyUTF16 didn't clear the string.");
+	}
+
+	return TCUnitTest::TestResult_Success;
+}
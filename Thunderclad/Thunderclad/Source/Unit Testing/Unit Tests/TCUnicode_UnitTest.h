@@ -0,0 +1,34 @@
+//
+// TCUnicode_UnitTest.h
+// This file will define the unit test for the UTF-8 and UTF-16 support in TCStringUtils
+//
+
+#ifndef __TC_UNICODE_UNIT_TEST_H__
+#define __TC_UNICODE_UNIT_TEST_H__
+
+//
+// Includes
+//
+
+#include "TCUnitTest.h"
+#include "TCStringUtils.h"
+
+//
+// Defines
+//
+
+//
+// Class Declaration
+//
+
+class TCUnicode_UnitTest : public TCUnitTest
+{
+	public:		// Members
+	public:		// Methods
+		virtual Result StartTest();
+
+	private:	// Members
+	private:	// Methods
+};
+
+#endif // __TC_UNICODE_UNIT_TEST_H__
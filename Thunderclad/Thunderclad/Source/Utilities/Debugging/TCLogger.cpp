@@ -8,6 +8,8 @@
 //
 
 #include "TCLogger.h"
+#include "TCStringBuilder.h"
+#include "TCMemoryTracker.h"
 #include <Windows.h>
 
 //
@@ -61,13 +63,15 @@ TCLogger& TCLogger::operator=( const TCLogger& logger )
 // SetLogName
 //		- Will set the application name for the logger.
 // Inputs:
-//		- TCString& name: the name of the application.
+//		- const TCStringView& name: the name of the application.
 // Outputs:
 //		- None.
 //
 
-void TCLogger::SetLogName( TCString name )
+void TCLogger::SetLogName( const TCStringView& name )
 {
+	// The logger outlives the application, its name isn't a leak.
+	TCMemoryTagScope memoryTag( TCMemoryTracker::kMemoryTagPermanent );
 	mApplicationName = name;
 }
 
@@ -75,92 +79,80 @@ void TCLogger::SetLogName( TCString name )
 // LogInfo
 //		- Will log information about the app, this is the lowest priority.
 // Inputs:
-//		- TCString& string: The log.
+//		- const TCStringView& log: The log.
 // Outputs:
 //		- None.
 //
 
-void TCLogger::LogInfo( TCString log )
+void TCLogger::LogInfo( const TCStringView& log )
 {
-	TCString output = "[";
-	output += mApplicationName;
-	output += " - INFO]\t\t";
-	output += log;
-	output += '\n';
+	TCStringBuilder output;
+	output.Append( '[' ).Append( mApplicationName ).Append( " - INFO]\t\t" ).Append( log ).Append( '\n' );
 
-	LogString( LOG_INFO, output );
+	LogString( LOG_INFO, output.Data() );
 }
 
 //
 // LogWarning
 //		- Will log a warning for the app, this is something that is not gamebreaking, but still something that should be known.
 // Inputs:
-//		- TCString& string: The message/
+//		- const TCStringView& log: The message/
 // Outputs:
 //		- None.
 //
 
-void TCLogger::LogWarning( TCString log )
+void TCLogger::LogWarning( const TCStringView& log )
 {
-	TCString output = "[";
-	output += mApplicationName;
-	output += " - WARNING]\t\t";
-	output += log;
-	output += '\n';
+	TCStringBuilder output;
+	output.Append( '[' ).Append( mApplicationName ).Append( " - WARNING]\t\t" ).Append( log ).Append( '\n' );
 
-	LogString( LOG_WARNING, output );
+	LogString( LOG_WARNING, output.Data() );
 }
 
 //
 // LogError
 //		- Will log an error for the app, this is something that is potentially gamebreaking
 // Inputs:
-//		- TCString& string: The message.
+//		- const TCStringView& log: The message.
 // Outputs:
 //		- None.
 //
 
-void TCLogger::LogError( TCString log )
+void TCLogger::LogError( const TCStringView& log )
 {
-	TCString output = "[";
-	output += mApplicationName;
-	output += " - ERROR]\t\t";
-	output += log;
-	output += '\n';
+	TCStringBuilder output;
+	output.Append( '[' ).Append( mApplicationName ).Append( " - ERROR]\t\t" ).Append( log ).Append( '\n' );
 
-	LogString( LOG_ERROR, output );
+	LogString( LOG_ERROR, output.Data() );
 }
 
 //
 // LogFailure
 //		- Will log a failure for the app, the game is broken.
 // Inputs:
-//		- TCString& string: The message.
+//		- const TCStringView& log: The message.
 // Outputs:
 //		- None.
 //
 
-void TCLogger::LogFailure( TCString log )
+void TCLogger::LogFailure( const TCStringView& log )
 {
-	TCString output = "[";
-	output += mApplicationName;
-	output += " - FAILURE]\t\t";
-	output += log;
-	output += '\n';
+	TCStringBuilder output;
+	output.Append( '[' ).Append( mApplicationName ).Append( " - FAILURE]\t\t" ).Append( log ).Append( '\n' );
 
-	LogString( LOG_FAILURE, output );
+	LogString( LOG_FAILURE, output.Data() );
 }
 
 //
 // LogString
 //		- Will determine which file to output to and flush the output.
 // Inputs:
-//		- TCString& message: The message for the log.
+//		- const char8* message: The message for the log.
 // Outputs:
 //		- None.
 //
 
-void TCLogger::LogString( TCLogger::LogType type, TCString& log )
+void TCLogger::LogString( TCLogger::LogType type, const char8* log )
 {
-	OutputDebugString( log.Data() );
+	OutputDebugString( log );
 }
\ No newline at end of file
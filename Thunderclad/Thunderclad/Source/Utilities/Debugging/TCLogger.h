@@ -42,11 +42,11 @@ class TCLogger
 			return &gLoggerInstance;
 		}
 
-		void SetLogName( TCString logName );
-		void LogInfo( TCString message );
-		void LogWarning( TCString message );
-		void LogError( TCString message );
-		void LogFailure( TCString message );
+		void SetLogName( const TCStringView& logName );
+		void LogInfo( const TCStringView& message );
+		void LogWarning( const TCStringView& message );
+		void LogError( const TCStringView& message );
+		void LogFailure( const TCStringView& message );
 
 	private:	// Members
 		TCString mApplicationName;
@@ -56,7 +56,7 @@ class TCLogger
 		TCLogger( const TCLogger& logger );
 		TCLogger& operator=(const TCLogger& logger);
 
-		void LogString( LogType, TCString& output );
+		void LogString( LogType, const char8* output );
 };
 
 #endif // __TCLOGGER_H__
\ No newline at end of file
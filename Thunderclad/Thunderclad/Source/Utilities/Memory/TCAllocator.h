@@ -0,0 +1,124 @@
+//
+// TCAllocator.h
+// This file will define the allocator policies collections draw their storage from.
+//
+
+#ifndef __TC_ALLOCATOR_H__
+#define __TC_ALLOCATOR_H__
+
+//
+// Includes
+//
+
+#include "TCPlatformPrecompilerSymbols.h"
+#include "TCMemoryTracker.h"
+
+//
+// Defines
+//
+
+//
+// Allocator Policy
+//		- A collection owns an allocator object and asks it for raw, unconstructed storage, an allocator needs:
+//			void*			Allocate( unsigned int size )	- Returns storage for size bytes, or NULL.
+//			void			Free( void* memory )			- Releases storage from Allocate, NULL is ignored.
+//			bool			CanTransfer( void* memory )		- Can storage from Allocate be handed to another collection.
+//			unsigned int	GetInlineSize()					- The bytes the allocator holds inside itself, 0 if none.
+//		- Copying an allocator gives a new allocator drawing from the same place, it never copies storage.
+//
+
+//
+// Class Declaration
+//		- Draws storage from the heap.
+//
+
+class TCHeapAllocator
+{
+	public:		// Members
+	public:		// Methods
+		inline void*			Allocate( unsigned int size )	{ return ( size > 0 ) ? TCMemoryTracker::Allocate( size, TCMemoryTracker::kMemoryTagCollections ) : NULL; }
+		inline void				Free( void* memory )			{ TCMemoryTracker::Free( memory ); }
+		inline bool				CanTransfer( void* )			{ return true; }
+		inline unsigned int		GetInlineSize()					{ return 0; }
+};
+
+//
+// Class Declaration
+//		- Holds Size bytes inside itself and hands them out to the first request that fits,
+//		  anything larger, or any request while the buffer is taken, comes from the heap.
+//		- The inline buffer lives inside the collection so it can never be handed to another collection.
+//
+
+template< unsigned int Size >
+class TCInlineAllocator
+{
+	public:		// Members
+	public:		// Methods
+								TCInlineAllocator()										{ mInUse = false; }
+								TCInlineAllocator( const TCInlineAllocator& )			{ mInUse = false; }
+		TCInlineAllocator&		operator=( const TCInlineAllocator& )					{ return *this; }
+
+		inline void*			Allocate( unsigned int size );
+		inline void				Free( void* memory );
+		inline bool				CanTransfer( void* memory )		{ return memory != mStorage.buffer; }
+		inline unsigned int		GetInlineSize()					{ return Size; }
+
+	private:	// Members
+		union Storage
+		{
+			char				buffer[ Size ];
+			long long			alignLongLong;		// The union keeps the buffer aligned for any type the heap would be.
+			double				alignDouble;
+			void*				alignPointer;
+		};
+
+		Storage					mStorage;
+		bool					mInUse;
+};
+
+//
+// Allocate
+//		- Will hand out the inline buffer if it is free and large enough, otherwise heap storage.
+// Inputs:
+//		- unsigned int size: The number of bytes needed.
+// Outputs:
+//		- void*: The storage, NULL if size is zero.
+//
+
+template< unsigned int Size >
+void* TCInlineAllocator< Size >::Allocate( unsigned int size )
+{
+	if( size == 0 )
+		return NULL;
+
+	if( !mInUse && size <= Size )
+	{
+		mInUse = true;
+		return mStorage.buffer;
+	}
+
+	return TCMemoryTracker::Allocate( size, TCMemoryTracker::kMemoryTagCollections );
+}
+
+//
+// Free
+//		- Will release storage handed out by Allocate.
+// Inputs:
+//		- void* memory: The storage to release.
+// Outputs:
+//		- None.
+//
+
+template< unsigned int Size >
+void TCInlineAllocator< Size >::Free( void* memory )
+{
+	if( memory == mStorage.buffer )
+	{
+		mInUse = false;
+		return;
+	}
+
+	TCMemoryTracker::Free( memory );
+}
+
+#endif // __TC_ALLOCATOR_H__
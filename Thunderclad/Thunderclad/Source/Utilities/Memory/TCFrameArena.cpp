@@ -0,0 +1,109 @@
+//
+// TCFrameArena.cpp
+// This file will define the double buffered frame arena.
+//
+
+//
+// Includes
+//
+
+#include "TCFrameArena.h"
+
+//
+// Defines
+//
+
+//
+// Default Constructor
+//		- Will create the frame arena without memory, until Initialize is called every allocation fails.
+// Inputs:
+//		- None.
+// Outputs:
+//		- None.
+//
+
+TCFrameArena::TCFrameArena()
+{
+	mCurrentArena	= 0;
+	mFrameNumber	= 0;
+}
+
+//
+// Initialize
+//		- Will allocate both arenas, anything already allocated from them is released.
+// Inputs:
+//		- unsigned int capacity: The size of each arena in bytes.
+// Outputs:
+//		- None.
+//
+
+void TCFrameArena::Initialize( unsigned int capacity )
+{
+	mArenas[ 0 ].Initialize( capacity );
+	mArenas[ 1 ].Initialize( capacity );
+
+	mCurrentArena	= 0;
+	mFrameNumber	= 0;
+}
+
+//
+// Destroy
+//		- Will release both arenas.
+// Inputs:
+//		- None.
+// Outputs:
+//		- None.
+//
+
+void TCFrameArena::Destroy()
+{
+	mArenas[ 0 ].Destroy();
+	mArenas[ 1 ].Destroy();
+}
+
+//
+// BeginFrame
+//		- Will release what was allocated two frames ago and make that arena current.
+// Inputs:
+//		- None.
+// Outputs:
+//		- None.
+//
+
+void TCFrameArena::BeginFrame()
+{
+	mCurrentArena ^= 1;
+	mArenas[ mCurrentArena ].Reset();
+	mFrameNumber++;
+}
+
+//
+// HighWaterMark
+//		- Will find the most either arena has had in use during one frame.
+// Inputs:
+//		- None.
+// Outputs:
+//		- unsigned int: The high water mark in bytes.
+//
+
+unsigned int TCFrameArena::HighWaterMark() const
+{
+	unsigned int first	= mArenas[ 0 ].HighWaterMark();
+	unsigned int second	= mArenas[ 1 ].HighWaterMark();
+
+	return ( first > second ) ? first : second;
+}
+
+//
+// NumFailedAllocations
+//		- Will count the requests that didn't fit in either arena.
+// Inputs:
+//		- None.
+// Outputs:
+//		- unsigned int: The number of failed allocations.
+//
+
+unsigned int TCFrameArena::NumFailedAllocations() const
+{
+	return mArenas[ 0 ].NumFailedAllocations() + mArenas[ 1 ].NumFailedAllocations();
+}
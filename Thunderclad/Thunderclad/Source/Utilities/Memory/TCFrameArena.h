@@ -0,0 +1,82 @@
+//
+// TCFrameArena.h
+// This file will declare a global pair of arenas for memory that only has to live for a frame.
+//
+
+#ifndef __TC_FRAME_ARENA_H__
+#define __TC_FRAME_ARENA_H__
+
+//
+// Includes
+//
+
+#include "TCLinearArena.h"
+
+//
+// Defines
+//
+
+#define gFrameArena							(TCFrameArena::GetInstance())
+
+#define TC_FRAME_ARENA_DEFAULT_CAPACITY		(4 * 1024 * 1024)	// Per arena, there are two.
+
+//
+// Class Declaration
+//		- Two arenas take turns, BeginFrame resets the older one and makes it current. Memory allocated during a frame
+//		  stays valid through the following frame, so one frame can hand its results to the next, and is released at
+//		  the start of the frame after that.
+//		- The arenas aren't locked, only the thread that calls BeginFrame may allocate from them.
+//
+
+class TCFrameArena
+{
+	public:		// Members
+	public:		// Methods
+
+		// Singleton, lazy instantiation.
+		static inline TCFrameArena* GetInstance()
+		{
+			static TCFrameArena gFrameArenaInstance;
+			return &gFrameArenaInstance;
+		}
+
+		void					Initialize( unsigned int capacity = TC_FRAME_ARENA_DEFAULT_CAPACITY );
+		void					Destroy();
+		void					BeginFrame();
+
+		inline void*			Allocate( unsigned int size, unsigned int alignment = TC_ARENA_DEFAULT_ALIGNMENT )	{ return Current().Allocate( size, alignment ); }
+		template< typename Object >
+		inline Object*			AllocateArray( unsigned int count )		{ return Current().AllocateArray< Object >( count ); }
+
+		inline TCLinearArena&	Current()								{ return mArenas[ mCurrentArena ]; }
+		inline TCLinearArena&	Previous()								{ return mArenas[ mCurrentArena ^ 1 ]; }
+		inline unsigned int		FrameNumber() const						{ return mFrameNumber; }
+
+		unsigned int			HighWaterMark() const;
+		unsigned int			NumFailedAllocations() const;
+
+	private:	// Members
+		TCLinearArena			mArenas[ 2 ];
+		unsigned int			mCurrentArena;
+		unsigned int			mFrameNumber;
+
+	private:	// Methods
+								TCFrameArena();
+								TCFrameArena( const TCFrameArena& arena );
+		TCFrameArena&			operator=( const TCFrameArena& arena );
+};
+
+//
+// Class Declaration
+//		- An allocator policy, see TCAllocator.h, that draws from the frame arena current when it was created, for
+//		  collections such as per-frame draw lists. The collection must be gone by the start of the frame after next.
+//
+
+class TCFrameAllocator : public TCArenaAllocator
+{
+	public:		// Members
+	public:		// Methods
+								TCFrameAllocator() : TCArenaAllocator( &gFrameArena->Current() )	{}
+};
+
+#endif // __TC_FRAME_ARENA_H__
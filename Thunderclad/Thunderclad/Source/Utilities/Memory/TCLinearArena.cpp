@@ -0,0 +1,325 @@
+//
+// TCLinearArena.cpp
+// This file will define the linear arena and the allocator policy that draws from it.
+//
+
+//
+// Includes
+//
+
+#include "TCLinearArena.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+//
+// Defines
+//
+
+#define TC_ARENA_NO_HEADER		(0xFFFFFFFF)
+
+//
+// Default Constructor
+//		- Will create an arena with no memory, Initialize must be called before it can hand anything out.
+// Inputs:
+//		- None.
+// Outputs:
+//		- None.
+//
+
+TCLinearArena::TCLinearArena()
+{
+	mBuffer					= NULL;
+	mUsed					= 0;
+	mCapacity				= 0;
+	mHighWaterMark			= 0;
+	mNumFailedAllocations	= 0;
+
+#if TC_BUILD_CONFIGURATION_DEBUG
+	mLastHeader				= TC_ARENA_NO_HEADER;
+#endif
+}
+
+//
+// Constructor
+//		- Will create an arena that can hand out capacity bytes.
+// Inputs:
+//		- unsigned int capacity: The size of the buffer in bytes.
+// Outputs:
+//		- None.
+//
+
+TCLinearArena::TCLinearArena( unsigned int capacity )
+{
+	mBuffer					= NULL;
+	mUsed					= 0;
+	mCapacity				= 0;
+	mHighWaterMark			= 0;
+	mNumFailedAllocations	= 0;
+
+#if TC_BUILD_CONFIGURATION_DEBUG
+	mLastHeader				= TC_ARENA_NO_HEADER;
+#endif
+
+	Initialize( capacity );
+}
+
+//
+// Destructor
+//		- Will release the buffer, everything handed out is gone with it.
+// Inputs:
+//		- None.
+// Outputs:
+//		- None.
+//
+
+TCLinearArena::~TCLinearArena()
+{
+	Destroy();
+}
+
+//
+// Initialize
+//		- Will allocate the buffer, any buffer this arena already had is released first.
+// Inputs:
+//		- unsigned int capacity: The size of the buffer in bytes.
+// Outputs:
+//		- None.
+//
+
+void TCLinearArena::Initialize( unsigned int capacity )
+{
+	Destroy();
+
+	mBuffer		= ( capacity > 0 ) ? (char*)malloc( capacity ) : NULL;
+	mCapacity	= ( mBuffer != NULL ) ? capacity : 0;
+}
+
+//
+// Destroy
+//		- Will release the buffer and clear the statistics.
+// Inputs:
+//		- None.
+// Outputs:
+//		- None.
+//
+
+void TCLinearArena::Destroy()
+{
+	TC_ASSERT( CheckGuards() && "An arena allocation was overrun" );
+
+	free( mBuffer );
+
+	mBuffer					= NULL;
+	mUsed					= 0;
+	mCapacity				= 0;
+	mHighWaterMark			= 0;
+	mNumFailedAllocations	= 0;
+
+#if TC_BUILD_CONFIGURATION_DEBUG
+	mLastHeader				= TC_ARENA_NO_HEADER;
+#endif
+}
+
+//
+// Allocate
+//		- Will hand out the next size bytes of the buffer.
+// Inputs:
+//		- unsigned int size: The number of bytes needed.
+//		- unsigned int alignment: The alignment of the memory, a power of two.
+// Outputs:
+//		- void*: The memory, NULL if the arena doesn't have room.
+//
+
+void* TCLinearArena::Allocate( unsigned int size, unsigned int alignment )
+{
+	TC_ASSERT( alignment > 0 && ( alignment & ( alignment - 1 ) ) == 0 && "Arena alignment must be a power of two" );
+
+#if TC_BUILD_CONFIGURATION_DEBUG
+	unsigned int headerOffset = AlignOffset( mUsed, TC_ALIGNOF( GuardHeader ) );
+	unsigned long long offset = AlignOffset( headerOffset + sizeof( GuardHeader ), alignment );
+	unsigned long long end = offset + size + TC_ARENA_GUARD_SIZE;
+#else
+	unsigned long long offset = AlignOffset( mUsed, alignment );
+	unsigned long long end = offset + size;
+#endif
+
+	if( mBuffer == NULL || end > mCapacity )
+	{
+		mNumFailedAllocations++;
+		return NULL;
+	}
+
+#if TC_BUILD_CONFIGURATION_DEBUG
+	GuardHeader* header = (GuardHeader*)( mBuffer + headerOffset );
+	header->previousHeader	= mLastHeader;
+	header->guardOffset		= (unsigned int)( offset + size );
+
+	memset( mBuffer + header->guardOffset, TC_ARENA_GUARD_FILL, TC_ARENA_GUARD_SIZE );
+	mLastHeader = headerOffset;
+#endif
+
+	mUsed = (unsigned int)end;
+	if( mUsed > mHighWaterMark )
+	{
+		mHighWaterMark = mUsed;
+	}
+
+	return mBuffer + offset;
+}
+
+//
+// Rewind
+//		- Will release everything allocated since the marker was taken.
+// Inputs:
+//		- Marker marker: A marker from GetMarker, taken no earlier than the last Reset.
+// Outputs:
+//		- None.
+//
+
+void TCLinearArena::Rewind( Marker marker )
+{
+	TC_ASSERT( marker <= mUsed && "Rewinding an arena to a marker it has already passed" );
+	if( marker >= mUsed )
+		return;
+
+#if TC_BUILD_CONFIGURATION_DEBUG
+	TC_ASSERT( CheckGuards( marker ) && "An arena allocation was overrun" );
+
+	while( mLastHeader != TC_ARENA_NO_HEADER && mLastHeader >= marker )
+	{
+		mLastHeader = ( (GuardHeader*)( mBuffer + mLastHeader ) )->previousHeader;
+	}
+
+	memset( mBuffer + marker, TC_ARENA_FREED_FILL, mUsed - marker );
+#endif
+
+	mUsed = marker;
+}
+
+//
+// Reset
+//		- Will release everything allocated from this arena, the buffer is kept.
+// Inputs:
+//		- None.
+// Outputs:
+//		- None.
+//
+
+void TCLinearArena::Reset()
+{
+	Rewind( 0 );
+}
+
+//
+// Owns
+//		- Will tell if memory points into this arena's buffer, whether or not it is still allocated.
+// Inputs:
+//		- const void* memory: The memory to check.
+// Outputs:
+//		- bool: Is the memory inside the buffer.
+//
+
+bool TCLinearArena::Owns( const void* memory ) const
+{
+	return mBuffer != NULL && (const char*)memory >= mBuffer && (const char*)memory < mBuffer + mCapacity;
+}
+
+//
+// CheckGuards
+//		- Will check that nothing allocated since the marker has written past its end, only debug builds have guards.
+// Inputs:
+//		- Marker marker: Only allocations made after this marker are checked, 0 checks everything.
+// Outputs:
+//		- bool: Are the guards intact, always true in release builds.
+//
+
+bool TCLinearArena::CheckGuards( Marker marker ) const
+{
+#if TC_BUILD_CONFIGURATION_DEBUG
+	for( unsigned int currentHeader = mLastHeader; currentHeader != TC_ARENA_NO_HEADER && currentHeader >= marker; )
+	{
+		const GuardHeader* header = (const GuardHeader*)( mBuffer + currentHeader );
+		const unsigned char* guard = (const unsigned char*)( mBuffer + header->guardOffset );
+		for( int currentByte = 0; currentByte < TC_ARENA_GUARD_SIZE; ++currentByte )
+		{
+			if( guard[ currentByte ] != TC_ARENA_GUARD_FILL )
+				return false;
+		}
+
+		currentHeader = header->previousHeader;
+	}
+#else
+	TC_UNUSED( marker );
+#endif
+
+	return true;
+}
+
+//
+// ResetStatistics
+//		- Will start tracking the high water mark and failed allocations again from now.
+// Inputs:
+//		- None.
+// Outputs:
+//		- None.
+//
+
+void TCLinearArena::ResetStatistics()
+{
+	mHighWaterMark			= mUsed;
+	mNumFailedAllocations	= 0;
+}
+
+//
+// AlignOffset
+//		- Will round an offset up so the address it points at is aligned, the buffer itself may not be.
+// Inputs:
+//		- unsigned int offset: The offset into the buffer.
+//		- unsigned int alignment: The alignment needed, a power of two.
+// Outputs:
+//		- unsigned int: The aligned offset.
+//
+
+unsigned int TCLinearArena::AlignOffset( unsigned int offset, unsigned int alignment ) const
+{
+	size_t address = (size_t)mBuffer + offset;
+	size_t padding = ( alignment - ( address & ( alignment - 1 ) ) ) & ( alignment - 1 );
+
+	return offset + (unsigned int)padding;
+}
+
+//
+// Allocate
+//		- Will hand out storage from the arena, or from the heap if the arena is full.
+// Inputs:
+//		- unsigned int size: The number of bytes needed.
+// Outputs:
+//		- void*: The storage, NULL if size is zero.
+//
+
+void* TCArenaAllocator::Allocate( unsigned int size )
+{
+	if( size == 0 )
+		return NULL;
+
+	void* memory = ( mArena != NULL ) ? mArena->Allocate( size ) : NULL;
+	return ( memory != NULL ) ? memory : malloc( size );
+}
+
+//
+// Free
+//		- Will release heap storage, storage from the arena is left for the arena to release.
+// Inputs:
+//		- void* memory: The storage to release, NULL is ignored.
+// Outputs:
+//		- None.
+//
+
+void TCArenaAllocator::Free( void* memory )
+{
+	if( mArena != NULL && mArena->Owns( memory ) )
+		return;
+
+	free( memory );
+}
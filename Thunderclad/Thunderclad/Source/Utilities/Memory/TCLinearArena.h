@@ -0,0 +1,133 @@
+//
+// TCLinearArena.h
+// This file will declare an arena that hands out memory by bumping an offset and frees it all at once.
+//
+
+#ifndef __TC_LINEAR_ARENA_H__
+#define __TC_LINEAR_ARENA_H__
+
+//
+// Includes
+//
+
+#include "TCPlatformPrecompilerSymbols.h"
+
+//
+// Defines
+//
+
+#define TC_ARENA_DEFAULT_ALIGNMENT		(16)	// Matches the heap, so anything malloc can hold an arena can hold.
+#define TC_ARENA_GUARD_SIZE				(16)	// Debug only, bytes written after every allocation to catch overruns.
+#define TC_ARENA_GUARD_FILL				(0xFD)
+#define TC_ARENA_FREED_FILL				(0xDD)	// Debug only, rewound memory is filled with this so stale reads stand out.
+
+//
+// Class Declaration
+//		- Allocating moves an offset forward through one buffer, nothing is freed on its own. A marker remembers the
+//		  offset so everything allocated after it can be released at once with Rewind, Reset releases everything.
+//		- Destructors are never run, only put objects that don't need one in an arena.
+//		- In debug builds every allocation is followed by guard bytes that are checked when the memory is rewound.
+//
+
+class TCLinearArena
+{
+	public:		// Members
+		typedef unsigned int	Marker;
+
+		//
+		// Scope
+		//		- Rewinds the arena to where it was when the scope was created, for scratch memory inside a function.
+		//
+
+		class Scope
+		{
+			public:
+								Scope( TCLinearArena& arena ) : mArena( arena ), mMarker( arena.GetMarker() )	{}
+								~Scope()																		{ mArena.Rewind( mMarker ); }
+
+			private:
+				TCLinearArena&	mArena;
+				Marker			mMarker;
+
+								Scope( const Scope& scope );
+				Scope&			operator=( const Scope& scope );
+		};
+
+	public:		// Methods
+								TCLinearArena();
+								TCLinearArena( unsigned int capacity );
+								~TCLinearArena();
+
+		void					Initialize( unsigned int capacity );
+		void					Destroy();
+
+		void*					Allocate( unsigned int size, unsigned int alignment = TC_ARENA_DEFAULT_ALIGNMENT );
+		template< typename Object >
+		inline Object*			AllocateArray( unsigned int count )		{ return (Object*)Allocate( sizeof( Object ) * count, TC_ALIGNOF( Object ) ); }
+
+		inline Marker			GetMarker() const						{ return mUsed; }
+		void					Rewind( Marker marker );
+		void					Reset();
+
+		bool					Owns( const void* memory ) const;
+		bool					CheckGuards( Marker marker = 0 ) const;
+
+		inline unsigned int		Used() const							{ return mUsed; }
+		inline unsigned int		Capacity() const						{ return mCapacity; }
+		inline unsigned int		HighWaterMark() const					{ return mHighWaterMark; }		// The most ever in use at once.
+		inline unsigned int		NumFailedAllocations() const			{ return mNumFailedAllocations; }	// Requests that didn't fit.
+		void					ResetStatistics();
+
+	private:	// Members
+		char*					mBuffer;
+		unsigned int			mUsed;
+		unsigned int			mCapacity;
+		unsigned int			mHighWaterMark;
+		unsigned int			mNumFailedAllocations;
+
+#if TC_BUILD_CONFIGURATION_DEBUG
+		// Each allocation is preceded by a header, they are chained newest to oldest so Rewind can find every guard.
+		struct GuardHeader
+		{
+			unsigned int		previousHeader;
+			unsigned int		guardOffset;
+		};
+
+		unsigned int			mLastHeader;
+#endif
+
+	private:	// Methods
+		// Memory handed out points into the buffer, so arenas can't be copied.
+								TCLinearArena( const TCLinearArena& arena );
+		TCLinearArena&			operator=( const TCLinearArena& arena );
+
+		unsigned int			AlignOffset( unsigned int offset, unsigned int alignment ) const;
+};
+
+//
+// Class Declaration
+//		- An allocator policy, see TCAllocator.h, that draws storage from a TCLinearArena. When the arena is full, or
+//		  there is no arena, storage comes from the heap instead so a collection never fails to grow.
+//		- Freeing arena storage does nothing, it is released when the arena is rewound. A collection using this
+//		  policy must not outlive the memory it was given.
+//
+
+class TCArenaAllocator
+{
+	public:		// Members
+	public:		// Methods
+								TCArenaAllocator()								{ mArena = NULL; }
+								TCArenaAllocator( TCLinearArena* arena )		{ mArena = arena; }
+
+		void*					Allocate( unsigned int size );
+		void					Free( void* memory );
+		inline bool				CanTransfer( void* )							{ return true; }
+		inline unsigned int		GetInlineSize()									{ return 0; }
+
+		inline TCLinearArena*	GetArena() const								{ return mArena; }
+
+	private:	// Members
+		TCLinearArena*			mArena;
+};
+
+#endif // __TC_LINEAR_ARENA_H__
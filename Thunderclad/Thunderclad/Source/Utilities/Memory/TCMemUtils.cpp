@@ -8,10 +8,34 @@
 //
 
 #include "TCMemUtils.h"
+#include "TCCPUFeatures.h"
 #include <memory.h>
+#include <string.h>
+
+#if TC_PLATFORM_WIN32
+	#include <emmintrin.h>
+	#include <immintrin.h>
+#endif
+
+//
+// Overlaps
+//		- Will determine if two runs of memory share any bytes.
+//
+
+static inline bool Overlaps( const void* first, const void* second, size_t size )
+{
+	return (const unsigned char*)first < (const unsigned char*)second + size && (const unsigned char*)second < (const unsigned char*)first + size;
+}
 
 //
-// Defines
+// MemCopy
+//		- Will copy memory after checking the pointers, the size and that the memory doesn't overlap.
+// Inputs:
+//		- const void* source: The memory to copy from.
+//		- void* dest: The memory to copy to.
+//		- unsigned int dataSize: The number of bytes to copy.
+// Outputs:
+//		- bool: Was the memory copied.
 //
 
 bool TCMemoryUtils::MemCopy( const void* source, void* dest, unsigned int dataSize )
@@ -23,25 +47,437 @@ bool TCMemoryUtils::MemCopy( const void* source, void* dest, unsigned int dataSi
 	// Check to make sure the memory doesn't overlap.
 	//
 
-	if( dest >= source && dest <= ((unsigned char*)source + dataSize) )
+	if( Overlaps( source, dest, dataSize ) )
 		return false;
 
-	memcpy( dest, source, dataSize );
+	Copy( source, dest, dataSize );
 	return true;
 }
 
+//
+// MemCopySafe
+//		- Will copy memory after the same checks as MemCopy, which already cover everything memcpy_s checked.
+// Inputs:
+//		- const void* source: The memory to copy from.
+//		- void* dest: The memory to copy to.
+//		- unsigned int dataSize: The number of bytes to copy.
+// Outputs:
+//		- bool: Was the memory copied.
+//
+
 bool TCMemoryUtils::MemCopySafe( const void* source, void* dest, unsigned int dataSize )
 {
-	if( source == NULL || dest == NULL || dataSize <= 0 )
-		return false;
+	return MemCopy( source, dest, dataSize );
+}
 
-	//
-	// Check to make sure the memory doesn't overlap.
-	//
+//
+// Small Sizes
+//		- Up to 16 bytes are moved as a pair of overlapping words from each end, so no size needs a loop or a branch
+//		  per byte. Everything is loaded before anything is stored.
+//
 
-	if( dest >= source && dest <= ((unsigned char*)source + dataSize) )
-		return false;
+static inline void CopySmall( const unsigned char* source, unsigned char* dest, size_t size )
+{
+	if( size >= 8 )
+	{
+		unsigned long long head, tail;
+		memcpy( &head, source, 8 );
+		memcpy( &tail, source + size - 8, 8 );
+		memcpy( dest, &head, 8 );
+		memcpy( dest + size - 8, &tail, 8 );
+	}
+	else if( size >= 4 )
+	{
+		unsigned int head, tail;
+		memcpy( &head, source, 4 );
+		memcpy( &tail, source + size - 4, 4 );
+		memcpy( dest, &head, 4 );
+		memcpy( dest + size - 4, &tail, 4 );
+	}
+	else if( size >= 2 )
+	{
+		unsigned short head, tail;
+		memcpy( &head, source, 2 );
+		memcpy( &tail, source + size - 2, 2 );
+		memcpy( dest, &head, 2 );
+		memcpy( dest + size - 2, &tail, 2 );
+	}
+	else if( size == 1 )
+	{
+		dest[ 0 ] = source[ 0 ];
+	}
+}
 
-	memcpy_s( dest, dataSize, source, dataSize );
-	return true;
-}
\ No newline at end of file
+static inline void FillSmall( unsigned char* dest, unsigned char value, size_t size )
+{
+	unsigned long long pattern = value * 0x0101010101010101ULL;
+
+	if( size >= 8 )
+	{
+		memcpy( dest, &pattern, 8 );
+		memcpy( dest + size - 8, &pattern, 8 );
+	}
+	else if( size >= 4 )
+	{
+		memcpy( dest, &pattern, 4 );
+		memcpy( dest + size - 4, &pattern, 4 );
+	}
+	else if( size >= 2 )
+	{
+		memcpy( dest, &pattern, 2 );
+		memcpy( dest + size - 2, &pattern, 2 );
+	}
+	else if( size == 1 )
+	{
+		dest[ 0 ] = value;
+	}
+}
+
+#if TC_PLATFORM_WIN32
+
+//
+// Lanes
+//		- The SSE2 and AVX2 registers behind one interface, so each routine is written once as a template.
+//
+
+struct TCMemorySSE2Lanes
+{
+	typedef __m128i Register;
+	enum { Width = 16 };
+
+	static inline Register		Load( const unsigned char* pointer )					{ return _mm_loadu_si128( (const __m128i*)pointer ); }
+	static inline void			Store( unsigned char* pointer, Register bytes )			{ _mm_storeu_si128( (__m128i*)pointer, bytes ); }
+	static inline void			StoreAligned( unsigned char* pointer, Register bytes )	{ _mm_store_si128( (__m128i*)pointer, bytes ); }
+	static inline void			Stream( unsigned char* pointer, Register bytes )		{ _mm_stream_si128( (__m128i*)pointer, bytes ); }
+	static inline Register		Splat( unsigned char value )							{ return _mm_set1_epi8( (char)value ); }
+	static inline void			Finish()												{}
+};
+
+struct TCMemoryAVX2Lanes
+{
+	typedef __m256i Register;
+	enum { Width = 32 };
+
+	static inline Register		Load( const unsigned char* pointer )					{ return _mm256_loadu_si256( (const __m256i*)pointer ); }
+	static inline void			Store( unsigned char* pointer, Register bytes )			{ _mm256_storeu_si256( (__m256i*)pointer, bytes ); }
+	static inline void			StoreAligned( unsigned char* pointer, Register bytes )	{ _mm256_store_si256( (__m256i*)pointer, bytes ); }
+	static inline void			Stream( unsigned char* pointer, Register bytes )		{ _mm256_stream_si256( (__m256i*)pointer, bytes ); }
+	static inline Register		Splat( unsigned char value )							{ return _mm256_set1_epi8( (char)value ); }
+
+	// Avoid the penalty for switching back to SSE code with the upper halves dirty.
+	static inline void			Finish()												{ _mm256_zeroupper(); }
+};
+
+//
+// CopyLanes
+//		- Will copy more than 8 registers. The first register is stored unaligned, then the destination steps to the
+//		  next aligned address so every store in the loop is aligned, and the last register is stored unaligned
+//		  against the end. Streaming stores go around the cache and are fenced so they're visible after.
+//
+
+template< class Lanes, bool Streaming >
+static void CopyLanes( const unsigned char* source, unsigned char* dest, size_t size )
+{
+	typename Lanes::Register last = Lanes::Load( source + size - Lanes::Width );
+	unsigned char* destEnd = dest + size;
+
+	Lanes::Store( dest, Lanes::Load( source ) );
+
+	size_t skip = Lanes::Width - ( (size_t)dest & ( Lanes::Width - 1 ) );
+	source	+= skip;
+	dest	+= skip;
+	size	-= skip;
+
+	for( ; size >= 4 * Lanes::Width; size -= 4 * Lanes::Width, source += 4 * Lanes::Width, dest += 4 * Lanes::Width )
+	{
+		typename Lanes::Register first	= Lanes::Load( source );
+		typename Lanes::Register second	= Lanes::Load( source + Lanes::Width );
+		typename Lanes::Register third	= Lanes::Load( source + 2 * Lanes::Width );
+		typename Lanes::Register fourth	= Lanes::Load( source + 3 * Lanes::Width );
+
+		if( Streaming )
+		{
+			Lanes::Stream( dest, first );
+			Lanes::Stream( dest + Lanes::Width, second );
+			Lanes::Stream( dest + 2 * Lanes::Width, third );
+			Lanes::Stream( dest + 3 * Lanes::Width, fourth );
+		}
+		else
+		{
+			Lanes::StoreAligned( dest, first );
+			Lanes::StoreAligned( dest + Lanes::Width, second );
+			Lanes::StoreAligned( dest + 2 * Lanes::Width, third );
+			Lanes::StoreAligned( dest + 3 * Lanes::Width, fourth );
+		}
+	}
+
+	for( ; size > Lanes::Width; size -= Lanes::Width, source += Lanes::Width, dest += Lanes::Width )
+	{
+		Lanes::StoreAligned( dest, Lanes::Load( source ) );
+	}
+
+	Lanes::Store( destEnd - Lanes::Width, last );
+
+	if( Streaming )
+	{
+		_mm_sfence();
+	}
+
+	Lanes::Finish();
+}
+
+//
+// FillOverlapping
+//		- Will fill more than 2 and up to 8 registers without a loop, half of the registers from each end.
+//
+
+template< class Lanes >
+static inline void FillOverlapping( unsigned char* dest, unsigned char value, size_t size )
+{
+	typename Lanes::Register bytes = Lanes::Splat( value );
+	unsigned char* destEnd = dest + size;
+
+	Lanes::Store( dest, bytes );
+	Lanes::Store( dest + Lanes::Width, bytes );
+	Lanes::Store( destEnd - 2 * Lanes::Width, bytes );
+	Lanes::Store( destEnd - Lanes::Width, bytes );
+
+	if( size > 4 * Lanes::Width )
+	{
+		Lanes::Store( dest + 2 * Lanes::Width, bytes );
+		Lanes::Store( dest + 3 * Lanes::Width, bytes );
+		Lanes::Store( destEnd - 4 * Lanes::Width, bytes );
+		Lanes::Store( destEnd - 3 * Lanes::Width, bytes );
+	}
+
+	Lanes::Finish();
+}
+
+//
+// FillLanes
+//		- Will fill more than 8 registers, laid out the same way as CopyLanes.
+//
+
+template< class Lanes, bool Streaming >
+static void FillLanes( unsigned char* dest, unsigned char value, size_t size )
+{
+	typename Lanes::Register bytes = Lanes::Splat( value );
+	unsigned char* destEnd = dest + size;
+
+	Lanes::Store( dest, bytes );
+
+	size_t skip = Lanes::Width - ( (size_t)dest & ( Lanes::Width - 1 ) );
+	dest	+= skip;
+	size	-= skip;
+
+	for( ; size >= 4 * Lanes::Width; size -= 4 * Lanes::Width, dest += 4 * Lanes::Width )
+	{
+		if( Streaming )
+		{
+			Lanes::Stream( dest, bytes );
+			Lanes::Stream( dest + Lanes::Width, bytes );
+			Lanes::Stream( dest + 2 * Lanes::Width, bytes );
+			Lanes::Stream( dest + 3 * Lanes::Width, bytes );
+		}
+		else
+		{
+			Lanes::StoreAligned( dest, bytes );
+			Lanes::StoreAligned( dest + Lanes::Width, bytes );
+			Lanes::StoreAligned( dest + 2 * Lanes::Width, bytes );
+			Lanes::StoreAligned( dest + 3 * Lanes::Width, bytes );
+		}
+	}
+
+	for( ; size > Lanes::Width; size -= Lanes::Width, dest += Lanes::Width )
+	{
+		Lanes::StoreAligned( dest, bytes );
+	}
+
+	Lanes::Store( destEnd - Lanes::Width, bytes );
+
+	if( Streaming )
+	{
+		_mm_sfence();
+	}
+
+	Lanes::Finish();
+}
+
+#endif // TC_PLATFORM_WIN32
+
+//
+// Copy
+//		- Will copy memory, the memory must not overlap. Up to 32 bytes are copied without a call or a loop, the CRT's
+//		  memcpy is as fast or faster from there until the copy is larger than the cache, which uses streaming stores.
+// Inputs:
+//		- const void* source: The memory to copy from.
+//		- void* dest: The memory to copy to.
+//		- size_t size: The number of bytes to copy.
+// Outputs:
+//		- None.
+//
+
+void TCMemoryUtils::Copy( const void* source, void* dest, size_t size )
+{
+	TC_ASSERT( !Overlaps( source, dest, size ) && "Copy can't be used on overlapping memory" );
+
+	const unsigned char* sourceBytes = (const unsigned char*)source;
+	unsigned char* destBytes = (unsigned char*)dest;
+
+	if( size <= 16 )
+	{
+		CopySmall( sourceBytes, destBytes, size );
+		return;
+	}
+
+#if TC_PLATFORM_WIN32
+	if( size <= 32 )
+	{
+		TCMemorySSE2Lanes::Register head = TCMemorySSE2Lanes::Load( sourceBytes );
+		TCMemorySSE2Lanes::Register tail = TCMemorySSE2Lanes::Load( sourceBytes + size - TCMemorySSE2Lanes::Width );
+		TCMemorySSE2Lanes::Store( destBytes, head );
+		TCMemorySSE2Lanes::Store( destBytes + size - TCMemorySSE2Lanes::Width, tail );
+		return;
+	}
+
+	if( size >= TC_STREAMING_LARGE_SIZE )
+	{
+		CopyStreaming( source, dest, size );
+		return;
+	}
+#endif
+
+	memcpy( destBytes, sourceBytes, size );
+}
+
+//
+// CopyStreaming
+//		- Will copy memory without pulling the destination into the cache, the memory must not overlap.
+// Inputs:
+//		- const void* source: The memory to copy from.
+//		- void* dest: The memory to copy to.
+//		- size_t size: The number of bytes to copy.
+// Outputs:
+//		- None.
+//
+
+void TCMemoryUtils::CopyStreaming( const void* source, void* dest, size_t size )
+{
+#if TC_PLATFORM_WIN32
+	if( size < TC_STREAMING_MIN_SIZE )
+	{
+		Copy( source, dest, size );
+		return;
+	}
+
+	TC_ASSERT( !Overlaps( source, dest, size ) && "CopyStreaming can't be used on overlapping memory" );
+
+	if( TCCPUFeatures::HasAVX2() )
+	{
+		CopyLanes< TCMemoryAVX2Lanes, true >( (const unsigned char*)source, (unsigned char*)dest, size );
+	}
+	else
+	{
+		CopyLanes< TCMemorySSE2Lanes, true >( (const unsigned char*)source, (unsigned char*)dest, size );
+	}
+#else
+	Copy( source, dest, size );
+#endif
+}
+
+//
+// Fill
+//		- Will set every byte of memory to a value. Fills larger than the cache use streaming stores.
+// Inputs:
+//		- void* dest: The memory to fill.
+//		- unsigned char value: The value of every byte.
+//		- size_t size: The number of bytes to fill.
+// Outputs:
+//		- None.
+//
+
+void TCMemoryUtils::Fill( void* dest, unsigned char value, size_t size )
+{
+	unsigned char* destBytes = (unsigned char*)dest;
+
+#if TC_PLATFORM_WIN32
+	if( size <= 16 )
+	{
+		FillSmall( destBytes, value, size );
+	}
+	else if( size <= 32 )
+	{
+		TCMemorySSE2Lanes::Register bytes = TCMemorySSE2Lanes::Splat( value );
+		TCMemorySSE2Lanes::Store( destBytes, bytes );
+		TCMemorySSE2Lanes::Store( destBytes + size - TCMemorySSE2Lanes::Width, bytes );
+	}
+	else if( size <= 4 * TCMemorySSE2Lanes::Width )
+	{
+		FillOverlapping< TCMemorySSE2Lanes >( destBytes, value, size );
+	}
+	else if( size >= TC_STREAMING_LARGE_SIZE )
+	{
+		FillStreaming( dest, value, size );
+	}
+	else if( TCCPUFeatures::HasAVX2() )
+	{
+		if( size <= 8 * TCMemoryAVX2Lanes::Width )
+		{
+			FillOverlapping< TCMemoryAVX2Lanes >( destBytes, value, size );
+		}
+		else
+		{
+			FillLanes< TCMemoryAVX2Lanes, false >( destBytes, value, size );
+		}
+	}
+	else if( size <= 8 * TCMemorySSE2Lanes::Width )
+	{
+		FillOverlapping< TCMemorySSE2Lanes >( destBytes, value, size );
+	}
+	else
+	{
+		FillLanes< TCMemorySSE2Lanes, false >( destBytes, value, size );
+	}
+#else
+	if( size <= 16 )
+	{
+		FillSmall( destBytes, value, size );
+		return;
+	}
+
+	memset( destBytes, value, size );
+#endif
+}
+
+//
+// FillStreaming
+//		- Will set every byte of memory to a value without pulling the memory into the cache.
+// Inputs:
+//		- void* dest: The memory to fill.
+//		- unsigned char value: The value of every byte.
+//		- size_t size: The number of bytes to fill.
+// Outputs:
+//		- None.
+//
+
+void TCMemoryUtils::FillStreaming( void* dest, unsigned char value, size_t size )
+{
+#if TC_PLATFORM_WIN32
+	if( size < TC_STREAMING_MIN_SIZE )
+	{
+		Fill( dest, value, size );
+		return;
+	}
+
+	if( TCCPUFeatures::HasAVX2() )
+	{
+		FillLanes< TCMemoryAVX2Lanes, true >( (unsigned char*)dest, value, size );
+	}
+	else
+	{
+		FillLanes< TCMemorySSE2Lanes, true >( (unsigned char*)dest, value, size );
+	}
+#else
+	Fill( dest, value, size );
+#endif
+}
@@ -12,6 +12,8 @@
 
 #include "TCPlatformPrecompilerSymbols.h"
 
+#include <stddef.h>
+
 //
 // Defines
 //
@@ -19,10 +21,88 @@
 #define TC_SAFE_DELETE( x )				if( x != NULL ){ delete x; x = NULL; }
 #define TC_SAFE_DELETE_ARRAY( x )		if( x != NULL ){ delete[] x; x = NULL; }
 
+#define TC_CACHE_LINE_SIZE				(64)	// Data written by different threads should be at least this far apart.
+#define TC_STREAMING_MIN_SIZE			(4096)				// Below this the streaming copy and fill use the cache, the fence would cost more than it saves.
+#define TC_STREAMING_LARGE_SIZE			(8 * 1024 * 1024)	// From this Copy and Fill stream too, the memory wouldn't fit in the cache anyway.
+
+#if defined( _MSC_VER ) && _MSC_VER < 1900
+	#define TC_IS_TRIVIALLY_COPYABLE( type )	( __has_trivial_copy( type ) && __has_trivial_assign( type ) && __has_trivial_destructor( type ) )
+#else
+	#define TC_IS_TRIVIALLY_COPYABLE( type )	__is_trivially_copyable( type )
+#endif
+
+//
+// Copy and Fill handle small sizes without a loop and write around the cache for buffers larger than it, Fill picks
+// the widest registers the cpu supports each call and Copy leaves the sizes in between to memcpy. The memory must not
+// overlap. The streaming variants write around the cache, for large buffers that won't be read back soon such as
+// mapped vertex and constant buffers.
+//
+
 namespace TCMemoryUtils
 {
 	bool MemCopySafe( const void* source, void* dest, unsigned int dataSize );
 	bool MemCopy( const void* source, void* dest, unsigned int dataSize );
+
+	void Copy( const void* source, void* dest, size_t size );
+	void CopyStreaming( const void* source, void* dest, size_t size );
+	void Fill( void* dest, unsigned char value, size_t size );
+	void FillStreaming( void* dest, unsigned char value, size_t size );
+}
+
+//
+// TCIsTriviallyCopyable
+//		- Will tell if a type can be copied and moved with memcpy/memmove and needs no destructor call.
+//
+
+template< typename Type >
+struct TCIsTriviallyCopyable
+{
+	enum { Value = TC_IS_TRIVIALLY_COPYABLE( Type ) };
+};
+
+//
+// TCRemoveReference
+//		- Will strip the reference from a type, used by TCMove and TCForward.
+//
+
+template< typename Type > struct TCRemoveReference				{ typedef Type Result; };
+template< typename Type > struct TCRemoveReference< Type& >		{ typedef Type Result; };
+template< typename Type > struct TCRemoveReference< Type&& >	{ typedef Type Result; };
+
+//
+// TCMove
+//		- Will mark an object as movable so its resources can be taken instead of copied.
+// Inputs:
+//		- Type&& object: The object to move from.
+// Outputs:
+//		- An rvalue reference to the object.
+//
+
+template< typename Type >
+inline typename TCRemoveReference< Type >::Result&& TCMove( Type&& object )
+{
+	return static_cast< typename TCRemoveReference< Type >::Result&& >( object );
+}
+
+//
+// TCForward
+//		- Will pass an argument on exactly as it was received, keeping rvalues as rvalues.
+// Inputs:
+//		- Type& object: The argument to forward.
+// Outputs:
+//		- The argument with its original value category.
+//
+
+template< typename Type >
+inline Type&& TCForward( typename TCRemoveReference< Type >::Result& object )
+{
+	return static_cast< Type&& >( object );
+}
+
+template< typename Type >
+inline Type&& TCForward( typename TCRemoveReference< Type >::Result&& object )
+{
+	return static_cast< Type&& >( object );
 }
 
 #endif // __TCMEM_UTILS_H__
\ No newline at end of file
@@ -0,0 +1,540 @@
+//
+// TCMemoryTracker.cpp
+// This file will define the memory tracker and the global new and delete that feed it.
+//
+
+//
+// Includes
+//
+
+#include "TCMemoryTracker.h"
+#include "TCLogger.h"
+#include "TCStringBuilder.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <new>
+#include <atomic>
+#include <mutex>
+
+#if TC_MEMORY_TRACKER_CALL_STACKS
+	#include <Windows.h>
+	#include <DbgHelp.h>
+#endif
+
+//
+// Defines
+//
+
+#define TC_MEMORY_HEADER_MAGIC		(0x7C3A11C8)
+#define TC_MEMORY_HEADER_SIZE		( ( sizeof( TCAllocationHeader ) + 15 ) & ~(size_t)15 )	// Keeps the memory after it aligned like the heap.
+#define TC_MEMORY_SYMBOL_NAME_SIZE	(256)
+
+#if TC_MEMORY_TRACKING
+
+//
+// TCAllocationHeader
+//		- Sits in front of every tracked allocation. With call stacks the headers of live allocations are also chained
+//		  together so the leak report can find them.
+//
+
+struct TCAllocationHeader
+{
+#if TC_MEMORY_TRACKER_CALL_STACKS
+	TCAllocationHeader*		previous;
+	TCAllocationHeader*		next;
+	unsigned long long		serial;
+	void*					frames[ TC_MEMORY_TRACKER_STACK_DEPTH ];
+	unsigned int			numFrames;
+#endif
+	size_t					size;
+	unsigned int			tag;
+	unsigned int			magic;
+};
+
+//
+// TCTagCounters
+//		- Zero initialized before any constructor runs, so allocations made during static initialization are counted.
+//
+
+struct TCTagCounters
+{
+	std::atomic< size_t >		liveBytes;
+	std::atomic< size_t >		peakBytes;
+	std::atomic< unsigned int >	numLiveAllocations;
+	std::atomic< unsigned int >	numAllocations;
+	unsigned int				numLiveAtCheckpoint;
+};
+
+static TCTagCounters					gTagCounters[ TCMemoryTracker::kNumMemoryTags ];
+static thread_local TCMemoryTracker::Tag	gCurrentTag = TCMemoryTracker::kMemoryTagGeneral;
+
+#if TC_MEMORY_TRACKER_CALL_STACKS
+
+static TCAllocationHeader*	gLiveAllocations	= NULL;
+static unsigned long long	gNextSerial			= 0;
+static unsigned long long	gCheckpointSerial	= 0;
+
+//
+// GetRegistryLock
+//		- The lock is built in static storage and never destroyed, memory can still be freed after statics are torn down.
+//
+
+static std::mutex& GetRegistryLock()
+{
+	static union
+	{
+		char				buffer[ sizeof( std::mutex ) ];
+		long long			alignLongLong;
+		void*				alignPointer;
+	} storage;
+
+	static std::mutex* lock = new( storage.buffer ) std::mutex();
+	return *lock;
+}
+
+#endif // TC_MEMORY_TRACKER_CALL_STACKS
+
+#endif // TC_MEMORY_TRACKING
+
+//
+// Allocate
+//		- Will allocate memory and count it against a tag.
+// Inputs:
+//		- size_t size: The number of bytes needed.
+//		- Tag tag: The subsystem the memory belongs to, an open TCMemoryTagScope takes precedence.
+// Outputs:
+//		- void*: The memory, NULL if the heap is out of memory.
+//
+
+void* TCMemoryTracker::Allocate( size_t size, Tag tag )
+{
+#if TC_MEMORY_TRACKING
+	TCAllocationHeader* header = (TCAllocationHeader*)malloc( TC_MEMORY_HEADER_SIZE + size );
+	if( header == NULL )
+		return NULL;
+
+	if( gCurrentTag != kMemoryTagGeneral )
+	{
+		tag = gCurrentTag;
+	}
+
+	header->size	= size;
+	header->tag		= tag;
+	header->magic	= TC_MEMORY_HEADER_MAGIC;
+
+	TCTagCounters& counters = gTagCounters[ tag ];
+	size_t liveBytes = counters.liveBytes.fetch_add( size, std::memory_order_relaxed ) + size;
+	size_t peakBytes = counters.peakBytes.load( std::memory_order_relaxed );
+	while( liveBytes > peakBytes && !counters.peakBytes.compare_exchange_weak( peakBytes, liveBytes, std::memory_order_relaxed ) )
+	{
+	}
+
+	counters.numLiveAllocations.fetch_add( 1, std::memory_order_relaxed );
+	counters.numAllocations.fetch_add( 1, std::memory_order_relaxed );
+
+#if TC_MEMORY_TRACKER_CALL_STACKS
+	header->numFrames	= CaptureStackBackTrace( 1, TC_MEMORY_TRACKER_STACK_DEPTH, header->frames, NULL );
+	header->previous	= NULL;
+
+	std::lock_guard< std::mutex > lock( GetRegistryLock() );
+	header->serial	= gNextSerial++;
+	header->next	= gLiveAllocations;
+	if( gLiveAllocations != NULL )
+	{
+		gLiveAllocations->previous = header;
+	}
+
+	gLiveAllocations = header;
+#endif
+
+	return (char*)header + TC_MEMORY_HEADER_SIZE;
+#else
+	TC_UNUSED( tag );
+	return malloc( size );
+#endif
+}
+
+//
+// Free
+//		- Will release memory from Allocate.
+// Inputs:
+//		- void* memory: The memory to release, NULL is ignored.
+// Outputs:
+//		- None.
+//
+
+void TCMemoryTracker::Free( void* memory )
+{
+#if TC_MEMORY_TRACKING
+	if( memory == NULL )
+		return;
+
+	TCAllocationHeader* header = (TCAllocationHeader*)( (char*)memory - TC_MEMORY_HEADER_SIZE );
+	TC_ASSERT( header->magic == TC_MEMORY_HEADER_MAGIC && "Freeing memory the tracker didn't allocate, or freeing it twice" );
+
+	TCTagCounters& counters = gTagCounters[ header->tag ];
+	counters.liveBytes.fetch_sub( header->size, std::memory_order_relaxed );
+	counters.numLiveAllocations.fetch_sub( 1, std::memory_order_relaxed );
+
+#if TC_MEMORY_TRACKER_CALL_STACKS
+	{
+		std::lock_guard< std::mutex > lock( GetRegistryLock() );
+		if( header->previous != NULL )
+		{
+			header->previous->next = header->next;
+		}
+		else
+		{
+			gLiveAllocations = header->next;
+		}
+
+		if( header->next != NULL )
+		{
+			header->next->previous = header->previous;
+		}
+	}
+#endif
+
+	header->magic = 0;
+	free( header );
+#else
+	free( memory );
+#endif
+}
+
+//
+// GetStats
+//		- Will read the counters for a tag, while other threads allocate it is only a snapshot.
+// Inputs:
+//		- Tag tag: The tag to read.
+// Outputs:
+//		- Stats: The counters, all zero when tracking is off.
+//
+
+TCMemoryTracker::Stats TCMemoryTracker::GetStats( Tag tag )
+{
+	Stats stats = {};
+
+#if TC_MEMORY_TRACKING
+	const TCTagCounters& counters = gTagCounters[ tag ];
+	stats.liveBytes				= counters.liveBytes.load( std::memory_order_relaxed );
+	stats.peakBytes				= counters.peakBytes.load( std::memory_order_relaxed );
+	stats.numLiveAllocations	= counters.numLiveAllocations.load( std::memory_order_relaxed );
+	stats.numAllocations		= counters.numAllocations.load( std::memory_order_relaxed );
+#else
+	TC_UNUSED( tag );
+#endif
+
+	return stats;
+}
+
+//
+// TagToString
+//		- Will name a tag for reports.
+// Inputs:
+//		- Tag tag: The tag to name.
+// Outputs:
+//		- const char*: The name.
+//
+
+const char* TCMemoryTracker::TagToString( Tag tag )
+{
+	switch( tag )
+	{
+		case kMemoryTagGeneral:			return "General";
+		case kMemoryTagString:			return "String";
+		case kMemoryTagCollections:		return "Collections";
+		case kMemoryTagShaderImporter:	return "ShaderImporter";
+		case kMemoryTagGraphics:		return "Graphics";
+		case kMemoryTagPermanent:		return "Permanent";
+		default:						return "Unknown";
+	}
+}
+
+//
+// SetLeakCheckpoint
+//		- Will mark the point after which every allocation is expected to be freed before ReportLeaks is called.
+// Inputs:
+//		- None.
+// Outputs:
+//		- None.
+//
+
+void TCMemoryTracker::SetLeakCheckpoint()
+{
+#if TC_MEMORY_TRACKING
+	for( int currentTag = 0; currentTag < kNumMemoryTags; ++currentTag )
+	{
+		gTagCounters[ currentTag ].numLiveAtCheckpoint = gTagCounters[ currentTag ].numLiveAllocations.load( std::memory_order_relaxed );
+	}
+
+#if TC_MEMORY_TRACKER_CALL_STACKS
+	std::lock_guard< std::mutex > lock( GetRegistryLock() );
+	gCheckpointSerial = gNextSerial;
+#endif
+#endif
+}
+
+#if TC_MEMORY_TRACKER_CALL_STACKS
+
+//
+// TCLeakRecord
+//		- A copy of a leaked allocation's header, taken so the report can be logged without holding the lock.
+//
+
+struct TCLeakRecord
+{
+	size_t			size;
+	unsigned int	tag;
+	unsigned int	numFrames;
+	void*			frames[ TC_MEMORY_TRACKER_STACK_DEPTH ];
+};
+
+//
+// LogCallStack
+//		- Will log one line per frame, with the function, file and line when the symbols can be found.
+// Inputs:
+//		- const TCLeakRecord& record: The allocation whose stack to log.
+// Outputs:
+//		- None.
+//
+
+static void LogCallStack( const TCLeakRecord& record )
+{
+	HANDLE process = GetCurrentProcess();
+
+	static bool symbolsLoaded = false;
+	if( !symbolsLoaded )
+	{
+		SymSetOptions( SYMOPT_LOAD_LINES | SYMOPT_UNDNAME | SYMOPT_DEFERRED_LOADS );
+		symbolsLoaded = SymInitialize( process, NULL, TRUE ) != FALSE;
+	}
+
+	union
+	{
+		SYMBOL_INFO		info;
+		char			buffer[ sizeof( SYMBOL_INFO ) + TC_MEMORY_SYMBOL_NAME_SIZE ];
+	} symbol;
+
+	for( unsigned int currentFrame = 0; currentFrame < record.numFrames; ++currentFrame )
+	{
+		DWORD64 address = (DWORD64)record.frames[ currentFrame ];
+
+		TCStringBuilder line;
+		line.Append( "\t\t" );
+
+		symbol.info.SizeOfStruct	= sizeof( SYMBOL_INFO );
+		symbol.info.MaxNameLen		= TC_MEMORY_SYMBOL_NAME_SIZE;
+
+		DWORD64 symbolDisplacement = 0;
+		DWORD lineDisplacement = 0;
+		IMAGEHLP_LINE64 sourceLine = {};
+		sourceLine.SizeOfStruct = sizeof( IMAGEHLP_LINE64 );
+
+		if( symbolsLoaded && SymGetLineFromAddr64( process, address, &lineDisplacement, &sourceLine ) )
+		{
+			line.Append( sourceLine.FileName ).Append( '(' ).Append( (int)sourceLine.LineNumber ).Append( "): " );
+		}
+
+		if( symbolsLoaded && SymFromAddr( process, address, &symbolDisplacement, &symbol.info ) )
+		{
+			line.Append( symbol.info.Name );
+		}
+		else
+		{
+			char8 addressString[ 2 + sizeof( void* ) * 2 + 1 ];
+			snprintf( addressString, sizeof( addressString ), "%p", record.frames[ currentFrame ] );
+			line.Append( addressString );
+		}
+
+		gLogger->LogWarning( line.Data() );
+	}
+}
+
+#endif // TC_MEMORY_TRACKER_CALL_STACKS
+
+//
+// ReportLeaks
+//		- Will log the allocations made since the checkpoint that are still live, with their call stacks in debug builds.
+//		  Memory tagged kMemoryTagPermanent is left out.
+// Inputs:
+//		- None.
+// Outputs:
+//		- int: The number of leaked allocations.
+//
+
+int TCMemoryTracker::ReportLeaks()
+{
+	int numLeaks = 0;
+
+#if TC_MEMORY_TRACKER_CALL_STACKS
+	//
+	// Copy the leaks out first, logging allocates and would deadlock on the registry lock.
+	//
+
+	static TCLeakRecord records[ TC_MEMORY_TRACKER_MAX_REPORTED_LEAKS ];	// Static, too large for the stack.
+	size_t leakedBytes = 0;
+
+	{
+		std::lock_guard< std::mutex > lock( GetRegistryLock() );
+		for( TCAllocationHeader* header = gLiveAllocations; header != NULL; header = header->next )
+		{
+			if( header->serial < gCheckpointSerial || header->tag == kMemoryTagPermanent )
+				continue;
+
+			if( numLeaks < TC_MEMORY_TRACKER_MAX_REPORTED_LEAKS )
+			{
+				TCLeakRecord& record = records[ numLeaks ];
+				record.size			= header->size;
+				record.tag			= header->tag;
+				record.numFrames	= header->numFrames;
+				memcpy( record.frames, header->frames, sizeof( void* ) * header->numFrames );
+			}
+
+			leakedBytes += header->size;
+			numLeaks++;
+		}
+	}
+
+	if( numLeaks == 0 )
+		return 0;
+
+	TCStringBuilder summary;
+	summary.Append( "[TCMemoryTracker] " ).Append( numLeaks ).Append( " allocations leaked, " ).Append( (int)leakedBytes ).Append( " bytes." );
+	gLogger->LogWarning( summary.Data() );
+
+	int numReported = ( numLeaks < TC_MEMORY_TRACKER_MAX_REPORTED_LEAKS ) ? numLeaks : TC_MEMORY_TRACKER_MAX_REPORTED_LEAKS;
+	for( int currentLeak = 0; currentLeak < numReported; ++currentLeak )
+	{
+		TCStringBuilder line;
+		line.Append( "\t" ).Append( (int)records[ currentLeak ].size ).Append( " bytes tagged " ).Append( TagToString( (Tag)records[ currentLeak ].tag ) ).Append( ", allocated at:" );
+		gLogger->LogWarning( line.Data() );
+
+		LogCallStack( records[ currentLeak ] );
+	}
+#elif TC_MEMORY_TRACKING
+	//
+	// Without call stacks the live allocations can only be counted per tag.
+	//
+
+	for( int currentTag = 0; currentTag < kNumMemoryTags; ++currentTag )
+	{
+		int numTagLeaks = (int)gTagCounters[ currentTag ].numLiveAllocations.load( std::memory_order_relaxed ) - (int)gTagCounters[ currentTag ].numLiveAtCheckpoint;
+		if( currentTag == kMemoryTagPermanent || numTagLeaks <= 0 )
+			continue;
+
+		TCStringBuilder line;
+		line.Append( "[TCMemoryTracker] " ).Append( numTagLeaks ).Append( " allocations leaked, tagged " ).Append( TagToString( (Tag)currentTag ) ).Append( '.' );
+		gLogger->LogWarning( line.Data() );
+
+		numLeaks += numTagLeaks;
+	}
+#endif
+
+	return numLeaks;
+}
+
+//
+// ReportStats
+//		- Will log the live bytes, peak bytes and allocation counts of every tag.
+// Inputs:
+//		- None.
+// Outputs:
+//		- None.
+//
+
+void TCMemoryTracker::ReportStats()
+{
+#if TC_MEMORY_TRACKING
+	for( int currentTag = 0; currentTag < kNumMemoryTags; ++currentTag )
+	{
+		Stats stats = GetStats( (Tag)currentTag );
+
+		TCStringBuilder line;
+		line.Append( "[TCMemoryTracker] " ).Append( TagToString( (Tag)currentTag ) ).Append( ": " ).Append( (int)stats.liveBytes ).Append( " bytes live, " );
+		line.Append( (int)stats.peakBytes ).Append( " bytes peak, " ).Append( (int)stats.numLiveAllocations ).Append( " live of " );
+		line.Append( (int)stats.numAllocations ).Append( " allocations." );
+
+		gLogger->LogInfo( line.Data() );
+	}
+#endif
+}
+
+//
+// Constructor
+//		- Will tag allocations on this thread until the scope ends.
+// Inputs:
+//		- TCMemoryTracker::Tag tag: The tag to use.
+// Outputs:
+//		- None.
+//
+
+TCMemoryTagScope::TCMemoryTagScope( TCMemoryTracker::Tag tag )
+{
+#if TC_MEMORY_TRACKING
+	mPreviousTag = gCurrentTag;
+	gCurrentTag = tag;
+#else
+	mPreviousTag = tag;
+#endif
+}
+
+//
+// Destructor
+//		- Will go back to the tag that was in use before this scope.
+// Inputs:
+//		- None.
+// Outputs:
+//		- None.
+//
+
+TCMemoryTagScope::~TCMemoryTagScope()
+{
+#if TC_MEMORY_TRACKING
+	gCurrentTag = mPreviousTag;
+#endif
+}
+
+#if TC_MEMORY_TRACKING
+
+//
+// Global new and delete
+//		- Every object the engine news up is counted, under the tag of the innermost TCMemoryTagScope.
+//
+
+void* operator new( size_t size )
+{
+	void* memory = TCMemoryTracker::Allocate( size, TCMemoryTracker::kMemoryTagGeneral );
+	if( memory == NULL )
+	{
+		throw std::bad_alloc();
+	}
+
+	return memory;
+}
+
+void* operator new[]( size_t size )
+{
+	return operator new( size );
+}
+
+void* operator new( size_t size, const std::nothrow_t& ) noexcept
+{
+	return TCMemoryTracker::Allocate( size, TCMemoryTracker::kMemoryTagGeneral );
+}
+
+void* operator new[]( size_t size, const std::nothrow_t& ) noexcept
+{
+	return TCMemoryTracker::Allocate( size, TCMemoryTracker::kMemoryTagGeneral );
+}
+
+void operator delete( void* memory ) noexcept								{ TCMemoryTracker::Free( memory ); }
+void operator delete[]( void* memory ) noexcept								{ TCMemoryTracker::Free( memory ); }
+void operator delete( void* memory, size_t ) noexcept						{ TCMemoryTracker::Free( memory ); }
+void operator delete[]( void* memory, size_t ) noexcept						{ TCMemoryTracker::Free( memory ); }
+void operator delete( void* memory, const std::nothrow_t& ) noexcept		{ TCMemoryTracker::Free( memory ); }
+void operator delete[]( void* memory, const std::nothrow_t& ) noexcept		{ TCMemoryTracker::Free( memory ); }
+
+#endif // TC_MEMORY_TRACKING
@@ -0,0 +1,88 @@
+//
+// TCMemoryTracker.h
+// This file will declare the optional layer that attributes heap memory to the subsystems that allocate it.
+//
+
+#ifndef __TC_MEMORY_TRACKER_H__
+#define __TC_MEMORY_TRACKER_H__
+
+//
+// Includes
+//
+
+#include "TCPlatformPrecompilerSymbols.h"
+
+#include <stddef.h>
+
+//
+// Defines
+//
+
+#ifndef TC_MEMORY_TRACKING
+	#define TC_MEMORY_TRACKING					TC_BUILD_CONFIGURATION_DEBUG	// Routes new/delete and engine allocations through the tracker.
+#endif
+
+#define TC_MEMORY_TRACKER_CALL_STACKS			( TC_MEMORY_TRACKING && TC_BUILD_CONFIGURATION_DEBUG )
+#define TC_MEMORY_TRACKER_STACK_DEPTH			(16)
+#define TC_MEMORY_TRACKER_MAX_REPORTED_LEAKS	(64)	// The leak report lists this many allocations, the rest are only counted.
+
+//
+// When tracking is on every allocation carries a small header with its size and tag, global new and delete are
+// replaced so all of the engine's objects are counted. Memory is tagged by the innermost TCMemoryTagScope, the tag
+// an allocation asks for is only used when no scope has been opened. When tracking is off, Allocate and Free go
+// straight to the heap and the statistics stay empty.
+//
+
+namespace TCMemoryTracker
+{
+	enum Tag
+	{
+		kMemoryTagGeneral,
+		kMemoryTagString,
+		kMemoryTagCollections,
+		kMemoryTagShaderImporter,
+		kMemoryTagGraphics,
+		kMemoryTagPermanent,		// Meant to live until the process exits, never reported as a leak.
+		kNumMemoryTags,
+	};
+
+	struct Stats
+	{
+		size_t			liveBytes;
+		size_t			peakBytes;
+		unsigned int	numLiveAllocations;
+		unsigned int	numAllocations;			// Every allocation ever made with the tag.
+	};
+
+	void*			Allocate( size_t size, Tag tag );
+	void			Free( void* memory );
+
+	Stats			GetStats( Tag tag );
+	const char*		TagToString( Tag tag );
+
+	void			SetLeakCheckpoint();
+	int				ReportLeaks();
+	void			ReportStats();
+}
+
+//
+// Class Declaration
+//		- Tags every allocation made on this thread while the scope is open.
+//
+
+class TCMemoryTagScope
+{
+	public:		// Members
+	public:		// Methods
+								TCMemoryTagScope( TCMemoryTracker::Tag tag );
+								~TCMemoryTagScope();
+
+	private:	// Members
+		TCMemoryTracker::Tag	mPreviousTag;
+
+	private:	// Methods
+								TCMemoryTagScope( const TCMemoryTagScope& scope );
+		TCMemoryTagScope&		operator=( const TCMemoryTagScope& scope );
+};
+
+#endif // __TC_MEMORY_TRACKER_H__
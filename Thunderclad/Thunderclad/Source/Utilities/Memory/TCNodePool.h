@@ -0,0 +1,72 @@
+//
+// TCNodePool.h
+// This file will declare a pool that hands out fixed size objects from blocks and recycles them through a free list.
+//
+
+#ifndef __TC_NODE_POOL_H__
+#define __TC_NODE_POOL_H__
+
+//
+// Includes
+//
+
+#include "TCPlatformPrecompilerSymbols.h"
+
+//
+// Defines
+//
+
+//
+// Class Declaration
+//		- Objects are carved out of blocks of NodesPerBlock objects, a freed object goes on a free list and is handed out
+//		  again by the next Allocate, so once the pool has warmed up allocating and freeing never touch the heap.
+//		- Blocks are only released when the pool is destroyed, every object must be freed before then.
+//
+
+template< typename Object, unsigned int NodesPerBlock = 64 >
+class TCNodePool
+{
+	public:		// Members
+	public:		// Methods
+							TCNodePool();
+							~TCNodePool();
+
+		inline int			Count() const				{ return mCount; }
+		inline int			Capacity() const			{ return mCapacity; }
+
+		template< typename... Args >
+		Object*				Allocate( Args&&... args );
+		void				Free( Object* object );
+
+	private:	// Members
+		union Node
+		{
+			Node*			nextFree;
+			char			storage[ sizeof( Object ) ];
+			long long		alignLongLong;		// The union keeps the storage aligned for any type the heap would be.
+			double			alignDouble;
+			void*			alignPointer;
+		};
+
+		struct Block
+		{
+			Block*			next;
+			Node			nodes[ NodesPerBlock ];
+		};
+
+		Block*				mBlocks;
+		Node*				mFreeNodes;
+		int					mCount;
+		int					mCapacity;
+
+	private:	// Methods
+		// Objects handed out point into the blocks, so pools can't be copied.
+							TCNodePool( const TCNodePool& pool );
+		TCNodePool&			operator=( const TCNodePool& pool );
+
+		void				AllocateBlock();
+};
+
+#include "TCNodePool.hpp"
+
+#endif // __TC_NODE_POOL_H__
@@ -0,0 +1,140 @@
+//
+// TCNodePool.hpp
+// This file will define the methods declared for a node pool.
+//
+
+#ifndef __TC_NODE_POOL_HPP__
+#define __TC_NODE_POOL_HPP__
+
+//
+// Includes
+//
+
+#include "TCNodePool.h"
+#include "TCMemUtils.h"
+#include "TCLogger.h"
+
+#include <new>
+
+//
+// Defines
+//
+
+//
+// Default Constructor
+//		- Initializes the pool to a safe state, no block is allocated until the first object is.
+// Inputs:
+//		- None.
+// Outputs:
+//		- None.
+//
+
+template< class Object, unsigned int NodesPerBlock >
+TCNodePool< Object, NodesPerBlock >::TCNodePool()
+{
+	mBlocks		= NULL;
+	mFreeNodes	= NULL;
+	mCount		= 0;
+	mCapacity	= 0;
+}
+
+//
+// Destructor
+//		- Will release every block.
+// Inputs:
+//		- None.
+// Outputs:
+//		- None.
+//
+
+template< class Object, unsigned int NodesPerBlock >
+TCNodePool< Object, NodesPerBlock >::~TCNodePool()
+{
+	if( mCount != 0 )
+	{
+		TCLogger::GetInstance()->LogError("Node pool destroyed while objects were still allocated from it.");
+	}
+
+	while( mBlocks != NULL )
+	{
+		Block* block = mBlocks;
+		mBlocks = block->next;
+		delete block;
+	}
+}
+
+//
+// Allocate
+//		- Will construct an object in a free node.
+// Inputs:
+//		- Args&&... args: The arguments for the object's constructor.
+// Outputs:
+//		- Object*: The new object.
+//
+
+template< class Object, unsigned int NodesPerBlock >
+template< typename... Args >
+Object* TCNodePool< Object, NodesPerBlock >::Allocate( Args&&... args )
+{
+	if( mFreeNodes == NULL )
+	{
+		AllocateBlock();
+	}
+
+	Node* node = mFreeNodes;
+	mFreeNodes = node->nextFree;
+	mCount++;
+
+	return new( node->storage ) Object( TCForward< Args >( args )... );
+}
+
+//
+// Free
+//		- Will destroy an object and put its node back on the free list.
+// Inputs:
+//		- Object* object: The object to free, it must have come from this pool. NULL is ignored.
+// Outputs:
+//		- None.
+//
+
+template< class Object, unsigned int NodesPerBlock >
+void TCNodePool< Object, NodesPerBlock >::Free( Object* object )
+{
+	if( object == NULL )
+		return;
+
+	object->~Object();
+
+	Node* node = reinterpret_cast< Node* >( object );
+	node->nextFree = mFreeNodes;
+	mFreeNodes = node;
+	mCount--;
+}
+
+//
+// AllocateBlock
+//		- Will add a block of nodes to the free list.
+// Inputs:
+//		- None.
+// Outputs:
+//		- None.
+//
+
+template< class Object, unsigned int NodesPerBlock >
+void TCNodePool< Object, NodesPerBlock >::AllocateBlock()
+{
+	Block* block = new Block;
+	block->next = mBlocks;
+	mBlocks = block;
+
+	// Link the nodes back to front so the first node is handed out first.
+	for( int currentNode = NodesPerBlock - 1; currentNode >= 0; --currentNode )
+	{
+		block->nodes[ currentNode ].nextFree = mFreeNodes;
+		mFreeNodes = &block->nodes[ currentNode ];
+	}
+
+	mCapacity += NodesPerBlock;
+}
+
+#endif // __TC_NODE_POOL_HPP__
@@ -0,0 +1,365 @@
+//
+// TCPoolAllocator.cpp
+// This file will define the block pool and the allocator policy that draws from it.
+//
+
+//
+// Includes
+//
+
+#include "TCPoolAllocator.h"
+
+//
+// Defines
+//
+
+//
+// Thread Cache Slots
+//		- Every thread gets the next slot the first time it touches any pool and keeps it for every pool, a slot past
+//		  TC_POOL_MAX_THREAD_CACHES means the thread has no cache.
+//
+
+static std::atomic< int >	gNumThreadCacheSlots( 0 );
+static thread_local int		gThreadCacheSlot = -1;
+
+static inline int GetThreadCacheSlot()
+{
+	if( gThreadCacheSlot < 0 )
+	{
+		gThreadCacheSlot = gNumThreadCacheSlots.fetch_add( 1 );
+	}
+
+	return ( gThreadCacheSlot < TC_POOL_MAX_THREAD_CACHES ) ? gThreadCacheSlot : -1;
+}
+
+//
+// Constructor
+//		- Will create an empty pool, the first chunk is allocated on the first Allocate.
+// Inputs:
+//		- unsigned int blockSize: The size of every block, it is rounded up to TC_POOL_BLOCK_ALIGNMENT.
+//		- unsigned int blocksPerChunk: The number of blocks allocated from the heap at once.
+//		- TCMemoryTracker::Tag tag: The tag the chunks are counted against.
+// Outputs:
+//		- None.
+//
+
+TCPoolAllocator::TCPoolAllocator( unsigned int blockSize, unsigned int blocksPerChunk, TCMemoryTracker::Tag tag )
+	: mChunks( NULL ), mNumChunks( 0 )
+{
+	TC_ASSERT( blocksPerChunk > 0 && "A pool needs at least one block per chunk" );
+
+	if( blockSize < sizeof( FreeBlock ) )
+	{
+		blockSize = sizeof( FreeBlock );
+	}
+
+	mBlockSize				= ( blockSize + TC_POOL_BLOCK_ALIGNMENT - 1 ) & ~( TC_POOL_BLOCK_ALIGNMENT - 1 );
+	mBlocksPerChunk			= blocksPerChunk;
+	mTag					= tag;
+	mFreeBlocks				= NULL;
+	mNumSharedAllocated		= 0;
+
+	for( int currentCache = 0; currentCache < TC_POOL_MAX_THREAD_CACHES; ++currentCache )
+	{
+		mCaches[ currentCache ].freeBlocks	= NULL;
+		mCaches[ currentCache ].numFree		= 0;
+		mCaches[ currentCache ].numAllocated.store( 0, std::memory_order_relaxed );
+	}
+}
+
+//
+// Destructor
+//		- Will release every chunk.
+// Inputs:
+//		- None.
+// Outputs:
+//		- None.
+//
+
+TCPoolAllocator::~TCPoolAllocator()
+{
+	TC_ASSERT( Count() == 0 && "A pool was destroyed while blocks were still allocated" );
+
+	Chunk* chunk = mChunks.load( std::memory_order_relaxed );
+	while( chunk != NULL )
+	{
+		Chunk* next = chunk->next;
+		TCMemoryTracker::Free( chunk );
+		chunk = next;
+	}
+}
+
+//
+// Allocate
+//		- Will hand out a block, from this thread's cache when it has one.
+// Inputs:
+//		- None.
+// Outputs:
+//		- void*: The block, NULL if the heap is out of memory.
+//
+
+void* TCPoolAllocator::Allocate()
+{
+	int slot = GetThreadCacheSlot();
+	if( slot < 0 )
+	{
+		std::lock_guard< std::mutex > lock( mLock );
+		if( mFreeBlocks == NULL )
+		{
+			AllocateChunk();
+			if( mFreeBlocks == NULL )
+				return NULL;
+		}
+
+		FreeBlock* block = mFreeBlocks;
+		mFreeBlocks = block->next;
+		mNumSharedAllocated++;
+
+		return block;
+	}
+
+	ThreadCache& cache = mCaches[ slot ];
+	if( cache.freeBlocks == NULL )
+	{
+		RefillCache( cache );
+		if( cache.freeBlocks == NULL )
+			return NULL;
+	}
+
+	FreeBlock* block = cache.freeBlocks;
+	cache.freeBlocks = block->next;
+	cache.numFree--;
+	cache.numAllocated.store( cache.numAllocated.load( std::memory_order_relaxed ) + 1, std::memory_order_relaxed );
+
+	return block;
+}
+
+//
+// Free
+//		- Will return a block to this thread's cache, a full cache hands a batch back to the shared list.
+// Inputs:
+//		- void* block: The block to free, it must have come from this pool. NULL is ignored.
+// Outputs:
+//		- None.
+//
+
+void TCPoolAllocator::Free( void* block )
+{
+	if( block == NULL )
+		return;
+
+	TC_ASSERT( Owns( block ) && "Freeing a block that didn't come from this pool" );
+
+	FreeBlock* freeBlock = (FreeBlock*)block;
+
+	int slot = GetThreadCacheSlot();
+	if( slot < 0 )
+	{
+		std::lock_guard< std::mutex > lock( mLock );
+		freeBlock->next = mFreeBlocks;
+		mFreeBlocks = freeBlock;
+		mNumSharedAllocated--;
+		return;
+	}
+
+	ThreadCache& cache = mCaches[ slot ];
+	freeBlock->next = cache.freeBlocks;
+	cache.freeBlocks = freeBlock;
+	cache.numFree++;
+	cache.numAllocated.store( cache.numAllocated.load( std::memory_order_relaxed ) - 1, std::memory_order_relaxed );
+
+	if( cache.numFree >= TC_POOL_CACHE_BATCH_SIZE * 2 )
+	{
+		FlushCache( cache, TC_POOL_CACHE_BATCH_SIZE );
+	}
+}
+
+//
+// Owns
+//		- Will tell if memory points into one of this pool's chunks, whether or not it is allocated.
+// Inputs:
+//		- const void* memory: The memory to check.
+// Outputs:
+//		- bool: Is the memory inside a chunk.
+//
+
+bool TCPoolAllocator::Owns( const void* memory ) const
+{
+	unsigned int chunkSize = mBlockSize * mBlocksPerChunk;
+	for( Chunk* chunk = mChunks.load( std::memory_order_acquire ); chunk != NULL; chunk = chunk->next )
+	{
+		if( (const char*)memory >= chunk->blocks && (const char*)memory < chunk->blocks + chunkSize )
+			return true;
+	}
+
+	return false;
+}
+
+//
+// Count
+//		- Will count the blocks handed out and not yet freed, while other threads are using the pool it is only a snapshot.
+// Inputs:
+//		- None.
+// Outputs:
+//		- int: The number of blocks in use.
+//
+
+int TCPoolAllocator::Count() const
+{
+	// A block can be allocated on one thread and freed on another, so only the total of every cache is meaningful.
+	int count = 0;
+	for( int currentCache = 0; currentCache < TC_POOL_MAX_THREAD_CACHES; ++currentCache )
+	{
+		count += mCaches[ currentCache ].numAllocated.load( std::memory_order_relaxed );
+	}
+
+	std::lock_guard< std::mutex > lock( mLock );
+	return count + mNumSharedAllocated;
+}
+
+//
+// Capacity
+//		- Will count the blocks in every chunk, allocated or not.
+// Inputs:
+//		- None.
+// Outputs:
+//		- int: The number of blocks.
+//
+
+int TCPoolAllocator::Capacity() const
+{
+	return mNumChunks.load( std::memory_order_relaxed ) * (int)mBlocksPerChunk;
+}
+
+//
+// RefillCache
+//		- Will move a batch of blocks from the shared list into a thread's cache, allocating a chunk if it's empty.
+// Inputs:
+//		- ThreadCache& cache: The cache to fill.
+// Outputs:
+//		- None.
+//
+
+void TCPoolAllocator::RefillCache( ThreadCache& cache )
+{
+	std::lock_guard< std::mutex > lock( mLock );
+	if( mFreeBlocks == NULL )
+	{
+		AllocateChunk();
+	}
+
+	for( int currentBlock = 0; currentBlock < TC_POOL_CACHE_BATCH_SIZE && mFreeBlocks != NULL; ++currentBlock )
+	{
+		FreeBlock* block = mFreeBlocks;
+		mFreeBlocks = block->next;
+
+		block->next = cache.freeBlocks;
+		cache.freeBlocks = block;
+		cache.numFree++;
+	}
+}
+
+//
+// FlushCache
+//		- Will move blocks from a thread's cache back to the shared list so other threads can use them.
+// Inputs:
+//		- ThreadCache& cache: The cache to take from.
+//		- int numBlocks: The number of blocks to move.
+// Outputs:
+//		- None.
+//
+
+void TCPoolAllocator::FlushCache( ThreadCache& cache, int numBlocks )
+{
+	//
+	// Unlink the blocks before taking the lock, only this thread touches its cache.
+	//
+
+	FreeBlock* first = cache.freeBlocks;
+	FreeBlock* last = first;
+	for( int currentBlock = 1; currentBlock < numBlocks; ++currentBlock )
+	{
+		last = last->next;
+	}
+
+	cache.freeBlocks = last->next;
+	cache.numFree -= numBlocks;
+
+	std::lock_guard< std::mutex > lock( mLock );
+	last->next = mFreeBlocks;
+	mFreeBlocks = first;
+}
+
+//
+// AllocateChunk
+//		- Will allocate a chunk and put its blocks on the shared list, the lock must be held.
+// Inputs:
+//		- None.
+// Outputs:
+//		- None.
+//
+
+void TCPoolAllocator::AllocateChunk()
+{
+	// The header sits in front of the blocks, the extra alignment lets the blocks start aligned wherever the heap puts it.
+	Chunk* chunk = (Chunk*)TCMemoryTracker::Allocate( sizeof( Chunk ) + TC_POOL_BLOCK_ALIGNMENT + mBlockSize * mBlocksPerChunk, mTag );
+	if( chunk == NULL )
+		return;
+
+	size_t blocksAddress = (size_t)( chunk + 1 );
+	blocksAddress = ( blocksAddress + TC_POOL_BLOCK_ALIGNMENT - 1 ) & ~(size_t)( TC_POOL_BLOCK_ALIGNMENT - 1 );
+	chunk->blocks = (char*)blocksAddress;
+
+	//
+	// Thread the blocks in address order, so a fresh chunk hands them out front to back.
+	//
+
+	for( int currentBlock = (int)mBlocksPerChunk - 1; currentBlock >= 0; --currentBlock )
+	{
+		FreeBlock* block = (FreeBlock*)( chunk->blocks + currentBlock * mBlockSize );
+		block->next = mFreeBlocks;
+		mFreeBlocks = block;
+	}
+
+	chunk->next = mChunks.load( std::memory_order_relaxed );
+	mChunks.store( chunk, std::memory_order_release );
+	mNumChunks.fetch_add( 1, std::memory_order_relaxed );
+}
+
+//
+// Allocate
+//		- Will hand out a block from the pool if the request fits in one, otherwise heap storage.
+// Inputs:
+//		- unsigned int size: The number of bytes needed.
+// Outputs:
+//		- void*: The storage, NULL if size is zero.
+//
+
+void* TCPoolBackedAllocator::Allocate( unsigned int size )
+{
+	if( size == 0 )
+		return NULL;
+
+	void* memory = ( mPool != NULL && size <= mPool->BlockSize() ) ? mPool->Allocate() : NULL;
+	return ( memory != NULL ) ? memory : TCMemoryTracker::Allocate( size, TCMemoryTracker::kMemoryTagCollections );
+}
+
+//
+// Free
+//		- Will return storage to the pool it came from, or to the heap.
+// Inputs:
+//		- void* memory: The storage to release, NULL is ignored.
+// Outputs:
+//		- None.
+//
+
+void TCPoolBackedAllocator::Free( void* memory )
+{
+	if( mPool != NULL && memory != NULL && mPool->Owns( memory ) )
+	{
+		mPool->Free( memory );
+		return;
+	}
+
+	TCMemoryTracker::Free( memory );
+}
@@ -0,0 +1,176 @@
+//
+// TCPoolAllocator.h
+// This file will declare a thread safe pool of fixed size blocks that keeps a cache of free blocks for each thread.
+//
+
+#ifndef __TC_POOL_ALLOCATOR_H__
+#define __TC_POOL_ALLOCATOR_H__
+
+//
+// Includes
+//
+
+#include "TCPlatformPrecompilerSymbols.h"
+#include "TCMemUtils.h"
+#include "TCMemoryTracker.h"
+
+#include <stddef.h>
+#include <atomic>
+#include <mutex>
+#include <new>
+
+//
+// Defines
+//
+
+#define TC_POOL_DEFAULT_BLOCKS_PER_CHUNK	(256)
+#define TC_POOL_BLOCK_ALIGNMENT				(16)	// Matches the heap, blocks are rounded up to a multiple of this.
+#define TC_POOL_MAX_THREAD_CACHES			(16)	// Threads started after this many go straight to the shared list.
+#define TC_POOL_CACHE_BATCH_SIZE			(32)	// Blocks moved between a thread's cache and the shared list at once.
+
+//
+// Class Declaration
+//		- Blocks are carved out of chunks and recycled through free lists. Each thread allocates from and frees into
+//		  its own cache without locking, only when a cache runs dry or holds too many blocks is a batch moved to or
+//		  from the shared list under the lock.
+//		- A block freed on another thread goes into that thread's cache. The blocks cached by a thread that has
+//		  exited aren't reused, there are never more than twice TC_POOL_CACHE_BATCH_SIZE of them.
+//		- Chunks are only released when the pool is destroyed, every block must be freed before then. They are
+//		  allocated through TCMemoryTracker under the pool's tag.
+//
+
+class TCPoolAllocator
+{
+	public:		// Members
+	public:		// Methods
+								TCPoolAllocator( unsigned int blockSize, unsigned int blocksPerChunk = TC_POOL_DEFAULT_BLOCKS_PER_CHUNK,
+												 TCMemoryTracker::Tag tag = TCMemoryTracker::kMemoryTagCollections );
+								~TCPoolAllocator();
+
+		void*					Allocate();
+		void					Free( void* block );
+
+		bool					Owns( const void* memory ) const;
+
+		inline unsigned int		BlockSize() const			{ return mBlockSize; }
+		int						Count() const;				// Blocks handed out and not yet freed.
+		int						Capacity() const;
+
+	private:	// Members
+		struct FreeBlock
+		{
+			FreeBlock*			next;
+		};
+
+		struct Chunk
+		{
+			Chunk*				next;
+			char*				blocks;
+		};
+
+		struct ThreadCache
+		{
+			FreeBlock*			freeBlocks;
+			int					numFree;
+			std::atomic< int >	numAllocated;				// Only the owning thread writes it, it's atomic so Count can read it.
+			char				padding[ TC_CACHE_LINE_SIZE ];
+		};
+
+		ThreadCache				mCaches[ TC_POOL_MAX_THREAD_CACHES ];
+
+		mutable std::mutex		mLock;						// Guards everything below except mChunks, which is only read without it.
+		FreeBlock*				mFreeBlocks;
+		std::atomic< Chunk* >	mChunks;
+		std::atomic< int >		mNumChunks;
+		int						mNumSharedAllocated;		// Blocks handed out to threads without a cache.
+		unsigned int			mBlockSize;
+		unsigned int			mBlocksPerChunk;
+		TCMemoryTracker::Tag	mTag;
+
+	private:	// Methods
+		// Blocks handed out point into the chunks, so pools can't be copied.
+								TCPoolAllocator( const TCPoolAllocator& pool );
+		TCPoolAllocator&		operator=( const TCPoolAllocator& pool );
+
+		void					RefillCache( ThreadCache& cache );
+		void					FlushCache( ThreadCache& cache, int numBlocks );
+		void					AllocateChunk();
+};
+
+//
+// Class Declaration
+//		- An allocator policy, see TCAllocator.h, that draws requests up to the block size from a pool and larger ones
+//		  from the heap, so small collections share the pool's blocks.
+//
+
+class TCPoolBackedAllocator
+{
+	public:		// Members
+	public:		// Methods
+								TCPoolBackedAllocator()							{ mPool = NULL; }
+								TCPoolBackedAllocator( TCPoolAllocator* pool )	{ mPool = pool; }
+
+		void*					Allocate( unsigned int size );
+		void					Free( void* memory );
+		inline bool				CanTransfer( void* )							{ return true; }
+		inline unsigned int		GetInlineSize()									{ return 0; }
+
+		inline TCPoolAllocator*	GetPool() const									{ return mPool; }
+
+	private:	// Members
+		TCPoolAllocator*		mPool;
+};
+
+//
+// Class Declaration
+//		- Deriving from this makes new and delete of Object come from a pool shared by every Object, for classes
+//		  created by the thousand. A subclass of a different size goes to the heap as usual. The pool's chunks are
+//		  counted against MemoryTag.
+//
+
+template< typename Object, unsigned int BlocksPerChunk = TC_POOL_DEFAULT_BLOCKS_PER_CHUNK, TCMemoryTracker::Tag MemoryTag = TCMemoryTracker::kMemoryTagGeneral >
+class TCPooledObject
+{
+	public:		// Members
+	public:		// Methods
+		static void*			operator new( size_t size );
+		static void				operator delete( void* memory, size_t size )	{ ( size == sizeof( Object ) ) ? GetPool().Free( memory ) : ::operator delete( memory ); }
+
+		// The pool is never destroyed, so objects can still be deleted while statics are being torn down.
+		static TCPoolAllocator&	GetPool()
+		{
+			static TCPoolAllocator* gPool = []()
+			{
+				TCMemoryTagScope memoryTag( TCMemoryTracker::kMemoryTagPermanent );
+				return new TCPoolAllocator( sizeof( Object ), BlocksPerChunk, MemoryTag );
+			}();
+
+			return *gPool;
+		}
+};
+
+//
+// operator new
+//		- Will take a block from the pool for an Object, anything larger goes to the heap.
+// Inputs:
+//		- size_t size: The size of the object being created.
+// Outputs:
+//		- void*: The memory, never NULL. Throws std::bad_alloc when the pool can't allocate a chunk.
+//
+
+template< typename Object, unsigned int BlocksPerChunk, TCMemoryTracker::Tag MemoryTag >
+inline void* TCPooledObject< Object, BlocksPerChunk, MemoryTag >::operator new( size_t size )
+{
+	if( size != sizeof( Object ) )
+		return ::operator new( size );
+
+	void* memory = GetPool().Allocate();
+	if( memory == NULL )
+	{
+		throw std::bad_alloc();
+	}
+
+	return memory;
+}
+
+#endif // __TC_POOL_ALLOCATOR_H__
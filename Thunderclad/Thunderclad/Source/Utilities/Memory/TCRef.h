@@ -0,0 +1,122 @@
+//
+// TCRef.h
+// This file will define a smart pointer for objects that count their own references.
+//
+
+#ifndef __TC_REF_H__
+#define __TC_REF_H__
+
+//
+// Includes
+//
+
+#include "TCPlatformPrecompilerSymbols.h"
+#include "TCMemUtils.h"
+
+#include <stddef.h>
+
+//
+// Class Declaration
+//		- Object counts its own references through AddReference and RemoveReference, and decides what happens when the
+//		  last one goes away. Graphics resources queue themselves to be destroyed at the end of the frame.
+//		- A new object starts with no references, the first TCRef to hold it takes ownership. Objects held by a TCRef
+//		  must come from new and must not be deleted by anything else, so taking a raw pointer is always spelled out:
+//		  TCMakeRef, the explicit constructor or Reset.
+//		- The count is atomic, so copies can be made and dropped on any thread. A single TCRef isn't locked.
+//
+
+template< typename Object >
+class TCRef
+{
+	public:		// Members
+	public:		// Methods
+								TCRef() : mObject( NULL )										{}
+		explicit				TCRef( Object* object ) : mObject( object )						{ if( mObject ) mObject->AddReference(); }
+								TCRef( const TCRef& ref ) : mObject( ref.mObject )				{ if( mObject ) mObject->AddReference(); }
+								TCRef( TCRef&& ref ) : mObject( ref.mObject )					{ ref.mObject = NULL; }
+		template< typename Other >
+								TCRef( const TCRef< Other >& ref ) : mObject( ref.Get() )		{ if( mObject ) mObject->AddReference(); }
+								~TCRef()														{ if( mObject ) mObject->RemoveReference(); }
+
+		inline TCRef&			operator=( const TCRef& ref )		{ Reset( ref.mObject ); return *this; }
+		inline TCRef&			operator=( TCRef&& ref );
+
+		inline Object*			operator->() const					{ TC_ASSERT( mObject && "Dereferenced an empty TCRef" ); return mObject; }
+		inline Object&			operator*() const					{ TC_ASSERT( mObject && "Dereferenced an empty TCRef" ); return *mObject; }
+		inline explicit			operator bool() const				{ return mObject != NULL; }
+
+		inline bool				operator==( const TCRef& ref ) const	{ return mObject == ref.mObject; }
+		inline bool				operator!=( const TCRef& ref ) const	{ return mObject != ref.mObject; }
+
+		inline Object*			Get() const							{ return mObject; }
+		inline bool				IsValid() const						{ return mObject != NULL; }
+		inline void				Reset( Object* object = NULL );
+
+	private:	// Members
+		Object*					mObject;
+};
+
+//
+// Move Assignment
+//		- Will take another ref's object without touching the count, and drop the one held before.
+// Inputs:
+//		- TCRef&& ref: The ref to take from, it's empty after.
+// Outputs:
+//		- TCRef&: This ref.
+//
+
+template< typename Object >
+inline TCRef< Object >& TCRef< Object >::operator=( TCRef&& ref )
+{
+	if( this != &ref )
+	{
+		Object* previous = mObject;
+		mObject = ref.mObject;
+		ref.mObject = NULL;
+
+		if( previous )
+			previous->RemoveReference();
+	}
+
+	return *this;
+}
+
+//
+// Reset
+//		- Will hold another object. The new object is referenced before the old one is dropped, so resetting to the
+//		  object already held can't destroy it.
+// Inputs:
+//		- Object* object: The object to hold, or NULL to hold nothing.
+// Outputs:
+//		- None.
+//
+
+template< typename Object >
+inline void TCRef< Object >::Reset( Object* object )
+{
+	if( object )
+		object->AddReference();
+
+	Object* previous = mObject;
+	mObject = object;
+
+	if( previous )
+		previous->RemoveReference();
+}
+
+//
+// TCMakeRef
+//		- Will create an object and hand it straight to a TCRef, so the object is never owned by a raw pointer.
+// Inputs:
+//		- Args&&... args: The arguments for the object's constructor.
+// Outputs:
+//		- TCRef< Object >: The ref holding the new object.
+//
+
+template< typename Object, typename... Args >
+inline TCRef< Object > TCMakeRef( Args&&... args )
+{
+	return TCRef< Object >( new Object( TCForward< Args >( args )... ) );
+}
+
+#endif // __TC_REF_H__
@@ -9,7 +9,9 @@
 
 #include "TCString.h"
 #include "TCList.h"
-#include <malloc.h>
+#include "TCMemUtils.h"
+#include "TCMemoryTracker.h"
+#include <string.h>
 
 //
 // Defines
@@ -26,8 +28,9 @@
 
 TCString::TCString()
 {
-	mString = NULL;
-	Copy( EMPTY_STRING );
+	mString = mInlineString;
+	mString[ 0 ] = NULL_TERMINATOR;
+	mLength = 0;
 }
 
 //
@@ -41,7 +44,10 @@ TCString::TCString()
 
 TCString::TCString( const char8* string )
 {
-	mString = NULL;
+	mString = mInlineString;
+	mString[ 0 ] = NULL_TERMINATOR;
+	mLength = 0;
+
 	Copy( string );
 }
 
@@ -56,9 +62,47 @@ TCString::TCString( const char8* string )
 
 TCString::TCString( const TCString& string )
 {
-	mString = NULL;
+	mString = mInlineString;
+	mString[ 0 ] = NULL_TERMINATOR;
+	mLength = 0;
+
+	Copy( string );
+}
+
+//
+// TCString View Constructor
+//		- Will initialize this string to the characters of a view.
+// Inputs:
+//		- const TCStringView& string: The characters to initialize to.
+// Outputs:
+//		- None.
+//
+
+TCString::TCString( const TCStringView& string )
+{
+	mString = mInlineString;
+	mString[ 0 ] = NULL_TERMINATOR;
+	mLength = 0;
+
 	Copy( string );
-	mLength = TCStringUtils::Length( Data() );
+}
+
+//
+// TCString Move Constructor
+//		- Will take the characters of another string, leaving it empty. Heap strings hand over their buffer.
+// Inputs:
+//		- TCString&& string: The string to move from.
+// Outputs:
+//		- None.
+//
+
+TCString::TCString( TCString&& string )
+{
+	mString = mInlineString;
+	mString[ 0 ] = NULL_TERMINATOR;
+	mLength = 0;
+
+	(*this) = TCMove( string );
 }
 
 //
@@ -72,9 +116,12 @@ TCString::TCString( const TCString& string )
 
 TCString::TCString( int value )
 {
-	mString = NULL;
-	Copy( TCStringUtils::ItoA( value ) );
-	mLength = TCStringUtils::Length( Data() );
+	mString = mInlineString;
+	mString[ 0 ] = NULL_TERMINATOR;
+	mLength = 0;
+
+	char8 buffer[ TC_INT_STRING_MAX_LENGTH ];
+	Copy( buffer, TCStringUtils::FormatInt( value, buffer ) );
 }
 
 //
@@ -94,7 +141,7 @@ TCString::~TCString()
 
 //
 // AllocateString
-//		- Will allocate a new string at a specific size.
+//		- Will allocate a new heap string at a specific size.
 // Inputs:
 //		- int length: The length of the new string.
 // Outputs:
@@ -103,7 +150,7 @@ TCString::~TCString()
 
 char8* TCString::AllocateString( int length )
 {
-	char8* string = (char8*)malloc( length );
+	char8* string = (char8*)TCMemoryTracker::Allocate( length, TCMemoryTracker::kMemoryTagString );
 	if( string == NULL )
 	{
 		// TODO: Log that there was an allocation failure. 
@@ -115,7 +162,7 @@ char8* TCString::AllocateString( int length )
 
 //
 // ReleaseString
-//		- Will release the memory of a specified string
+//		- Will release the memory of a specified string, the inline string is left alone.
 // Inputs:
 //		- char8* string: the string to release.
 // Outputs:
@@ -124,35 +171,182 @@ char8* TCString::AllocateString( int length )
 
 void TCString::ReleaseString( char8*& string )
 {
-	if( string == NULL )
+	if( string == NULL || string == mInlineString )
 	{
 		return;
 	}
 
-	free( string );
+	TCMemoryTracker::Free( string );
 	string = NULL;
 }
 
 //
 // ResizeString
-//		- Will resize a string to a new size
+//		- Will make sure the string can hold a number of characters, keeping the current contents. It never shrinks.
 // Inputs:
-//		- int newSize: The size to resize the string to.
+//		- int newSize: The number of characters to hold, including the NULL_TERMINATOR.
 // Outputs:
 //		- None.
 //
 
 void TCString::ResizeString( int newSize )
 {
+	if( newSize <= (int)GetCapacity() + 1 )
+	{
+		return;
+	}
+
 	//
-	// Allocate a new string.
+	// Allocate a new string and move our characters into it.
 	//
 
-	mString = AllocateString( newSize );
-	if( mString == NULL )
+	char8* newString = AllocateString( newSize );
+	if( newString == NULL )
 	{
 		return;
 	}
+
+	memcpy( newString, mString, mLength + 1 );
+	ReleaseString( mString );
+
+	mString = newString;
+	mCapacity = newSize - 1;
+}
+
+//
+// BoundedLength
+//		- Will find the length of a string without reading past a maximum length.
+// Inputs:
+//		- const char8* string: The string to measure.
+//		- unsigned int maxLength: The most characters to look at.
+// Outputs:
+//		- unsigned int: The length of the string, at most maxLength.
+//
+
+unsigned int TCString::BoundedLength( const char8* string, unsigned int maxLength )
+{
+	const void* terminator = memchr( string, NULL_TERMINATOR, maxLength );
+	return terminator != NULL ? (unsigned int)( (const char8*)terminator - string ) : maxLength;
+}
+
+//
+// CopyCharacters
+//		- Will replace the internal string with an exact number of characters.
+// Inputs:
+//		- const char8* string: The characters to copy, there must be at least length of them.
+//		- unsigned int length: The number of characters to copy.
+// Outputs:
+//		- None.
+//
+
+void TCString::CopyCharacters( const char8* string, unsigned int length )
+{
+	//
+	// Only allocate when the string doesn't fit, the old characters don't need to be kept.
+	//
+
+	if( length > GetCapacity() )
+	{
+		char8* newString = AllocateString( length + 1 );
+		if( newString == NULL )
+		{
+			return;
+		}
+
+		ReleaseString( mString );
+		mString = newString;
+		mCapacity = length;
+	}
+
+	//
+	// Copy in the new string, it may be a part of this string.
+	//
+
+	memmove( mString, string, length );
+	mString[ length ] = NULL_TERMINATOR;
+
+	//
+	// Update our length 
+	//
+
+	mLength = length;
+}
+
+//
+// AppendCharacters
+//		- Will append an exact number of characters to the internal string.
+// Inputs:
+//		- const char8* string: The characters to append, there must be at least length of them.
+//		- unsigned int length: The number of characters to append.
+// Outputs:
+//		- None
+//
+
+void TCString::AppendCharacters( const char8* string, unsigned int length )
+{
+	//
+	// Grow the string if the suffix doesn't fit, the suffix may be a part of this string so find it again afterwards.
+	// The capacity at least doubles so appending in a loop stays linear.
+	//
+
+	if( mLength + length > GetCapacity() )
+	{
+		bool isInternal = string >= mString && string <= mString + mLength;
+		unsigned int internalOffset = isInternal ? (unsigned int)( string - mString ) : 0;
+
+		unsigned int newCapacity = GetCapacity() * TC_STRING_GROWTH_FACTOR;
+		if( newCapacity < mLength + length )
+		{
+			newCapacity = mLength + length;
+		}
+
+		ResizeString( newCapacity + 1 );
+		if( mLength + length > GetCapacity() )
+		{
+			return;
+		}
+
+		if( isInternal )
+		{
+			string = mString + internalOffset;
+		}
+	}
+
+	//
+	// Copy in the string to append.
+	//
+
+	memmove( &mString[ mLength ], string, length );
+	mLength += length;
+	mString[ mLength ] = NULL_TERMINATOR;
+}
+
+//
+// Capacity
+//		- Will return the number of characters the string can hold before it has to allocate.
+// Inputs:
+//		- None.
+// Outputs:
+//		- unsigned int: The capacity, not counting the NULL_TERMINATOR.
+//
+
+unsigned int TCString::Capacity() const
+{
+	return GetCapacity();
+}
+
+//
+// Reserve
+//		- Will make room for a number of characters up front, so building a string of a known size allocates once.
+// Inputs:
+//		- unsigned int capacity: The number of characters to make room for, not counting the NULL_TERMINATOR.
+// Outputs:
+//		- None.
+//
+
+void TCString::Reserve( unsigned int capacity )
+{
+	ResizeString( capacity + 1 );
 }
 
 //
@@ -180,12 +374,12 @@ int TCString::Length() const
 
 bool TCString::IsEmpty()
 {
-	return Equal( EMPTY_STRING );
+	return mLength == 0;
 }
 
 //
 // Clear
-//		- Empty out this string.
+//		- Empty out this string, the buffer is kept for reuse.
 // Inputs:
 //		- None.
 // Outputs:
@@ -194,7 +388,8 @@ bool TCString::IsEmpty()
 
 void TCString::Clear()
 {
-	Copy( EMPTY_STRING );
+	mString[ 0 ] = NULL_TERMINATOR;
+	mLength = 0;
 }
 
 //
@@ -212,8 +407,10 @@ void TCString::Copy( const char8* string )
 	// Reallocate a string of the right size.
 	//
 
-	int inputStringLength = TCStringUtils::Length( string );
-	Copy( string, inputStringLength );
+	if( string == NULL )
+		return;
+
+	CopyCharacters( string, TCStringUtils::Length( string ) );
 }
 
 //
@@ -221,7 +418,7 @@ void TCString::Copy( const char8* string )
 //		- Will copy from the provided string to the internal string.
 // Inputs:
 //		- const char8* string: The string to copy from.
-//		- int length: The length of the string to copy from.
+//		- int length: The most characters to copy, the copy stops early at a NULL_TERMINATOR.
 // Outputs:
 //		- None.
 //
@@ -231,25 +428,7 @@ void TCString::Copy( const char8* string, unsigned int length )
 	if( string == NULL )
 		return;
 
-	//
-	// Reallocate a string of the right size.
-	//
-
-	ReleaseString( mString );
-	ResizeString( length + 1 );
-
-	//
-	// Copy in the new string.
-	//
-
-	TCStringUtils::Copy( mString, string, length );
-	mString[ length ] = NULL_TERMINATOR;
-
-	//
-	// Update our length 
-	//
-
-	mLength = length;
+	CopyCharacters( string, BoundedLength( string, length ) );
 }
 
 //
@@ -263,7 +442,7 @@ void TCString::Copy( const char8* string, unsigned int length )
 
 void TCString::Copy( const TCString& string )
 {
-	Copy( string.Data() );
+	CopyCharacters( string.mString, string.mLength );
 }
 
 //
@@ -278,7 +457,21 @@ void TCString::Copy( const TCString& string )
 
 void TCString::Copy( const TCString& string, unsigned int length )
 {
-	Copy( string.Data(), length );
+	CopyCharacters( string.mString, length < string.mLength ? length : string.mLength );
+}
+
+//
+// Copy
+//		- Will copy the characters of a view into our internal string.
+// Inputs:
+//		- const TCStringView& string: The characters to copy.
+// Outputs:
+//		- None.
+//
+
+void TCString::Copy( const TCStringView& string )
+{
+	CopyCharacters( string.Data(), string.Length() );
 }
 
 //
@@ -295,7 +488,7 @@ void TCString::Append( const char8* string )
 	if( string == NULL )
 		return;
 
-	Append( string, TCStringUtils::Length( string ) );
+	AppendCharacters( string, TCStringUtils::Length( string ) );
 }
 
 //
@@ -303,7 +496,7 @@ void TCString::Append( const char8* string )
 //		- Will append a string to the internal string, reading only a specific length.
 // Inputs:
 //		- char8* string: The string to copy.
-//		- unsigned int length: The length to read from the string.
+//		- unsigned int length: The most characters to read from the string, it stops early at a NULL_TERMINATOR.
 // Outputs:
 //		- None
 //
@@ -313,46 +506,7 @@ void TCString::Append( const char8* string, unsigned int length )
 	if( string == NULL )
 		return;
 
-	//
-	// Calculate the size of the string we'll need.
-	//
-
-	int oldLength = Length();
-	int newSize = Length() + length + 1;
-
-	//
-	// Resize the string.
-	//
-
-	char8* prevString = mString;
-	ResizeString( newSize );
-
-	//
-	// Copy in our old string.
-	//
-
-	if( prevString != NULL )
-	{
-		TCStringUtils::Copy( mString, prevString );	
-	}
-
-	//
-	// Release the previous string.
-	//
-
-	ReleaseString( prevString );
-
-	//
-	// Now we need to copy in the string to append.
-	//
-
-	TCStringUtils::Copy( &mString[oldLength], string, length );
-
-	//
-	// Update our length
-	//
-
-	mLength = newSize - 1;
+	AppendCharacters( string, BoundedLength( string, length ) );
 }
 
 //
@@ -366,7 +520,7 @@ void TCString::Append( const char8* string, unsigned int length )
 
 void TCString::Append( const TCString& string )
 {
-	Append( string.Data() );
+	AppendCharacters( string.mString, string.mLength );
 }
 
 //
@@ -381,7 +535,21 @@ void TCString::Append( const TCString& string )
 
 void TCString::Append( const TCString& string, unsigned int length )
 {
-	Append( string.Data(), length );
+	AppendCharacters( string.mString, length < string.mLength ? length : string.mLength );
+}
+
+//
+// Append
+//		- Will append the characters of a view to the internal string.
+// Inputs:
+//		- const TCStringView& string: The characters to append.
+// Outputs:
+//		- None.
+//
+
+void TCString::Append( const TCStringView& string )
+{
+	AppendCharacters( string.Data(), string.Length() );
 }
 
 //
@@ -418,6 +586,23 @@ int TCString::Compare( const TCString& string ) const
 	return Compare( string.Data() );
 }
 
+//
+// Compare
+//		- Will compare the internal string with the characters of a view.
+// Inputs:
+//		- const TCStringView& string: the view to compare.
+// Outputs:
+//		- int: 
+//			- 0 if the strings are equal
+//			- <0 if this string is less than the input.
+//			- >0 if this string is greater than the input.
+//
+
+int TCString::Compare( const TCStringView& string ) const
+{
+	return TCStringView( mString, mLength ).Compare( string );
+}
+
 //
 // CompareInsensitive
 //		- Will compare the internal string with a string provided with no regards to capitalization.
@@ -477,7 +662,21 @@ bool TCString::Equal( const char8* string ) const
 
 bool TCString::Equal( const TCString& string ) const
 {
-	return Equal( string.Data() );
+	return mLength == string.mLength && memcmp( mString, string.mString, mLength ) == 0;
+}
+
+//
+// Equal
+//		- Will determine if the internal string holds the same characters as a view.
+// Inputs:
+//		- const TCStringView& string: The view to check.
+// Outputs:
+//		- bool: Are the strings equal.
+//
+
+bool TCString::Equal( const TCStringView& string ) const
+{
+	return TCStringView( mString, mLength ).Equal( string );
 }
 
 //
@@ -491,45 +690,10 @@ bool TCString::Equal( const TCString& string ) const
 
 bool TCString::Contains( const char8* string )
 {
-	int checkLength = TCStringUtils::Length( string );
-	for( unsigned int currentChar = 0; currentChar < mLength; ++currentChar )
-	{
-		if( mString[ currentChar ] == string[ 0 ] )
-		{
-			//
-			// Check if this string is proceeded.
-			//
-
-			int currentCheckChar = 1;
-			bool matched = true;
-			for( currentCheckChar; currentCheckChar < checkLength; ++currentCheckChar )
-			{
-				if( mString[ currentChar + currentCheckChar ] == NULL_TERMINATOR )
-				{
-					// We've reached the end of our string.
-					return false;
-				}
-
-				if( mString[ currentChar + currentCheckChar ] != string[ currentCheckChar ] )
-				{
-					// The strings don't match.
-					currentChar += currentCheckChar;
-					matched = false;
-				}
-			}
-
-			//
-			// We've reached the end of the search string with no misses, return success!
-			//
-
-			if( matched )
-			{
-				return true;
-			}
-		}
-	}
+	if( string == NULL )
+		return false;
 
-	return false;
+	return TCStringUtils::FindString( mString, mLength, string, TCStringUtils::Length( string ) ) >= 0;
 }
 
 //
@@ -546,6 +710,20 @@ bool TCString::Contains( const TCString& string )
 	return Contains( string.Data() );
 }
 
+//
+// Contains
+//		- Will determine if the characters of a view are found inside our internal string.
+// Inputs:
+//		- const TCStringView& string: The view to search for.
+// Outputs:
+//		- bool: Was the string found.
+//
+
+bool TCString::Contains( const TCStringView& string ) const
+{
+	return TCStringView( mString, mLength ).Contains( string );
+}
+
 //
 // FindFirstIndexOf
 //		- Will return the first index of the specified character.
@@ -557,15 +735,7 @@ bool TCString::Contains( const TCString& string )
 
 int TCString::FindFirstIndexOf( char8 character )
 {
-	for( unsigned int currentChar = 0; currentChar < mLength; ++currentChar )
-	{
-		if( mString[ currentChar ] == character )
-		{
-			return currentChar;
-		}
-	}
-
-	return -1;
+	return TCStringUtils::FindCharacter( mString, mLength, character );
 }
 
 //
@@ -626,10 +796,7 @@ void TCString::Reverse()
 
 void TCString::ToLower()
 {
-	for( unsigned int currentChar = 0; currentChar < mLength; ++ currentChar )
-	{
-		mString[ currentChar ] = TCStringUtils::ConvertToLowercase( mString[ currentChar ] );
-	}
+	TCStringUtils::ToLower( mString, mLength );
 }
 
 //
@@ -643,10 +810,7 @@ void TCString::ToLower()
 
 void TCString::ToUpper()
 {
-	for( unsigned int currentChar = 0; currentChar < mLength; ++currentChar )
-	{
-		mString[ currentChar ] = TCStringUtils::ConvertToUppercase( mString[ currentChar ] );
-	}
+	TCStringUtils::ToUpper( mString, mLength );
 }
 
 //
@@ -683,9 +847,10 @@ void TCString::Substring( unsigned int startIndex, unsigned int endIndex, TCStri
 	if( endIndex < 0 || endIndex >= mLength )
 		return;
 
-	char8* substring = AllocateString( (endIndex - startIndex) + 2 ); // Include the last index + NULL_TERMINATOR
-	TCStringUtils::Copy( substring, &mString[ startIndex ], endIndex - startIndex + 1);
-	stringToFill.Copy( substring );
+	if( endIndex + 1 < startIndex )
+		return;
+
+	stringToFill.CopyCharacters( &mString[ startIndex ], endIndex - startIndex + 1 );	// Include the last index.
 }
 
 //
@@ -726,35 +891,21 @@ void TCString::RemoveAllInstances( const char8 charToRemove )
 	if( mString == NULL )
 		return;
 
-	int numInstances = 0;
+	//
+	// Shift the characters we keep down in place.
+	//
+
+	unsigned int newLength = 0;
 	for( unsigned int currentChar = 0; currentChar < mLength; ++currentChar )
 	{
-		if( mString[ currentChar ] == charToRemove )
+		if( mString[ currentChar ] != charToRemove )
 		{
-			numInstances++;
+			mString[ newLength++ ] = mString[ currentChar ];
 		}
 	}
 
-	if( numInstances > 0 )
-	{
-		char8* prevString = mString;
-		ResizeString( mLength - numInstances + 1);
-
-		int numRemoved = 0;
-		for( unsigned currentChar = 0; currentChar < mLength; ++currentChar )
-		{
-			if( prevString[ currentChar ] != charToRemove )
-			{
-				mString[ currentChar - numRemoved ] = prevString[ currentChar ]; 
-			}
-			else
-			{
-				numRemoved++;
-			}
-		}
-
-		mLength = mLength - numInstances;
-	}
+	mLength = newLength;
+	mString[ mLength ] = NULL_TERMINATOR;
 }
 
 //
@@ -768,22 +919,7 @@ void TCString::RemoveAllInstances( const char8 charToRemove )
 
 void TCString::TrimWhitespaceLeft()
 {
-	//
-	// Determine how many whitespace characters are in the string.
-	//
-
-	int numWhitespaceCharacters = 0;
-	for( unsigned int currentChar = 0; currentChar < mLength; ++currentChar )
-	{
-		if( TCStringUtils::IsWhitespaceCharacter( mString[ currentChar ] ) )
-		{
-			numWhitespaceCharacters++;
-		}
-		else
-		{
-			break;
-		}
-	}
+	int numWhitespaceCharacters = TCStringUtils::SkipWhitespace( mString, 0, mLength );
 
 	//
 	// Early out if possible.
@@ -793,41 +929,11 @@ void TCString::TrimWhitespaceLeft()
 		return;
 
 	//
-	// Resize the string.
-	//
-
-	int newLength = mLength - numWhitespaceCharacters;
-	int prevLength = mLength;
-	char* prevString = mString;
-	ResizeString( newLength + 1);
-	mLength = newLength;
-
-	//
-	// Copy over all the characters except whitespace characters.
-	//
-
-	int currentTrimChar = 0;
-	int numWhitespaceCharactersRemaining = numWhitespaceCharacters;
-	for( int currentChar = 0; currentChar < prevLength; ++currentChar )
-	{
-		if( !TCStringUtils::IsWhitespaceCharacter( prevString[ currentChar ] ) && numWhitespaceCharacters-- > 0 )
-		{
-			mString[ currentTrimChar++ ] = prevString[ currentChar ];
-		}
-	}
-
-	//
-	// Release the previous string.
+	// Shift the rest of the string down over the whitespace, the terminator comes along.
 	//
 
-	ReleaseString( prevString );
-
-	//
-	// Update our length again.
-	//
-
-	mLength = newLength;
-	mString[ mLength ] = NULL_TERMINATOR;
+	mLength -= numWhitespaceCharacters;
+	memmove( mString, &mString[ numWhitespaceCharacters ], mLength + 1 );
 }
 
 //
@@ -842,59 +948,33 @@ void TCString::TrimWhitespaceLeft()
 void TCString::TrimWhitespace()
 {
 	//
-	// Determine how many whitespace characters are in the string.
-	//
-
-	int numWhitespaceCharacters = 0;
-	for( unsigned int currentChar = 0; currentChar < mLength; ++currentChar )
-	{
-		if( TCStringUtils::IsWhitespaceCharacter( mString[ currentChar ] ) )
-		{
-			numWhitespaceCharacters++;
-		}
-	}
-
-	//
-	// Early out if possible.
+	// Early out if there is no whitespace.
 	//
 
-	if( numWhitespaceCharacters == 0 )
+	int currentTrimChar = TCStringUtils::FindWhitespace( mString, 0, mLength );
+	if( currentTrimChar < 0 )
 		return;
 
 	//
-	// Resize the string.
+	// Shift each run of characters between the whitespace down in place.
 	//
 
-	int newLength = mLength - numWhitespaceCharacters;
-	int prevLength = mLength;
-	char* prevString = mString;
-	ResizeString( newLength + 1);
-	mLength = newLength;
-
-	//
-	// Copy over all the characters except whitespace characters.
-	//
-
-	int currentTrimChar = 0;
-	for( int currentChar = 0; currentChar < prevLength; ++currentChar )
+	int currentChar = currentTrimChar;
+	while( currentChar < (int)mLength )
 	{
-		if( !TCStringUtils::IsWhitespaceCharacter( prevString[ currentChar ] ) )
+		int runStart = TCStringUtils::SkipWhitespace( mString, currentChar, mLength );
+		int runEnd = TCStringUtils::FindWhitespace( mString, runStart, mLength );
+		if( runEnd < 0 )
 		{
-			mString[ currentTrimChar++ ] = prevString[ currentChar ];
+			runEnd = mLength;
 		}
-	}
-
-	//
-	// Release the previous string.
-	//
 
-	ReleaseString( prevString );
-
-	//
-	// Update our length again.
-	//
+		memmove( &mString[ currentTrimChar ], &mString[ runStart ], runEnd - runStart );
+		currentTrimChar += runEnd - runStart;
+		currentChar = runEnd;
+	}
 
-	mLength = newLength;
+	mLength = currentTrimChar;
 	mString[ mLength ] = NULL_TERMINATOR;
 }
 
@@ -951,39 +1031,128 @@ bool TCString::StartsWith( const TCString& string )
 	return StartsWith( string.Data() );
 }
 
+//
+// StartsWith
+//		- Will determine if the string starts with the characters of a view.
+// Inputs:
+//		- const TCStringView& string: The prefix to search for.
+// Outputs:
+//		- bool: Did the string start with the prefix.
+//
+
+bool TCString::StartsWith( const TCStringView& string ) const
+{
+	return TCStringView( mString, mLength ).StartsWith( string );
+}
+
 //
 // Split
-//		- Will create an array of sub strings separated by a delimiter.
+//		- Will create a string for each piece separated by a delimiter. An empty string has no pieces, otherwise
+//		  there is one more piece than delimiters.
 // Inputs:
 //		- const char8 delimiter: The character that represents the end of a substring.
-//		- TCList< TCString > subStrings: The list of substrings found.
+//		- TCList< TCString >& subStrings: The list the substrings are appended to.
 // Ouputs:
-//		- TCString*: The array of substrings.
+//		- None.
 //
 
 void TCString::Split( const char8 delimiter, TCList< TCString >& subStrings )
 {
-	unsigned int currentSubStringStart = 0;
-	unsigned int currentSubStringEnd = 0;
-	TCString subString;
+	TCList< TCStringView > views;
+	Split( delimiter, views );
 
-	for( int currentCharacter = 0; currentCharacter < Length(); ++currentCharacter )
+	subStrings.Reserve( subStrings.Count() + views.Count() );
+	for( int currentView = 0; currentView < views.Count(); ++currentView )
 	{
-		if( mString[ currentCharacter ] == delimiter ||
-			currentCharacter == Length() - 1 )
-		{
-			currentSubStringEnd = currentCharacter - 1;		// Exclude the delimiter.
+		subStrings.EmplaceBack( views[ currentView ] );
+	}
+}
 
-			//
-			// Create the sub string.
-			//
+//
+// Split
+//		- Will view the pieces separated by a delimiter, nothing is copied. The views are only valid until this
+//		  string is changed or destroyed.
+// Inputs:
+//		- const char8 delimiter: The character that represents the end of a substring.
+//		- TCList< TCStringView >& subStrings: The list the substrings are appended to.
+// Ouputs:
+//		- None.
+//
 
-			Substring( currentSubStringStart, currentSubStringEnd, subString );
-			subStrings.Append( subString );
+void TCString::Split( const char8 delimiter, TCList< TCStringView >& subStrings ) const
+{
+	TCStringView( mString, mLength ).Split( delimiter, subStrings );
+}
 
-			currentSubStringStart = currentCharacter + 1;	// Set us up for the next string.
+//
+// CodePointCount
+//		- Will count the code points in this string, it is always stored as UTF-8.
+// Inputs:
+//		- None.
+// Outputs:
+//		- int: The number of code points, a malformed sequence counts as one.
+//
+
+int TCString::CodePointCount() const
+{
+	return TCStringUtils::CountCodePoints( mString, mLength );
+}
+
+//
+// IsValidUTF8
+//		- Will determine if this string is well formed UTF-8.
+// Inputs:
+//		- None.
+// Outputs:
+//		- bool: Is every sequence in this string valid.
+//
+
+bool TCString::IsValidUTF8() const
+{
+	return TCStringUtils::FindInvalidUTF8( mString, mLength ) < 0;
+}
+
+//
+// ToUTF16
+//		- Will write this string as NULL terminated UTF-16, eg: for the wide Win32 functions.
+// Inputs:
+//		- char16* buffer: The buffer to write into, it must hold Length() + 1 units.
+// Outputs:
+//		- int: The number of units written, not counting the NULL_TERMINATOR.
+//
+
+int TCString::ToUTF16( char16* buffer ) const
+{
+	int numUnits = TCStringUtils::UTF8ToUTF16( mString, mLength, buffer );
+	buffer[ numUnits ] = NULL_TERMINATOR;
+	return numUnits;
+}
+
+//
+// CopyUTF16
+//		- Will set this string to UTF-16 characters, transcoded straight into this string's storage.
+// Inputs:
+//		- const char16* string: The units to copy.
+//		- int length: The number of units to copy.
+// Outputs:
+//		- None.
+//
+
+void TCString::CopyUTF16( const char16* string, int length )
+{
+	unsigned int maxLength = (unsigned int)length * TC_UTF8_MAX_BYTES_PER_UTF16;
+	if( maxLength > GetCapacity() )
+	{
+		Clear();
+		Reserve( maxLength );
+		if( maxLength > GetCapacity() )
+		{
+			return;
 		}
 	}
+
+	mLength = TCStringUtils::UTF16ToUTF8( string, length, mString );
+	mString[ mLength ] = NULL_TERMINATOR;
 }
 
 //
@@ -1001,6 +1170,21 @@ TCString& TCString::operator=( const char8* string )
 	return *this;
 }
 
+//
+// Assignment Operator
+//		- Will set the value of this string to the characters of a view.
+// Inputs:
+//		- const TCStringView& string: The characters to set this string to.
+// Outputs:
+//		- const TCString&: The resultant string.
+//
+
+TCString& TCString::operator=( const TCStringView& string )
+{
+	Copy( string );
+	return *this;
+}
+
 //
 // Assignment Operator
 // Inputs:
@@ -1011,7 +1195,48 @@ TCString& TCString::operator=( const char8* string )
 
 TCString& TCString::operator=( const TCString& string )
 {
-	return (*this) = string.Data();
+	if( this != &string )
+	{
+		Copy( string );
+	}
+
+	return *this;
+}
+
+//
+// Move Assignment Operator
+//		- Will take the characters of another string, leaving it empty. Heap strings hand over their buffer.
+// Inputs:
+//		- TCString&& string: The string to move from.
+// Outputs:
+//		- TCString&: The resultant string.
+//
+
+TCString& TCString::operator=( TCString&& string )
+{
+	if( this == &string )
+	{
+		return *this;
+	}
+
+	if( string.IsInline() )
+	{
+		Copy( string );
+	}
+	else
+	{
+		ReleaseString( mString );
+		mString = string.mString;
+		mLength = string.mLength;
+		mCapacity = string.mCapacity;
+
+		string.mString = string.mInlineString;
+	}
+
+	string.mString[ 0 ] = NULL_TERMINATOR;
+	string.mLength = 0;
+
+	return *this;
 }
 
 //
@@ -1024,11 +1249,8 @@ TCString& TCString::operator=( const TCString& string )
 
 TCString& TCString::operator=( const char8 character )
 {
-	char8 string[2];
-	string[ 0 ] = character;
-	string[ 1 ] = NULL_TERMINATOR;
-
-	return (*this) = string;
+	CopyCharacters( &character, 1 );
+	return *this;
 }
 
 //
@@ -1041,8 +1263,9 @@ TCString& TCString::operator=( const char8 character )
 
 TCString& TCString::operator=( const int value )
 {
-	TCString valueStr = TCStringUtils::ItoA( value );
-	return (*this) = valueStr;
+	char8 buffer[ TC_INT_STRING_MAX_LENGTH ];
+	Copy( buffer, TCStringUtils::FormatInt( value, buffer ) );
+	return (*this);
 }
 
 //
@@ -1072,7 +1295,9 @@ TCString TCString::operator+( const char8* string )
 
 TCString TCString::operator+( const TCString& string )
 {
-	return (*this) + string.Data();
+	TCString toReturn = *this;
+	toReturn.Append( string );
+	return toReturn;
 }
 
 //
@@ -1086,11 +1311,9 @@ TCString TCString::operator+( const TCString& string )
 
 TCString TCString::operator+( const char8 character )
 {
-	char8 string[2];
-	string[ 0 ] = character;
-	string[ 1 ] = NULL_TERMINATOR;
-
-	return (*this) + string;
+	TCString toReturn = *this;
+	toReturn.AppendCharacters( &character, 1 );
+	return toReturn;
 }
 
 //
@@ -1104,8 +1327,7 @@ TCString TCString::operator+( const char8 character )
 
 TCString TCString::operator+( const int value )
 {
-	TCString valueStr = TCStringUtils::ItoA( value );
-	return (*this) + valueStr;
+	return (*this) + TCStringUtils::ItoA( value );
 }
 
 //
@@ -1133,7 +1355,21 @@ void TCString::operator+=( const char8* string )
 
 void TCString::operator+=( const TCString& string )
 {
-	(*this) += string.Data();
+	Append( string );
+}
+
+//
+// Append Operator
+//		- Will append the characters of a view to this string.
+// Inputs:
+//		- const TCStringView& string: the characters to append.
+// Outputs:
+//		None.
+//
+
+void TCString::operator+=( const TCStringView& string )
+{
+	Append( string );
 }
 
 //
@@ -1147,11 +1383,7 @@ void TCString::operator+=( const TCString& string )
 
 void TCString::operator+=( const char8 character )
 {
-	char8 string[2];
-	string[ 0 ] = character;
-	string[ 1 ] = NULL_TERMINATOR;
-
-	(*this) += string;
+	AppendCharacters( &character, 1 );
 }
 
 //
@@ -1165,8 +1397,8 @@ void TCString::operator+=( const char8 character )
 
 void TCString::operator+=( const int value )
 {
-	TCString valStr = TCStringUtils::ItoA( value );
-	(*this) += valStr;
+	char8 buffer[ TC_INT_STRING_MAX_LENGTH ];
+	Append( buffer, TCStringUtils::FormatInt( value, buffer ) );
 }
 
 //
@@ -1194,7 +1426,21 @@ bool TCString::operator==( const char8* string ) const
 
 bool TCString::operator==( const TCString& string ) const
 {
-	return (*this) == string.Data();
+	return Equal( string );
+}
+
+//
+// Equivalence Operator
+//		- Will determine if this string holds the same characters as a view.
+// Inputs:
+//		- const TCStringView& string: The view to check.
+// Outputs:
+//		- bool: Is this string the same as the view provided.
+//
+
+bool TCString::operator==( const TCStringView& string ) const
+{
+	return Equal( string );
 }
 
 //
@@ -1226,8 +1472,8 @@ bool TCString::operator==( const char8 character ) const
 
 bool TCString::operator==( const int value ) const
 {
-	TCString valStr = TCStringUtils::ItoA( value );
-	return (*this) == valStr;
+	char8 buffer[ TC_INT_STRING_MAX_LENGTH ];
+	return (*this) == TCStringView( buffer, TCStringUtils::FormatInt( value, buffer ) );
 }
 
 //
@@ -1239,7 +1485,7 @@ bool TCString::operator==( const int value ) const
 //		- None.
 //
 
-bool TCString::operator!=( const char8* string )
+bool TCString::operator!=( const char8* string ) const
 {
 	return !Equal( string );
 }
@@ -1253,9 +1499,9 @@ bool TCString::operator!=( const char8* string )
 //		- None.
 //
 
-bool TCString::operator!=( const TCString& string )
+bool TCString::operator!=( const TCString& string ) const
 {
-	return (*this) != string.Data();
+	return !Equal( string );
 }
 
 //
@@ -1267,7 +1513,7 @@ bool TCString::operator!=( const TCString& string )
 //		- None.
 //
 
-bool TCString::operator!=( const char8 character )
+bool TCString::operator!=( const char8 character ) const
 {
 	char8 string[2];
 	string[ 0 ] = character;
@@ -1285,7 +1531,7 @@ bool TCString::operator!=( const char8 character )
 //		- bool: Does this character not equal this value.
 //
 
-bool TCString::operator!=( const int value )
+bool TCString::operator!=( const int value ) const
 {
 	return !( (*this) == value );
 }
\ No newline at end of file
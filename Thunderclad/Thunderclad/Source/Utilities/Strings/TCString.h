@@ -12,12 +12,15 @@
 
 #include "TCPlatformPrecompilerSymbols.h"
 #include "TCStringUtils.h"
+#include "TCStringView.h"
 #include "TCList.h"
 
 //
 // Defines
 //
 
+#define TC_STRING_INLINE_CAPACITY	(23)	// Strings up to this many characters are stored inside the TCString and never allocate.
+#define TC_STRING_GROWTH_FACTOR		(2)		// Appending past the capacity grows it by at least this factor.
 
 class TCString
 {
@@ -27,11 +30,15 @@ class TCString
 		TCString();
 		TCString( const char8* string );
 		TCString( const TCString& string );
+		TCString( const TCStringView& string );
+		TCString( TCString&& string );
 		TCString( int value );
 
 		virtual ~TCString();
 
 		int Length() const;
+		unsigned int Capacity() const;
+		void Reserve( unsigned int capacity );
 
 		bool IsEmpty();
 		void Clear();
@@ -40,23 +47,28 @@ class TCString
 		void Copy( const char8* string, unsigned int length );
 		void Copy( const TCString& string );
 		void Copy( const TCString& string, unsigned int length );
+		void Copy( const TCStringView& string );
 			
 		void Append( const char8* string );
 		void Append( const char8* string, unsigned int length );
 		void Append( const TCString& string );
 		void Append( const TCString& string, unsigned int length );
+		void Append( const TCStringView& string );
 
 		int Compare( const char8* string ) const;
 		int Compare( const TCString& string ) const;
+		int Compare( const TCStringView& string ) const;
 
 		int CompareInsensitive( const char8* string );
 		int CompareInsensitive( const TCString& string );
 
 		bool Equal( const char8* string ) const;
 		bool Equal( const TCString& string ) const;
+		bool Equal( const TCStringView& string ) const;
 
 		bool Contains( const char8* string );
 		bool Contains( const TCString& string );
+		bool Contains( const TCStringView& string ) const;
 
 		int FindFirstIndexOf( const char8 character );
 		int FindLastIndexOf( const char8 character );
@@ -77,11 +89,21 @@ class TCString
 
 		bool StartsWith( const char8* string );
 		bool StartsWith( const TCString& string );
+		bool StartsWith( const TCStringView& string ) const;
 
 		void Split( const char8 delimiter, TCList< TCString >& subStrings );
+		void Split( const char8 delimiter, TCList< TCStringView >& subStrings ) const;
+
+		// The characters are UTF-8, these convert at the boundaries that need UTF-16.
+		int CodePointCount() const;
+		bool IsValidUTF8() const;
+		int ToUTF16( char16* buffer ) const;
+		void CopyUTF16( const char16* string, int length );
 
 		TCString& operator=( const TCString& string );
+		TCString& operator=( TCString&& string );
 		TCString& operator=( const char8* string );
+		TCString& operator=( const TCStringView& string );
 		TCString& operator=( const char8 character );
 		TCString& operator=( const int value );
 
@@ -92,32 +114,50 @@ class TCString
 
 		void operator+=( const TCString& string );
 		void operator+=( const char8* string );
+		void operator+=( const TCStringView& string );
 		void operator+=( const char character );
 		void operator+=( const int value );
 
 		bool operator==( const TCString& string ) const;
 		bool operator==( const char8* string )	  const;
+		bool operator==( const TCStringView& string ) const;
 		bool operator==( const char character )	  const;
 		bool operator==( const int value )		  const;
 
-		bool operator!=( const TCString& string );
-		bool operator!=( const char8* string );
-		bool operator!=( const char character );
-		bool operator!=( const int value );
+		bool operator!=( const TCString& string ) const;
+		bool operator!=( const char8* string )	  const;
+		bool operator!=( const char character )	  const;
+		bool operator!=( const int value )		  const;
 
 		char8 operator[]( unsigned int index ) { TC_ASSERT( mString != NULL && index >= 0 && index < mLength ); return mString[ index ]; }
 
 		char8* Data() const { return mString; } 
 
+		// Views never copy, so passing a TCString to a TCStringView parameter is free.
+		operator TCStringView() const { return TCStringView( mString, mLength ); }
+
 	private: // Members
-		char8* mString;
+		char8* mString;						// Points at mInlineString until the string outgrows it.
 		unsigned int mLength;
 
+		union
+		{
+			char8 mInlineString[ TC_STRING_INLINE_CAPACITY + 1 ];
+			unsigned int mCapacity;			// The characters a heap string can hold, not counting the terminator.
+		};
+
 	protected: // Methods
 
+		inline bool IsInline() const { return mString == mInlineString; }
+		inline unsigned int GetCapacity() const { return IsInline() ? TC_STRING_INLINE_CAPACITY : mCapacity; }
+
 		char8* AllocateString( int length );
 		void ReleaseString( char8*& string );
 		void ResizeString( int newSize );
+
+		void CopyCharacters( const char8* string, unsigned int length );
+		void AppendCharacters( const char8* string, unsigned int length );
+		static unsigned int BoundedLength( const char8* string, unsigned int maxLength );
 };
 
 #endif // __TC_STRING_H__
\ No newline at end of file
@@ -0,0 +1,472 @@
+//
+// TCStringAtom.cpp
+// This file will define the global string table behind TCStringAtom.
+//
+
+//
+// Includes
+//
+
+#include "TCStringAtom.h"
+#include "TCMemoryTracker.h"
+
+#include <string.h>
+#include <mutex>
+
+//
+// Defines
+//
+
+#define TC_STRING_ATOM_CHUNK_SHIFT		(10)
+#define TC_STRING_ATOM_CHUNK_SIZE		(1 << TC_STRING_ATOM_CHUNK_SHIFT)	// Entries are allocated in chunks that never move.
+#define TC_STRING_ATOM_MAX_CHUNKS		(4096)								// Room for four million atoms.
+#define TC_STRING_ATOM_INITIAL_SLOTS	(1024)
+#define TC_STRING_ATOM_PAGE_SIZE		(16 * 1024)							// Characters are packed into pages of this size.
+
+//
+// TCStringAtomEntry
+//		- The characters of an atom and the hash used to place it in the table.
+//
+
+struct TCStringAtomEntry
+{
+	const char8*	string;
+	unsigned int	length;
+	unsigned int	hash;
+};
+
+//
+// TCStringInterner
+//		- The table is open addressed with linear probing and holds ids, the entries keep the hash so growing the
+//		  table never rehashes any characters. Writing our own table rather than using TCFlatHashTable lets a hash
+//		  computed at compile time by TC_STRING_HASH be used directly.
+//
+
+class TCStringInterner
+{
+	public:
+									TCStringInterner();
+									~TCStringInterner();
+
+		unsigned int				Intern( const TCStringView& string, unsigned int hash, bool addIfMissing );
+		int							Count();
+
+		inline const TCStringAtomEntry&	GetEntry( unsigned int id ) const	{ return mChunks[ id >> TC_STRING_ATOM_CHUNK_SHIFT ][ id & ( TC_STRING_ATOM_CHUNK_SIZE - 1 ) ]; }
+
+	private:
+		std::mutex					mLock;
+		TCStringAtomEntry*			mChunks[ TC_STRING_ATOM_MAX_CHUNKS ];
+		unsigned int				mCount;				// Includes the empty string at id 0.
+		unsigned int*				mSlots;				// Atom ids, 0 marks an empty slot since the empty string is never stored.
+		unsigned int				mNumSlots;			// Always a power of two.
+		void*						mPages;				// Every allocation starts with a pointer to the previous one.
+		char8*						mPageCursor;
+		unsigned int				mPageRemaining;
+
+		// There is only one table, it's never copied.
+									TCStringInterner( const TCStringInterner& interner );
+		TCStringInterner&			operator=( const TCStringInterner& interner );
+
+		const char8*				StoreCharacters( const TCStringView& string );
+		void*						AllocatePage( unsigned int size );
+		void						Grow();
+};
+
+//
+// GetInterner
+//		- Will create the table the first time it's needed, so atoms can be made during static initialization.
+// Inputs:
+//		- None.
+// Outputs:
+//		- TCStringInterner&: The global table.
+//
+
+static TCStringInterner& GetInterner()
+{
+	static TCStringInterner interner;
+	return interner;
+}
+
+//
+// Constructor
+//		- Will set up the table with the empty string at id 0.
+// Inputs:
+//		- None.
+// Outputs:
+//		- None.
+//
+
+TCStringInterner::TCStringInterner()
+{
+	memset( mChunks, 0, sizeof( mChunks ) );
+
+	mChunks[ 0 ] = (TCStringAtomEntry*)TCMemoryTracker::Allocate( TC_STRING_ATOM_CHUNK_SIZE * sizeof( TCStringAtomEntry ), TCMemoryTracker::kMemoryTagString );
+	mChunks[ 0 ][ 0 ].string	= EMPTY_STRING;
+	mChunks[ 0 ][ 0 ].length	= 0;
+	mChunks[ 0 ][ 0 ].hash		= TC_STRING_HASH_OFFSET_BASIS;
+	mCount						= 1;
+
+	mNumSlots	= TC_STRING_ATOM_INITIAL_SLOTS;
+	mSlots		= (unsigned int*)TCMemoryTracker::Allocate( mNumSlots * sizeof( unsigned int ), TCMemoryTracker::kMemoryTagString );
+	memset( mSlots, 0, mNumSlots * sizeof( unsigned int ) );
+
+	mPages			= NULL;
+	mPageCursor		= NULL;
+	mPageRemaining	= 0;
+}
+
+//
+// Destructor
+//		- Will release every chunk and page, no atom can be read after this.
+// Inputs:
+//		- None.
+// Outputs:
+//		- None.
+//
+
+TCStringInterner::~TCStringInterner()
+{
+	for( int currentChunk = 0; currentChunk < TC_STRING_ATOM_MAX_CHUNKS && mChunks[ currentChunk ] != NULL; ++currentChunk )
+	{
+		TCMemoryTracker::Free( mChunks[ currentChunk ] );
+	}
+
+	while( mPages != NULL )
+	{
+		void* previousPage = *(void**)mPages;
+		TCMemoryTracker::Free( mPages );
+		mPages = previousPage;
+	}
+
+	TCMemoryTracker::Free( mSlots );
+}
+
+//
+// Intern
+//		- Will find the id of a string, adding it to the table if asked to.
+// Inputs:
+//		- const TCStringView& string: The characters to find, they are copied if added.
+//		- unsigned int hash: The hash of the characters, from TCStringAtom::Hash or TC_STRING_HASH.
+//		- bool addIfMissing: Should the string be added if it isn't in the table.
+// Outputs:
+//		- unsigned int: The id, 0 if the string is empty or wasn't found.
+//
+
+unsigned int TCStringInterner::Intern( const TCStringView& string, unsigned int hash, bool addIfMissing )
+{
+	if( string.IsEmpty() )
+		return 0;
+
+	std::lock_guard< std::mutex > lock( mLock );
+
+	unsigned int slotMask = mNumSlots - 1;
+	unsigned int slot = hash & slotMask;
+	for( ;; )
+	{
+		unsigned int id = mSlots[ slot ];
+		if( id == 0 )
+			break;
+
+		const TCStringAtomEntry& entry = GetEntry( id );
+		if( entry.hash == hash && entry.length == (unsigned int)string.Length() && memcmp( entry.string, string.Data(), entry.length ) == 0 )
+		{
+			return id;
+		}
+
+		slot = ( slot + 1 ) & slotMask;
+	}
+
+	if( !addIfMissing )
+		return 0;
+
+	//
+	// Make room for the entry, the chunk is allocated before the id is handed out so readers never see it missing.
+	//
+
+	unsigned int id = mCount;
+	unsigned int chunk = id >> TC_STRING_ATOM_CHUNK_SHIFT;
+	if( chunk >= TC_STRING_ATOM_MAX_CHUNKS )
+	{
+		TC_ASSERT( "Ran out of string atoms!" && 0 );
+		return 0;
+	}
+
+	if( mChunks[ chunk ] == NULL )
+	{
+		mChunks[ chunk ] = (TCStringAtomEntry*)TCMemoryTracker::Allocate( TC_STRING_ATOM_CHUNK_SIZE * sizeof( TCStringAtomEntry ), TCMemoryTracker::kMemoryTagString );
+		if( mChunks[ chunk ] == NULL )
+		{
+			TC_ASSERT( "Failed to allocate string atoms!" && 0 );
+			return 0;
+		}
+	}
+
+	const char8* characters = StoreCharacters( string );
+	if( characters == NULL )
+		return 0;
+
+	TCStringAtomEntry& entry = mChunks[ chunk ][ id & ( TC_STRING_ATOM_CHUNK_SIZE - 1 ) ];
+	entry.string	= characters;
+	entry.length	= string.Length();
+	entry.hash		= hash;
+
+	mSlots[ slot ] = id;
+	mCount++;
+
+	// Keep the table at most half full so probes stay short.
+	if( mCount * 2 > mNumSlots )
+	{
+		Grow();
+	}
+
+	return id;
+}
+
+//
+// Count
+//		- Will return the number of atoms, including the empty string.
+// Inputs:
+//		- None.
+// Outputs:
+//		- int: The number of atoms.
+//
+
+int TCStringInterner::Count()
+{
+	std::lock_guard< std::mutex > lock( mLock );
+	return mCount;
+}
+
+//
+// StoreCharacters
+//		- Will copy characters into the current page, NULL terminated.
+// Inputs:
+//		- const TCStringView& string: The characters to copy.
+// Outputs:
+//		- const char8*: The stored characters, NULL if out of memory.
+//
+
+const char8* TCStringInterner::StoreCharacters( const TCStringView& string )
+{
+	unsigned int size = string.Length() + 1;
+
+	//
+	// Long strings get a page of their own so they don't waste the rest of the current page.
+	//
+
+	char8* characters = NULL;
+	if( size > TC_STRING_ATOM_PAGE_SIZE / 4 )
+	{
+		characters = (char8*)AllocatePage( size );
+	}
+	else
+	{
+		if( size > mPageRemaining )
+		{
+			mPageCursor		= (char8*)AllocatePage( TC_STRING_ATOM_PAGE_SIZE );
+			mPageRemaining	= mPageCursor != NULL ? TC_STRING_ATOM_PAGE_SIZE : 0;
+		}
+
+		if( mPageCursor != NULL )
+		{
+			characters		= mPageCursor;
+			mPageCursor		+= size;
+			mPageRemaining	-= size;
+		}
+	}
+
+	if( characters == NULL )
+	{
+		TC_ASSERT( "Failed to allocate string atom characters!" && 0 );
+		return NULL;
+	}
+
+	memcpy( characters, string.Data(), size - 1 );
+	characters[ size - 1 ] = NULL_TERMINATOR;
+
+	return characters;
+}
+
+//
+// AllocatePage
+//		- Will allocate memory that is freed with the table.
+// Inputs:
+//		- unsigned int size: The number of bytes needed.
+// Outputs:
+//		- void*: The memory, NULL if out of memory.
+//
+
+void* TCStringInterner::AllocatePage( unsigned int size )
+{
+	void* page = TCMemoryTracker::Allocate( sizeof( void* ) + size, TCMemoryTracker::kMemoryTagString );
+	if( page == NULL )
+		return NULL;
+
+	*(void**)page = mPages;
+	mPages = page;
+
+	return (char8*)page + sizeof( void* );
+}
+
+//
+// Grow
+//		- Will double the number of slots and put every id back using its stored hash.
+// Inputs:
+//		- None.
+// Outputs:
+//		- None.
+//
+
+void TCStringInterner::Grow()
+{
+	unsigned int newNumSlots = mNumSlots * 2;
+	unsigned int* newSlots = (unsigned int*)TCMemoryTracker::Allocate( newNumSlots * sizeof( unsigned int ), TCMemoryTracker::kMemoryTagString );
+	if( newSlots == NULL )
+	{
+		TC_ASSERT( "Failed to grow the string atom table!" && 0 );
+		return;
+	}
+
+	memset( newSlots, 0, newNumSlots * sizeof( unsigned int ) );
+
+	unsigned int slotMask = newNumSlots - 1;
+	for( unsigned int id = 1; id < mCount; ++id )
+	{
+		unsigned int slot = GetEntry( id ).hash & slotMask;
+		while( newSlots[ slot ] != 0 )
+		{
+			slot = ( slot + 1 ) & slotMask;
+		}
+
+		newSlots[ slot ] = id;
+	}
+
+	TCMemoryTracker::Free( mSlots );
+	mSlots		= newSlots;
+	mNumSlots	= newNumSlots;
+}
+
+//
+// Constructor
+//		- Will intern a string.
+// Inputs:
+//		- const TCStringView& string: The characters to intern, they are copied the first time they're seen.
+// Outputs:
+//		- None.
+//
+
+TCStringAtom::TCStringAtom( const TCStringView& string )
+{
+	mId = GetInterner().Intern( string, Hash( string ), true );
+}
+
+//
+// Constructor
+//		- Will intern a string whose hash is already known, used by TC_STRING_ATOM.
+// Inputs:
+//		- const TCStringView& string: The characters to intern, they are copied the first time they're seen.
+//		- unsigned int hash: The hash of the characters, it must match TCStringAtom::Hash.
+// Outputs:
+//		- None.
+//
+
+TCStringAtom::TCStringAtom( const TCStringView& string, unsigned int hash )
+{
+	TC_ASSERT( hash == Hash( string ) && "The hash provided doesn't match the string" );
+	mId = GetInterner().Intern( string, hash, true );
+}
+
+//
+// Find
+//		- Will find the atom of a string without interning it, so looking up names that were never interned
+//		  doesn't grow the table.
+// Inputs:
+//		- const TCStringView& string: The characters to find.
+// Outputs:
+//		- TCStringAtom: The atom, empty if the string was never interned.
+//
+
+TCStringAtom TCStringAtom::Find( const TCStringView& string )
+{
+	TCStringAtom atom;
+	atom.mId = GetInterner().Intern( string, Hash( string ), false );
+	return atom;
+}
+
+//
+// Hash
+//		- Will hash characters with FNV-1a, the same hash TC_STRING_HASH makes at compile time.
+// Inputs:
+//		- const TCStringView& string: The characters to hash.
+// Outputs:
+//		- unsigned int: The hash.
+//
+
+unsigned int TCStringAtom::Hash( const TCStringView& string )
+{
+	const unsigned char* characters = (const unsigned char*)string.Data();
+	unsigned int hash = TC_STRING_HASH_OFFSET_BASIS;
+
+	for( int currentChar = 0; currentChar < string.Length(); ++currentChar )
+	{
+		hash = ( hash ^ characters[ currentChar ] ) * TC_STRING_HASH_PRIME;
+	}
+
+	return hash;
+}
+
+//
+// Count
+//		- Will return the number of strings interned so far, including the empty string.
+// Inputs:
+//		- None.
+// Outputs:
+//		- int: The number of atoms.
+//
+
+int TCStringAtom::Count()
+{
+	return GetInterner().Count();
+}
+
+//
+// Data
+//		- Will return the interned characters.
+// Inputs:
+//		- None.
+// Outputs:
+//		- const char8*: The NULL terminated characters, valid for the whole program.
+//
+
+const char8* TCStringAtom::Data() const
+{
+	return GetInterner().GetEntry( mId ).string;
+}
+
+//
+// Length
+//		- Will return the number of interned characters.
+// Inputs:
+//		- None.
+// Outputs:
+//		- int: The length.
+//
+
+int TCStringAtom::Length() const
+{
+	return GetInterner().GetEntry( mId ).length;
+}
+
+//
+// GetHash
+//		- Will return the hash of the interned characters.
+// Inputs:
+//		- None.
+// Outputs:
+//		- unsigned int: The hash, the same as TC_STRING_HASH on the same characters.
+//
+
+unsigned int TCStringAtom::GetHash() const
+{
+	return GetInterner().GetEntry( mId ).hash;
+}
@@ -0,0 +1,103 @@
+//
+// TCStringAtom.h
+// This file will declare an interned string, a small integer that stands in for a string that lives forever.
+//
+
+#ifndef __TC_STRING_ATOM_H__
+#define __TC_STRING_ATOM_H__
+
+//
+// Includes
+//
+
+#include "TCPlatformPrecompilerSymbols.h"
+#include "TCStringView.h"
+#include "TCHashTraits.h"
+
+#include <type_traits>
+
+//
+// Defines
+//
+
+#define TC_STRING_HASH_OFFSET_BASIS		(2166136261u)	// 32 bit FNV-1a.
+#define TC_STRING_HASH_PRIME			(16777619u)
+
+//
+// TCStringHashLiteral
+//		- Will hash a NULL terminated string with FNV-1a, written as a single return so it can run at compile time where
+//		  the compiler supports constexpr.
+// Inputs:
+//		- const char8* string: The string to hash.
+//		- unsigned int hash: The hash of the characters before this one.
+// Outputs:
+//		- unsigned int: The hash, the same as TCStringAtom::Hash on the same characters.
+//
+
+inline TC_CONSTEXPR unsigned int TCStringHashLiteral( const char8* string, unsigned int hash = TC_STRING_HASH_OFFSET_BASIS )
+{
+	return *string == NULL_TERMINATOR ? hash : TCStringHashLiteral( string + 1, ( hash ^ (unsigned char)*string ) * TC_STRING_HASH_PRIME );
+}
+
+// Hashes a string literal at compile time, the result can be used as a case label when TC_HAS_CONSTEXPR is set.
+#if TC_HAS_CONSTEXPR
+	#define TC_STRING_HASH( literal )	( std::integral_constant< unsigned int, TCStringHashLiteral( literal ) >::value )
+#else
+	#define TC_STRING_HASH( literal )	( TCStringHashLiteral( literal ) )
+#endif
+
+// Interns a string literal the first time the line runs, every run after that is a static load.
+#define TC_STRING_ATOM( literal )	( []() -> TCStringAtom { static const TCStringAtom atom( literal, TC_STRING_HASH( literal ) ); return atom; }() )
+
+//
+// Class Declaration
+//		- Interning a string stores one copy of its characters in a global table and returns its id, the same characters
+//		  always give the same id so comparing and hashing atoms is a single integer operation.
+//		- Ids are handed out in order starting at 1, the empty string is always id 0 which is also a default atom.
+//		- The characters are never freed or moved, so Data() is NULL terminated and stays valid for the whole program.
+//		- Interning and finding take a lock, reading the characters of an atom doesn't.
+//
+
+class TCStringAtom
+{
+	public:		// Members
+	public:		// Methods
+									TCStringAtom()										{ mId = 0; }
+		explicit					TCStringAtom( const TCStringView& string );
+									TCStringAtom( const TCStringView& string, unsigned int hash );
+
+		static TCStringAtom			Find( const TCStringView& string );
+		static unsigned int			Hash( const TCStringView& string );
+		static int					Count();
+
+		inline unsigned int			GetId() const										{ return mId; }
+		inline bool					IsEmpty() const										{ return mId == 0; }
+
+		const char8*				Data() const;
+		int							Length() const;
+		unsigned int				GetHash() const;
+		TCStringView				View() const										{ return TCStringView( Data(), Length() ); }
+
+		inline bool					operator==( const TCStringAtom& atom ) const		{ return mId == atom.mId; }
+		inline bool					operator!=( const TCStringAtom& atom ) const		{ return mId != atom.mId; }
+		inline bool					operator<( const TCStringAtom& atom ) const			{ return mId < atom.mId; }	// Interning order, not alphabetical.
+
+	private:	// Members
+		unsigned int				mId;
+};
+
+//
+// Hash Specialization
+//		- Atoms hash their id, the characters are never touched.
+//
+
+template<>
+struct TCHash< TCStringAtom >
+{
+	static inline unsigned int Hash( const TCStringAtom& key, TCHashFunction )
+	{
+		return TCHashInteger( key.GetId() );
+	}
+};
+
+#endif // __TC_STRING_ATOM_H__
@@ -0,0 +1,304 @@
+//
+// TCStringBuilder.cpp
+// This file will define the methods declared for a string builder.
+//
+
+//
+// Includes
+//
+
+#include "TCStringBuilder.h"
+#include "TCStringUtils.h"
+#include "TCMemoryTracker.h"
+
+#include <string.h>
+
+//
+// Defines
+//
+
+//
+// Default Constructor
+//		- Initializes the builder to an empty string in its inline buffer.
+// Inputs:
+//		- None.
+// Outputs:
+//		- None.
+//
+
+TCStringBuilder::TCStringBuilder()
+{
+	mBuffer		= mInlineBuffer;
+	mLength		= 0;
+	mCapacity	= TC_STRING_BUILDER_INLINE_CAPACITY;
+
+	mBuffer[ 0 ] = NULL_TERMINATOR;
+}
+
+//
+// Constructor
+//		- Initializes the builder with room for a number of characters.
+// Inputs:
+//		- unsigned int capacity: The number of characters to make room for.
+// Outputs:
+//		- None.
+//
+
+TCStringBuilder::TCStringBuilder( unsigned int capacity )
+{
+	mBuffer		= mInlineBuffer;
+	mLength		= 0;
+	mCapacity	= TC_STRING_BUILDER_INLINE_CAPACITY;
+
+	mBuffer[ 0 ] = NULL_TERMINATOR;
+
+	Reserve( capacity );
+}
+
+//
+// Destructor
+//		- Will release the buffer if it was allocated.
+// Inputs:
+//		- None.
+// Outputs:
+//		- None.
+//
+
+TCStringBuilder::~TCStringBuilder()
+{
+	if( mBuffer != mInlineBuffer )
+	{
+		TCMemoryTracker::Free( mBuffer );
+	}
+}
+
+//
+// Reserve
+//		- Will make room for a number of characters up front.
+// Inputs:
+//		- unsigned int capacity: The number of characters to make room for, not counting the NULL_TERMINATOR.
+// Outputs:
+//		- None.
+//
+
+void TCStringBuilder::Reserve( unsigned int capacity )
+{
+	if( capacity > mCapacity )
+	{
+		Grow( capacity );
+	}
+}
+
+//
+// Clear
+//		- Will empty the builder, the buffer is kept for the next string.
+// Inputs:
+//		- None.
+// Outputs:
+//		- None.
+//
+
+void TCStringBuilder::Clear()
+{
+	mLength = 0;
+	mBuffer[ 0 ] = NULL_TERMINATOR;
+}
+
+//
+// Append
+//		- Will append a NULL terminated string.
+// Inputs:
+//		- const char8* string: The string to append, NULL is ignored.
+// Outputs:
+//		- TCStringBuilder&: This builder, so appends can be chained.
+//
+
+TCStringBuilder& TCStringBuilder::Append( const char8* string )
+{
+	if( string == NULL )
+		return *this;
+
+	return Append( string, TCStringUtils::Length( string ) );
+}
+
+//
+// Append
+//		- Will append a number of characters.
+// Inputs:
+//		- const char8* string: The characters to append.
+//		- unsigned int length: The number of characters to append, there must be at least this many.
+// Outputs:
+//		- TCStringBuilder&: This builder, so appends can be chained.
+//
+
+TCStringBuilder& TCStringBuilder::Append( const char8* string, unsigned int length )
+{
+	if( string == NULL || length == 0 )
+		return *this;
+
+	//
+	// Grow geometrically, the characters may come from Data() so find them again in the new buffer afterwards.
+	//
+
+	if( mLength + length > mCapacity )
+	{
+		bool isInternal = string >= mBuffer && string <= mBuffer + mLength;
+		unsigned int internalOffset = isInternal ? (unsigned int)( string - mBuffer ) : 0;
+
+		unsigned int newCapacity = mCapacity * TC_STRING_GROWTH_FACTOR;
+		if( newCapacity < mLength + length )
+		{
+			newCapacity = mLength + length;
+		}
+
+		Grow( newCapacity );
+		if( mLength + length > mCapacity )
+		{
+			return *this;
+		}
+
+		if( isInternal )
+		{
+			string = mBuffer + internalOffset;
+		}
+	}
+
+	memcpy( &mBuffer[ mLength ], string, length );
+	mLength += length;
+	mBuffer[ mLength ] = NULL_TERMINATOR;
+
+	return *this;
+}
+
+//
+// Append
+//		- Will append a TCString, using its cached length.
+// Inputs:
+//		- const TCString& string: The string to append.
+// Outputs:
+//		- TCStringBuilder&: This builder, so appends can be chained.
+//
+
+TCStringBuilder& TCStringBuilder::Append( const TCString& string )
+{
+	return Append( string.Data(), string.Length() );
+}
+
+//
+// Append
+//		- Will append the characters of a view.
+// Inputs:
+//		- const TCStringView& string: The characters to append.
+// Outputs:
+//		- TCStringBuilder&: This builder, so appends can be chained.
+//
+
+TCStringBuilder& TCStringBuilder::Append( const TCStringView& string )
+{
+	return Append( string.Data(), string.Length() );
+}
+
+//
+// Append
+//		- Will append a single character.
+// Inputs:
+//		- char8 character: The character to append.
+// Outputs:
+//		- TCStringBuilder&: This builder, so appends can be chained.
+//
+
+TCStringBuilder& TCStringBuilder::Append( char8 character )
+{
+	return Append( &character, 1 );
+}
+
+//
+// Append
+//		- Will append the text of an integer.
+// Inputs:
+//		- int value: The value to append.
+//		- int base: The base to write the value in.
+// Outputs:
+//		- TCStringBuilder&: This builder, so appends can be chained.
+//
+
+TCStringBuilder& TCStringBuilder::Append( int value, int base )
+{
+	char8 buffer[ TC_INT_STRING_MAX_LENGTH ];
+	return Append( buffer, TCStringUtils::FormatInt( value, buffer, base ) );
+}
+
+//
+// Append
+//		- Will append the text of a float.
+// Inputs:
+//		- float value: The value to append.
+//		- int precision: The number of digits after the decimal point, negative for the shortest text that reads back the same.
+// Outputs:
+//		- TCStringBuilder&: This builder, so appends can be chained.
+//
+
+TCStringBuilder& TCStringBuilder::Append( float value, int precision )
+{
+	char8 buffer[ TC_FLOAT_STRING_MAX_LENGTH ];
+	return Append( buffer, TCStringUtils::FormatFloat( value, precision, buffer ) );
+}
+
+//
+// ToString
+//		- Will make a TCString of the text built so far.
+// Inputs:
+//		- None.
+// Outputs:
+//		- TCString: The text.
+//
+
+TCString TCStringBuilder::ToString() const
+{
+	TCString string;
+	ToString( string );
+	return string;
+}
+
+//
+// ToString
+//		- Will copy the text built so far into a string, reusing the string's buffer when it is big enough.
+// Inputs:
+//		- TCString& string: The string to fill.
+// Outputs:
+//		- None.
+//
+
+void TCStringBuilder::ToString( TCString& string ) const
+{
+	string.Copy( mBuffer, mLength );
+}
+
+//
+// Grow
+//		- Will move the text into a bigger heap buffer.
+// Inputs:
+//		- unsigned int capacity: The new capacity, not counting the NULL_TERMINATOR.
+// Outputs:
+//		- None.
+//
+
+void TCStringBuilder::Grow( unsigned int capacity )
+{
+	char8* newBuffer = (char8*)TCMemoryTracker::Allocate( capacity + 1, TCMemoryTracker::kMemoryTagString );
+	if( newBuffer == NULL )
+	{
+		TC_ASSERT( "Failed to allocate string builder!" && 0 );
+		return;
+	}
+
+	memcpy( newBuffer, mBuffer, mLength + 1 );
+
+	if( mBuffer != mInlineBuffer )
+	{
+		TCMemoryTracker::Free( mBuffer );
+	}
+
+	mBuffer		= newBuffer;
+	mCapacity	= capacity;
+}
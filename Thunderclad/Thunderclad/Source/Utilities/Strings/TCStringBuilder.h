@@ -0,0 +1,69 @@
+//
+// TCStringBuilder.h
+// This file will declare a buffer that collects pieces of text and turns them into one TCString at the end.
+//
+
+#ifndef __TC_STRING_BUILDER_H__
+#define __TC_STRING_BUILDER_H__
+
+//
+// Includes
+//
+
+#include "TCPlatformPrecompilerSymbols.h"
+#include "TCString.h"
+
+//
+// Defines
+//
+
+#define TC_STRING_BUILDER_INLINE_CAPACITY	(255)	// Text up to this long is built on the stack, a typical log line never allocates.
+
+//
+// Class Declaration
+//		- Pieces are appended into one buffer that grows geometrically, the buffer is always NULL terminated so Data()
+//		  can be handed straight to C APIs without making a TCString first.
+//
+
+class TCStringBuilder
+{
+	public:		// Members
+	public:		// Methods
+								TCStringBuilder();
+								TCStringBuilder( unsigned int capacity );
+								~TCStringBuilder();
+
+		inline int				Length() const				{ return mLength; }
+		inline unsigned int		Capacity() const			{ return mCapacity; }
+		inline bool				IsEmpty() const				{ return mLength == 0; }
+		inline const char8*		Data() const				{ return mBuffer; }
+
+		void					Reserve( unsigned int capacity );
+		void					Clear();
+
+		TCStringBuilder&		Append( const char8* string );
+		TCStringBuilder&		Append( const char8* string, unsigned int length );		// Appends exactly length characters.
+		TCStringBuilder&		Append( const TCString& string );
+		TCStringBuilder&		Append( const TCStringView& string );
+		TCStringBuilder&		Append( char8 character );
+		TCStringBuilder&		Append( int value, int base = 10 );
+		TCStringBuilder&		Append( float value, int precision = -1 );
+
+		TCString				ToString() const;
+		void					ToString( TCString& string ) const;
+
+	private:	// Members
+		char8*					mBuffer;			// Points at mInlineBuffer until the text outgrows it.
+		unsigned int			mLength;
+		unsigned int			mCapacity;			// Not counting the NULL_TERMINATOR.
+		char8					mInlineBuffer[ TC_STRING_BUILDER_INLINE_CAPACITY + 1 ];
+
+	private:	// Methods
+		// Builders are meant to live on the stack for one piece of text, they can't be copied.
+								TCStringBuilder( const TCStringBuilder& builder );
+		TCStringBuilder&		operator=( const TCStringBuilder& builder );
+
+		void					Grow( unsigned int capacity );
+};
+
+#endif // __TC_STRING_BUILDER_H__
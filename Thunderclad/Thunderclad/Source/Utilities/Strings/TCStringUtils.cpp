@@ -10,18 +10,1556 @@
 #include "TCStringUtils.h"
 #include "TCMathUtils.h"
 #include "TCString.h"
+#include "TCStringView.h"
+#include "TCBitUtils.h"
+#include "TCCPUFeatures.h"
+
+#include <string.h>
+
+#if TC_PLATFORM_WIN32
+	#include <emmintrin.h>
+	#include <immintrin.h>
+#endif
+
+//
+// Defines
+//
+
+#define TC_ASCII_LOWERCASE_RANGE_START	(97)
+#define TC_ASCII_LOWERCASE_RANGE_END	(122)
+#define TC_ASCII_UPPERCASE_RANGE_START	(65)
+#define TC_ASCII_UPPERCASE_RANGE_END	(90)
+#define TC_ASCII_CASE_CONVERSION_AMOUNT	(TC_ASCII_LOWERCASE_RANGE_START - TC_ASCII_UPPERCASE_RANGE_START)
+#define TC_ASCII_NUMERIC_RANGE_START	(48)
+#define TC_ASCII_NUMERIC_RANGE_END		(57)
+#define TC_PAGE_SIZE					(4096)
+#define TC_FLOAT_MANTISSA_BITS			(23)
+#define TC_FLOAT_EXPONENT_BIAS			(127)
+#define TC_FLOAT_POW5_INV_BITCOUNT		(59)
+#define TC_FLOAT_POW5_BITCOUNT			(61)
+#define TC_FLOAT_SMALLEST_POWER_OF_TEN	(-64)		// Anything smaller than 10^-64 rounds to zero.
+#define TC_FLOAT_LARGEST_POWER_OF_TEN	(38)		// Anything larger than 10^38 with a nonzero mantissa is infinite.
+#define TC_FLOAT_FIXED_NOTATION_MIN		(-5)		// Shortest text uses fixed notation while the decimal point is within this range.
+#define TC_FLOAT_FIXED_NOTATION_MAX		(9)
+#define TC_FLOAT_FIXED_NOTATION_LIMIT	(9e18)		// Scaled values at or above this don't fit the fixed precision path.
+#define TC_FLOAT_MAX_PRECISION			(9)
+#define TC_MAX_PARSE_DIGITS				(19)		// The most decimal digits that always fit in 64 bits.
+#define TC_MAX_PARSE_EXPONENT			(100000)	// Written exponents are clamped here, far past where every float saturates.
+#define TC_MAX_EXACT_DIGITS				(120)		// Digits read when resolving a halfway case, more can't change the rounding of a float.
+#define TC_BIG_INTEGER_WORDS			(40)
+
+//
+// Scalar Helpers
+//		- Each SIMD routine finishes its tail with these, and they are the whole routine on platforms without SIMD.
+//
+
+static int FindCharacterScalar( const char8* string, int startIndex, int length, char8 character )
+{
+	for( int currentChar = startIndex; currentChar < length; ++currentChar )
+	{
+		if( string[ currentChar ] == character )
+		{
+			return currentChar;
+		}
+	}
+
+	return -1;
+}
+
+static int FindStringScalar( const char8* string, int startIndex, int length, const char8* stringToFind, int findLength )
+{
+	for( int currentChar = startIndex; currentChar + findLength <= length; ++currentChar )
+	{
+		if( string[ currentChar ] == stringToFind[ 0 ] && memcmp( &string[ currentChar ], stringToFind, findLength ) == 0 )
+		{
+			return currentChar;
+		}
+	}
+
+	return -1;
+}
+
+static int FindWhitespaceScalar( const char8* string, int startIndex, int length )
+{
+	for( int currentChar = startIndex; currentChar < length; ++currentChar )
+	{
+		if( TCStringUtils::IsWhitespaceCharacter( string[ currentChar ] ) )
+		{
+			return currentChar;
+		}
+	}
+
+	return -1;
+}
+
+static int SkipWhitespaceScalar( const char8* string, int startIndex, int length )
+{
+	int currentChar = startIndex;
+	while( currentChar < length && TCStringUtils::IsWhitespaceCharacter( string[ currentChar ] ) )
+	{
+		currentChar++;
+	}
+
+	return currentChar;
+}
+
+static int SkipWhitespaceReverseScalar( const char8* string, int endIndex )
+{
+	int currentChar = endIndex;
+	while( currentChar > 0 && TCStringUtils::IsWhitespaceCharacter( string[ currentChar - 1 ] ) )
+	{
+		currentChar--;
+	}
+
+	return currentChar;
+}
+
+static void ConvertCaseScalar( char8* string, int startIndex, int length, bool toUpper )
+{
+	for( int currentChar = startIndex; currentChar < length; ++currentChar )
+	{
+		string[ currentChar ] = toUpper ? TCStringUtils::ConvertToUppercase( string[ currentChar ] ) : TCStringUtils::ConvertToLowercase( string[ currentChar ] );
+	}
+}
+
+//
+// DecodeUTF8Sequence
+//		- Will decode one code point. A malformed sequence is cut at its longest valid prefix, the way the Unicode standard
+//		  recommends, so every function here agrees on where the next character starts.
+// Inputs:
+//		- const char8* string: The bytes to decode, at least one.
+//		- int length: The number of bytes available.
+//		- char32& codePoint: Filled with the code point, or TC_UNICODE_REPLACEMENT_CHARACTER if the sequence is malformed.
+// Outputs:
+//		- int: The number of bytes read, negative if the sequence is malformed.
+//
+
+static inline int DecodeUTF8Sequence( const char8* string, int length, char32& codePoint )
+{
+	unsigned char lead = (unsigned char)string[ 0 ];
+	if( lead < 0x80 )
+	{
+		codePoint = lead;
+		return 1;
+	}
+
+	//
+	// The lead byte decides the length, and the range of the second byte rules out overlong forms, surrogates and
+	// anything past U+10FFFF.
+	//
+
+	int numContinuations = 0;
+	unsigned char secondMin = 0x80;
+	unsigned char secondMax = 0xBF;
+	if( lead >= 0xC2 && lead <= 0xDF )
+	{
+		numContinuations = 1;
+		codePoint = lead & 0x1F;
+	}
+	else if( lead >= 0xE0 && lead <= 0xEF )
+	{
+		numContinuations = 2;
+		codePoint = lead & 0x0F;
+		secondMin = ( lead == 0xE0 ) ? 0xA0 : 0x80;
+		secondMax = ( lead == 0xED ) ? 0x9F : 0xBF;
+	}
+	else if( lead >= 0xF0 && lead <= 0xF4 )
+	{
+		numContinuations = 3;
+		codePoint = lead & 0x07;
+		secondMin = ( lead == 0xF0 ) ? 0x90 : 0x80;
+		secondMax = ( lead == 0xF4 ) ? 0x8F : 0xBF;
+	}
+	else
+	{
+		codePoint = TC_UNICODE_REPLACEMENT_CHARACTER;
+		return -1;
+	}
+
+	for( int currentByte = 1; currentByte <= numContinuations; ++currentByte )
+	{
+		unsigned char continuation = currentByte < length ? (unsigned char)string[ currentByte ] : 0;
+		unsigned char minimum = ( currentByte == 1 ) ? secondMin : 0x80;
+		unsigned char maximum = ( currentByte == 1 ) ? secondMax : 0xBF;
+		if( currentByte >= length || continuation < minimum || continuation > maximum )
+		{
+			codePoint = TC_UNICODE_REPLACEMENT_CHARACTER;
+			return -currentByte;
+		}
+
+		codePoint = ( codePoint << 6 ) | ( continuation & 0x3F );
+	}
+
+	return numContinuations + 1;
+}
+
+//
+// DecodeUTF16Sequence
+//		- Will decode one code point from UTF-16, an unpaired surrogate is read as TC_UNICODE_REPLACEMENT_CHARACTER.
+//
+
+static inline int DecodeUTF16Sequence( const char16* string, int length, char32& codePoint )
+{
+	char32 unit = string[ 0 ];
+	if( unit < 0xD800 || unit > 0xDFFF )
+	{
+		codePoint = unit;
+		return 1;
+	}
+
+	if( unit <= 0xDBFF && length > 1 && string[ 1 ] >= 0xDC00 && string[ 1 ] <= 0xDFFF )
+	{
+		codePoint = 0x10000 + ( ( unit - 0xD800 ) << 10 ) + ( string[ 1 ] - 0xDC00 );
+		return 2;
+	}
+
+	codePoint = TC_UNICODE_REPLACEMENT_CHARACTER;
+	return 1;
+}
+
+//
+// EncodeUTF16Sequence
+//		- Will encode one valid code point as one unit or a surrogate pair.
+//
+
+static inline int EncodeUTF16Sequence( char32 codePoint, char16* buffer )
+{
+	if( codePoint < 0x10000 )
+	{
+		buffer[ 0 ] = (char16)codePoint;
+		return 1;
+	}
+
+	codePoint -= 0x10000;
+	buffer[ 0 ] = (char16)( 0xD800 + ( codePoint >> 10 ) );
+	buffer[ 1 ] = (char16)( 0xDC00 + ( codePoint & 0x3FF ) );
+	return 2;
+}
+
+static int FindInvalidUTF8Scalar( const char8* string, int startIndex, int length )
+{
+	char32 codePoint;
+	for( int currentChar = startIndex; currentChar < length; )
+	{
+		int numBytes = DecodeUTF8Sequence( string + currentChar, length - currentChar, codePoint );
+		if( numBytes < 0 )
+		{
+			return currentChar;
+		}
+
+		currentChar += numBytes;
+	}
+
+	return -1;
+}
+
+static int CountCodePointsScalar( const char8* string, int startIndex, int length )
+{
+	int numCodePoints = 0;
+	char32 codePoint;
+	for( int currentChar = startIndex; currentChar < length; ++numCodePoints )
+	{
+		int numBytes = DecodeUTF8Sequence( string + currentChar, length - currentChar, codePoint );
+		currentChar += numBytes < 0 ? -numBytes : numBytes;
+	}
+
+	return numCodePoints;
+}
+
+static int UTF8ToUTF16Scalar( const char8* source, int startIndex, int length, char16* dest )
+{
+	int numWritten = 0;
+	char32 codePoint;
+	for( int currentChar = startIndex; currentChar < length; )
+	{
+		int numBytes = DecodeUTF8Sequence( source + currentChar, length - currentChar, codePoint );
+		currentChar += numBytes < 0 ? -numBytes : numBytes;
+		numWritten += EncodeUTF16Sequence( codePoint, dest + numWritten );
+	}
+
+	return numWritten;
+}
+
+static int UTF8ToUTF32Scalar( const char8* source, int startIndex, int length, char32* dest )
+{
+	int numWritten = 0;
+	for( int currentChar = startIndex; currentChar < length; ++numWritten )
+	{
+		int numBytes = DecodeUTF8Sequence( source + currentChar, length - currentChar, dest[ numWritten ] );
+		currentChar += numBytes < 0 ? -numBytes : numBytes;
+	}
+
+	return numWritten;
+}
+
+static int UTF16ToUTF8Scalar( const char16* source, int startIndex, int length, char8* dest )
+{
+	int numWritten = 0;
+	char32 codePoint;
+	for( int currentUnit = startIndex; currentUnit < length; )
+	{
+		currentUnit += DecodeUTF16Sequence( source + currentUnit, length - currentUnit, codePoint );
+		numWritten += TCStringUtils::EncodeUTF8( codePoint, dest + numWritten );
+	}
+
+	return numWritten;
+}
+
+#if TC_PLATFORM_WIN32
+
+//
+// Lanes
+//		- The SSE2 and AVX2 registers behind one interface, so each routine is written once as a template. LoadPastEnd
+//		  is for blocks that may run past the terminator but are known not to cross into another page.
+//
+
+struct TCSSE2Lanes
+{
+	typedef __m128i Register;
+	enum { Width = 16 };
+	static const unsigned int AllMask = 0xFFFF;
+
+	static inline Register		Load( const char8* pointer )			{ return _mm_loadu_si128( (const __m128i*)pointer ); }
+	TC_NO_SANITIZE_ADDRESS
+	static inline Register		LoadPastEnd( const char8* pointer )		{ return _mm_loadu_si128( (const __m128i*)pointer ); }
+	static inline void			Store( char8* pointer, Register chars )	{ _mm_storeu_si128( (__m128i*)pointer, chars ); }
+	static inline Register		Splat( char8 character )				{ return _mm_set1_epi8( character ); }
+	static inline Register		Equal( Register lhs, Register rhs )		{ return _mm_cmpeq_epi8( lhs, rhs ); }
+	static inline Register		Greater( Register lhs, Register rhs )	{ return _mm_cmpgt_epi8( lhs, rhs ); }
+	static inline Register		And( Register lhs, Register rhs )		{ return _mm_and_si128( lhs, rhs ); }
+	static inline Register		Or( Register lhs, Register rhs )		{ return _mm_or_si128( lhs, rhs ); }
+	static inline Register		Add( Register lhs, Register rhs )		{ return _mm_add_epi8( lhs, rhs ); }
+	static inline unsigned int	MoveMask( Register chars )				{ return (unsigned int)_mm_movemask_epi8( chars ); }
+
+	// Zero extends a block of ASCII into UTF-16 units or code points.
+	static inline void StoreWidened( char16* pointer, Register chars )
+	{
+		_mm_storeu_si128( (__m128i*)pointer, _mm_unpacklo_epi8( chars, _mm_setzero_si128() ) );
+		_mm_storeu_si128( (__m128i*)( pointer + 8 ), _mm_unpackhi_epi8( chars, _mm_setzero_si128() ) );
+	}
+
+	static inline void StoreWidened( char32* pointer, Register chars )
+	{
+		__m128i low = _mm_unpacklo_epi8( chars, _mm_setzero_si128() );
+		__m128i high = _mm_unpackhi_epi8( chars, _mm_setzero_si128() );
+		_mm_storeu_si128( (__m128i*)pointer, _mm_unpacklo_epi16( low, _mm_setzero_si128() ) );
+		_mm_storeu_si128( (__m128i*)( pointer + 4 ), _mm_unpackhi_epi16( low, _mm_setzero_si128() ) );
+		_mm_storeu_si128( (__m128i*)( pointer + 8 ), _mm_unpacklo_epi16( high, _mm_setzero_si128() ) );
+		_mm_storeu_si128( (__m128i*)( pointer + 12 ), _mm_unpackhi_epi16( high, _mm_setzero_si128() ) );
+	}
+
+	// Packs a block of UTF-16 units to bytes, false if any of them isn't ASCII.
+	static inline bool LoadNarrowed( const char16* pointer, Register& chars )
+	{
+		__m128i low = _mm_loadu_si128( (const __m128i*)pointer );
+		__m128i high = _mm_loadu_si128( (const __m128i*)( pointer + 8 ) );
+		__m128i nonASCII = _mm_and_si128( _mm_or_si128( low, high ), _mm_set1_epi16( (short)0xFF80 ) );
+		if( _mm_movemask_epi8( _mm_cmpeq_epi16( nonASCII, _mm_setzero_si128() ) ) != 0xFFFF )
+			return false;
+
+		chars = _mm_packus_epi16( low, high );
+		return true;
+	}
+};
+
+struct TCAVX2Lanes
+{
+	typedef __m256i Register;
+	enum { Width = 32 };
+	static const unsigned int AllMask = 0xFFFFFFFF;
+
+	static inline Register		Load( const char8* pointer )			{ return _mm256_loadu_si256( (const __m256i*)pointer ); }
+	TC_NO_SANITIZE_ADDRESS
+	static inline Register		LoadPastEnd( const char8* pointer )		{ return _mm256_loadu_si256( (const __m256i*)pointer ); }
+	static inline void			Store( char8* pointer, Register chars )	{ _mm256_storeu_si256( (__m256i*)pointer, chars ); }
+	static inline Register		Splat( char8 character )				{ return _mm256_set1_epi8( character ); }
+	static inline Register		Equal( Register lhs, Register rhs )		{ return _mm256_cmpeq_epi8( lhs, rhs ); }
+	static inline Register		Greater( Register lhs, Register rhs )	{ return _mm256_cmpgt_epi8( lhs, rhs ); }
+	static inline Register		And( Register lhs, Register rhs )		{ return _mm256_and_si256( lhs, rhs ); }
+	static inline Register		Or( Register lhs, Register rhs )		{ return _mm256_or_si256( lhs, rhs ); }
+	static inline Register		Add( Register lhs, Register rhs )		{ return _mm256_add_epi8( lhs, rhs ); }
+	static inline unsigned int	MoveMask( Register chars )				{ return (unsigned int)_mm256_movemask_epi8( chars ); }
+
+	static inline void StoreWidened( char16* pointer, Register chars )
+	{
+		_mm256_storeu_si256( (__m256i*)pointer, _mm256_cvtepu8_epi16( _mm256_castsi256_si128( chars ) ) );
+		_mm256_storeu_si256( (__m256i*)( pointer + 16 ), _mm256_cvtepu8_epi16( _mm256_extracti128_si256( chars, 1 ) ) );
+	}
+
+	static inline void StoreWidened( char32* pointer, Register chars )
+	{
+		__m128i low = _mm256_castsi256_si128( chars );
+		__m128i high = _mm256_extracti128_si256( chars, 1 );
+		_mm256_storeu_si256( (__m256i*)pointer, _mm256_cvtepu8_epi32( low ) );
+		_mm256_storeu_si256( (__m256i*)( pointer + 8 ), _mm256_cvtepu8_epi32( _mm_srli_si128( low, 8 ) ) );
+		_mm256_storeu_si256( (__m256i*)( pointer + 16 ), _mm256_cvtepu8_epi32( high ) );
+		_mm256_storeu_si256( (__m256i*)( pointer + 24 ), _mm256_cvtepu8_epi32( _mm_srli_si128( high, 8 ) ) );
+	}
+
+	// The pack works within each 128 bit half, so the middle quarters are swapped back afterwards.
+	static inline bool LoadNarrowed( const char16* pointer, Register& chars )
+	{
+		__m256i low = _mm256_loadu_si256( (const __m256i*)pointer );
+		__m256i high = _mm256_loadu_si256( (const __m256i*)( pointer + 16 ) );
+		__m256i nonASCII = _mm256_and_si256( _mm256_or_si256( low, high ), _mm256_set1_epi16( (short)0xFF80 ) );
+		if( !_mm256_testz_si256( nonASCII, nonASCII ) )
+			return false;
+
+		chars = _mm256_permute4x64_epi64( _mm256_packus_epi16( low, high ), 0xD8 );
+		return true;
+	}
+};
+
+//
+// Character Classes
+//		- The signed compares leave every byte above 127 alone, matching ConvertToLowercase and ConvertToUppercase.
+//
+
+template< class Lanes >
+static inline typename Lanes::Register ConvertCaseRegister( typename Lanes::Register chars, bool toUpper )
+{
+	typename Lanes::Register first	= Lanes::Splat( toUpper ? 'a' - 1 : 'A' - 1 );
+	typename Lanes::Register last	= Lanes::Splat( toUpper ? 'z' + 1 : 'Z' + 1 );
+	typename Lanes::Register inRange = Lanes::And( Lanes::Greater( chars, first ), Lanes::Greater( last, chars ) );
+	typename Lanes::Register offset	= Lanes::Splat( toUpper ? -TC_ASCII_CASE_CONVERSION_AMOUNT : TC_ASCII_CASE_CONVERSION_AMOUNT );
+
+	return Lanes::Add( chars, Lanes::And( inRange, offset ) );
+}
+
+template< class Lanes >
+static inline unsigned int WhitespaceMask( typename Lanes::Register chars )
+{
+	typename Lanes::Register spaces		= Lanes::Or( Lanes::Equal( chars, Lanes::Splat( ' ' ) ), Lanes::Equal( chars, Lanes::Splat( '\t' ) ) );
+	typename Lanes::Register newLines	= Lanes::Or( Lanes::Equal( chars, Lanes::Splat( '\r' ) ), Lanes::Equal( chars, Lanes::Splat( '\n' ) ) );
+
+	return Lanes::MoveMask( Lanes::Or( spaces, newLines ) );
+}
+
+//
+// CanReadBlock
+//		- Will determine if a whole block can be read starting at a pointer without crossing into the next page.
+//
+
+static inline bool CanReadBlock( const char8* pointer, int blockSize )
+{
+	return (int)( (size_t)pointer & ( TC_PAGE_SIZE - 1 ) ) <= TC_PAGE_SIZE - blockSize;
+}
+
+//
+// LengthLanes
+//		- Will find the terminator a block at a time. The loads are aligned so they never cross a page, the bytes
+//		  before the string in the first block are shifted out of the mask.
+//
+
+template< class Lanes >
+static int LengthLanes( const char8* string )
+{
+	const char8* block = (const char8*)( (size_t)string & ~(size_t)( Lanes::Width - 1 ) );
+	typename Lanes::Register zero = Lanes::Splat( NULL_TERMINATOR );
+
+	unsigned int mask = Lanes::MoveMask( Lanes::Equal( Lanes::LoadPastEnd( block ), zero ) ) >> ( string - block );
+	if( mask != 0 )
+	{
+		return TCBitUtils::CountTrailingZeros( mask );
+	}
+
+	for( ;; )
+	{
+		block += Lanes::Width;
+		mask = Lanes::MoveMask( Lanes::Equal( Lanes::LoadPastEnd( block ), zero ) );
+		if( mask != 0 )
+		{
+			return (int)( block - string ) + TCBitUtils::CountTrailingZeros( mask );
+		}
+	}
+}
+
+//
+// CompareLanes
+//		- Will compare a block at a time until the strings differ or end. Blocks that would cross a page are compared
+//		  a character at a time, since the terminator may be the last readable byte.
+//
+
+template< class Lanes, bool Insensitive >
+static int CompareLanes( const char8* lhs, const char8* rhs )
+{
+	typename Lanes::Register zero = Lanes::Splat( NULL_TERMINATOR );
+	int currentChar = 0;
+
+	for( ;; )
+	{
+		if( CanReadBlock( lhs + currentChar, Lanes::Width ) && CanReadBlock( rhs + currentChar, Lanes::Width ) )
+		{
+			typename Lanes::Register lhsChars = Lanes::LoadPastEnd( lhs + currentChar );
+			typename Lanes::Register rhsChars = Lanes::LoadPastEnd( rhs + currentChar );
+			if( Insensitive )
+			{
+				lhsChars = ConvertCaseRegister< Lanes >( lhsChars, false );
+				rhsChars = ConvertCaseRegister< Lanes >( rhsChars, false );
+			}
+
+			unsigned int stopMask = ( ~Lanes::MoveMask( Lanes::Equal( lhsChars, rhsChars ) ) & Lanes::AllMask ) | Lanes::MoveMask( Lanes::Equal( lhsChars, zero ) );
+			if( stopMask == 0 )
+			{
+				currentChar += Lanes::Width;
+				continue;
+			}
+
+			currentChar += TCBitUtils::CountTrailingZeros( stopMask );
+		}
+
+		char8 lhsChar = Insensitive ? TCStringUtils::ConvertToLowercase( lhs[ currentChar ] ) : lhs[ currentChar ];
+		char8 rhsChar = Insensitive ? TCStringUtils::ConvertToLowercase( rhs[ currentChar ] ) : rhs[ currentChar ];
+		if( lhsChar != rhsChar )
+		{
+			return lhsChar < rhsChar ? -1 : 1;
+		}
+
+		if( lhsChar == NULL_TERMINATOR )
+		{
+			return 0;
+		}
+
+		currentChar++;
+	}
+}
+
+//
+// FindCharacterLanes
+//		- Will find the first index of a character a block at a time.
+//
+
+template< class Lanes >
+static int FindCharacterLanes( const char8* string, int length, char8 character )
+{
+	typename Lanes::Register characters = Lanes::Splat( character );
+
+	int currentChar = 0;
+	for( ; currentChar + Lanes::Width <= length; currentChar += Lanes::Width )
+	{
+		unsigned int mask = Lanes::MoveMask( Lanes::Equal( Lanes::Load( string + currentChar ), characters ) );
+		if( mask != 0 )
+		{
+			return currentChar + TCBitUtils::CountTrailingZeros( mask );
+		}
+	}
+
+	return FindCharacterScalar( string, currentChar, length, character );
+}
+
+//
+// FindStringLanes
+//		- Will find the first index of a string. Each block checks the first and last character of the string at
+//		  every position, only the positions where both match need the full compare.
+//
+
+template< class Lanes >
+static int FindStringLanes( const char8* string, int length, const char8* stringToFind, int findLength )
+{
+	typename Lanes::Register firstChars	= Lanes::Splat( stringToFind[ 0 ] );
+	typename Lanes::Register lastChars	= Lanes::Splat( stringToFind[ findLength - 1 ] );
+
+	int currentChar = 0;
+	for( ; currentChar + findLength - 1 + Lanes::Width <= length; currentChar += Lanes::Width )
+	{
+		typename Lanes::Register firstMatches	= Lanes::Equal( Lanes::Load( string + currentChar ), firstChars );
+		typename Lanes::Register lastMatches	= Lanes::Equal( Lanes::Load( string + currentChar + findLength - 1 ), lastChars );
+
+		unsigned int mask = Lanes::MoveMask( Lanes::And( firstMatches, lastMatches ) );
+		while( mask != 0 )
+		{
+			int candidate = currentChar + TCBitUtils::CountTrailingZeros( mask );
+			if( memcmp( string + candidate + 1, stringToFind + 1, findLength - 2 ) == 0 )
+			{
+				return candidate;
+			}
+
+			mask &= mask - 1;
+		}
+	}
+
+	return FindStringScalar( string, currentChar, length, stringToFind, findLength );
+}
+
+//
+// FindWhitespaceLanes
+//		- Will find the first whitespace character a block at a time.
+//
+
+template< class Lanes >
+static int FindWhitespaceLanes( const char8* string, int startIndex, int length )
+{
+	int currentChar = startIndex;
+	for( ; currentChar + Lanes::Width <= length; currentChar += Lanes::Width )
+	{
+		unsigned int mask = WhitespaceMask< Lanes >( Lanes::Load( string + currentChar ) );
+		if( mask != 0 )
+		{
+			return currentChar + TCBitUtils::CountTrailingZeros( mask );
+		}
+	}
+
+	return FindWhitespaceScalar( string, currentChar, length );
+}
+
+//
+// SkipWhitespaceLanes
+//		- Will find the first character that isn't whitespace a block at a time.
+//
+
+template< class Lanes >
+static int SkipWhitespaceLanes( const char8* string, int startIndex, int length )
+{
+	int currentChar = startIndex;
+	for( ; currentChar + Lanes::Width <= length; currentChar += Lanes::Width )
+	{
+		unsigned int mask = ~WhitespaceMask< Lanes >( Lanes::Load( string + currentChar ) ) & Lanes::AllMask;
+		if( mask != 0 )
+		{
+			return currentChar + TCBitUtils::CountTrailingZeros( mask );
+		}
+	}
+
+	return SkipWhitespaceScalar( string, currentChar, length );
+}
+
+//
+// SkipWhitespaceReverseLanes
+//		- Will step back over whole blocks of whitespace from the end, the last partial block is finished one
+//		  character at a time.
+//
+
+template< class Lanes >
+static int SkipWhitespaceReverseLanes( const char8* string, int endIndex )
+{
+	int currentChar = endIndex;
+	while( currentChar >= Lanes::Width && WhitespaceMask< Lanes >( Lanes::Load( string + currentChar - Lanes::Width ) ) == Lanes::AllMask )
+	{
+		currentChar -= Lanes::Width;
+	}
+
+	return SkipWhitespaceReverseScalar( string, currentChar );
+}
+
+//
+// ConvertCaseLanes
+//		- Will convert a run of characters in place a block at a time.
+//
+
+template< class Lanes >
+static void ConvertCaseLanes( char8* string, int length, bool toUpper )
+{
+	int currentChar = 0;
+	for( ; currentChar + Lanes::Width <= length; currentChar += Lanes::Width )
+	{
+		Lanes::Store( string + currentChar, ConvertCaseRegister< Lanes >( Lanes::Load( string + currentChar ), toUpper ) );
+	}
+
+	ConvertCaseScalar( string, currentChar, length, toUpper );
+}
+
+//
+// FindInvalidUTF8Lanes
+//		- Will validate UTF-8 skipping whole blocks of ASCII, a block with multi byte characters is decoded one code point
+//		  at a time and the last one may run into the next block.
+//
+
+template< class Lanes >
+static int FindInvalidUTF8Lanes( const char8* string, int length )
+{
+	int currentChar = 0;
+	while( currentChar + Lanes::Width <= length )
+	{
+		if( Lanes::MoveMask( Lanes::Load( string + currentChar ) ) == 0 )
+		{
+			currentChar += Lanes::Width;
+			continue;
+		}
+
+		char32 codePoint;
+		for( int blockEnd = currentChar + Lanes::Width; currentChar < blockEnd; )
+		{
+			int numBytes = DecodeUTF8Sequence( string + currentChar, length - currentChar, codePoint );
+			if( numBytes < 0 )
+			{
+				return currentChar;
+			}
+
+			currentChar += numBytes;
+		}
+	}
+
+	return FindInvalidUTF8Scalar( string, currentChar, length );
+}
+
+//
+// CountCodePointsLanes
+//		- Will count the code points in UTF-8, a whole block of ASCII is that many code points.
+//
+
+template< class Lanes >
+static int CountCodePointsLanes( const char8* string, int length )
+{
+	int currentChar = 0;
+	int numCodePoints = 0;
+	while( currentChar + Lanes::Width <= length )
+	{
+		if( Lanes::MoveMask( Lanes::Load( string + currentChar ) ) == 0 )
+		{
+			currentChar += Lanes::Width;
+			numCodePoints += Lanes::Width;
+			continue;
+		}
+
+		char32 codePoint;
+		for( int blockEnd = currentChar + Lanes::Width; currentChar < blockEnd; ++numCodePoints )
+		{
+			int numBytes = DecodeUTF8Sequence( string + currentChar, length - currentChar, codePoint );
+			currentChar += numBytes < 0 ? -numBytes : numBytes;
+		}
+	}
+
+	return numCodePoints + CountCodePointsScalar( string, currentChar, length );
+}
+
+//
+// UTF8ToUTF16Lanes
+//		- Will transcode a block of ASCII by zero extending it, other blocks are decoded one code point at a time.
+//
+
+template< class Lanes >
+static int UTF8ToUTF16Lanes( const char8* source, int length, char16* dest )
+{
+	int currentChar = 0;
+	int numWritten = 0;
+	while( currentChar + Lanes::Width <= length )
+	{
+		typename Lanes::Register chars = Lanes::Load( source + currentChar );
+		if( Lanes::MoveMask( chars ) == 0 )
+		{
+			Lanes::StoreWidened( dest + numWritten, chars );
+			currentChar += Lanes::Width;
+			numWritten += Lanes::Width;
+			continue;
+		}
+
+		char32 codePoint;
+		for( int blockEnd = currentChar + Lanes::Width; currentChar < blockEnd; )
+		{
+			int numBytes = DecodeUTF8Sequence( source + currentChar, length - currentChar, codePoint );
+			currentChar += numBytes < 0 ? -numBytes : numBytes;
+			numWritten += EncodeUTF16Sequence( codePoint, dest + numWritten );
+		}
+	}
+
+	return numWritten + UTF8ToUTF16Scalar( source, currentChar, length, dest + numWritten );
+}
+
+//
+// UTF8ToUTF32Lanes
+//		- Will transcode a block of ASCII by zero extending it, other blocks are decoded one code point at a time.
+//
+
+template< class Lanes >
+static int UTF8ToUTF32Lanes( const char8* source, int length, char32* dest )
+{
+	int currentChar = 0;
+	int numWritten = 0;
+	while( currentChar + Lanes::Width <= length )
+	{
+		typename Lanes::Register chars = Lanes::Load( source + currentChar );
+		if( Lanes::MoveMask( chars ) == 0 )
+		{
+			Lanes::StoreWidened( dest + numWritten, chars );
+			currentChar += Lanes::Width;
+			numWritten += Lanes::Width;
+			continue;
+		}
+
+		for( int blockEnd = currentChar + Lanes::Width; currentChar < blockEnd; ++numWritten )
+		{
+			int numBytes = DecodeUTF8Sequence( source + currentChar, length - currentChar, dest[ numWritten ] );
+			currentChar += numBytes < 0 ? -numBytes : numBytes;
+		}
+	}
+
+	return numWritten + UTF8ToUTF32Scalar( source, currentChar, length, dest + numWritten );
+}
+
+//
+// UTF16ToUTF8Lanes
+//		- Will transcode a block of ASCII units by packing them to bytes, other blocks are encoded one code point at a time.
+//
+
+template< class Lanes >
+static int UTF16ToUTF8Lanes( const char16* source, int length, char8* dest )
+{
+	int currentUnit = 0;
+	int numWritten = 0;
+	while( currentUnit + Lanes::Width <= length )
+	{
+		typename Lanes::Register chars;
+		if( Lanes::LoadNarrowed( source + currentUnit, chars ) )
+		{
+			Lanes::Store( dest + numWritten, chars );
+			currentUnit += Lanes::Width;
+			numWritten += Lanes::Width;
+			continue;
+		}
+
+		char32 codePoint;
+		for( int blockEnd = currentUnit + Lanes::Width; currentUnit < blockEnd; )
+		{
+			currentUnit += DecodeUTF16Sequence( source + currentUnit, length - currentUnit, codePoint );
+			numWritten += TCStringUtils::EncodeUTF8( codePoint, dest + numWritten );
+		}
+	}
+
+	return numWritten + UTF16ToUTF8Scalar( source, currentUnit, length, dest + numWritten );
+}
+
+//
+// UseAVX2
+//		- Will determine if a run is long enough to fill an AVX2 register and the cpu supports it.
+//
+
+static inline bool UseAVX2( int length )
+{
+	return length >= TCAVX2Lanes::Width && TCCPUFeatures::HasAVX2();
+}
+
+#endif // TC_PLATFORM_WIN32
+
+
+//
+// Number Helpers
+//		- Shortest float formatting follows Ryu (Ulf Adams, 2018) and float parsing follows Eisel-Lemire (Daniel Lemire, 2021),
+//		  both work on the bits of the float with integer math so the text never depends on the locale or the FPU state.
+//
+
+static const char8 gDigitPairs[ 201 ] =
+	"0001020304050607080910111213141516171819"
+	"2021222324252627282930313233343536373839"
+	"4041424344454647484950515253545556575859"
+	"6061626364656667686970717273747576777879"
+	"8081828384858687888990919293949596979899";
+
+static const float gFloatPowersOfTen[] = { 1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f };		// All exact in a float.
+static const double gDoublePowersOfTen[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9 };
+
+// The top bits of 2^k / 5^i and 5^i, used by Ryu to scale the float into a decimal interval.
+static const unsigned long long gFloatPow5InvSplit[ 31 ] =
+{
+	576460752303423489ULL, 461168601842738791ULL, 368934881474191033ULL,
+	295147905179352826ULL, 472236648286964522ULL, 377789318629571618ULL,
+	302231454903657294ULL, 483570327845851670ULL, 386856262276681336ULL,
+	309485009821345069ULL, 495176015714152110ULL, 396140812571321688ULL,
+	316912650057057351ULL, 507060240091291761ULL, 405648192073033409ULL,
+	324518553658426727ULL, 519229685853482763ULL, 415383748682786211ULL,
+	332306998946228969ULL, 531691198313966350ULL, 425352958651173080ULL,
+	340282366920938464ULL, 544451787073501542ULL, 435561429658801234ULL,
+	348449143727040987ULL, 557518629963265579ULL, 446014903970612463ULL,
+	356811923176489971ULL, 570899077082383953ULL, 456719261665907162ULL,
+	365375409332725730ULL
+};
+
+static const unsigned long long gFloatPow5Split[ 47 ] =
+{
+	1152921504606846976ULL, 1441151880758558720ULL, 1801439850948198400ULL,
+	2251799813685248000ULL, 1407374883553280000ULL, 1759218604441600000ULL,
+	2199023255552000000ULL, 1374389534720000000ULL, 1717986918400000000ULL,
+	2147483648000000000ULL, 1342177280000000000ULL, 1677721600000000000ULL,
+	2097152000000000000ULL, 1310720000000000000ULL, 1638400000000000000ULL,
+	2048000000000000000ULL, 1280000000000000000ULL, 1600000000000000000ULL,
+	2000000000000000000ULL, 1250000000000000000ULL, 1562500000000000000ULL,
+	1953125000000000000ULL, 1220703125000000000ULL, 1525878906250000000ULL,
+	1907348632812500000ULL, 1192092895507812500ULL, 1490116119384765625ULL,
+	1862645149230957031ULL, 1164153218269348144ULL, 1455191522836685180ULL,
+	1818989403545856475ULL, 2273736754432320594ULL, 1421085471520200371ULL,
+	1776356839400250464ULL, 2220446049250313080ULL, 1387778780781445675ULL,
+	1734723475976807094ULL, 2168404344971008868ULL, 1355252715606880542ULL,
+	1694065894508600678ULL, 2117582368135750847ULL, 1323488980084844279ULL,
+	1654361225106055349ULL, 2067951531382569187ULL, 1292469707114105741ULL,
+	1615587133892632177ULL, 2019483917365790221ULL
+};
+
+// 5^q as 128 bits with the top bit set, for q from TC_FLOAT_SMALLEST_POWER_OF_TEN to TC_FLOAT_LARGEST_POWER_OF_TEN, used by Eisel-Lemire.
+static const unsigned long long gPowersOfFive128[ 2 * ( TC_FLOAT_LARGEST_POWER_OF_TEN - TC_FLOAT_SMALLEST_POWER_OF_TEN + 1 ) ] =
+{
+	0xA87FEA27A539E9A5ULL, 0x3F2398D747B36224ULL, 0xD29FE4B18E88640EULL, 0x8EEC7F0D19A03AADULL,
+	0x83A3EEEEF9153E89ULL, 0x1953CF68300424ACULL, 0xA48CEAAAB75A8E2BULL, 0x5FA8C3423C052DD7ULL,
+	0xCDB02555653131B6ULL, 0x3792F412CB06794DULL, 0x808E17555F3EBF11ULL, 0xE2BBD88BBEE40BD0ULL,
+	0xA0B19D2AB70E6ED6ULL, 0x5B6ACEAEAE9D0EC4ULL, 0xC8DE047564D20A8BULL, 0xF245825A5A445275ULL,
+	0xFB158592BE068D2EULL, 0xEED6E2F0F0D56712ULL, 0x9CED737BB6C4183DULL, 0x55464DD69685606BULL,
+	0xC428D05AA4751E4CULL, 0xAA97E14C3C26B886ULL, 0xF53304714D9265DFULL, 0xD53DD99F4B3066A8ULL,
+	0x993FE2C6D07B7FABULL, 0xE546A8038EFE4029ULL, 0xBF8FDB78849A5F96ULL, 0xDE98520472BDD033ULL,
+	0xEF73D256A5C0F77CULL, 0x963E66858F6D4440ULL, 0x95A8637627989AADULL, 0xDDE7001379A44AA8ULL,
+	0xBB127C53B17EC159ULL, 0x5560C018580D5D52ULL, 0xE9D71B689DDE71AFULL, 0xAAB8F01E6E10B4A6ULL,
+	0x9226712162AB070DULL, 0xCAB3961304CA70E8ULL, 0xB6B00D69BB55C8D1ULL, 0x3D607B97C5FD0D22ULL,
+	0xE45C10C42A2B3B05ULL, 0x8CB89A7DB77C506AULL, 0x8EB98A7A9A5B04E3ULL, 0x77F3608E92ADB242ULL,
+	0xB267ED1940F1C61CULL, 0x55F038B237591ED3ULL, 0xDF01E85F912E37A3ULL, 0x6B6C46DEC52F6688ULL,
+	0x8B61313BBABCE2C6ULL, 0x2323AC4B3B3DA015ULL, 0xAE397D8AA96C1B77ULL, 0xABEC975E0A0D081AULL,
+	0xD9C7DCED53C72255ULL, 0x96E7BD358C904A21ULL, 0x881CEA14545C7575ULL, 0x7E50D64177DA2E54ULL,
+	0xAA242499697392D2ULL, 0xDDE50BD1D5D0B9E9ULL, 0xD4AD2DBFC3D07787ULL, 0x955E4EC64B44E864ULL,
+	0x84EC3C97DA624AB4ULL, 0xBD5AF13BEF0B113EULL, 0xA6274BBDD0FADD61ULL, 0xECB1AD8AEACDD58EULL,
+	0xCFB11EAD453994BAULL, 0x67DE18EDA5814AF2ULL, 0x81CEB32C4B43FCF4ULL, 0x80EACF948770CED7ULL,
+	0xA2425FF75E14FC31ULL, 0xA1258379A94D028DULL, 0xCAD2F7F5359A3B3EULL, 0x096EE45813A04330ULL,
+	0xFD87B5F28300CA0DULL, 0x8BCA9D6E188853FCULL, 0x9E74D1B791E07E48ULL, 0x775EA264CF55347EULL,
+	0xC612062576589DDAULL, 0x95364AFE032A819EULL, 0xF79687AED3EEC551ULL, 0x3A83DDBD83F52205ULL,
+	0x9ABE14CD44753B52ULL, 0xC4926A9672793543ULL, 0xC16D9A0095928A27ULL, 0x75B7053C0F178294ULL,
+	0xF1C90080BAF72CB1ULL, 0x5324C68B12DD6339ULL, 0x971DA05074DA7BEEULL, 0xD3F6FC16EBCA5E04ULL,
+	0xBCE5086492111AEAULL, 0x88F4BB1CA6BCF585ULL, 0xEC1E4A7DB69561A5ULL, 0x2B31E9E3D06C32E6ULL,
+	0x9392EE8E921D5D07ULL, 0x3AFF322E62439FD0ULL, 0xB877AA3236A4B449ULL, 0x09BEFEB9FAD487C3ULL,
+	0xE69594BEC44DE15BULL, 0x4C2EBE687989A9B4ULL, 0x901D7CF73AB0ACD9ULL, 0x0F9D37014BF60A11ULL,
+	0xB424DC35095CD80FULL, 0x538484C19EF38C95ULL, 0xE12E13424BB40E13ULL, 0x2865A5F206B06FBAULL,
+	0x8CBCCC096F5088CBULL, 0xF93F87B7442E45D4ULL, 0xAFEBFF0BCB24AAFEULL, 0xF78F69A51539D749ULL,
+	0xDBE6FECEBDEDD5BEULL, 0xB573440E5A884D1CULL, 0x89705F4136B4A597ULL, 0x31680A88F8953031ULL,
+	0xABCC77118461CEFCULL, 0xFDC20D2B36BA7C3EULL, 0xD6BF94D5E57A42BCULL, 0x3D32907604691B4DULL,
+	0x8637BD05AF6C69B5ULL, 0xA63F9A49C2C1B110ULL, 0xA7C5AC471B478423ULL, 0x0FCF80DC33721D54ULL,
+	0xD1B71758E219652BULL, 0xD3C36113404EA4A9ULL, 0x83126E978D4FDF3BULL, 0x645A1CAC083126EAULL,
+	0xA3D70A3D70A3D70AULL, 0x3D70A3D70A3D70A4ULL, 0xCCCCCCCCCCCCCCCCULL, 0xCCCCCCCCCCCCCCCDULL,
+	0x8000000000000000ULL, 0x0000000000000000ULL, 0xA000000000000000ULL, 0x0000000000000000ULL,
+	0xC800000000000000ULL, 0x0000000000000000ULL, 0xFA00000000000000ULL, 0x0000000000000000ULL,
+	0x9C40000000000000ULL, 0x0000000000000000ULL, 0xC350000000000000ULL, 0x0000000000000000ULL,
+	0xF424000000000000ULL, 0x0000000000000000ULL, 0x9896800000000000ULL, 0x0000000000000000ULL,
+	0xBEBC200000000000ULL, 0x0000000000000000ULL, 0xEE6B280000000000ULL, 0x0000000000000000ULL,
+	0x9502F90000000000ULL, 0x0000000000000000ULL, 0xBA43B74000000000ULL, 0x0000000000000000ULL,
+	0xE8D4A51000000000ULL, 0x0000000000000000ULL, 0x9184E72A00000000ULL, 0x0000000000000000ULL,
+	0xB5E620F480000000ULL, 0x0000000000000000ULL, 0xE35FA931A0000000ULL, 0x0000000000000000ULL,
+	0x8E1BC9BF04000000ULL, 0x0000000000000000ULL, 0xB1A2BC2EC5000000ULL, 0x0000000000000000ULL,
+	0xDE0B6B3A76400000ULL, 0x0000000000000000ULL, 0x8AC7230489E80000ULL, 0x0000000000000000ULL,
+	0xAD78EBC5AC620000ULL, 0x0000000000000000ULL, 0xD8D726B7177A8000ULL, 0x0000000000000000ULL,
+	0x878678326EAC9000ULL, 0x0000000000000000ULL, 0xA968163F0A57B400ULL, 0x0000000000000000ULL,
+	0xD3C21BCECCEDA100ULL, 0x0000000000000000ULL, 0x84595161401484A0ULL, 0x0000000000000000ULL,
+	0xA56FA5B99019A5C8ULL, 0x0000000000000000ULL, 0xCECB8F27F4200F3AULL, 0x0000000000000000ULL,
+	0x813F3978F8940984ULL, 0x4000000000000000ULL, 0xA18F07D736B90BE5ULL, 0x5000000000000000ULL,
+	0xC9F2C9CD04674EDEULL, 0xA400000000000000ULL, 0xFC6F7C4045812296ULL, 0x4D00000000000000ULL,
+	0x9DC5ADA82B70B59DULL, 0xF020000000000000ULL, 0xC5371912364CE305ULL, 0x6C28000000000000ULL,
+	0xF684DF56C3E01BC6ULL, 0xC732000000000000ULL, 0x9A130B963A6C115CULL, 0x3C7F400000000000ULL,
+	0xC097CE7BC90715B3ULL, 0x4B9F100000000000ULL, 0xF0BDC21ABB48DB20ULL, 0x1E86D40000000000ULL,
+	0x96769950B50D88F4ULL, 0x1314448000000000ULL
+};
+
+//
+// FloatToBits / BitsToFloat
+//		- Will reinterpret a float without breaking strict aliasing.
+//
+
+static inline unsigned int FloatToBits( float value )
+{
+	unsigned int bits;
+	memcpy( &bits, &value, sizeof( bits ) );
+	return bits;
+}
+
+static inline float BitsToFloat( unsigned int bits )
+{
+	float value;
+	memcpy( &value, &bits, sizeof( value ) );
+	return value;
+}
+
+//
+// CountDigits
+//		- Will count the decimal digits in a value, zero has one digit.
+//
+
+static inline int CountDigits( unsigned int value )
+{
+	int numDigits = 1;
+	for( ; value >= 10000; value /= 10000 )
+	{
+		numDigits += 4;
+	}
+
+	return numDigits + ( value >= 10 ) + ( value >= 100 ) + ( value >= 1000 );
+}
+
+//
+// WriteDigits
+//		- Will write the decimal digits of a value backwards from the end of a buffer, two digits at a time.
+//
+
+static inline void WriteDigits( unsigned long long value, char8* end )
+{
+	while( value >= 100 )
+	{
+		unsigned int pair = (unsigned int)( value % 100 ) * 2;
+		value /= 100;
+		*--end = gDigitPairs[ pair + 1 ];
+		*--end = gDigitPairs[ pair ];
+	}
+
+	if( value >= 10 )
+	{
+		*--end = gDigitPairs[ value * 2 + 1 ];
+		*--end = gDigitPairs[ value * 2 ];
+	}
+	else
+	{
+		*--end = (char8)( '0' + value );
+	}
+}
+
+//
+// MultiplyFull
+//		- Will multiply two 64 bit values into 128 bits.
+//
+
+static inline unsigned long long MultiplyFull( unsigned long long lhs, unsigned long long rhs, unsigned long long& high )
+{
+#if TC_PLATFORM_WIN32 && defined( _M_X64 )
+	return _umul128( lhs, rhs, &high );
+#else
+	unsigned long long lowLow		= ( lhs & 0xFFFFFFFFULL ) * ( rhs & 0xFFFFFFFFULL );
+	unsigned long long lowHigh		= ( lhs & 0xFFFFFFFFULL ) * ( rhs >> 32 );
+	unsigned long long highLow		= ( lhs >> 32 ) * ( rhs & 0xFFFFFFFFULL );
+	unsigned long long highHigh		= ( lhs >> 32 ) * ( rhs >> 32 );
+	unsigned long long middle		= ( lowLow >> 32 ) + ( lowHigh & 0xFFFFFFFFULL ) + ( highLow & 0xFFFFFFFFULL );
+
+	high = highHigh + ( lowHigh >> 32 ) + ( highLow >> 32 ) + ( middle >> 32 );
+	return ( middle << 32 ) | ( lowLow & 0xFFFFFFFFULL );
+#endif
+}
+
+//
+// Ryu Helpers
+//		- Estimates of logarithms that are exact over the float range.
+//
+
+static inline int Pow5Bits( int exponent )			{ return (int)( ( (unsigned int)exponent * 1217359 ) >> 19 ) + 1; }		// ceil( log2( 5^exponent ) )
+static inline int Log10Pow2( int exponent )			{ return (int)( ( (unsigned int)exponent * 78913 ) >> 18 ); }			// floor( log10( 2^exponent ) )
+static inline int Log10Pow5( int exponent )			{ return (int)( ( (unsigned int)exponent * 732923 ) >> 20 ); }			// floor( log10( 5^exponent ) )
+
+static inline bool IsMultipleOfPowerOf5( unsigned int value, int power )
+{
+	int count = 0;
+	for( ; value % 5 == 0 && value != 0; value /= 5 )
+	{
+		count++;
+	}
+
+	return count >= power;
+}
+
+static inline unsigned int MultiplyShift( unsigned int value, unsigned long long factor, int shift )
+{
+	unsigned long long low	= (unsigned long long)value * (unsigned int)factor;
+	unsigned long long high	= (unsigned long long)value * (unsigned int)( factor >> 32 );
+	return (unsigned int)( ( ( low >> 32 ) + high ) >> ( shift - 32 ) );
+}
+
+//
+// ShortestDecimal
+//		- Will find the shortest decimal that parses back to a finite, non zero float. Ties between two shortest
+//		  decimals go to the one closest to the float.
+// Inputs:
+//		- unsigned int bits: The bits of the float, the sign is ignored.
+//		- int& exponent: Filled with the power of ten to scale the digits by.
+// Outputs:
+//		- unsigned int: The digits.
+//
+
+static unsigned int ShortestDecimal( unsigned int bits, int& exponent )
+{
+	unsigned int ieeeMantissa = bits & ( ( 1u << TC_FLOAT_MANTISSA_BITS ) - 1 );
+	unsigned int ieeeExponent = ( bits >> TC_FLOAT_MANTISSA_BITS ) & 0xFF;
+
+	//
+	// Step 1, decode the float into mantissa * 2^exponent, two extra bits make room for the interval below.
+	//
+
+	int e2;
+	unsigned int m2;
+	if( ieeeExponent == 0 )
+	{
+		e2 = 1 - TC_FLOAT_EXPONENT_BIAS - TC_FLOAT_MANTISSA_BITS - 2;
+		m2 = ieeeMantissa;
+	}
+	else
+	{
+		e2 = (int)ieeeExponent - TC_FLOAT_EXPONENT_BIAS - TC_FLOAT_MANTISSA_BITS - 2;
+		m2 = ( 1u << TC_FLOAT_MANTISSA_BITS ) | ieeeMantissa;
+	}
+
+	bool acceptBounds = ( m2 & 1 ) == 0;		// Round to even, an even float owns the edges of its interval.
+
+	//
+	// Step 2, every decimal between the halfway points to the neighbours parses back to this float.
+	//
+
+	unsigned int mv = 4 * m2;
+	unsigned int mp = 4 * m2 + 2;
+	unsigned int mmShift = ( ieeeMantissa != 0 || ieeeExponent <= 1 ) ? 1 : 0;		// The gap below a power of two is half as wide.
+	unsigned int mm = 4 * m2 - 1 - mmShift;
+
+	//
+	// Step 3, scale the interval by a power of ten so it becomes integers.
+	//
+
+	unsigned int vr, vp, vm;
+	int e10;
+	bool vmIsTrailingZeros = false;
+	bool vrIsTrailingZeros = false;
+	unsigned int lastRemovedDigit = 0;
+	if( e2 >= 0 )
+	{
+		int q = Log10Pow2( e2 );
+		e10 = q;
+		int k = TC_FLOAT_POW5_INV_BITCOUNT + Pow5Bits( q ) - 1;
+		int i = -e2 + q + k;
+		vr = MultiplyShift( mv, gFloatPow5InvSplit[ q ], i );
+		vp = MultiplyShift( mp, gFloatPow5InvSplit[ q ], i );
+		vm = MultiplyShift( mm, gFloatPow5InvSplit[ q ], i );
+		if( q != 0 && ( vp - 1 ) / 10 <= vm / 10 )
+		{
+			// The loop below won't run, but the digit we're about to drop still decides the rounding.
+			int l = TC_FLOAT_POW5_INV_BITCOUNT + Pow5Bits( q - 1 ) - 1;
+			lastRemovedDigit = MultiplyShift( mv, gFloatPow5InvSplit[ q - 1 ], -e2 + q - 1 + l ) % 10;
+		}
+
+		if( q <= 9 )
+		{
+			// Only one of mp, mv and mm can be a multiple of 5.
+			if( mv % 5 == 0 )
+			{
+				vrIsTrailingZeros = IsMultipleOfPowerOf5( mv, q );
+			}
+			else if( acceptBounds )
+			{
+				vmIsTrailingZeros = IsMultipleOfPowerOf5( mm, q );
+			}
+			else
+			{
+				vp -= IsMultipleOfPowerOf5( mp, q ) ? 1 : 0;
+			}
+		}
+	}
+	else
+	{
+		int q = Log10Pow5( -e2 );
+		e10 = q + e2;
+		int i = -e2 - q;
+		int k = Pow5Bits( i ) - TC_FLOAT_POW5_BITCOUNT;
+		int j = q - k;
+		vr = MultiplyShift( mv, gFloatPow5Split[ i ], j );
+		vp = MultiplyShift( mp, gFloatPow5Split[ i ], j );
+		vm = MultiplyShift( mm, gFloatPow5Split[ i ], j );
+		if( q != 0 && ( vp - 1 ) / 10 <= vm / 10 )
+		{
+			j = q - 1 - ( Pow5Bits( i + 1 ) - TC_FLOAT_POW5_BITCOUNT );
+			lastRemovedDigit = MultiplyShift( mv, gFloatPow5Split[ i + 1 ], j ) % 10;
+		}
+
+		if( q <= 1 )
+		{
+			// mv = 4 * m2 so it has at least two trailing zero bits, mm has one only when mmShift is one.
+			vrIsTrailingZeros = true;
+			if( acceptBounds )
+			{
+				vmIsTrailingZeros = mmShift == 1;
+			}
+			else
+			{
+				--vp;
+			}
+		}
+		else if( q < 31 )
+		{
+			vrIsTrailingZeros = ( mv & ( ( 1u << ( q - 1 ) ) - 1 ) ) == 0;
+		}
+	}
+
+	//
+	// Step 4, drop digits while the interval still holds a shorter decimal.
+	//
+
+	int removed = 0;
+	unsigned int output;
+	if( vmIsTrailingZeros || vrIsTrailingZeros )
+	{
+		// The rare case, the bounds may be exact so every dropped digit has to be tracked.
+		while( vp / 10 > vm / 10 )
+		{
+			vmIsTrailingZeros &= vm % 10 == 0;
+			vrIsTrailingZeros &= lastRemovedDigit == 0;
+			lastRemovedDigit = vr % 10;
+			vr /= 10;
+			vp /= 10;
+			vm /= 10;
+			++removed;
+		}
+
+		if( vmIsTrailingZeros )
+		{
+			while( vm % 10 == 0 )
+			{
+				vrIsTrailingZeros &= lastRemovedDigit == 0;
+				lastRemovedDigit = vr % 10;
+				vr /= 10;
+				vp /= 10;
+				vm /= 10;
+				++removed;
+			}
+		}
+
+		if( vrIsTrailingZeros && lastRemovedDigit == 5 && vr % 2 == 0 )
+		{
+			lastRemovedDigit = 4;		// The exact value is halfway, round to even.
+		}
+
+		output = vr + ( ( vr == vm && ( !acceptBounds || !vmIsTrailingZeros ) ) || lastRemovedDigit >= 5 );
+	}
+	else
+	{
+		while( vp / 10 > vm / 10 )
+		{
+			lastRemovedDigit = vr % 10;
+			vr /= 10;
+			vp /= 10;
+			vm /= 10;
+			++removed;
+		}
+
+		output = vr + ( vr == vm || lastRemovedDigit >= 5 );
+	}
+
+	exponent = e10 + removed;
+	return output;
+}
+
+//
+// ComputeFloat
+//		- Will round mantissa * 10^exponent to the nearest float with one 128 bit multiply.
+// Inputs:
+//		- unsigned long long mantissa: The decimal digits, at most TC_MAX_PARSE_DIGITS of them.
+//		- int exponent: The power of ten.
+// Outputs:
+//		- float: The nearest float, ties go to even.
+//
+
+static float ComputeFloat( unsigned long long mantissa, int exponent )
+{
+	if( mantissa == 0 || exponent < TC_FLOAT_SMALLEST_POWER_OF_TEN )
+		return 0.0f;
+
+	if( exponent > TC_FLOAT_LARGEST_POWER_OF_TEN )
+		return BitsToFloat( 0x7F800000 );
+
+	//
+	// Clinger's fast path, both operands are exact floats so a single float operation rounds correctly.
+	//
+
+	if( mantissa <= ( 1ULL << ( TC_FLOAT_MANTISSA_BITS + 1 ) ) && exponent >= -10 && exponent <= 10 )
+	{
+		float value = (float)mantissa;
+		return exponent < 0 ? value / gFloatPowersOfTen[ -exponent ] : value * gFloatPowersOfTen[ exponent ];
+	}
+
+	//
+	// Normalize the mantissa and multiply by the truncated power of five, the second word is only needed when
+	// the bits below the ones we keep are all ones and could carry.
+	//
+
+	int leadingZeros = TCBitUtils::CountLeadingZeros( mantissa );
+	mantissa <<= leadingZeros;
+
+	const unsigned long long* powerOfFive = &gPowersOfFive128[ 2 * ( exponent - TC_FLOAT_SMALLEST_POWER_OF_TEN ) ];
+	unsigned long long high;
+	unsigned long long low = MultiplyFull( mantissa, powerOfFive[ 0 ], high );
+
+	const unsigned long long precisionMask = 0xFFFFFFFFFFFFFFFFULL >> ( TC_FLOAT_MANTISSA_BITS + 3 );
+	if( ( high & precisionMask ) == precisionMask )
+	{
+		unsigned long long secondHigh;
+		MultiplyFull( mantissa, powerOfFive[ 1 ], secondHigh );
+		low += secondHigh;
+		if( secondHigh > low )
+		{
+			high++;
+		}
+	}
+
+	int upperBit = (int)( high >> 63 );
+	int shift = upperBit + 64 - TC_FLOAT_MANTISSA_BITS - 3;
+	unsigned long long bits = high >> shift;
+	int power2 = ( ( ( 152170 + 65536 ) * exponent ) >> 16 ) + 63 + upperBit - leadingZeros + TC_FLOAT_EXPONENT_BIAS;
+
+	//
+	// Subnormals shift the extra bits out before rounding.
+	//
+
+	if( power2 <= 0 )
+	{
+		if( -power2 + 1 >= 64 )
+			return 0.0f;
+
+		bits >>= -power2 + 1;
+		bits += bits & 1;
+		bits >>= 1;
+
+		// Rounding up may have carried into the smallest normal, the exponent bit then comes from the mantissa.
+		return BitsToFloat( (unsigned int)bits );
+	}
+
+	//
+	// Round to nearest, a product that landed exactly halfway has to round to even instead of up.
+	//
+
+	if( low <= 1 && exponent >= -17 && exponent <= 10 && ( bits & 3 ) == 1 && ( bits << shift ) == high )
+	{
+		bits &= ~1ULL;
+	}
+
+	bits += bits & 1;
+	bits >>= 1;
+	if( bits >= ( 2ULL << TC_FLOAT_MANTISSA_BITS ) )
+	{
+		bits = 1ULL << TC_FLOAT_MANTISSA_BITS;
+		power2++;
+	}
+
+	bits &= ~( 1ULL << TC_FLOAT_MANTISSA_BITS );
+	if( power2 >= 0xFF )
+		return BitsToFloat( 0x7F800000 );
+
+	return BitsToFloat( (unsigned int)bits | ( (unsigned int)power2 << TC_FLOAT_MANTISSA_BITS ) );
+}
+
+//
+// TCBigInteger
+//		- Just enough of an arbitrary precision integer to compare a long decimal against a halfway point exactly.
+//
+
+struct TCBigInteger
+{
+	unsigned int	words[ TC_BIG_INTEGER_WORDS ];		// Least significant first.
+	int				numWords;
+
+	TCBigInteger( unsigned long long value )
+	{
+		words[ 0 ]	= (unsigned int)value;
+		words[ 1 ]	= (unsigned int)( value >> 32 );
+		numWords	= words[ 1 ] != 0 ? 2 : ( words[ 0 ] != 0 ? 1 : 0 );
+	}
+
+	void MultiplyAdd( unsigned int multiplier, unsigned int addend )
+	{
+		unsigned long long carry = addend;
+		for( int currentWord = 0; currentWord < numWords; ++currentWord )
+		{
+			carry += (unsigned long long)words[ currentWord ] * multiplier;
+			words[ currentWord ] = (unsigned int)carry;
+			carry >>= 32;
+		}
+
+		if( carry != 0 && numWords < TC_BIG_INTEGER_WORDS )
+		{
+			words[ numWords++ ] = (unsigned int)carry;
+		}
+	}
+
+	void MultiplyPow5( int power )
+	{
+		for( ; power >= 13; power -= 13 )
+		{
+			MultiplyAdd( 1220703125, 0 );		// 5^13, the largest power of five in a word.
+		}
+
+		unsigned int remaining = 1;
+		for( ; power > 0; --power )
+		{
+			remaining *= 5;
+		}
+
+		MultiplyAdd( remaining, 0 );
+	}
+
+	void ShiftLeft( int bits )
+	{
+		if( numWords == 0 || bits == 0 )
+			return;
+
+		int wordShift = bits / 32;
+		int bitShift = bits % 32;
+		TC_ASSERT( numWords + wordShift + 1 <= TC_BIG_INTEGER_WORDS );
+
+		words[ numWords + wordShift ] = 0;
+		for( int currentWord = numWords - 1; currentWord >= 0; --currentWord )
+		{
+			unsigned long long shifted = (unsigned long long)words[ currentWord ] << bitShift;
+			words[ currentWord + wordShift + 1 ] |= (unsigned int)( shifted >> 32 );
+			words[ currentWord + wordShift ] = (unsigned int)shifted;
+		}
+
+		for( int currentWord = 0; currentWord < wordShift; ++currentWord )
+		{
+			words[ currentWord ] = 0;
+		}
+
+		numWords += wordShift + 1;
+		while( numWords > 0 && words[ numWords - 1 ] == 0 )
+		{
+			numWords--;
+		}
+	}
+
+	int Compare( const TCBigInteger& other ) const
+	{
+		if( numWords != other.numWords )
+			return numWords < other.numWords ? -1 : 1;
+
+		for( int currentWord = numWords - 1; currentWord >= 0; --currentWord )
+		{
+			if( words[ currentWord ] != other.words[ currentWord ] )
+				return words[ currentWord ] < other.words[ currentWord ] ? -1 : 1;
+		}
+
+		return 0;
+	}
+};
+
+//
+// ResolveHalfway
+//		- Will pick between two neighbouring floats by comparing every digit against the point halfway between them,
+//		  only needed when a number has more digits than the fast path can hold and they land on either side of it.
+// Inputs:
+//		- const char8* digits: The characters of the number, from the first digit up to the exponent.
+//		- int length: The number of characters.
+//		- int exponent: The power of ten written after the digits.
+//		- float lower: The smaller of the two floats.
+// Outputs:
+//		- float: The float nearest to the digits.
+//
+
+static float ResolveHalfway( const char8* digits, int length, int exponent, float lower )
+{
+	//
+	// Collect the significant digits, the rest only matter as a sticky bit.
+	//
+
+	TCBigInteger decimal( 0 );
+	int numDigits = 0;
+	int decimalExponent = exponent;
+	bool hasMoreDigits = false;
+	bool pastPoint = false;
+	for( int currentChar = 0; currentChar < length; ++currentChar )
+	{
+		if( digits[ currentChar ] == '.' )
+		{
+			pastPoint = true;
+			continue;
+		}
+
+		unsigned int digit = digits[ currentChar ] - '0';
+		if( numDigits < TC_MAX_EXACT_DIGITS && ( numDigits > 0 || digit != 0 ) )
+		{
+			decimal.MultiplyAdd( 10, digit );
+			numDigits++;
+			decimalExponent -= pastPoint ? 1 : 0;
+		}
+		else if( numDigits == 0 )
+		{
+			decimalExponent -= pastPoint ? 1 : 0;			// A leading zero.
+		}
+		else
+		{
+			decimalExponent += pastPoint ? 0 : 1;			// A dropped digit.
+			hasMoreDigits |= digit != 0;
+		}
+	}
+
+	//
+	// The halfway point is ( 2 * mantissa + 1 ) * 2^( exponent - 1 ), scale both sides until they are integers.
+	//
+
+	unsigned int bits = FloatToBits( lower );
+	unsigned int biasedExponent = bits >> TC_FLOAT_MANTISSA_BITS;
+	unsigned int mantissa = bits & ( ( 1u << TC_FLOAT_MANTISSA_BITS ) - 1 );
+	int binaryExponent = ( biasedExponent == 0 ? 1 : (int)biasedExponent ) - TC_FLOAT_EXPONENT_BIAS - TC_FLOAT_MANTISSA_BITS - 1;
+	if( biasedExponent != 0 )
+	{
+		mantissa |= 1u << TC_FLOAT_MANTISSA_BITS;
+	}
+
+	if( decimalExponent < TC_FLOAT_SMALLEST_POWER_OF_TEN - TC_MAX_EXACT_DIGITS || decimalExponent > TC_FLOAT_LARGEST_POWER_OF_TEN )
+		return lower;
+
+	TCBigInteger halfway( 2ULL * mantissa + 1 );
+	int twosOnDecimal = 0;
+	if( decimalExponent >= 0 )
+	{
+		decimal.MultiplyPow5( decimalExponent );
+		twosOnDecimal = decimalExponent - binaryExponent;
+	}
+	else
+	{
+		halfway.MultiplyPow5( -decimalExponent );
+		twosOnDecimal = -binaryExponent + decimalExponent;
+	}
+
+	if( twosOnDecimal > 0 )
+	{
+		decimal.ShiftLeft( twosOnDecimal );
+	}
+	else
+	{
+		halfway.ShiftLeft( -twosOnDecimal );
+	}
+
+	int comparison = decimal.Compare( halfway );
+	if( comparison == 0 && hasMoreDigits )
+	{
+		comparison = 1;
+	}
+
+	if( comparison > 0 || ( comparison == 0 && ( mantissa & 1 ) != 0 ) )
+	{
+		return BitsToFloat( bits + 1 );
+	}
+
+	return lower;
+}
 
 //
-// Defines
+// ParseArray
+//		- Will parse a list of numbers separated by a delimiter, with any whitespace around each number.
 //
 
-#define TC_ASCII_LOWERCASE_RANGE_START	(97)
-#define TC_ASCII_LOWERCASE_RANGE_END	(122)
-#define TC_ASCII_UPPERCASE_RANGE_START	(65)
-#define TC_ASCII_UPPERCASE_RANGE_END	(90)
-#define TC_ASCII_CASE_CONVERSION_AMOUNT	(TC_ASCII_LOWERCASE_RANGE_START - TC_ASCII_UPPERCASE_RANGE_START)
-#define TC_ASCII_NUMERIC_RANGE_START	(48)
-#define TC_ASCII_NUMERIC_RANGE_END		(57)
+template< typename Type >
+static int ParseArray( const TCStringView& string, char8 delimiter, Type* values, int maxValues, int (*parse)( const char8*, int, Type& ) )
+{
+	const char8* data = string.Data();
+	int length = string.Length();
+
+	int currentChar = TCStringUtils::SkipWhitespace( data, 0, length );
+	if( currentChar >= length )
+		return 0;
+
+	int numValues = 0;
+	for( ;; )
+	{
+		Type value;
+		int numRead = parse( data + currentChar, length - currentChar, value );
+		if( numRead == 0 )
+			return -1;
+
+		if( numValues < maxValues )
+		{
+			values[ numValues ] = value;
+		}
+		numValues++;
+
+		currentChar = TCStringUtils::SkipWhitespace( data, currentChar + numRead, length );
+		if( currentChar >= length )
+			return numValues;
+
+		if( data[ currentChar ] != delimiter )
+			return -1;
+
+		currentChar = TCStringUtils::SkipWhitespace( data, currentChar + 1, length );
+	}
+}
 
 namespace TCStringUtils
 {
@@ -39,6 +1577,12 @@ namespace TCStringUtils
 		if( string == NULL )
 			return 0;
 
+#if TC_PLATFORM_WIN32
+		if( TCCPUFeatures::HasAVX2() )
+			return LengthLanes< TCAVX2Lanes >( string );
+
+		return LengthLanes< TCSSE2Lanes >( string );
+#else
 		int size = 0;
 		while( string[ size ] != NULL_TERMINATOR )
 		{
@@ -46,6 +1590,7 @@ namespace TCStringUtils
 		}
 
 		return size;
+#endif
 	}
 
 	//
@@ -130,11 +1675,17 @@ namespace TCStringUtils
 			return 0;
 
 		if( lhs == NULL )
-			return rhs[0];
+			return ( rhs[0] == NULL_TERMINATOR ) ? 0 : -1;	// NULL orders like an empty string.
 
 		if( rhs == NULL )
-			return lhs[0];
+			return ( lhs[0] == NULL_TERMINATOR ) ? 0 : 1;
+
+#if TC_PLATFORM_WIN32
+		if( TCCPUFeatures::HasAVX2() )
+			return CompareLanes< TCAVX2Lanes, false >( lhs, rhs );
 
+		return CompareLanes< TCSSE2Lanes, false >( lhs, rhs );
+#else
 		int currentChar = 0;
 		while(true)
 		{
@@ -159,6 +1710,7 @@ namespace TCStringUtils
 			currentChar++;
 
 		}
+#endif
 	}
 
 	//
@@ -177,11 +1729,17 @@ namespace TCStringUtils
 			return 0;
 
 		if( lhs == NULL )
-			return rhs[0];
+			return ( rhs[0] == NULL_TERMINATOR ) ? 0 : -1;	// NULL orders like an empty string.
 
 		if( rhs == NULL )
-			return lhs[0];
+			return ( lhs[0] == NULL_TERMINATOR ) ? 0 : 1;
+
+#if TC_PLATFORM_WIN32
+		if( TCCPUFeatures::HasAVX2() )
+			return CompareLanes< TCAVX2Lanes, true >( lhs, rhs );
 
+		return CompareLanes< TCSSE2Lanes, true >( lhs, rhs );
+#else
 		int currentChar = 0;
 		char8 lhsChar = 0;
 		char8 rhsChar = 0;
@@ -210,6 +1768,193 @@ namespace TCStringUtils
 
 			currentChar++;
 		}
+#endif
+	}
+
+	//
+	// FindCharacter
+	//		- Will find the first index of a character in a run of characters.
+	// Inputs:
+	//		- const char8* string: The characters to search.
+	//		- int length: The number of characters to search.
+	//		- char8 character: The character to find.
+	// Outputs:
+	//		- int: The index found at. -1 if not found.
+	//
+
+	int FindCharacter( const char8* string, int length, char8 character )
+	{
+		if( string == NULL || length <= 0 )
+			return -1;
+
+#if TC_PLATFORM_WIN32
+		if( UseAVX2( length ) )
+			return FindCharacterLanes< TCAVX2Lanes >( string, length, character );
+
+		return FindCharacterLanes< TCSSE2Lanes >( string, length, character );
+#else
+		return FindCharacterScalar( string, 0, length, character );
+#endif
+	}
+
+	//
+	// FindString
+	//		- Will find the first index of a string in a run of characters.
+	// Inputs:
+	//		- const char8* string: The characters to search.
+	//		- int length: The number of characters to search.
+	//		- const char8* stringToFind: The characters to find.
+	//		- int findLength: The number of characters to find.
+	// Outputs:
+	//		- int: The index found at, an empty string is found at 0. -1 if not found.
+	//
+
+	int FindString( const char8* string, int length, const char8* stringToFind, int findLength )
+	{
+		if( findLength <= 0 )
+			return 0;
+
+		if( string == NULL || stringToFind == NULL || findLength > length )
+			return -1;
+
+		if( findLength == 1 )
+			return FindCharacter( string, length, stringToFind[ 0 ] );
+
+#if TC_PLATFORM_WIN32
+		if( UseAVX2( length - findLength + 1 ) )
+			return FindStringLanes< TCAVX2Lanes >( string, length, stringToFind, findLength );
+
+		return FindStringLanes< TCSSE2Lanes >( string, length, stringToFind, findLength );
+#else
+		return FindStringScalar( string, 0, length, stringToFind, findLength );
+#endif
+	}
+
+	//
+	// FindWhitespace
+	//		- Will find the first whitespace character in a run of characters.
+	// Inputs:
+	//		- const char8* string: The characters to search.
+	//		- int startIndex: The index to start searching from.
+	//		- int length: The number of characters in the run.
+	// Outputs:
+	//		- int: The index found at. -1 if not found.
+	//
+
+	int FindWhitespace( const char8* string, int startIndex, int length )
+	{
+		if( string == NULL )
+			return -1;
+
+#if TC_PLATFORM_WIN32
+		if( UseAVX2( length - startIndex ) )
+			return FindWhitespaceLanes< TCAVX2Lanes >( string, startIndex, length );
+
+		return FindWhitespaceLanes< TCSSE2Lanes >( string, startIndex, length );
+#else
+		return FindWhitespaceScalar( string, startIndex, length );
+#endif
+	}
+
+	//
+	// SkipWhitespace
+	//		- Will find the first character that isn't whitespace in a run of characters.
+	// Inputs:
+	//		- const char8* string: The characters to search.
+	//		- int startIndex: The index to start searching from.
+	//		- int length: The number of characters in the run.
+	// Outputs:
+	//		- int: The index found at. length if the rest of the run is whitespace.
+	//
+
+	int SkipWhitespace( const char8* string, int startIndex, int length )
+	{
+		if( string == NULL )
+			return length;
+
+#if TC_PLATFORM_WIN32
+		if( UseAVX2( length - startIndex ) )
+			return SkipWhitespaceLanes< TCAVX2Lanes >( string, startIndex, length );
+
+		return SkipWhitespaceLanes< TCSSE2Lanes >( string, startIndex, length );
+#else
+		return SkipWhitespaceScalar( string, startIndex, length );
+#endif
+	}
+
+	//
+	// SkipWhitespaceReverse
+	//		- Will step back over the whitespace at the end of a run of characters.
+	// Inputs:
+	//		- const char8* string: The characters to search.
+	//		- int length: The number of characters in the run.
+	// Outputs:
+	//		- int: The length of the run without its trailing whitespace.
+	//
+
+	int SkipWhitespaceReverse( const char8* string, int length )
+	{
+		if( string == NULL )
+			return 0;
+
+#if TC_PLATFORM_WIN32
+		if( UseAVX2( length ) )
+			return SkipWhitespaceReverseLanes< TCAVX2Lanes >( string, length );
+
+		return SkipWhitespaceReverseLanes< TCSSE2Lanes >( string, length );
+#else
+		return SkipWhitespaceReverseScalar( string, length );
+#endif
+	}
+
+	//
+	// ToLower
+	//		- Will convert a run of characters to lowercase in place.
+	// Inputs:
+	//		- char8* string: The characters to convert.
+	//		- int length: The number of characters to convert.
+	// Outputs:
+	//		- None.
+	//
+
+	void ToLower( char8* string, int length )
+	{
+		if( string == NULL )
+			return;
+
+#if TC_PLATFORM_WIN32
+		if( UseAVX2( length ) )
+			ConvertCaseLanes< TCAVX2Lanes >( string, length, false );
+		else
+			ConvertCaseLanes< TCSSE2Lanes >( string, length, false );
+#else
+		ConvertCaseScalar( string, 0, length, false );
+#endif
+	}
+
+	//
+	// ToUpper
+	//		- Will convert a run of characters to uppercase in place.
+	// Inputs:
+	//		- char8* string: The characters to convert.
+	//		- int length: The number of characters to convert.
+	// Outputs:
+	//		- None.
+	//
+
+	void ToUpper( char8* string, int length )
+	{
+		if( string == NULL )
+			return;
+
+#if TC_PLATFORM_WIN32
+		if( UseAVX2( length ) )
+			ConvertCaseLanes< TCAVX2Lanes >( string, length, true );
+		else
+			ConvertCaseLanes< TCSSE2Lanes >( string, length, true );
+#else
+		ConvertCaseScalar( string, 0, length, true );
+#endif
 	}
 
 	//
@@ -235,434 +1980,796 @@ namespace TCStringUtils
 	}
 
 	//
-	// ConvertToUppercase
-	//		- Will return the upper case variant of the character.
+	// ConvertToUppercase
+	//		- Will return the upper case variant of the character.
+	// Inputs:
+	//		- char8 character: The character to convert.
+	// Outputs:
+	//		- char8: The converted character.
+	//
+
+	char8 ConvertToUppercase( char8 character )
+	{
+		if( character > TC_ASCII_LOWERCASE_RANGE_END||
+			character < TC_ASCII_LOWERCASE_RANGE_START )
+		{
+			return character;
+		}
+		else
+		{
+			return character - TC_ASCII_CASE_CONVERSION_AMOUNT;
+		}
+	}
+
+	//
+	// IsWhitespaceCharacter
+	//		- Will return whether the character provided is a whitespace character.
+	// Inputs:
+	//		- char8 character: The character to test.
+	// Outputs:
+	//		- bool: Will return if the character is whitespace or not.
+	//
+
+	bool IsWhitespaceCharacter( char8 character )
+	{
+		if( character == ' ' ||
+			character == '\t' ||
+			character == '\r' ||
+			character == '\n' )
+		{
+			return true;
+		}
+		else
+		{
+			return false;
+		}
+	}
+
+	//
+	// IsNumericCharacter
+	//		- Will return whether the character provided is a numeric character.
+	// Inputs:
+	//		- char8 character: The character to test.
+	// Outputs:
+	//		- bool: Will return if the character is numeric or not.
+	//
+
+	bool IsNumericCharacter( char8 character )
+	{
+		if( character >= '0' && character <= '9' )
+		{
+			return true;
+		}
+		else
+		{
+			return false;
+		}
+	}
+
+	//
+	// FindInvalidUTF8
+	//		- Will find the first malformed sequence in UTF-8, this includes overlong forms, surrogates, code points past
+	//		  U+10FFFF and a sequence cut off by the end of the run.
+	// Inputs:
+	//		- const char8* string: The characters to check.
+	//		- int length: The number of characters in the run.
+	// Outputs:
+	//		- int: The index of the first byte of the malformed sequence, -1 if the run is valid UTF-8.
+	//
+
+	int FindInvalidUTF8( const char8* string, int length )
+	{
+		if( string == NULL )
+			return -1;
+
+#if TC_PLATFORM_WIN32
+		if( UseAVX2( length ) )
+			return FindInvalidUTF8Lanes< TCAVX2Lanes >( string, length );
+
+		return FindInvalidUTF8Lanes< TCSSE2Lanes >( string, length );
+#else
+		return FindInvalidUTF8Scalar( string, 0, length );
+#endif
+	}
+
+	//
+	// CountCodePoints
+	//		- Will count the code points in UTF-8, each malformed sequence counts as one.
+	// Inputs:
+	//		- const char8* string: The characters to count.
+	//		- int length: The number of characters in the run.
+	// Outputs:
+	//		- int: The number of code points.
+	//
+
+	int CountCodePoints( const char8* string, int length )
+	{
+		if( string == NULL )
+			return 0;
+
+#if TC_PLATFORM_WIN32
+		if( UseAVX2( length ) )
+			return CountCodePointsLanes< TCAVX2Lanes >( string, length );
+
+		return CountCodePointsLanes< TCSSE2Lanes >( string, length );
+#else
+		return CountCodePointsScalar( string, 0, length );
+#endif
+	}
+
+	//
+	// DecodeUTF8
+	//		- Will decode the code point at the start of a run of UTF-8, stepping by the result walks a string one code
+	//		  point at a time.
+	// Inputs:
+	//		- const char8* string: The characters to decode.
+	//		- int length: The number of characters in the run, at least one.
+	//		- char32& codePoint: Filled with the code point, TC_UNICODE_REPLACEMENT_CHARACTER for a malformed sequence.
+	// Outputs:
+	//		- int: The number of characters read, from 1 to TC_UTF8_MAX_SEQUENCE_LENGTH.
+	//
+
+	int DecodeUTF8( const char8* string, int length, char32& codePoint )
+	{
+		TC_ASSERT( string != NULL && length > 0 );
+
+		int numBytes = DecodeUTF8Sequence( string, length, codePoint );
+		return numBytes < 0 ? -numBytes : numBytes;
+	}
+
+	//
+	// EncodeUTF8
+	//		- Will encode a code point as UTF-8, surrogates and values past U+10FFFF are written as TC_UNICODE_REPLACEMENT_CHARACTER.
+	// Inputs:
+	//		- char32 codePoint: The code point to encode.
+	//		- char8* buffer: The buffer to write into, it must hold TC_UTF8_MAX_SEQUENCE_LENGTH characters.
+	// Outputs:
+	//		- int: The number of characters written, no NULL_TERMINATOR is written.
+	//
+
+	int EncodeUTF8( char32 codePoint, char8* buffer )
+	{
+		if( codePoint < 0x80 )
+		{
+			buffer[ 0 ] = (char8)codePoint;
+			return 1;
+		}
+
+		if( codePoint < 0x800 )
+		{
+			buffer[ 0 ] = (char8)( 0xC0 | ( codePoint >> 6 ) );
+			buffer[ 1 ] = (char8)( 0x80 | ( codePoint & 0x3F ) );
+			return 2;
+		}
+
+		if( ( codePoint >= 0xD800 && codePoint <= 0xDFFF ) || codePoint > 0x10FFFF )
+		{
+			codePoint = TC_UNICODE_REPLACEMENT_CHARACTER;
+		}
+
+		if( codePoint < 0x10000 )
+		{
+			buffer[ 0 ] = (char8)( 0xE0 | ( codePoint >> 12 ) );
+			buffer[ 1 ] = (char8)( 0x80 | ( ( codePoint >> 6 ) & 0x3F ) );
+			buffer[ 2 ] = (char8)( 0x80 | ( codePoint & 0x3F ) );
+			return 3;
+		}
+
+		buffer[ 0 ] = (char8)( 0xF0 | ( codePoint >> 18 ) );
+		buffer[ 1 ] = (char8)( 0x80 | ( ( codePoint >> 12 ) & 0x3F ) );
+		buffer[ 2 ] = (char8)( 0x80 | ( ( codePoint >> 6 ) & 0x3F ) );
+		buffer[ 3 ] = (char8)( 0x80 | ( codePoint & 0x3F ) );
+		return 4;
+	}
+
+	//
+	// UTF8ToUTF16
+	//		- Will transcode UTF-8 to UTF-16, runs of ASCII are copied a block at a time.
+	// Inputs:
+	//		- const char8* source: The characters to transcode.
+	//		- int length: The number of characters in the run.
+	//		- char16* dest: The buffer to write into, it must hold length units.
+	// Outputs:
+	//		- int: The number of units written, no NULL_TERMINATOR is written.
+	//
+
+	int UTF8ToUTF16( const char8* source, int length, char16* dest )
+	{
+		if( source == NULL || dest == NULL )
+			return 0;
+
+#if TC_PLATFORM_WIN32
+		if( UseAVX2( length ) )
+			return UTF8ToUTF16Lanes< TCAVX2Lanes >( source, length, dest );
+
+		return UTF8ToUTF16Lanes< TCSSE2Lanes >( source, length, dest );
+#else
+		return UTF8ToUTF16Scalar( source, 0, length, dest );
+#endif
+	}
+
+	//
+	// UTF16ToUTF8
+	//		- Will transcode UTF-16 to UTF-8, runs of ASCII are copied a block at a time.
+	// Inputs:
+	//		- const char16* source: The units to transcode.
+	//		- int length: The number of units in the run.
+	//		- char8* dest: The buffer to write into, it must hold length * TC_UTF8_MAX_BYTES_PER_UTF16 characters.
+	// Outputs:
+	//		- int: The number of characters written, no NULL_TERMINATOR is written.
+	//
+
+	int UTF16ToUTF8( const char16* source, int length, char8* dest )
+	{
+		if( source == NULL || dest == NULL )
+			return 0;
+
+#if TC_PLATFORM_WIN32
+		if( UseAVX2( length ) )
+			return UTF16ToUTF8Lanes< TCAVX2Lanes >( source, length, dest );
+
+		return UTF16ToUTF8Lanes< TCSSE2Lanes >( source, length, dest );
+#else
+		return UTF16ToUTF8Scalar( source, 0, length, dest );
+#endif
+	}
+
+	//
+	// UTF8ToUTF32
+	//		- Will decode a run of UTF-8 into code points, runs of ASCII are copied a block at a time.
 	// Inputs:
-	//		- char8 character: The character to convert.
+	//		- const char8* source: The characters to decode.
+	//		- int length: The number of characters in the run.
+	//		- char32* dest: The buffer to write into, it must hold length code points.
 	// Outputs:
-	//		- char8: The converted character.
+	//		- int: The number of code points written.
 	//
 
-	char8 ConvertToUppercase( char8 character )
+	int UTF8ToUTF32( const char8* source, int length, char32* dest )
 	{
-		if( character > TC_ASCII_LOWERCASE_RANGE_END||
-			character < TC_ASCII_LOWERCASE_RANGE_START )
-		{
-			return character;
-		}
-		else
-		{
-			return character - TC_ASCII_CASE_CONVERSION_AMOUNT;
-		}
+		if( source == NULL || dest == NULL )
+			return 0;
+
+#if TC_PLATFORM_WIN32
+		if( UseAVX2( length ) )
+			return UTF8ToUTF32Lanes< TCAVX2Lanes >( source, length, dest );
+
+		return UTF8ToUTF32Lanes< TCSSE2Lanes >( source, length, dest );
+#else
+		return UTF8ToUTF32Scalar( source, 0, length, dest );
+#endif
 	}
 
 	//
-	// IsWhitespaceCharacter
-	//		- Will return whether the character provided is a whitespace character.
+	// UTF32ToUTF8
+	//		- Will encode a run of code points as UTF-8.
 	// Inputs:
-	//		- char8 character: The character to test.
+	//		- const char32* source: The code points to encode.
+	//		- int length: The number of code points in the run.
+	//		- char8* dest: The buffer to write into, it must hold length * TC_UTF8_MAX_SEQUENCE_LENGTH characters.
 	// Outputs:
-	//		- bool: Will return if the character is whitespace or not.
+	//		- int: The number of characters written, no NULL_TERMINATOR is written.
 	//
 
-	bool IsWhitespaceCharacter( char8 character )
+	int UTF32ToUTF8( const char32* source, int length, char8* dest )
 	{
-		if( character == ' ' ||
-			character == '\t' ||
-			character == '\r' ||
-			character == '\n' )
-		{
-			return true;
-		}
-		else
+		if( source == NULL || dest == NULL )
+			return 0;
+
+		int numWritten = 0;
+		for( int currentCodePoint = 0; currentCodePoint < length; ++currentCodePoint )
 		{
-			return false;
+			numWritten += EncodeUTF8( source[ currentCodePoint ], dest + numWritten );
 		}
+
+		return numWritten;
 	}
 
 	//
-	// IsNumericCharacter
-	//		- Will return whether the character provided is a numeric character.
+	// FormatInt
+	//		- Will write an integer into a buffer, nothing is allocated.
 	// Inputs:
-	//		- char8 character: The character to test.
+	//		- int value: The value to write.
+	//		- char8* buffer: The buffer to write into, it must hold TC_INT_STRING_MAX_LENGTH characters.
+	//		- int base: The base to write the value in, from 2 to 36. Bases other than 10 write the bits of the value like
+	//		  itoa does, so -1 in base 16 is ffffffff.
 	// Outputs:
-	//		- bool: Will return if the character is numeric or not.
+	//		- int: The number of characters written, not counting the NULL_TERMINATOR.
 	//
 
-	bool IsNumericCharacter( char8 character )
+	int FormatInt( int value, char8* buffer, int base )
 	{
-		if( character >= '0' && character <= '9' )
+		TC_ASSERT( buffer != NULL && base >= 2 && base <= 36 );
+
+		char8* cursor = buffer;
+		unsigned int magnitude = (unsigned int)value;
+		if( base == 10 )
 		{
-			return true;
+			if( value < 0 )
+			{
+				*cursor++ = '-';
+				magnitude = 0u - magnitude;
+			}
+
+			int numDigits = CountDigits( magnitude );
+			WriteDigits( magnitude, cursor + numDigits );
+			cursor += numDigits;
 		}
 		else
 		{
-			return false;
+			char8 digits[ 32 ];
+			int numDigits = 0;
+			do
+			{
+				unsigned int digit = magnitude % base;
+				digits[ numDigits++ ] = (char8)( digit < 10 ? '0' + digit : 'a' + digit - 10 );
+				magnitude /= base;
+			} while( magnitude != 0 );
+
+			while( numDigits > 0 )
+			{
+				*cursor++ = digits[ --numDigits ];
+			}
 		}
+
+		*cursor = NULL_TERMINATOR;
+		return (int)( cursor - buffer );
 	}
 
 	//
-	// ItoA
-	//		- Will convert from an integer value to a string.
+	// FormatFloat
+	//		- Will write the shortest text that parses back to exactly the same float, nothing is allocated. Numbers
+	//		  far from one are written in scientific notation, eg: 1.5e+20.
 	// Inputs:
-	//		- int value: The value to convert to a string.
-	//		- int base: The base for the integer.
+	//		- float value: The value to write.
+	//		- char8* buffer: The buffer to write into, it must hold TC_FLOAT_STRING_MAX_LENGTH characters.
 	// Outputs:
-	//		- TCString: The resultant string.
+	//		- int: The number of characters written, not counting the NULL_TERMINATOR.
 	//
 
-	TCString ItoA( int value, int base )
+	int FormatFloat( float value, char8* buffer )
 	{
-		//
-		// Early out if the value is zero.
-		//
+		TC_ASSERT( buffer != NULL );
 
-		if( value == 0 )
-		{
-			return TCString( "0" );
-		}
+		unsigned int bits = FloatToBits( value );
+		char8* cursor = buffer;
 
 		//
-		// The standard itoa only will negate numbers if the base is 10.
+		// Handle our special cases.
 		//
 
-		bool isNegative = false;
-		if( value < 0 && base == 10 )
+		if( ( bits & 0x7F800000 ) == 0x7F800000 )
 		{
-			isNegative = true;
-			value = -value;
+			const char8* special = ( bits & 0x007FFFFF ) != 0 ? "NaN" : ( ( bits >> 31 ) != 0 ? "-Inf" : "Inf" );
+			Copy( buffer, special );
+			return Length( buffer );
 		}
 
-		//
-		// Walk the list and calculate the string.
-		//
+		if( ( bits >> 31 ) != 0 )
+		{
+			*cursor++ = '-';
+		}
 
-		TCString retString;
-		while( value != 0 )
+		if( ( bits & 0x7FFFFFFF ) == 0 )
 		{
-			int remainder = value % base;
-			retString += (char8)(( remainder > 9 ) ? ( remainder - 10 ) + 'a' : remainder + '0');
-			value /= base;
+			*cursor++ = '0';
+			*cursor = NULL_TERMINATOR;
+			return (int)( cursor - buffer );
 		}
 
 		//
-		// Append negative sign if applicable
+		// Find the digits, then place the decimal point.
 		//
 
-		if( isNegative )
+		int exponent = 0;
+		unsigned int digits = ShortestDecimal( bits, exponent );
+		int numDigits = CountDigits( digits );
+		int decimalPoint = numDigits + exponent;	// The number of digits before the decimal point.
+
+		if( decimalPoint > TC_FLOAT_FIXED_NOTATION_MAX || decimalPoint < TC_FLOAT_FIXED_NOTATION_MIN )
 		{
-			retString += '-';
+			// d.ddde+x
+			WriteDigits( digits, cursor + numDigits + 1 );
+			cursor[ 0 ] = cursor[ 1 ];
+			cursor[ 1 ] = '.';
+			cursor += ( numDigits > 1 ) ? numDigits + 1 : 1;
+
+			int scientificExponent = decimalPoint - 1;
+			*cursor++ = 'e';
+			*cursor++ = scientificExponent < 0 ? '-' : '+';
+			scientificExponent = scientificExponent < 0 ? -scientificExponent : scientificExponent;
+
+			int numExponentDigits = CountDigits( scientificExponent );
+			WriteDigits( scientificExponent, cursor + numExponentDigits );
+			cursor += numExponentDigits;
 		}
+		else if( decimalPoint <= 0 )
+		{
+			// 0.000ddd
+			*cursor++ = '0';
+			*cursor++ = '.';
+			for( ; decimalPoint < 0; ++decimalPoint )
+			{
+				*cursor++ = '0';
+			}
 
-		//
-		// Reverse the string.
-		//
-
-		retString.Reverse();
+			WriteDigits( digits, cursor + numDigits );
+			cursor += numDigits;
+		}
+		else if( decimalPoint >= numDigits )
+		{
+			// ddd000
+			WriteDigits( digits, cursor + numDigits );
+			cursor += numDigits;
+			for( int currentZero = numDigits; currentZero < decimalPoint; ++currentZero )
+			{
+				*cursor++ = '0';
+			}
+		}
+		else
+		{
+			// ddd.ddd
+			WriteDigits( digits, cursor + numDigits + 1 );
+			memmove( cursor, cursor + 1, decimalPoint );
+			cursor[ decimalPoint ] = '.';
+			cursor += numDigits + 1;
+		}
 
-		return retString;
+		*cursor = NULL_TERMINATOR;
+		return (int)( cursor - buffer );
 	}
 
 	//
-	// AtoI
-	//		- Will take a string and convert it to an integer.
+	// FormatFloat
+	//		- Will write a float with a fixed number of digits after the decimal point, rounded to nearest and ties to
+	//		  even. Values too large to write that way fall back to the shortest text.
 	// Inputs:
-	//		- TCString string: The string to convert.
+	//		- float value: The value to write.
+	//		- int precision: The number of digits after the decimal point, up to 9. A negative precision writes the shortest text.
+	//		- char8* buffer: The buffer to write into, it must hold TC_FLOAT_STRING_MAX_LENGTH characters.
 	// Outputs:
-	//		- int: The value represented in the string.
+	//		- int: The number of characters written, not counting the NULL_TERMINATOR.
 	//
 
-	int AtoI( TCString& string )
+	int FormatFloat( float value, int precision, char8* buffer )
 	{
-		//
-		// Check to see if the string is empty.
-		//
+		if( precision < 0 )
+			return FormatFloat( value, buffer );
 
-		if( string.IsEmpty() )
-			return 0;
+		if( precision > TC_FLOAT_MAX_PRECISION )
+		{
+			precision = TC_FLOAT_MAX_PRECISION;
+		}
 
 		//
-		// Determine the sign 
+		// A float times a power of ten up to 10^9 needs at most 45 bits, so the product is exact in a double and
+		// rounding it to an integer is the only rounding done.
 		//
 
-		int sign = 1;
-		int offset = 0;
-		if( string[ 0 ] == '-' )
+		double magnitude = value < 0.0f ? -(double)value : (double)value;
+		double scaled = magnitude * gDoublePowersOfTen[ precision ];
+		if( !( scaled < TC_FLOAT_FIXED_NOTATION_LIMIT ) )		// Also catches NaN.
+			return FormatFloat( value, buffer );
+
+		unsigned long long whole = (unsigned long long)scaled;
+		double remainder = scaled - (double)whole;
+		if( remainder > 0.5 || ( remainder == 0.5 && ( whole & 1 ) != 0 ) )
 		{
-			sign = -1;
-			offset++;
+			whole++;
 		}
 
 		//
-		// Calculate the value.
+		// Write the digits with the decimal point inserted, a value that rounds to zero drops its sign.
 		//
 
-		int result = 0;
-		for( int currentChar = offset; currentChar < string.Length(); ++currentChar )
+		char8* cursor = buffer;
+		if( value < 0.0f && whole != 0 )
+		{
+			*cursor++ = '-';
+		}
+
+		unsigned long long divisor = (unsigned long long)gDoublePowersOfTen[ precision ];
+		unsigned long long integerPart = whole / divisor;
+		unsigned long long fractionPart = whole % divisor;
+
+		int numDigits = 1;
+		for( unsigned long long remaining = integerPart; remaining >= 10; remaining /= 10 )
+		{
+			numDigits++;
+		}
+
+		WriteDigits( integerPart, cursor + numDigits );
+		cursor += numDigits;
+
+		if( precision > 0 )
 		{
-			if( !IsNumericCharacter( string[ currentChar ] ) )
+			*cursor++ = '.';
+			for( int currentDigit = precision - 1; currentDigit >= 0; --currentDigit, fractionPart /= 10 )
 			{
-				return 0;
+				cursor[ currentDigit ] = (char8)( '0' + fractionPart % 10 );
 			}
-
-			result = result * 10 + string[ currentChar ] - TC_ASCII_NUMERIC_RANGE_START;
+			cursor += precision;
 		}
 
-		return result * sign;
+		*cursor = NULL_TERMINATOR;
+		return (int)( cursor - buffer );
 	}
 
 	//
-	// FtoA
-	//		- Will convert a float to a string.
+	// ParseInt
+	//		- Will read a decimal integer from the start of a string, with an optional sign.
 	// Inputs:
-	//		- float value: The float to convert.
-	//		- int precision: The precision of the string.
+	//		- const char8* string: The characters to read, they don't need to be NULL terminated.
+	//		- int length: The number of characters available.
+	//		- int& value: Filled with the value read, untouched on failure.
 	// Outputs:
-	//		- TCString: The string representing the float.
+	//		- int: The number of characters read, 0 if the string doesn't start with an integer or it overflows.
 	//
 
-	TCString TCStringUtils::FtoA( float value, int precision )
+	int ParseInt( const char8* string, int length, int& value )
 	{
-		//
-		// Handle our special cases.
-		//
-
-		if( isnan( value ) )
-		{
-			return TCString( "NaN" );
-		}
-		else if( isinf( value ) )
+		int currentChar = 0;
+		bool isNegative = false;
+		if( currentChar < length && ( string[ currentChar ] == '-' || string[ currentChar ] == '+' ) )
 		{
-			return TCString( "Inf" );
+			isNegative = string[ currentChar ] == '-';
+			currentChar++;
 		}
-		else if( value == 0.0f )
+
+		int firstDigit = currentChar;
+		unsigned long long magnitude = 0;
+		for( ; currentChar < length && IsNumericCharacter( string[ currentChar ] ); ++currentChar )
 		{
-			return TCString( "0" );
+			magnitude = magnitude * 10 + ( string[ currentChar ] - '0' );
+			if( magnitude > 2147483648ULL )
+				return 0;
 		}
 
-		TCString result;
-		char text[ 32 ];
-		char* textBuffer = text;
-
-		int magnitude = (int)TCMathUtils::Log10( value );
-		int sciNotationMagnitude = magnitude;
-		int digit = -1;
+		if( currentChar == firstDigit || ( !isNegative && magnitude > 2147483647ULL ) )
+			return 0;
 
-		bool isNegative = value < 0.0f;
-		bool printExponent = magnitude >= 14 || ( isNegative && magnitude >= 9 || magnitude <= -9 );
-		
-		if( isNegative ) *(textBuffer++) = '-';
+		value = isNegative ? (int)( 0u - (unsigned int)magnitude ) : (int)magnitude;
+		return currentChar;
+	}
 
-		//
-		// Setup for scientific notation if necessary.
-		//
+	//
+	// ParseFloat
+	//		- Will read a float from the start of a string, rounded to the nearest float. Accepts an optional sign,
+	//		  digits with an optional decimal point, an optional exponent and an optional 'f' suffix, as well as the
+	//		  NaN and Inf that FormatFloat writes.
+	// Inputs:
+	//		- const char8* string: The characters to read, they don't need to be NULL terminated.
+	//		- int length: The number of characters available.
+	//		- float& value: Filled with the value read, untouched on failure.
+	// Outputs:
+	//		- int: The number of characters read, 0 if the string doesn't start with a number.
+	//
 
-		if( printExponent )
+	int ParseFloat( const char8* string, int length, float& value )
+	{
+		int currentChar = 0;
+		bool isNegative = false;
+		if( currentChar < length && ( string[ currentChar ] == '-' || string[ currentChar ] == '+' ) )
 		{
-			if( magnitude < 0 )
-			{
-				magnitude -= 1;
-			}
-
-			value = value / TCMathUtils::Pow( 10.0f, magnitude );	// Shear off the exponent and get the mantissa.
-			sciNotationMagnitude = magnitude;
-			magnitude = 0;
+			isNegative = string[ currentChar ] == '-';
+			currentChar++;
 		}
 
 		//
-		// Clamp our magnitude
+		// Handle our special cases.
 		//
 
-		if( magnitude < 1 )
+		if( currentChar + 3 <= length && ( memcmp( string + currentChar, "Inf", 3 ) == 0 || memcmp( string + currentChar, "NaN", 3 ) == 0 ) )
 		{
-			magnitude = 0;
+			unsigned int bits = string[ currentChar ] == 'N' ? 0x7FC00000 : 0x7F800000;
+			value = BitsToFloat( bits | ( isNegative ? 0x80000000 : 0 ) );
+			return currentChar + 3;
 		}
 
 		//
-		// Generate the digits.
+		// Gather up to TC_MAX_PARSE_DIGITS significant digits, digits past that only move the exponent.
 		//
 
-		while( value > precision || magnitude >= 0 )
+		int firstDigit = currentChar;
+		unsigned long long mantissa = 0;
+		int numSignificantDigits = 0;
+		int exponent = 0;
+		bool isTruncated = false;
+		bool pastPoint = false;
+		int numDigits = 0;
+		for( ; currentChar < length; ++currentChar )
 		{
-			//
-			// Determine the current digit.
-			//
-
-			float weight = TCMathUtils::Pow( 10.0f, magnitude );
-			if( weight > 0 && !isinf( weight ) )
+			char8 character = string[ currentChar ];
+			if( character == '.' && !pastPoint )
 			{
-				digit = (int)TCMathUtils::Floor( value / weight );		// Get the current digit.
-				value -= digit * weight;								// Reduce value by the digit we just added, eg, move from hundreds to tens.
-				*(textBuffer++) = TC_ASCII_NUMERIC_RANGE_START + digit;	// Append the numeric character, eg: '0', '1'
+				pastPoint = true;
+				continue;
 			}
 
-			//
-			// Check to see if we need to add the decimal.
-			//
+			if( !IsNumericCharacter( character ) )
+				break;
 
-			if( magnitude == 0 && value > 0 )
+			numDigits++;
+			unsigned int digit = character - '0';
+			if( numSignificantDigits < TC_MAX_PARSE_DIGITS )
+			{
+				mantissa = mantissa * 10 + digit;
+				numSignificantDigits += ( mantissa != 0 ) ? 1 : 0;		// Leading zeros aren't significant.
+				exponent -= pastPoint ? 1 : 0;
+			}
+			else
 			{
-				*(textBuffer++) = '.'; 
+				exponent += pastPoint ? 0 : 1;
+				isTruncated |= digit != 0;
 			}
+		}
 
-			//
-			// Reduce our magnitude
-			//
+		if( numDigits == 0 )
+			return 0;
 
-			magnitude--;
-		}
+		int digitsEnd = currentChar;
 
 		//
-		// Append the scientific notation, if necessary.
+		// Read the exponent, an 'e' without digits after it isn't part of the number.
 		//
 
-		if( printExponent )
+		int writtenExponent = 0;
+		if( currentChar < length && ( string[ currentChar ] == 'e' || string[ currentChar ] == 'E' ) )
 		{
-			//
-			// Determine the prefix's sign.
-			//
-
-			*(textBuffer++) = 'e';
-			if( sciNotationMagnitude > 0 )
-			{
-				*(textBuffer++) = '+';
-			}
-			else
+			int exponentChar = currentChar + 1;
+			bool negativeExponent = false;
+			if( exponentChar < length && ( string[ exponentChar ] == '-' || string[ exponentChar ] == '+' ) )
 			{
-				*(textBuffer++) = '-';
-				sciNotationMagnitude = -sciNotationMagnitude;
+				negativeExponent = string[ exponentChar ] == '-';
+				exponentChar++;
 			}
 
-			magnitude = 0;
-			while( sciNotationMagnitude > 0 )
+			if( exponentChar < length && IsNumericCharacter( string[ exponentChar ] ) )
 			{
-				*(textBuffer++) = TC_ASCII_NUMERIC_RANGE_START + (sciNotationMagnitude % 10); // Determine the current notation digit.
-				sciNotationMagnitude /= 10;
-				magnitude++; // Use magnitude as a counter for how many digits are in the notation.
-			}
-
-			//
-			// Swap the digits order, since they are outputted backwards
-			//
+				for( ; exponentChar < length && IsNumericCharacter( string[ exponentChar ] ); ++exponentChar )
+				{
+					if( writtenExponent < TC_MAX_PARSE_EXPONENT )
+					{
+						writtenExponent = writtenExponent * 10 + ( string[ exponentChar ] - '0' );
+					}
+				}
 
-			textBuffer -= magnitude; // Move back to the start of the notation.
-			int startOfMagnitude = 0;
-			int endOfMagnitude = 0;
-			for( startOfMagnitude = 0, endOfMagnitude = magnitude - 1; startOfMagnitude < endOfMagnitude; ++startOfMagnitude, --endOfMagnitude )
-			{
-				textBuffer[ startOfMagnitude ] ^= textBuffer[ endOfMagnitude ];
-				textBuffer[ endOfMagnitude ] ^= textBuffer[ startOfMagnitude ];
-				textBuffer[ startOfMagnitude ] ^= textBuffer[ endOfMagnitude ];
+				writtenExponent = negativeExponent ? -writtenExponent : writtenExponent;
+				currentChar = exponentChar;
 			}
-			textBuffer += magnitude; // Move back to the end of the string.
+		}
+
+		// Shader files write literals the way HLSL does, eg: 1.0f.
+		if( currentChar < length && ( string[ currentChar ] == 'f' || string[ currentChar ] == 'F' ) )
+		{
+			currentChar++;
 		}
 
 		//
-		// Terminate the string and return the result.
+		// Round to the nearest float, a truncated mantissa is only trusted if rounding it up gives the same float.
 		//
 
-		*(textBuffer) = '\0';
-		result = textBuffer;
-		return result;
+		float result = ComputeFloat( mantissa, exponent + writtenExponent );
+		if( isTruncated )
+		{
+			float upper = ComputeFloat( mantissa + 1, exponent + writtenExponent );
+			if( upper != result )
+			{
+				result = ResolveHalfway( string + firstDigit, digitsEnd - firstDigit, writtenExponent, result );
+			}
+		}
+
+		value = isNegative ? -result : result;
+		return currentChar;
 	}
 
 	//
-	// AtoF
-	//		- Will convert a string to a float.
+	// ParseIntArray
+	//		- Will read a list of integers separated by a delimiter, whitespace around each integer is skipped.
 	// Inputs:
-	//		- TCString text: The text of the float to convert.
+	//		- const TCStringView& string: The list to read.
+	//		- char8 delimiter: The character between the integers.
+	//		- int* values: Filled with the integers.
+	//		- int maxValues: The number of integers values can hold, any more are checked and counted but not stored.
 	// Outputs:
-	//		- float: The float result.
+	//		- int: The number of integers in the list, -1 if one of them is malformed.
 	//
 
-	float TCStringUtils::AtoF( TCString& text )
+	int ParseIntArray( const TCStringView& string, char8 delimiter, int* values, int maxValues )
 	{
-		char8* string				= text.Data();
-		bool isNegative				= string[ 0 ] == '-';
-		bool negativeExponent		= false;
-		int decimalIndex			= -1;
-		int scientificNotationIndex = -1;
-		int scientificNotationExp	= 0;
-		int mantissa				= 0;
-		int sciNotationExponent		= 0;
-		float exponent				= 0.0f;
-
-		//
-		// First we need to find out the mantissa.
-		//
-
-		for( int currentChar = 0; currentChar < text.Length(); ++currentChar )
-		{
-			if( string[ currentChar ] == '.' )
-			{
-				decimalIndex = currentChar;
-				break;
-			}
+		return ParseArray< int >( string, delimiter, values, maxValues, ParseInt );
+	}
 
-			if( string[ currentChar ] == 'f' )
-				continue;
+	//
+	// ParseFloatArray
+	//		- Will read a list of floats separated by a delimiter, whitespace around each float is skipped.
+	// Inputs:
+	//		- const TCStringView& string: The list to read.
+	//		- char8 delimiter: The character between the floats.
+	//		- float* values: Filled with the floats.
+	//		- int maxValues: The number of floats values can hold, any more are checked and counted but not stored.
+	// Outputs:
+	//		- int: The number of floats in the list, -1 if one of them is malformed.
+	//
 
-			mantissa = mantissa * 10 + (string[ currentChar ] - TC_ASCII_NUMERIC_RANGE_START);
-		}
+	int ParseFloatArray( const TCStringView& string, char8 delimiter, float* values, int maxValues )
+	{
+		return ParseArray< float >( string, delimiter, values, maxValues, ParseFloat );
+	}
 
-		//
-		// Next we need to determine the exponent.
-		//
+	//
+	// ItoA
+	//		- Will convert from an integer value to a string.
+	// Inputs:
+	//		- int value: The value to convert to a string.
+	//		- int base: The base for the integer.
+	// Outputs:
+	//		- TCString: The resultant string.
+	//
 
-		if( decimalIndex > 0 )
-		{
-			int numExponentDigits = 0;
-			for( int currentChar = decimalIndex + 1; currentChar < text.Length(); ++currentChar )
-			{
-				if( string[ currentChar ] == 'e' )
-				{
-					scientificNotationIndex = currentChar + 2; // Move past the 'e' and the sign ('-','+')
-					negativeExponent = string[ currentChar + 1 ] == '-';
-					break;
-				}
+	TCString ItoA( int value, int base )
+	{
+		char8 buffer[ TC_INT_STRING_MAX_LENGTH ];
+		int length = FormatInt( value, buffer, base );
 
-				if( string[ currentChar ] == 'f' )
-				{
-					continue;
-				}
+		TCString result;
+		result.Copy( buffer, length );
+		return result;
+	}
 
-				exponent = exponent * 10.0f + (float)(string[ currentChar ] - TC_ASCII_NUMERIC_RANGE_START);
-			}
-		}
+	//
+	// AtoI
+	//		- Will take a string and convert it to an integer.
+	// Inputs:
+	//		- const TCStringView& string: The string to convert.
+	// Outputs:
+	//		- int: The value represented in the string, 0 if the whole string isn't an integer.
+	//
 
+	int AtoI( const TCStringView& string )
+	{
+		int value = 0;
+		if( ParseInt( string.Data(), string.Length(), value ) != string.Length() )
+			return 0;
 
-		//
-		// Next we need to read the scientific notation exponent.
-		//
+		return value;
+	}
 
-		if( scientificNotationIndex > 0 )
-		{
-			for( int currentChar = scientificNotationIndex; currentChar < text.Length(); ++currentChar )
-			{
-				if( string[ currentChar ] == 'f' )
-					continue;
+	//
+	// FtoA
+	//		- Will convert a float to a string.
+	// Inputs:
+	//		- float value: The float to convert.
+	//		- int precision: The number of digits after the decimal point, negative for the shortest text that reads back the same.
+	// Outputs:
+	//		- TCString: The string representing the float.
+	//
 
-				scientificNotationExp = scientificNotationExp * 10 + (string[ currentChar ] - TC_ASCII_NUMERIC_RANGE_START);
-			}
-		}
+	TCString FtoA( float value, int precision )
+	{
+		char8 buffer[ TC_FLOAT_STRING_MAX_LENGTH ];
+		int length = FormatFloat( value, precision, buffer );
 
-		//
-		// Now we need to combine everything to make the actual value.
-		//
+		TCString result;
+		result.Copy( buffer, length );
+		return result;
+	}
 
-		float result = (float)mantissa;
-		
-		if( exponent > 0.0f )
-		{
-			while( exponent > 1.0f ) exponent /= 10.0f;
-			result += exponent;
-		}
+	//
+	// AtoF
+	//		- Will convert a string to a float.
+	// Inputs:
+	//		- const TCStringView& text: The text of the float to convert.
+	// Outputs:
+	//		- float: The float result, 0 if the whole string isn't a float.
+	//
 
-		if( scientificNotationExp > 0.0f )
-		{
-			result *= TCMathUtils::Pow( 10, scientificNotationExp );
-		}
+	float AtoF( const TCStringView& text )
+	{
+		float value = 0.0f;
+		if( ParseFloat( text.Data(), text.Length(), value ) != text.Length() )
+			return 0.0f;
 
-		return result;
+		return value;
 	}
-}
\ No newline at end of file
+}
@@ -16,12 +16,18 @@
 
 #define NULL_TERMINATOR ('\0')
 #define EMPTY_STRING ("\0")
+#define TC_INT_STRING_MAX_LENGTH (34)		// A 32 bit value in base 2 plus a sign and the NULL_TERMINATOR.
+#define TC_FLOAT_STRING_MAX_LENGTH (32)
+#define TC_UNICODE_REPLACEMENT_CHARACTER (0xFFFD)
+#define TC_UTF8_MAX_SEQUENCE_LENGTH (4)
+#define TC_UTF8_MAX_BYTES_PER_UTF16 (3)		// A surrogate pair is two units and four bytes, so no unit needs more than three.
 
 //
 // Typedefs
 //
 
-typedef short char16;
+typedef unsigned short char16;		// A UTF-16 unit, the same size as a Win32 WCHAR.
+typedef unsigned int char32;		// A Unicode code point.
 typedef char char8;
 
 //
@@ -29,6 +35,7 @@ typedef char char8;
 //
 
 class TCString;
+class TCStringView;
 
 namespace TCStringUtils
 {
@@ -37,16 +44,46 @@ namespace TCStringUtils
 	void Copy( char8* copyTo, const char8* copyFrom );
 	int Compare( const char8* lhs, const char8* rhs );
 	int CompareInsensitive( const char8* lhs, const char8* rhs );
+
+	// Run based scans, these use SSE2 or AVX2 when the cpu has them and never read past length.
+	int FindCharacter( const char8* string, int length, char8 character );
+	int FindString( const char8* string, int length, const char8* stringToFind, int findLength );
+	int FindWhitespace( const char8* string, int startIndex, int length );
+	int SkipWhitespace( const char8* string, int startIndex, int length );
+	int SkipWhitespaceReverse( const char8* string, int length );
+	void ToLower( char8* string, int length );
+	void ToUpper( char8* string, int length );
+
 	char8 ConvertToLowercase( char8 character );
 	char8 ConvertToUppercase( char8 character );
 	bool IsWhitespaceCharacter( char8 character );
 	bool IsNumericCharacter( char8 character );
 
+	// UTF-8, a malformed sequence is read as one TC_UNICODE_REPLACEMENT_CHARACTER. The transcoders copy runs of ASCII a
+	// block at a time with SSE2 or AVX2, and never write more units than the source has bytes going to UTF-16 or UTF-32.
+	int FindInvalidUTF8( const char8* string, int length );
+	int CountCodePoints( const char8* string, int length );
+	int DecodeUTF8( const char8* string, int length, char32& codePoint );
+	int EncodeUTF8( char32 codePoint, char8* buffer );
+	int UTF8ToUTF16( const char8* source, int length, char16* dest );
+	int UTF16ToUTF8( const char16* source, int length, char8* dest );
+	int UTF8ToUTF32( const char8* source, int length, char32* dest );
+	int UTF32ToUTF8( const char32* source, int length, char8* dest );
+
+	// Locale free number conversion, these write into and read from caller buffers and never allocate.
+	int FormatInt( int value, char8* buffer, int base = 10 );
+	int FormatFloat( float value, char8* buffer );
+	int FormatFloat( float value, int precision, char8* buffer );
+	int ParseInt( const char8* string, int length, int& value );
+	int ParseFloat( const char8* string, int length, float& value );
+	int ParseIntArray( const TCStringView& string, char8 delimiter, int* values, int maxValues );
+	int ParseFloatArray( const TCStringView& string, char8 delimiter, float* values, int maxValues );
+
 	TCString ItoA( int value, int base = 10 );
-	int AtoI( TCString& string );
+	int AtoI( const TCStringView& string );
 
-	TCString FtoA( float value, int precision = 5);
-	float AtoF( TCString& string );
+	TCString FtoA( float value, int precision = -1 );
+	float AtoF( const TCStringView& string );
 }
 
 #endif // __TCSTRING_UTILS_H__
\ No newline at end of file
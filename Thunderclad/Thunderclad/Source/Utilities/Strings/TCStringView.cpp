@@ -0,0 +1,210 @@
+//
+// TCStringView.cpp
+// This file will define the methods declared for a read-only string view.
+//
+
+//
+// Includes
+//
+
+#include "TCStringView.h"
+
+#include <string.h>
+
+//
+// Defines
+//
+
+//
+// Constructor
+//		- Will view a NULL terminated string.
+// Inputs:
+//		- const char8* string: The string to view, NULL is treated as empty.
+// Outputs:
+//		- None.
+//
+
+TCStringView::TCStringView( const char8* string )
+{
+	mData	= string != NULL ? string : EMPTY_STRING;
+	mLength	= string != NULL ? TCStringUtils::Length( string ) : 0;
+}
+
+//
+// Compare
+//		- Will compare the characters of two views.
+// Inputs:
+//		- const TCStringView& string: The view to compare with.
+// Outputs:
+//		- int:
+//			- 0 if the views are equal
+//			- <0 if this view is less than the input.
+//			- >0 if this view is greater than the input.
+//
+
+int TCStringView::Compare( const TCStringView& string ) const
+{
+	unsigned int commonLength = mLength < string.mLength ? mLength : string.mLength;
+	int result = commonLength > 0 ? memcmp( mData, string.mData, commonLength ) : 0;
+	if( result != 0 )
+	{
+		return result;
+	}
+
+	// A view that is a prefix of the other comes first.
+	return mLength < string.mLength ? -1 : ( mLength > string.mLength ? 1 : 0 );
+}
+
+//
+// Equal
+//		- Will determine if two views hold the same characters.
+// Inputs:
+//		- const TCStringView& string: The view to compare with.
+// Outputs:
+//		- bool: Are the views equal.
+//
+
+bool TCStringView::Equal( const TCStringView& string ) const
+{
+	return mLength == string.mLength && ( mLength == 0 || memcmp( mData, string.mData, mLength ) == 0 );
+}
+
+//
+// Find
+//		- Will find the first index of a character.
+// Inputs:
+//		- char8 character: The character to find.
+//		- unsigned int startIndex: The index to start searching from.
+// Outputs:
+//		- int: The index found at. -1 if not found.
+//
+
+int TCStringView::Find( char8 character, unsigned int startIndex ) const
+{
+	if( startIndex >= mLength )
+		return -1;
+
+	int index = TCStringUtils::FindCharacter( mData + startIndex, mLength - startIndex, character );
+	return index >= 0 ? index + startIndex : -1;
+}
+
+//
+// Find
+//		- Will find the first index of another string.
+// Inputs:
+//		- const TCStringView& string: The string to find.
+//		- unsigned int startIndex: The index to start searching from.
+// Outputs:
+//		- int: The index found at. -1 if not found.
+//
+
+int TCStringView::Find( const TCStringView& string, unsigned int startIndex ) const
+{
+	if( startIndex > mLength )
+		return -1;
+
+	int index = TCStringUtils::FindString( mData + startIndex, mLength - startIndex, string.mData, string.mLength );
+	return index >= 0 ? index + startIndex : -1;
+}
+
+//
+// FindLast
+//		- Will find the last index of a character.
+// Inputs:
+//		- char8 character: The character to find.
+// Outputs:
+//		- int: The index found at. -1 if not found.
+//
+
+int TCStringView::FindLast( char8 character ) const
+{
+	for( int currentChar = (int)mLength - 1; currentChar >= 0; --currentChar )
+	{
+		if( mData[ currentChar ] == character )
+		{
+			return currentChar;
+		}
+	}
+
+	return -1;
+}
+
+//
+// StartsWith
+//		- Will determine if the view starts with a prefix.
+// Inputs:
+//		- const TCStringView& string: The prefix to check for.
+// Outputs:
+//		- bool: Does the view start with the prefix.
+//
+
+bool TCStringView::StartsWith( const TCStringView& string ) const
+{
+	return string.mLength <= mLength && ( string.mLength == 0 || memcmp( mData, string.mData, string.mLength ) == 0 );
+}
+
+//
+// EndsWith
+//		- Will determine if the view ends with a suffix.
+// Inputs:
+//		- const TCStringView& string: The suffix to check for.
+// Outputs:
+//		- bool: Does the view end with the suffix.
+//
+
+bool TCStringView::EndsWith( const TCStringView& string ) const
+{
+	return string.mLength <= mLength && ( string.mLength == 0 || memcmp( mData + mLength - string.mLength, string.mData, string.mLength ) == 0 );
+}
+
+//
+// Substring
+//		- Will view the characters from an index to the end.
+// Inputs:
+//		- unsigned int startIndex: The index where the substring should start.
+// Outputs:
+//		- TCStringView: The substring, empty if the index is out of range.
+//
+
+TCStringView TCStringView::Substring( unsigned int startIndex ) const
+{
+	if( startIndex >= mLength )
+		return TCStringView();
+
+	return TCStringView( mData + startIndex, mLength - startIndex );
+}
+
+//
+// Substring
+//		- Will view the characters between two indices, matching TCString::Substring.
+// Inputs:
+//		- unsigned int startIndex: The index where the substring should start.
+//		- unsigned int endIndex: The index where the substring should end, this character is included.
+// Outputs:
+//		- TCStringView: The substring, empty if the indices are out of range.
+//
+
+TCStringView TCStringView::Substring( unsigned int startIndex, unsigned int endIndex ) const
+{
+	if( startIndex >= mLength || endIndex >= mLength || endIndex < startIndex )
+		return TCStringView();
+
+	return TCStringView( mData + startIndex, endIndex - startIndex + 1 );
+}
+
+//
+// TrimWhitespace
+//		- Will view the characters without any whitespace at either end.
+// Inputs:
+//		- None.
+// Outputs:
+//		- TCStringView: The trimmed view.
+//
+
+TCStringView TCStringView::TrimWhitespace() const
+{
+	int start = TCStringUtils::SkipWhitespace( mData, 0, mLength );
+	int end = start < (int)mLength ? TCStringUtils::SkipWhitespaceReverse( mData, mLength ) : start;
+
+	return TCStringView( mData + start, end - start );
+}
@@ -0,0 +1,98 @@
+//
+// TCStringView.h
+// This file will declare a read-only window onto characters owned by someone else.
+//
+
+#ifndef __TC_STRING_VIEW_H__
+#define __TC_STRING_VIEW_H__
+
+//
+// Includes
+//
+
+#include "TCPlatformPrecompilerSymbols.h"
+#include "TCStringUtils.h"
+#include "TCList.h"
+
+//
+// Defines
+//
+
+//
+// Class Declaration
+//		- A view is a pointer and a length, it never allocates or copies. The characters aren't required to be NULL
+//		  terminated, so Data() must not be handed to C APIs. The owner must outlive every view onto it.
+//
+
+class TCStringView
+{
+	public:		// Members
+	public:		// Methods
+									TCStringView()										{ mData = EMPTY_STRING; mLength = 0; }
+									TCStringView( const char8* string );
+									TCStringView( const char8* string, unsigned int length )	{ mData = string != NULL ? string : EMPTY_STRING; mLength = string != NULL ? length : 0; }
+
+		inline int					Length() const										{ return mLength; }
+		inline bool					IsEmpty() const										{ return mLength == 0; }
+		inline const char8*			Data() const										{ return mData; }
+		inline char8				operator[]( unsigned int index ) const				{ TC_ASSERT( index < mLength && "Accessing a string view out of bounds" ); return mData[ index ]; }
+
+		int							Compare( const TCStringView& string ) const;
+		bool						Equal( const TCStringView& string ) const;
+
+		int							Find( char8 character, unsigned int startIndex = 0 ) const;
+		int							Find( const TCStringView& string, unsigned int startIndex = 0 ) const;
+		int							FindLast( char8 character ) const;
+		bool						Contains( const TCStringView& string ) const		{ return Find( string ) >= 0; }
+
+		bool						StartsWith( const TCStringView& string ) const;
+		bool						EndsWith( const TCStringView& string ) const;
+
+		TCStringView				Substring( unsigned int startIndex ) const;
+		TCStringView				Substring( unsigned int startIndex, unsigned int endIndex ) const;
+		TCStringView				TrimWhitespace() const;
+
+		template< typename Allocator >
+		void						Split( char8 delimiter, TCList< TCStringView, Allocator >& subStrings ) const;
+
+		inline bool					operator==( const TCStringView& string ) const		{ return Equal( string ); }
+		inline bool					operator!=( const TCStringView& string ) const		{ return !Equal( string ); }
+
+	private:	// Members
+		const char8*				mData;
+		unsigned int				mLength;
+};
+
+//
+// Split
+//		- Will view the pieces separated by a delimiter, nothing is copied. An empty view has no pieces, otherwise
+//		  there is always one more piece than delimiters so empty pieces are kept.
+// Inputs:
+//		- char8 delimiter: The character that separates the pieces.
+//		- TCList< TCStringView, Allocator >& subStrings: The list the pieces are appended to, from any allocator.
+// Outputs:
+//		- None.
+//
+
+template< typename Allocator >
+void TCStringView::Split( char8 delimiter, TCList< TCStringView, Allocator >& subStrings ) const
+{
+	if( mLength == 0 )
+		return;
+
+	unsigned int currentSubStringStart = 0;
+	for( ;; )
+	{
+		int delimiterIndex = Find( delimiter, currentSubStringStart );
+		unsigned int currentSubStringEnd = delimiterIndex >= 0 ? (unsigned int)delimiterIndex : mLength;
+
+		subStrings.EmplaceBack( mData + currentSubStringStart, currentSubStringEnd - currentSubStringStart );
+
+		if( delimiterIndex < 0 )
+			break;
+
+		currentSubStringStart = currentSubStringEnd + 1;	// Skip the delimiter.
+	}
+}
+
+#endif // __TC_STRING_VIEW_H__